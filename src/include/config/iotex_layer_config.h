@@ -686,9 +686,41 @@
  *
  * Requires: IOTEX_HMAC_DRBG_C, IOTEX_ECDSA_C
  *
+ * With the TinyCrypt backend the nonce is derived with the TinyCrypt
+ * HMAC-DRBG, so only PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256) is
+ * supported, and signing no longer calls the RNG.
+ *
  * Comment this macro to disable deterministic ECDSA.
  */
-//#define IOTEX_ECDSA_DETERMINISTIC
+#define IOTEX_ECDSA_DETERMINISTIC
+
+/**
+ * \def IOTEX_PSA_ECC_PUBLIC_KEY_CACHE
+ *
+ * Keep the public point of each ECC key next to its key material in the key
+ * slot, in the native word form used by the TinyCrypt ECC code. The point is
+ * derived once when the key is imported, generated or loaded from storage,
+ * so that verifying a signature or exporting the public key does not redo a
+ * scalar multiplication or parse the key each time. Costs 64 Bytes of RAM
+ * per key slot.
+ *
+ * Comment this macro to derive the public point on every use instead.
+ */
+#define IOTEX_PSA_ECC_PUBLIC_KEY_CACHE
+
+/**
+ * \def IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE
+ *
+ * Number of ECC key pairs that iotex_psa_ecc_ephemeral_pool_fill() can
+ * generate ahead of time. psa_generate_key() takes a volatile secp256r1 or
+ * secp256k1 key pair from this pool when one is ready, so a handshake that
+ * creates an ephemeral key does not wait for the scalar multiplication.
+ * Costs about 100 Bytes of RAM per entry. Requires
+ * IOTEX_PSA_ECC_PUBLIC_KEY_CACHE.
+ *
+ * Set this macro to 0 to disable the pool.
+ */
+#define IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE 2
 
 /**
  * \def IOTEX_KEY_EXCHANGE_PSK_ENABLED
@@ -1855,6 +1887,10 @@
  * Requires: IOTEX_HAVE_ASM
  *
  * This modules adds support for the AES-NI instructions on x86-64
+ *
+ * With TinyCrypt the AES rounds stay in portable C; only the GCM GHASH
+ * multiplication uses PCLMULQDQ and SSSE3, and only when the CPU reports
+ * them at run time. Requires GCC or Clang.
  */
 //#define IOTEX_AESNI_C
 
@@ -2110,7 +2146,7 @@
  * This module enables the AES-CCM ciphersuites, if other requisites are
  * enabled as well.
  */
-//#define IOTEX_CCM_C
+#define IOTEX_CCM_C
 
 /**
  * \def IOTEX_CHACHA20_C
@@ -2118,8 +2154,12 @@
  * Enable the ChaCha20 stream cipher.
  *
  * Module:  library/chacha20.c
+ *
+ * The block function works on 32-bit words. With IOTEX_HAVE_ASM on x86-64
+ * GCC/Clang builds, runs of four blocks use SSE2 and runs of eight use AVX2
+ * when the CPU reports it at run time.
  */
-//#define IOTEX_CHACHA20_C
+#define IOTEX_CHACHA20_C
 
 /**
  * \def IOTEX_CHACHAPOLY_C
@@ -2130,7 +2170,7 @@
  *
  * This module requires: IOTEX_CHACHA20_C, IOTEX_POLY1305_C
  */
-//#define IOTEX_CHACHAPOLY_C
+#define IOTEX_CHACHAPOLY_C
 
 /**
  * \def IOTEX_CIPHER_C
@@ -2352,7 +2392,7 @@
  * This module enables the AES-GCM and CAMELLIA-GCM ciphersuites, if other
  * requisites are enabled as well.
  */
-//#define IOTEX_GCM_C
+#define IOTEX_GCM_C
 
 /**
  * \def IOTEX_HKDF_C
@@ -2695,11 +2735,11 @@
  *
  * Enable the Platform Security Architecture persistent key storage.
  *
- * Module:  library/psa_crypto_storage.c
+ * Module:  src/psa_layer/psa_crypto_storage.c
  *
  * Requires: IOTEX_PSA_CRYPTO_C,
- *           either IOTEX_PSA_ITS_FILE_C or a native implementation of
- *           the PSA ITS interface
+ *           either IOTEX_PSA_ITS_FILE_C, IOTEX_PSA_ITS_FLASH_C or a native
+ *           implementation of the PSA ITS interface
  */
 //#define IOTEX_PSA_CRYPTO_STORAGE_C
 
@@ -2709,12 +2749,39 @@
  * Enable the emulation of the Platform Security Architecture
  * Internal Trusted Storage (PSA ITS) over files.
  *
- * Module:  library/psa_its_file.c
+ * Each entry is a file, written next to the previous version and renamed
+ * over it once synced to disk. See iotex_psa_its_file_begin_batch() to
+ * coalesce the syncs of many writes.
+ *
+ * Module:  src/psa_layer/psa_its_file.c
  *
  * Requires: IOTEX_FS_IO
  */
 //#define IOTEX_PSA_ITS_FILE_C
 
+/**
+ * \def IOTEX_PSA_ITS_FLASH_C
+ *
+ * Enable the Platform Security Architecture Internal Trusted Storage
+ * (PSA ITS) over a log-structured store in flash, for devices that keep
+ * their keys in NOR flash.
+ *
+ * Writes append records to the log instead of erasing a sector, and a
+ * RAM index of the entries is rebuilt at mount. Sectors are compacted
+ * oldest first, which spreads the erases over the whole device. The
+ * application passes its flash driver to iotex_psa_its_flash_mount().
+ * With IOTEX_FS_IO, iotex_psa_flash_sim_open() provides a simulated flash
+ * device over a file.
+ *
+ * If IOTEX_PSA_ITS_FILE_C is enabled too, it provides the PSA ITS
+ * interface, and the store is only reachable through its iotex_psa_its_flash_*
+ * functions.
+ *
+ * Module:  src/psa_layer/psa_its_flash.c
+ *          src/psa_layer/psa_its_flash_sim.c
+ */
+//#define IOTEX_PSA_ITS_FLASH_C
+
 /**
  * \def IOTEX_RIPEMD160_C
  *
@@ -3399,6 +3466,105 @@
  */
 //#define IOTEX_PSA_KEY_SLOT_COUNT 32
 
+/** \def IOTEX_PSA_KEY_SLOT_DYNAMIC
+ * Allocate the key slot table from the heap as keys are created instead of
+ * reserving IOTEX_PSA_KEY_SLOT_COUNT slots up front. The table grows in
+ * chunks, each twice the size of the previous one, until it holds
+ * IOTEX_PSA_KEY_SLOT_COUNT slots, which remains the limit. Key slots are
+ * only evicted once the table cannot grow any more. Everything is freed by
+ * iotex_psa_crypto_free().
+ *
+ * Use this on hosts that hold an unknown number of keys, with a large
+ * IOTEX_PSA_KEY_SLOT_COUNT.
+ */
+//#define IOTEX_PSA_KEY_SLOT_DYNAMIC
+
+/** \def IOTEX_PSA_KEY_SLOT_CHUNK
+ * Number of slots in the first chunk of the key slot table when
+ * IOTEX_PSA_KEY_SLOT_DYNAMIC is set.
+ *
+ * If this option is unset, the first chunk holds 16 slots.
+ */
+//#define IOTEX_PSA_KEY_SLOT_CHUNK 16
+
+/** \def IOTEX_PSA_KEY_ARENA_SIZE
+ * Size in bytes of the arena that key material is carved from. Buffers of
+ * up to 512 bytes are rounded up to a size class and recycled within their
+ * class, which avoids a heap allocation per key. Larger buffers, and any
+ * buffer that does not fit once the arena is used up, come from the heap.
+ *
+ * Without IOTEX_PSA_KEY_SLOT_DYNAMIC the arena is a static buffer, by
+ * default 48 bytes per key slot. With it the arena is made of pages of this
+ * size allocated as needed, 4096 bytes by default. Set it to 0 to allocate
+ * all key material from the heap.
+ */
+//#define IOTEX_PSA_KEY_ARENA_SIZE 4096
+
+/** \def IOTEX_PSA_ITS_FILE_LOCATION
+ * Directory of the files of the ITS emulation, see IOTEX_PSA_ITS_FILE_C.
+ * iotex_psa_its_file_set_location() changes it at run time.
+ *
+ * If this option is unset, the files go to the current directory.
+ */
+//#define IOTEX_PSA_ITS_FILE_LOCATION "/var/lib/psa"
+
+/** \def IOTEX_PSA_ITS_FILE_BATCH_SIZE
+ * Number of ITS writes a batch holds before it is flushed on its own, see
+ * iotex_psa_its_file_begin_batch().
+ *
+ * If this option is unset, a batch holds up to 32 writes.
+ */
+//#define IOTEX_PSA_ITS_FILE_BATCH_SIZE 32
+
+/** \def IOTEX_PSA_ITS_FLASH_MAX_SECTORS
+ * Largest number of sectors the flash store of IOTEX_PSA_ITS_FLASH_C can
+ * mount. It sizes two 32-bit counters per sector in RAM.
+ *
+ * If this option is unset, the store handles up to 16 sectors.
+ */
+//#define IOTEX_PSA_ITS_FLASH_MAX_SECTORS 16
+
+/** \def IOTEX_PSA_ITS_FLASH_MAX_ENTRIES
+ * Number of entries, and so of persistent keys, the flash store of
+ * IOTEX_PSA_ITS_FLASH_C can hold. Each takes 24 bytes of RAM in the index.
+ *
+ * If this option is unset, the store holds up to 32 entries.
+ */
+//#define IOTEX_PSA_ITS_FLASH_MAX_ENTRIES 32
+
+/** \def IOTEX_AES_KEY_CACHE_SIZE
+ * Number of expanded AES key schedules kept by the TinyCrypt AES port, so
+ * that setting up an operation with a recently used key skips key expansion.
+ * Entries are recycled least recently used first and wiped when their key is
+ * destroyed. Set to 0 to disable the cache.
+ *
+ * If this option is unset, the library will fall back to a default value of
+ * 4 schedules.
+ */
+//#define IOTEX_AES_KEY_CACHE_SIZE 4
+
+/** \def IOTEX_PSA_MAC_KEY_CACHE_SIZE
+ * Number of keys whose MAC key setup is kept: the HMAC inner and outer pad
+ * hash states, or the AES key schedule and CMAC subkeys. A MAC with a key
+ * slot used recently then skips that work. Only keys held in a key slot are
+ * cached, and their entry is wiped when the key is removed from memory. Set
+ * to 0 to disable the cache.
+ *
+ * If this option is unset, the library will fall back to a default value of
+ * 4 keys.
+ */
+//#define IOTEX_PSA_MAC_KEY_CACHE_SIZE 4
+
+/** \def IOTEX_GCM_GHASH_TABLE_BITS
+ * Width in bits of the GHASH multiplication table precomputed for each GCM
+ * key. 4 keeps 256 Bytes per GCM context and folds the hash in two table
+ * lookups per byte; 8 keeps 4 KiB per context and needs one lookup per byte.
+ *
+ * If this option is unset, the library will fall back to a default value of
+ * 4 bits.
+ */
+//#define IOTEX_GCM_GHASH_TABLE_BITS 4
+
 /* SSL Cache options */
 //#define IOTEX_SSL_CACHE_DEFAULT_TIMEOUT       86400 /**< 1 day  */
 //#define IOTEX_SSL_CACHE_DEFAULT_MAX_ENTRIES      50 /**< Maximum entries in cache */
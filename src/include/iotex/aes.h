@@ -21,6 +21,11 @@
 /** Invalid input data. */
 #define IOTEX_ERR_AES_BAD_INPUT_DATA -0x0021
 
+/* See iotex_layer_config.h for definition */
+#if !defined(IOTEX_AES_KEY_CACHE_SIZE)
+	#define IOTEX_AES_KEY_CACHE_SIZE 4
+#endif
+
 #if(defined(__ARMCC_VERSION) || defined(_MSC_VER)) && !defined(inline) && !defined(__cplusplus)
 	#define inline __inline
 #endif
@@ -36,6 +41,11 @@ extern "C"
 
 	/**
 	 * \brief The AES context-type definition.
+	 *
+	 * \note  With the TinyCrypt backend, \c rk points into \c buf, which
+	 *        holds the expanded key schedule of this context. Every context
+	 *        owns its schedule, so independent operations never share
+	 *        round keys.
 	 */
 	typedef struct iotex_aes_context
 	{
@@ -87,6 +97,22 @@ extern "C"
 	 */
 	void iotex_aes_free(iotex_aes_context* ctx);
 
+	/**
+	 * \brief          This function drops any cached key schedule derived
+	 *                 from \p key.
+	 *
+	 *                 The key schedule cache lets repeated setkey calls with
+	 *                 the same key skip key expansion. It must be purged when
+	 *                 the key material is destroyed, so that no expanded copy
+	 *                 of the key outlives it.
+	 *
+	 * \param key      The key whose schedule should be dropped, or \c NULL
+	 *                 to wipe the whole cache.
+	 * \param keybits  The size of \p key in bits. Ignored if \p key is
+	 *                 \c NULL.
+	 */
+	void iotex_aes_key_cache_purge(const unsigned char* key, unsigned int keybits);
+
 #if defined(IOTEX_CIPHER_MODE_XTS)
 	/**
 	 * \brief          This function initializes the specified AES XTS context.
@@ -5,6 +5,10 @@
 
 #include "include/iotex/cipher.h"
 
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#include "include/iotex/aes.h"
+#endif
+
 #define IOTEX_CCM_DECRYPT 0
 #define IOTEX_CCM_ENCRYPT 1
 #define IOTEX_CCM_STAR_DECRYPT 2
@@ -32,7 +36,11 @@ extern "C"
 	{
 		unsigned char y[16];			   /*!< The Y working buffer */
 		unsigned char ctr[16];			   /*!< The counter buffer */
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) != (CRYPTO_USE_TINYCRYPO))
 		iotex_cipher_context_t cipher_ctx; /*!< The cipher context used. */
+	#else
+		iotex_aes_context aes; /*!< The AES context used for CBC-MAC and CTR. */
+	#endif
 		size_t plaintext_len;			   /*!< Total plaintext length */
 		size_t add_len;					   /*!< Total authentication data length */
 		size_t tag_len;					   /*!< Total tag length */
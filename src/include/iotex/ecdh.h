@@ -394,6 +394,40 @@ extern "C"
 							   size_t blen, int (*f_rng)(void*, unsigned char*, size_t),
 							   void* p_rng);
 
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	/**
+	 * \brief           This function computes the raw ECDH shared secret of a
+	 *                  private key and a peer public key with TinyCrypt.
+	 *
+	 *                  The shared secret is the X coordinate of the product of
+	 *                  the private value and the peer point, in big-endian
+	 *                  order, as psa_raw_key_agreement() returns it.
+	 *
+	 * \param family    The curve family: #PSA_ECC_FAMILY_SECP_R1 or
+	 *                  #PSA_ECC_FAMILY_SECP_K1, 256 bits.
+	 * \param key_buffer The private value, \c NUM_ECC_BYTES Bytes.
+	 * \param key_buffer_size The length of \p key_buffer in Bytes.
+	 * \param peer_key  The peer public key in the uncompressed
+	 *                  0x04 || X || Y representation.
+	 * \param peer_key_length The length of \p peer_key in Bytes.
+	 * \param shared_secret The buffer to write the shared secret to.
+	 * \param shared_secret_size The length of \p shared_secret in Bytes.
+	 * \param shared_secret_length The number of Bytes written on success.
+	 *
+	 * \return          #PSA_SUCCESS on success.
+	 * \return          #PSA_ERROR_NOT_SUPPORTED if the curve is not one of
+	 *                  the TinyCrypt curves.
+	 * \return          #PSA_ERROR_INVALID_ARGUMENT if the peer key is not
+	 *                  a point of the curve in the expected representation.
+	 * \return          #PSA_ERROR_BUFFER_TOO_SMALL if \p shared_secret is
+	 *                  too small.
+	 */
+int iotex_ecdh_compute_shared_raw(psa_ecc_family_t family, const uint8_t* key_buffer,
+								  size_t key_buffer_size, const uint8_t* peer_key,
+								  size_t peer_key_length, uint8_t* shared_secret,
+								  size_t shared_secret_size, size_t* shared_secret_length);
+#endif
+
 #if defined(IOTEX_ECP_RESTARTABLE)
 	/**
 	 * \brief           This function enables restartable EC computations for this
@@ -187,11 +187,17 @@ int iotex_ecdsa_sign(psa_key_type_t type, const uint8_t* key_buffer, size_t key_
 	 * \return          An \c IOTEX_ERR_ECP_XXX or \c IOTEX_MPI_XXX
 	 *                  error code on failure.
 	 */
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS))
 	int iotex_ecdsa_sign_det_ext(iotex_ecp_group* grp, iotex_mpi* r, iotex_mpi* s,
 								 const iotex_mpi* d, const unsigned char* buf, size_t blen,
 								 iotex_md_type_t md_alg,
 								 int (*f_rng_blind)(void*, unsigned char*, size_t),
 								 void* p_rng_blind);
+	#else
+int iotex_ecdsa_sign_det(psa_key_type_t type, const uint8_t* key_buffer, size_t key_buffer_size,
+						 const uint8_t* hash, size_t hash_length, uint8_t* signature,
+						 size_t* signature_length);
+	#endif
 #endif /* IOTEX_ECDSA_DETERMINISTIC */
 
 	/**
@@ -5,6 +5,10 @@
 
 #include "include/iotex/cipher.h"
 
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#include "include/iotex/aes.h"
+#endif
+
 #include <stdint.h>
 
 #define IOTEX_GCM_ENCRYPT 1
@@ -17,6 +21,15 @@
 /** An output buffer is too small. */
 #define IOTEX_ERR_GCM_BUFFER_TOO_SMALL -0x0016
 
+/* See iotex_layer_config.h for definition */
+#if !defined(IOTEX_GCM_GHASH_TABLE_BITS)
+	#define IOTEX_GCM_GHASH_TABLE_BITS 4
+#endif
+
+#if(IOTEX_GCM_GHASH_TABLE_BITS != 4) && (IOTEX_GCM_GHASH_TABLE_BITS != 8)
+	#error "IOTEX_GCM_GHASH_TABLE_BITS must be 4 or 8"
+#endif
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -29,9 +42,15 @@ extern "C"
 	 */
 	typedef struct iotex_gcm_context
 	{
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) != (CRYPTO_USE_TINYCRYPO))
 		iotex_cipher_context_t cipher_ctx; /*!< The cipher context used. */
 		uint64_t HL[16];				   /*!< Precalculated HTable low. */
 		uint64_t HH[16];				   /*!< Precalculated HTable high. */
+	#else
+		iotex_aes_context aes; /*!< The AES context used for GCTR and H. */
+		uint64_t HL[1 << IOTEX_GCM_GHASH_TABLE_BITS]; /*!< Precalculated HTable low. */
+		uint64_t HH[1 << IOTEX_GCM_GHASH_TABLE_BITS]; /*!< Precalculated HTable high. */
+	#endif
 		uint64_t len;					   /*!< The total length of the encrypted data. */
 		uint64_t add_len;				   /*!< The total length of the additional data. */
 		unsigned char base_ectr[16];	   /*!< The first ECTR for tag. */
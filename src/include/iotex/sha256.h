@@ -6,6 +6,10 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#include "../tinycrypt/sha256.h"
+#endif
+
 /** SHA-256 input data was malformed. */
 #define IOTEX_ERR_SHA256_BAD_INPUT_DATA -0x0074
 
@@ -34,7 +38,7 @@ extern "C"
 		int is224;				  /*!< Determines which function to use:
 									   0: Use SHA-256, or 1: Use SHA-224. */
 	#else
-		void* sha256_ctx;
+		struct tc_sha256_state_struct sha256_ctx; /*!< Embedded so that hashing never allocates. */
 	#endif
 	} iotex_sha256_context;
 
@@ -8,6 +8,7 @@
 #include "psa_crypto_ecp.h"
 #include "psa_crypto_hash.h"
 #include "psa_crypto_invasive.h"
+#include "psa_crypto_key_arena.h"
 #include "psa_crypto_its.h"
 #include "psa_crypto_mac.h"
 #include "psa_crypto_rsa.h"
@@ -5,6 +5,26 @@
 
 #include "include/svc/crypto.h"
 
+#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE) &&                                                     \
+	(defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_KEY_PAIR) ||                                           \
+	 defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_PUBLIC_KEY)) &&                                        \
+	((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#define IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED
+
+	#include "include/tinycrypt/ecc.h"
+#endif
+
+#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED) &&                                             \
+	defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_KEY_PAIR) &&                                            \
+	defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE) && (IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE) > 0
+	#define IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED
+#endif
+
+#if(defined(IOTEX_PSA_BUILTIN_ALG_ECDSA) || defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA)) && \
+	((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#define IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED
+#endif
+
 /** Constant-time buffer comparison
  *
  * \param[in]  a    Left-hand buffer for comparison.
@@ -63,6 +83,18 @@ typedef struct
 		uint8_t* data;
 		size_t bytes;
 	} key;
+
+#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	/* Public point of an ECC key held in local storage, X then Y in TinyCrypt
+	 * native word order. Filled in when the key material enters the slot and
+	 * never changed afterwards, so readers holding a lock can use it without
+	 * further synchronization. Only meaningful if `valid` is nonzero. */
+	struct ecc_public_point
+	{
+		uECC_word_t point[2 * NUM_ECC_WORDS];
+		uint8_t valid;
+	} ecc_public;
+#endif
 } psa_key_slot_t;
 
 /* A mask of key attribute flags used only internally.
@@ -3,6 +3,7 @@
 
 #include "include/iotex/ecp.h"
 #include "include/svc/crypto.h"
+#include "include/svc/crypto/psa_crypto_core.h"
 
 /** Load the contents of a key buffer into an internal ECP representation
  *
@@ -190,4 +191,167 @@ psa_status_t iotex_psa_ecdsa_verify_hash(const psa_key_attributes_t* attributes,
 										 psa_algorithm_t alg, const uint8_t* hash,
 										 size_t hash_length, const uint8_t* signature,
 										 size_t signature_length);
+
+#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+/** Derive the public point of the ECC key held in a slot and keep it there.
+ *
+ * Call this once the key material is in the slot and before the slot is
+ * shared, i.e. while creating or loading the key. For a key pair the point
+ * is computed from the private value; for a public key it is parsed from
+ * the uncompressed export representation. Keys that the TinyCrypt ECC code
+ * does not handle, and keys outside local storage, are left without a
+ * cached point, which is not an error.
+ *
+ * \param[in,out] slot     The key slot holding the key material.
+ *
+ * \retval #PSA_SUCCESS
+ *         The point is cached, or the key is not cacheable.
+ * \retval #PSA_ERROR_INVALID_ARGUMENT
+ *         The private value is out of range or the public point is not on
+ *         the curve.
+ */
+psa_status_t iotex_psa_ecp_cache_public_point(psa_key_slot_t* slot);
+
+/** Export the cached public point of a slot in uncompressed format.
+ *
+ * \param[in]  slot         A key slot whose public point is cached.
+ * \param[out] data         Buffer where the key data is to be written.
+ * \param[in]  data_size    Size of the \p data buffer in bytes.
+ * \param[out] data_length  On success, the number of bytes written in
+ *                          \p data.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ */
+psa_status_t iotex_psa_ecp_export_public_point(const psa_key_slot_t* slot, uint8_t* data,
+											   size_t data_size, size_t* data_length);
+
+/** Verify an ECDSA hash signature with the cached public point of a slot.
+ *
+ * \param[in]  slot             A key slot whose public point is cached.
+ * \param[in]  hash             The hash whose signature is to be verified.
+ * \param[in]  hash_length      Size of the \p hash buffer in bytes.
+ * \param[in]  signature        Buffer containing the signature to verify.
+ * \param[in]  signature_length Size of the \p signature buffer in bytes.
+ *
+ * \retval #PSA_SUCCESS
+ *         The signature is valid.
+ * \retval #PSA_ERROR_INVALID_SIGNATURE
+ *         The signature is malformed or does not match.
+ */
+psa_status_t iotex_psa_ecdsa_verify_hash_with_point(const psa_key_slot_t* slot,
+													const uint8_t* hash, size_t hash_length,
+													const uint8_t* signature,
+													size_t signature_length);
+
+/** Verify ECDSA hash signatures with the cached public points of their slots.
+ *
+ * Signatures on the same curve share their modular inversions, see
+ * uECC_verify_batch_native().
+ *
+ * \param[in]  slots    For each item, a key slot whose public point is
+ *                      cached, or \c NULL to leave the item alone.
+ * \param[in]  items    The signatures to verify.
+ * \param count         The number of elements in \p slots and \p items.
+ * \param[out] results  For each item with a slot, #PSA_SUCCESS if the
+ *                      signature is valid and #PSA_ERROR_INVALID_SIGNATURE
+ *                      if not.
+ */
+void iotex_psa_ecdsa_verify_hash_batch_with_points(psa_key_slot_t* const* slots,
+												   const iotex_psa_verify_hash_batch_item_t* items,
+												   size_t count, psa_status_t* results);
+#endif /* IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED */
+
+#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+/** Generate ECC key pairs ahead of time into the ephemeral key pool.
+ *
+ * \param family           The curve family, #PSA_ECC_FAMILY_SECP_R1 or
+ *                         #PSA_ECC_FAMILY_SECP_K1.
+ * \param count            The number of key pairs to add at most. Fewer are
+ *                         added once the pool is full.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ *         \p family is not a TinyCrypt curve.
+ * \retval #PSA_ERROR_INSUFFICIENT_ENTROPY
+ */
+psa_status_t iotex_psa_ecp_ephemeral_pool_fill(psa_ecc_family_t family, size_t count);
+
+/** The number of pooled key pairs on a curve. */
+size_t iotex_psa_ecp_ephemeral_pool_count(psa_ecc_family_t family);
+
+/** Move a pooled key pair into a slot being created.
+ *
+ * On success the slot holds the private value and its cached public point,
+ * and the pool entry is wiped.
+ *
+ * \param[in,out] slot     A slot for a 256-bit ECC key pair in local
+ *                         storage, with a key buffer of \c NUM_ECC_BYTES.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_DOES_NOT_EXIST
+ *         The slot is not for such a key, or no key pair of its curve is
+ *         pooled.
+ */
+psa_status_t iotex_psa_ecp_ephemeral_pool_take(psa_key_slot_t* slot);
+
+/** Wipe every pooled key pair. */
+void iotex_psa_ecp_ephemeral_pool_wipe(void);
+#endif /* IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED */
+
+#if defined(IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED)
+/** Sign an already-calculated hash with ECDSA and append the recovery id.
+ *
+ * \param[in]  attributes       The attributes of the ECC key pair.
+ * \param[in]  key_buffer       The private value of the key pair.
+ * \param[in]  key_buffer_size  Size of the \p key_buffer buffer in bytes.
+ * \param[in]  alg              Randomized or deterministic ECDSA algorithm.
+ * \param[in]  hash             The hash to sign.
+ * \param[in]  hash_length      Size of the \p hash buffer in bytes.
+ * \param[out] signature        Buffer where r, s and the recovery id are
+ *                              to be written.
+ * \param[in]  signature_size   Size of the \p signature buffer in bytes.
+ * \param[out] signature_length On success, the number of bytes written in
+ *                              \p signature.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ *         The key is not a TinyCrypt curve or \p alg is not supported.
+ * \retval #PSA_ERROR_INVALID_ARGUMENT
+ * \retval #PSA_ERROR_GENERIC_ERROR
+ */
+psa_status_t iotex_psa_ecdsa_sign_hash_recoverable(const psa_key_attributes_t* attributes,
+												   const uint8_t* key_buffer,
+												   size_t key_buffer_size, psa_algorithm_t alg,
+												   const uint8_t* hash, size_t hash_length,
+												   uint8_t* signature, size_t signature_size,
+												   size_t* signature_length);
+
+/** Recover the public key of a recoverable ECDSA hash signature.
+ *
+ * \param family                The curve family of the signing key.
+ * \param[in]  hash             The hash that was signed.
+ * \param[in]  hash_length      Size of the \p hash buffer in bytes.
+ * \param[in]  signature        r, s and the recovery id.
+ * \param[in]  signature_length Size of the \p signature buffer in bytes.
+ * \param[out] data             Buffer where the public key is to be written
+ *                              in uncompressed format.
+ * \param[in]  data_size        Size of the \p data buffer in bytes.
+ * \param[out] data_length      On success, the number of bytes written in
+ *                              \p data.
+ *
+ * \retval #PSA_SUCCESS
+ * \retval #PSA_ERROR_INVALID_SIGNATURE
+ *         No public key can have made the signature.
+ * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+ * \retval #PSA_ERROR_NOT_SUPPORTED
+ *         \p family is not a TinyCrypt curve.
+ */
+psa_status_t iotex_psa_ecdsa_recover_public_key(psa_ecc_family_t family, const uint8_t* hash,
+												size_t hash_length, const uint8_t* signature,
+												size_t signature_length, uint8_t* data,
+												size_t data_size, size_t* data_length);
+#endif /* IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED */
+
 #endif /* PSA_CRYPTO_ECP_H */
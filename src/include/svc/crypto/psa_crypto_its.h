@@ -133,6 +133,30 @@ extern "C"
 	 */
 	psa_status_t psa_its_remove(psa_storage_uid_t uid);
 
+#if defined(IOTEX_PSA_ITS_FLASH_C)
+	/**
+	 * \brief The PSA ITS functions, run on the log-structured store.
+	 *
+	 * They behave like psa_its_set(), psa_its_get(), psa_its_get_info() and
+	 * psa_its_remove(). While no device is mounted the store is empty, and
+	 * iotex_psa_its_flash_set() returns #PSA_ERROR_BAD_STATE. It returns
+	 * #PSA_ERROR_INSUFFICIENT_STORAGE, leaving the store unchanged, unless
+	 * the new record is sure to fit once the store is compacted, with room
+	 * left to remove an entry. Records do not cross sector boundaries, so
+	 * the end of a sector may stay unused; entries of nearly a sector each
+	 * take a sector of their own.
+	 */
+	psa_status_t iotex_psa_its_flash_set(psa_storage_uid_t uid, uint32_t data_length,
+										 const void* p_data,
+										 psa_storage_create_flags_t create_flags);
+	psa_status_t iotex_psa_its_flash_get(psa_storage_uid_t uid, uint32_t data_offset,
+										 uint32_t data_length, void* p_data,
+										 size_t* p_data_length);
+	psa_status_t iotex_psa_its_flash_get_info(psa_storage_uid_t uid,
+											  struct psa_storage_info_t* p_info);
+	psa_status_t iotex_psa_its_flash_remove(psa_storage_uid_t uid);
+#endif /* IOTEX_PSA_ITS_FLASH_C */
+
 #ifdef __cplusplus
 }
 #endif
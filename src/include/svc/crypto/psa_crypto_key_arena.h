@@ -0,0 +1,58 @@
+#ifndef PSA_CRYPTO_KEY_ARENA_H
+#define PSA_CRYPTO_KEY_ARENA_H
+
+#include "include/svc/crypto.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* See iotex_layer_config.h for definition */
+#if !defined(IOTEX_PSA_KEY_ARENA_SIZE)
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+		#define IOTEX_PSA_KEY_ARENA_SIZE 4096
+	#else
+		#define IOTEX_PSA_KEY_ARENA_SIZE (48 * IOTEX_PSA_KEY_SLOT_COUNT)
+	#endif
+#endif
+
+/** Allocate a zeroed buffer for key material.
+ *
+ * Buffers of up to 512 bytes come from size classes carved out of the key
+ * arena, so creating and destroying keys does not fragment the heap. Larger
+ * buffers, and all buffers once a static arena is full, come from
+ * iotex_calloc().
+ *
+ * \param size  Size of the buffer in bytes.
+ *
+ * \return The buffer, or NULL if there is not enough memory.
+ */
+uint8_t* iotex_psa_key_arena_alloc(size_t size);
+
+/** Wipe and free a buffer from iotex_psa_key_arena_alloc().
+ *
+ * The whole block is zeroized, including any bytes of its size class past
+ * the size that was asked for.
+ *
+ * \param[in] data  The buffer, or NULL.
+ */
+void iotex_psa_key_arena_free(uint8_t* data);
+
+/** Return the memory of the key arena.
+ *
+ * Only call this when no key buffer is allocated, that is after all key
+ * slots have been wiped.
+ */
+void iotex_psa_key_arena_release(void);
+
+/** Memory held for key material.
+ *
+ * \param[out] reserved_bytes   Bytes of arena, static or allocated pages.
+ * \param[out] used_bytes       Bytes of arena in allocated key buffers,
+ *                              counting whole size classes.
+ * \param[out] heap_bytes       Bytes of key buffers allocated outside the
+ *                              arena.
+ */
+void iotex_psa_key_arena_get_stats(size_t* reserved_bytes, size_t* used_bytes,
+								   size_t* heap_bytes);
+
+#endif /* PSA_CRYPTO_KEY_ARENA_H */
@@ -3,6 +3,11 @@
 
 #include "include/svc/crypto.h"
 
+/* See iotex_layer_config.h for definition */
+#if !defined(IOTEX_PSA_MAC_KEY_CACHE_SIZE)
+	#define IOTEX_PSA_MAC_KEY_CACHE_SIZE 4
+#endif
+
 /** Calculate the MAC (message authentication code) of a message using Mbed TLS.
  *
  * \note The signature of this function is that of a PSA driver mac_compute
@@ -235,4 +240,17 @@ psa_status_t iotex_psa_mac_verify_finish(iotex_psa_mac_operation_t* operation, c
  */
 psa_status_t iotex_psa_mac_abort(iotex_psa_mac_operation_t* operation);
 
+/** Forget the precomputed MAC state of a key.
+ *
+ * MAC operations set up with a key that lives in a key slot keep what they
+ * derive from the key alone: the hash states after the HMAC inner and outer
+ * pads, or the AES key schedule and the CMAC subkeys. Later operations with
+ * the same key start from there. This function wipes that state; it must be
+ * called before the key material of the slot is released.
+ *
+ * \param key                   The identifier of the key. Keys with nothing
+ *                              cached are ignored.
+ */
+void iotex_psa_mac_key_cache_purge(psa_key_id_t key);
+
 #endif /* PSA_CRYPTO_MAC_H */
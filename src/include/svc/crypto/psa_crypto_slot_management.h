@@ -5,6 +5,11 @@
 #include "include/svc/crypto/psa_crypto_core.h"
 #include "include/svc/crypto/psa_crypto_se.h"
 
+/* See iotex_layer_config.h for definition */
+#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC) && !defined(IOTEX_PSA_KEY_SLOT_CHUNK)
+	#define IOTEX_PSA_KEY_SLOT_CHUNK 16
+#endif
+
 /** Range of volatile key identifiers.
  *
  *  The last #IOTEX_PSA_KEY_SLOT_COUNT identifiers of the implementation
@@ -72,6 +77,72 @@ static inline int psa_key_id_is_volatile(psa_key_id_t key_id)
  */
 psa_status_t psa_get_and_lock_key_slot(psa_key_id_t key, psa_key_slot_t** p_slot);
 
+/** An entry of the key identifier index. A \c key_id of 0 marks a free
+ * bucket, 0 is never a valid key identifier. */
+typedef struct
+{
+	psa_key_id_t key_id;
+	uint16_t slot_number;
+} psa_key_slot_index_entry_t;
+
+/** Open-addressing hash table from key identifiers to slot numbers.
+ *
+ * The table has \c mask + 1 entries, a power of two, and uses linear
+ * probing with backward-shift deletion. The same key identifier may be
+ * present several times, for different slots.
+ */
+typedef struct
+{
+	psa_key_slot_index_entry_t* entries;
+	size_t mask;
+} psa_key_slot_index_t;
+
+/** The value psa_key_slot_index_find() returns for a missing identifier. */
+#define PSA_KEY_SLOT_INDEX_NOT_FOUND ((size_t)-1)
+
+/** Empty a key identifier index. */
+void psa_key_slot_index_clear(const psa_key_slot_index_t* index);
+
+/** Add \p key_id in slot \p slot_number to a key identifier index.
+ *
+ * The index must have a free entry left. The key slot tables keep it at
+ * most half full.
+ */
+void psa_key_slot_index_insert(const psa_key_slot_index_t* index, psa_key_id_t key_id,
+							   size_t slot_number);
+
+/** Look up a key identifier in a key identifier index.
+ *
+ * \return The slot number of \p key_id, or #PSA_KEY_SLOT_INDEX_NOT_FOUND.
+ */
+size_t psa_key_slot_index_find(const psa_key_slot_index_t* index, psa_key_id_t key_id);
+
+/** Remove \p key_id in slot \p slot_number from a key identifier index,
+ * if it is there. */
+void psa_key_slot_index_remove(const psa_key_slot_index_t* index, psa_key_id_t key_id,
+							   size_t slot_number);
+
+/** Add a key slot to the key identifier index.
+ *
+ * Call this once \c slot->attr.id holds the identifier of a persistent
+ * key, so that psa_get_and_lock_key_slot() finds the slot without scanning
+ * the key slots. Volatile key identifiers are not indexed, they encode
+ * their slot number.
+ *
+ * \param[in] slot  The key slot.
+ */
+void psa_index_key_slot(psa_key_slot_t* slot);
+
+/** Return a key slot to the empty key slots.
+ *
+ * psa_wipe_key_slot() calls this before it clears \p slot: the key
+ * identifier of \p slot leaves the index and \p slot goes on the free
+ * list that psa_get_empty_key_slot() takes from.
+ *
+ * \param[in] slot  The key slot.
+ */
+void psa_release_key_slot(psa_key_slot_t* slot);
+
 /** Initialize the key slot structures.
  *
  * \retval #PSA_SUCCESS
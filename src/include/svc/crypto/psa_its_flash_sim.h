@@ -0,0 +1,72 @@
+#ifndef PSA_ITS_FLASH_SIM_H
+#define PSA_ITS_FLASH_SIM_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "include/svc/crypto.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#if defined(IOTEX_PSA_ITS_FLASH_C) && defined(IOTEX_FS_IO)
+	/**
+	 * \brief A simulated flash device: a file holding the sectors.
+	 *
+	 * It enforces the NOR flash rules of #iotex_psa_flash_t, failing a
+	 * program that is not word aligned or that hits a word not erased or
+	 * already programmed since the last erase of its sector, and adds up
+	 * the time the operations would keep a real device busy.
+	 *
+	 * Words programmed to 0xFFFFFFFF are only known to be programmed until
+	 * the device is closed; the file cannot tell them from erased ones.
+	 */
+	typedef struct
+	{
+		iotex_psa_flash_t flash; /**< The device to mount */
+		FILE* file;
+		uint32_t* programmed; /**< One bit per word */
+
+		/* Timing model, set by iotex_psa_flash_sim_open() to the figures
+		 * of a typical SPI NOR flash; change them to model another part. */
+		uint32_t erase_time_us;	  /**< Erasing a sector */
+		uint32_t program_time_ns; /**< Programming a byte */
+		uint32_t read_time_ns;	  /**< Reading a byte */
+
+		uint64_t busy_ns; /**< Simulated time spent by the device */
+		uint32_t erases;  /**< Sectors erased */
+		uint64_t bytes_programmed;
+		uint64_t bytes_read;
+	} iotex_psa_flash_sim_t;
+
+	/**
+	 * \brief Open a simulated flash device.
+	 *
+	 * \param[out] sim          The device. Its \c flash member is what
+	 *                          iotex_psa_its_flash_mount() takes; it points
+	 *                          back to \p sim, which must not move.
+	 * \param[in] path          The file holding the sectors. It is created
+	 *                          erased if it does not exist, and reopened
+	 *                          as it is otherwise.
+	 * \param sector_size       Bytes per sector, a multiple of 4.
+	 * \param sector_count      Number of sectors.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_INVALID_ARGUMENT
+	 * \retval #PSA_ERROR_INSUFFICIENT_MEMORY
+	 * \retval #PSA_ERROR_STORAGE_FAILURE
+	 */
+	psa_status_t iotex_psa_flash_sim_open(iotex_psa_flash_sim_t* sim, const char* path,
+										  uint32_t sector_size, uint32_t sector_count);
+
+	/** \brief Close a simulated flash device. The file is kept. */
+	void iotex_psa_flash_sim_close(iotex_psa_flash_sim_t* sim);
+#endif /* IOTEX_PSA_ITS_FLASH_C && IOTEX_FS_IO */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSA_ITS_FLASH_SIM_H */
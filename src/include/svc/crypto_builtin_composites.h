@@ -11,6 +11,24 @@
 #endif
 
 #if defined(IOTEX_PSA_BUILTIN_ALG_HMAC) || defined(PSA_CRYPTO_DRIVER_TEST)
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+		#include "../tinycrypt/sha256.h"
+
+typedef struct
+{
+	/** The HMAC algorithm in use */
+	psa_algorithm_t alg;
+	/** The inner hash, started with the key XOR ipad block. */
+	struct tc_sha256_state_struct inner;
+	/** The outer hash, started with the key XOR opad block. */
+	struct tc_sha256_state_struct outer;
+} iotex_psa_hmac_operation_t;
+
+		#define IOTEX_PSA_HMAC_OPERATION_INIT                                                      \
+			{                                                                                      \
+				0                                                                                  \
+			}
+	#else
 typedef struct
 {
 	/** The HMAC algorithm in use */
@@ -21,17 +39,31 @@ typedef struct
 	uint8_t opad[PSA_HMAC_MAX_HASH_BLOCK_SIZE];
 } iotex_psa_hmac_operation_t;
 
-	#define IOTEX_PSA_HMAC_OPERATION_INIT                                                          \
-		{                                                                                          \
-			0, PSA_HASH_OPERATION_INIT,                                                            \
+		#define IOTEX_PSA_HMAC_OPERATION_INIT                                                      \
 			{                                                                                      \
-				0                                                                                  \
-			}                                                                                      \
-		}
+				0, PSA_HASH_OPERATION_INIT,                                                        \
+				{                                                                                  \
+					0                                                                              \
+				}                                                                                  \
+			}
+	#endif
 #endif /* IOTEX_PSA_BUILTIN_ALG_HMAC */
 
 #include "../iotex/cmac.h"
 
+#if(defined(IOTEX_PSA_BUILTIN_ALG_CMAC) || defined(PSA_CRYPTO_DRIVER_TEST)) &&                     \
+	((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#include "../tinycrypt/cmac_mode.h"
+
+typedef struct
+{
+	/** The TinyCrypt CMAC state. Its schedule pointer refers to \c sched. */
+	struct tc_cmac_struct cmac;
+	/** The AES key schedule. */
+	struct tc_aes_key_sched_struct sched;
+} iotex_psa_cmac_operation_t;
+#endif /* IOTEX_PSA_BUILTIN_ALG_CMAC */
+
 typedef struct
 {
 	psa_algorithm_t alg;
@@ -42,7 +74,11 @@ typedef struct
 		iotex_psa_hmac_operation_t hmac;
 #endif /* IOTEX_PSA_BUILTIN_ALG_HMAC */
 #if defined(IOTEX_PSA_BUILTIN_ALG_CMAC) || defined(PSA_CRYPTO_DRIVER_TEST)
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+		iotex_psa_cmac_operation_t cmac;
+	#else
 		iotex_cipher_context_t cmac;
+	#endif
 #endif /* IOTEX_PSA_BUILTIN_ALG_CMAC */
 	} ctx;
 } iotex_psa_mac_operation_t;
@@ -213,6 +213,31 @@ extern "C"
 		psa_key_id_t max_open_internal_key_id;
 		/** Largest key id value among open keys in secure elements. */
 		psa_key_id_t max_open_external_key_id;
+		/** Number of persistent key lookups that found the key in a slot
+		 * since psa_crypto_init(). */
+		size_t cache_hits;
+		/** Number of persistent key lookups that had to load the key
+		 * from storage since psa_crypto_init(). */
+		size_t cache_misses;
+		/** Number of persistent keys dropped from their slot, least
+		 * recently used first, to make room for another key since
+		 * psa_crypto_init(). */
+		size_t cache_evictions;
+		/** Number of key slots in the slot table. This is
+		 * IOTEX_PSA_KEY_SLOT_COUNT unless IOTEX_PSA_KEY_SLOT_DYNAMIC is set,
+		 * in which case the table grows up to it as keys are created. */
+		size_t slot_capacity;
+		/** Bytes used by the slot table and the free list, LRU list and
+		 * key identifier index kept alongside it. */
+		size_t slot_table_bytes;
+		/** Bytes of the arena that key material is carved from. */
+		size_t key_arena_bytes;
+		/** Bytes of the arena in use by key material, counting each key
+		 * buffer at the size of its size class. */
+		size_t key_arena_used_bytes;
+		/** Bytes of key material allocated on the heap because it did not
+		 * fit a size class or the arena was full. */
+		size_t key_heap_bytes;
 	} iotex_psa_stats_t;
 
 	/** \brief Get statistics about
@@ -224,6 +249,179 @@ extern "C"
 	 */
 	void iotex_psa_get_stats(iotex_psa_stats_t* stats);
 
+	/** \brief One signature of an iotex_psa_verify_hash_batch() call. */
+	typedef struct iotex_psa_verify_hash_batch_item_s
+	{
+		/** Identifier of the key to use for the verification. */
+		psa_key_id_t key;
+		/** A signature algorithm that is compatible with the type of \c key. */
+		psa_algorithm_t alg;
+		/** The hash whose signature is to be verified. */
+		const uint8_t* hash;
+		/** Size of the \c hash buffer in bytes. */
+		size_t hash_length;
+		/** Buffer containing the signature to verify. */
+		const uint8_t* signature;
+		/** Size of the \c signature buffer in bytes. */
+		size_t signature_length;
+	} iotex_psa_verify_hash_batch_item_t;
+
+	/**
+	 * \brief Verify the signatures of many hashes.
+	 *
+	 * Each item is checked as by psa_verify_hash(), with its own key and
+	 * algorithm, and gets its own status. ECDSA signatures over secp256r1
+	 * and secp256k1 keys are verified together, sharing the modular
+	 * inversions of a verification between several items, which makes this
+	 * faster than calling psa_verify_hash() in a loop.
+	 *
+	 * \param[in] items        The signatures to verify.
+	 * \param count            The number of elements in \p items.
+	 * \param[out] results     On return, \c results[i] holds the status
+	 *                         psa_verify_hash() returns for \c items[i].
+	 *                         It must have room for \p count elements.
+	 *
+	 * \retval #PSA_SUCCESS
+	 *         Every signature is valid.
+	 * \retval #PSA_ERROR_INVALID_ARGUMENT
+	 *         \p items or \p results is \c NULL and \p count is not 0.
+	 *         \p results is not written.
+	 * \return The first status in \p results that is not #PSA_SUCCESS,
+	 *         if any.
+	 */
+	psa_status_t iotex_psa_verify_hash_batch(const iotex_psa_verify_hash_batch_item_t* items,
+											 size_t count, psa_status_t* results);
+
+/** The size of a recoverable ECDSA signature on a curve of \p curve_bits
+ * bits: r, s and a one-byte recovery id, 65 bytes for a 256-bit curve.
+ */
+#define IOTEX_PSA_ECDSA_RECOVERABLE_SIGNATURE_SIZE(curve_bits)                                     \
+	(2 * PSA_BITS_TO_BYTES(curve_bits) + 1)
+
+	/**
+	 * \brief Sign a hash with ECDSA so that the public key can be recovered
+	 *        from the signature.
+	 *
+	 * The signature is the one psa_sign_hash() makes, r followed by s,
+	 * followed by one byte holding the recovery id (0 to 3) that
+	 * iotex_psa_recover_public_key() needs. An Ethereum-style \c v is
+	 * 27 plus the recovery id.
+	 *
+	 * \param key              Identifier of an ECC key pair on
+	 *                         #PSA_ECC_FAMILY_SECP_K1 or
+	 *                         #PSA_ECC_FAMILY_SECP_R1. It must allow the
+	 *                         usage #PSA_KEY_USAGE_SIGN_HASH.
+	 * \param alg              #PSA_ALG_ECDSA or
+	 *                         #PSA_ALG_DETERMINISTIC_ECDSA(#PSA_ALG_SHA_256),
+	 *                         compatible with the policy of \p key.
+	 * \param[in] hash         The hash to sign.
+	 * \param hash_length      Size of the \p hash buffer in bytes.
+	 * \param[out] signature   Buffer where the signature is to be written.
+	 * \param signature_size   Size of the \p signature buffer in bytes, at
+	 *                         least
+	 *                         #IOTEX_PSA_ECDSA_RECOVERABLE_SIGNATURE_SIZE(256).
+	 * \param[out] signature_length On success, the number of bytes that make
+	 *                         up the returned signature value.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_INVALID_HANDLE
+	 * \retval #PSA_ERROR_NOT_PERMITTED
+	 * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+	 * \retval #PSA_ERROR_INVALID_ARGUMENT
+	 *         \p key is not an ECC key pair.
+	 * \retval #PSA_ERROR_NOT_SUPPORTED
+	 *         \p alg is not ECDSA, the curve is not supported, or the
+	 *         library is not built on TinyCrypt.
+	 * \retval #PSA_ERROR_BAD_STATE
+	 *         The library has not been previously initialized by
+	 *         psa_crypto_init().
+	 */
+	psa_status_t iotex_psa_sign_hash_recoverable(psa_key_id_t key, psa_algorithm_t alg,
+												 const uint8_t* hash, size_t hash_length,
+												 uint8_t* signature, size_t signature_size,
+												 size_t* signature_length);
+
+	/**
+	 * \brief Recover the public key from a recoverable ECDSA signature.
+	 *
+	 * This replaces psa_verify_hash() for signatures made by
+	 * iotex_psa_sign_hash_recoverable(): the verifier does not need to
+	 * import the signer's public key, and compares the recovered key (or a
+	 * digest of it, such as an address) with the one it expects instead.
+	 * Any well-formed signature yields some key, so the result must always
+	 * be compared. It needs no key slot and does not require
+	 * psa_crypto_init().
+	 *
+	 * \param family           The curve family of the signing key,
+	 *                         #PSA_ECC_FAMILY_SECP_K1 or
+	 *                         #PSA_ECC_FAMILY_SECP_R1.
+	 * \param alg              The ECDSA algorithm the signature was made
+	 *                         with.
+	 * \param[in] hash         The hash that was signed.
+	 * \param hash_length      Size of the \p hash buffer in bytes.
+	 * \param[in] signature    The signature, r, s and the recovery id.
+	 * \param signature_length Size of the \p signature buffer in bytes.
+	 * \param[out] public_key  Buffer where the public key is to be written
+	 *                         in the format of psa_export_public_key().
+	 * \param public_key_size  Size of the \p public_key buffer in bytes.
+	 * \param[out] public_key_length On success, the number of bytes written
+	 *                         in \p public_key.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_INVALID_SIGNATURE
+	 *         The signature is malformed, or no point on the curve matches
+	 *         r and the recovery id.
+	 * \retval #PSA_ERROR_BUFFER_TOO_SMALL
+	 * \retval #PSA_ERROR_INVALID_ARGUMENT
+	 *         \p alg is not a hash signature algorithm.
+	 * \retval #PSA_ERROR_NOT_SUPPORTED
+	 *         \p alg is not ECDSA, \p family is not supported, or the
+	 *         library is not built on TinyCrypt.
+	 */
+	psa_status_t iotex_psa_recover_public_key(psa_ecc_family_t family, psa_algorithm_t alg,
+											  const uint8_t* hash, size_t hash_length,
+											  const uint8_t* signature, size_t signature_length,
+											  uint8_t* public_key, size_t public_key_size,
+											  size_t* public_key_length);
+
+	/**
+	 * \brief Generate ephemeral ECC key pairs ahead of time.
+	 *
+	 * Call this when the device is idle. Each key pair it adds to the pool
+	 * is later handed out by a psa_generate_key() call for a volatile
+	 * 256-bit key pair on the same curve, which then returns without a
+	 * scalar multiplication. A handshake that generates an ephemeral key
+	 * and calls psa_raw_key_agreement() thus only pays for the agreement.
+	 * The pool holds up to #IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE key pairs
+	 * over all curves and is wiped by iotex_psa_crypto_free().
+	 *
+	 * \param family           The curve family, #PSA_ECC_FAMILY_SECP_R1 or
+	 *                         #PSA_ECC_FAMILY_SECP_K1.
+	 * \param count            The number of key pairs to add at most. Fewer
+	 *                         are added once the pool is full, which is not
+	 *                         an error.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_NOT_SUPPORTED
+	 *         The pool is disabled or \p family is not supported.
+	 * \retval #PSA_ERROR_INSUFFICIENT_ENTROPY
+	 * \retval #PSA_ERROR_BAD_STATE
+	 *         The library has not been previously initialized by
+	 *         psa_crypto_init().
+	 */
+	psa_status_t iotex_psa_ecc_ephemeral_pool_fill(psa_ecc_family_t family, size_t count);
+
+	/**
+	 * \brief The number of pooled ephemeral key pairs on a curve.
+	 *
+	 * \param family           The curve family.
+	 *
+	 * \return The number of key pairs that iotex_psa_ecc_ephemeral_pool_fill()
+	 *         generated for \p family and psa_generate_key() has not taken
+	 *         yet.
+	 */
+	size_t iotex_psa_ecc_ephemeral_pool_count(psa_ecc_family_t family);
+
 	/**
 	 * \brief Inject an initial entropy seed for the random generator into
 	 *        secure storage.
@@ -295,6 +493,168 @@ extern "C"
 	 */
 	psa_status_t iotex_psa_inject_entropy(const uint8_t* seed, size_t seed_size);
 
+#if defined(IOTEX_PSA_ITS_FILE_C)
+	/* See iotex_layer_config.h for definition */
+	#if !defined(IOTEX_PSA_ITS_FILE_LOCATION)
+		#define IOTEX_PSA_ITS_FILE_LOCATION ""
+	#endif
+	#if !defined(IOTEX_PSA_ITS_FILE_BATCH_SIZE)
+		#define IOTEX_PSA_ITS_FILE_BATCH_SIZE 32
+	#endif
+
+	/**
+	 * \brief Set the directory that holds the files of the ITS emulation.
+	 *
+	 * Each entry of the internal trusted storage, and so each persistent
+	 * key, is a file in this directory. The directory must exist.
+	 *
+	 * \param[in] directory     The directory, or NULL to go back to
+	 *                          #IOTEX_PSA_ITS_FILE_LOCATION. The string is
+	 *                          copied.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_INVALID_ARGUMENT
+	 *         \p directory is too long.
+	 * \retval #PSA_ERROR_BAD_STATE
+	 *         A batch has writes that are not flushed yet.
+	 * \retval #PSA_ERROR_STORAGE_FAILURE
+	 *         Syncing the removals of the batch in the current directory
+	 *         failed.
+	 */
+	psa_status_t iotex_psa_its_file_set_location(const char* directory);
+
+	/**
+	 * \brief Start coalescing ITS writes.
+	 *
+	 * Until iotex_psa_its_file_end_batch(), each write goes to a temporary
+	 * file that is not synced to disk. Reads see the new data at once. The
+	 * previous version of each entry stays in place, so a crash before the
+	 * batch is flushed loses the writes of the batch but never leaves an
+	 * entry half written.
+	 *
+	 * Removing an entry takes effect at once, also while batching; only
+	 * syncing the directory that records the removal waits for the next
+	 * flush.
+	 *
+	 * This makes creating many persistent keys in a row cost one sync of
+	 * the file system instead of one per key. The batch is flushed on its
+	 * own once it holds #IOTEX_PSA_ITS_FILE_BATCH_SIZE entries.
+	 */
+	void iotex_psa_its_file_begin_batch(void);
+
+	/**
+	 * \brief Make the writes of the current batch durable.
+	 *
+	 * The pending files are synced to disk, then renamed over the previous
+	 * version of their entry, and the location is synced to make these
+	 * renames and the removals of the batch durable. Batching goes on.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_STORAGE_FAILURE
+	 *         The entries that could not be put in place stay pending.
+	 */
+	psa_status_t iotex_psa_its_file_flush(void);
+
+	/**
+	 * \brief Flush the current batch and go back to syncing every write.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_STORAGE_FAILURE
+	 *         The flush failed and batching goes on.
+	 */
+	psa_status_t iotex_psa_its_file_end_batch(void);
+#endif /* IOTEX_PSA_ITS_FILE_C */
+
+#if defined(IOTEX_PSA_ITS_FLASH_C)
+	/* See iotex_layer_config.h for definition */
+	#if !defined(IOTEX_PSA_ITS_FLASH_MAX_SECTORS)
+		#define IOTEX_PSA_ITS_FLASH_MAX_SECTORS 16
+	#endif
+	#if !defined(IOTEX_PSA_ITS_FLASH_MAX_ENTRIES)
+		#define IOTEX_PSA_ITS_FLASH_MAX_ENTRIES 32
+	#endif
+
+	/**
+	 * \brief A flash device for the log-structured ITS store.
+	 *
+	 * The device is an array of \c sector_count sectors of \c sector_size
+	 * bytes each. It behaves like NOR flash: erasing a sector sets all its
+	 * bytes to 0xFF, and programming can only clear bits. The store
+	 * programs whole 32-bit words at 4-byte aligned addresses, and programs
+	 * each word at most once between two erases.
+	 *
+	 * Each callback returns 0 on success.
+	 */
+	typedef struct
+	{
+		uint32_t sector_size;
+		uint32_t sector_count;
+		int (*read)(void* context, uint32_t address, void* data, size_t length);
+		int (*program)(void* context, uint32_t address, const void* data, size_t length);
+		int (*erase)(void* context, uint32_t sector);
+		void* context;
+	} iotex_psa_flash_t;
+
+	/** Counters of the log-structured ITS store. */
+	typedef struct
+	{
+		size_t entries;			  /**< Entries in the store */
+		size_t live_bytes;		  /**< Flash taken by the current version of each entry */
+		size_t free_sectors;	  /**< Erased sectors, including the one kept for compaction */
+		uint32_t compactions;	  /**< Sectors compacted since the store was mounted */
+		uint32_t erases;		  /**< Sectors erased since the store was mounted */
+		uint32_t min_erase_count; /**< Lifetime erases of the least worn sector */
+		uint32_t max_erase_count; /**< Lifetime erases of the most worn sector */
+	} iotex_psa_its_flash_stats_t;
+
+	/**
+	 * \brief Mount the log-structured ITS store on a flash device.
+	 *
+	 * The store is a log of records appended to the sectors in turn. A new
+	 * version of an entry, or its removal, is a new record, so no write
+	 * erases a sector. Once only one erased sector is left, the oldest
+	 * sector is compacted: the current records it holds are copied to the
+	 * head of the log and it is erased. Compacting the oldest sector first
+	 * moves entries that never change as well, which spreads the erases
+	 * over all sectors; each sector keeps its erase count in its header.
+	 *
+	 * Mounting scans the device to rebuild the index of the entries in
+	 * RAM. Blank sectors are formatted. A record cut short by a power loss
+	 * is ignored, along with the rest of its sector.
+	 *
+	 * Unless #IOTEX_PSA_ITS_FILE_C is enabled too, the PSA ITS interface,
+	 * and so the persistent keys, use this store. Its entries can also be
+	 * reached directly with iotex_psa_its_flash_set() and the other
+	 * functions of psa_crypto_its.h. psa_its_flash_sim.h has a simulated
+	 * flash device for host builds.
+	 *
+	 * \param[in] flash         The device. It must stay valid until
+	 *                          iotex_psa_its_flash_unmount().
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_INVALID_ARGUMENT
+	 *         The device has fewer than 2 sectors, more than
+	 *         #IOTEX_PSA_ITS_FLASH_MAX_SECTORS, or sectors too small.
+	 * \retval #PSA_ERROR_INSUFFICIENT_MEMORY
+	 *         The device holds more than #IOTEX_PSA_ITS_FLASH_MAX_ENTRIES
+	 *         entries.
+	 * \retval #PSA_ERROR_STORAGE_FAILURE
+	 */
+	psa_status_t iotex_psa_its_flash_mount(const iotex_psa_flash_t* flash);
+
+	/** \brief Detach the store from its device. */
+	void iotex_psa_its_flash_unmount(void);
+
+	/**
+	 * \brief Read the counters of the log-structured ITS store.
+	 *
+	 * \retval #PSA_SUCCESS
+	 * \retval #PSA_ERROR_BAD_STATE
+	 *         No device is mounted.
+	 */
+	psa_status_t iotex_psa_its_flash_get_stats(iotex_psa_its_flash_stats_t* stats);
+#endif /* IOTEX_PSA_ITS_FLASH_C */
+
 /** \addtogroup crypto_types
  * @{
  */
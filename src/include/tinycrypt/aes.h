@@ -1,4 +1,4 @@
-/* aes.h - TinyCrypt interface to an AES-128 implementation */
+/* aes.h - TinyCrypt interface to an AES implementation */
 
 /*
  *  Copyright (C) 2017 by Intel Corporation, All Rights Reserved.
@@ -32,16 +32,19 @@
 
 /**
  * @file
- * @brief -- Interface to an AES-128 implementation.
+ * @brief -- Interface to an AES implementation.
  *
  *  Overview:   AES-128 is a NIST approved block cipher specified in
  *              FIPS 197. Block ciphers are deterministic algorithms that
  *              perform a transformation specified by a symmetric key in fixed-
  *              length data sets, also called blocks.
  *
- *  Security:   AES-128 provides approximately 128 bits of security.
+ *  Security:   AES-128 provides approximately 128 bits of security,
+ *              AES-192 and AES-256 approximately 192 and 256 bits.
  *
- *  Usage:      1) call tc_aes128_set_encrypt/decrypt_key to set the key.
+ *  Usage:      1) call tc_aes_set_encrypt/decrypt_key (or the AES-128
+ *                 shorthands tc_aes128_set_encrypt/decrypt_key) to set the
+ *                 key.
  *
  *              2) call tc_aes_encrypt/decrypt to process the data.
  */
@@ -57,29 +60,57 @@ extern "C" {
 
 #define Nb (4)  /* number of columns (32-bit words) comprising the state */
 #define Nk (4)  /* number of 32-bit words comprising the key */
-#define Nr (10) /* number of rounds */
+#define Nr (10) /* number of rounds with an AES-128 key */
+#define TC_AES_MAX_ROUNDS (14) /* number of rounds with an AES-256 key */
 #define TC_AES_BLOCK_SIZE (Nb*Nk)
 #define TC_AES_KEY_SIZE (Nb*Nk)
+#define TC_AES_MAX_KEY_SIZE (32)
+
+/*
+ * Round implementation, selected at build time. With TC_AES_TTABLE set to 1
+ * (the default) the state is kept as four 32-bit columns: encryption rounds
+ * are looked up in a 1 KiB table of combined SubBytes/MixColumns words and
+ * decryption rounds run InvMixColumns on whole words. Set it to 0 for the
+ * original byte-oriented rounds, which need no table beyond the S-boxes but
+ * are several times slower. Table lookups are indexed by secret data, so on
+ * cores with a data cache the byte-oriented S-box lookups and the T-table
+ * lookups leak through cache timing alike.
+ */
+#ifndef TC_AES_TTABLE
+#define TC_AES_TTABLE 1
+#endif
 
 typedef struct tc_aes_key_sched_struct {
-	unsigned int words[Nb*(Nr+1)];
+	unsigned int words[Nb*(TC_AES_MAX_ROUNDS+1)];
+	unsigned int rounds; /* 10, 12 or 14 */
 } *TCAesKeySched_t;
 
+/**
+ *  @brief Set an AES-128, AES-192 or AES-256 encryption key
+ *  Uses key k to initialize s
+ *  @return  returns TC_CRYPTO_SUCCESS (1)
+ *           returns TC_CRYPTO_FAIL (0) if: s == NULL or k == NULL or
+ *           keybits is not 128, 192 or 256
+ *  @param      s IN/OUT -- initialized struct tc_aes_key_sched_struct
+ *  @param      k IN -- points to the AES key, keybits / 8 bytes long
+ *  @param      keybits IN -- key length in bits
+ */
+int tc_aes_set_encrypt_key(TCAesKeySched_t s, const uint8_t *k,
+			   unsigned int keybits);
+
 /**
  *  @brief Set AES-128 encryption key
  *  Uses key k to initialize s
  *  @return  returns TC_CRYPTO_SUCCESS (1)
  *           returns TC_CRYPTO_FAIL (0) if: s == NULL or k == NULL
- *  @note       This implementation skips the additional steps required for keys
- *              larger than 128 bits, and must not be used for AES-192 or
- *              AES-256 key schedule -- see FIPS 197 for details
+ *  @note       Same as tc_aes_set_encrypt_key(s, k, 128)
  *  @param      s IN/OUT -- initialized struct tc_aes_key_sched_struct
  *  @param      k IN -- points to the AES key
  */
 int tc_aes128_set_encrypt_key(TCAesKeySched_t s, const uint8_t *k);
 
 /**
- *  @brief AES-128 Encryption procedure
+ *  @brief AES Encryption procedure
  *  Encrypts contents of in buffer into out buffer under key;
  *              schedule s
  *  @note Assumes s was initialized by aes_set_encrypt_key;
@@ -93,6 +124,21 @@ int tc_aes128_set_encrypt_key(TCAesKeySched_t s, const uint8_t *k);
 int tc_aes_encrypt(uint8_t *out, const uint8_t *in, 
 		   const TCAesKeySched_t s);
 
+/**
+ *  @brief Set an AES-128, AES-192 or AES-256 decryption key
+ *  Uses key k to initialize s
+ *  @return returns TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if: s == NULL or k == NULL or
+ *          keybits is not 128, 192 or 256
+ *  @note       The schedule is the encryption schedule; this is the
+ *              straightforward inverse cipher of FIPS-197 figure 12
+ *  @param s  IN/OUT -- initialized struct tc_aes_key_sched_struct
+ *  @param k  IN -- points to the AES key, keybits / 8 bytes long
+ *  @param keybits IN -- key length in bits
+ */
+int tc_aes_set_decrypt_key(TCAesKeySched_t s, const uint8_t *k,
+			   unsigned int keybits);
+
 /**
  *  @brief Set the AES-128 decryption key
  *  Uses key k to initialize s
@@ -101,16 +147,14 @@ int tc_aes_encrypt(uint8_t *out, const uint8_t *in,
  *  @note       This is the implementation of the straightforward inverse cipher
  *              using the cipher documented in FIPS-197 figure 12, not the
  *              equivalent inverse cipher presented in Figure 15
- *  @warning    This routine skips the additional steps required for keys larger
- *              than 128, and must not be used for AES-192 or AES-256 key
- *              schedule -- see FIPS 197 for details
+ *  @note       Same as tc_aes_set_decrypt_key(s, k, 128)
  *  @param s  IN/OUT -- initialized struct tc_aes_key_sched_struct
  *  @param k  IN -- points to the AES key
  */
 int tc_aes128_set_decrypt_key(TCAesKeySched_t s, const uint8_t *k);
 
 /**
- *  @brief AES-128 Encryption procedure
+ *  @brief AES Decryption procedure
  *  Decrypts in buffer into out buffer under key schedule s
  *  @return returns TC_CRYPTO_SUCCESS (1)
  *          returns TC_CRYPTO_FAIL (0) if: out is NULL or in is NULL or s is NULL
@@ -81,19 +81,86 @@ extern "C" {
 #define uECC_CURVE_TYPE_SECP256R1		1
 #define uECC_CURVE_TYPE_SECP256K1		2
 
-/* Word size (4 bytes considering 32-bits architectures) */
+/*
+ * Word size of the field arithmetic, in bytes. 64-bit hosts whose compiler
+ * has a 128-bit integer type get 8-byte limbs, so that a 256-bit element is
+ * four words and a product takes 16 multiplications instead of 64; every
+ * other target keeps the 4-byte limbs. Define to 4 to force the 32-bit code.
+ */
+#ifndef uECC_WORD_SIZE
+#if defined(__SIZEOF_INT128__) && \
+    (defined(__x86_64__) || defined(__aarch64__) || defined(__LP64__))
+#define uECC_WORD_SIZE 8
+#else
 #define uECC_WORD_SIZE 4
+#endif
+#endif
 
 /* setting max number of calls to prng: */
 #ifndef uECC_RNG_MAX_TRIES
 #define uECC_RNG_MAX_TRIES 64
 #endif
 
+/*
+ * Width of the fixed-base comb that multiplies the curve generator when a
+ * public key is derived or a signature is made. The comb reads 2^(w-1)
+ * precomputed points per curve from const data in ecc_comb_tables.c and
+ * needs about 256/w point doublings and additions, against 256 ladder steps
+ * for EccPoint_mult():
+ *   4 -- 512 bytes per curve
+ *   5 -- 1 KiB per curve
+ *   6 -- 2 KiB per curve
+ * Set to 0 to drop the tables and use the Montgomery ladder for G as well.
+ */
+#ifndef uECC_BASE_COMB_WIDTH
+#define uECC_BASE_COMB_WIDTH 5
+#endif
+
+/*
+ * Window width of the wNAF double-scalar multiplication u1*G + u2*Q that
+ * uECC_verify() runs. The odd multiples of G come from ecc_comb_tables.c
+ * (2^(w-2) points per curve), those of Q are computed on each call:
+ *   4 -- 256 bytes per curve
+ *   5 -- 512 bytes per curve
+ * Set to 0 for the original 1-bit Shamir's trick over {G, Q, G+Q}.
+ */
+#ifndef uECC_VERIFY_WNAF_WIDTH
+#define uECC_VERIFY_WNAF_WIDTH 5
+#endif
+
+/*
+ * Split secp256k1 scalars with the curve's endomorphism (x, y) -> (beta*x, y),
+ * which is multiplication by lambda: k = k1 + k2*lambda (mod n) with k1 and
+ * k2 of about 128 bits. uECC_verify() then runs a 4-way wNAF over G,
+ * lambda*G, Q and lambda*Q, and uECC_shared_secret() a regular signed window
+ * over P and lambda*P, each with half the point doublings. Both reuse the
+ * wNAF point tables, so this has no effect with uECC_VERIFY_WNAF_WIDTH 0.
+ * Set to 0 to run secp256k1 through the generic code like secp256r1.
+ */
+#ifndef uECC_SECP256K1_GLV
+#define uECC_SECP256K1_GLV 1
+#endif
+
 /* defining data types to store word and bit counts: */
 typedef int8_t wordcount_t;
 typedef int16_t bitcount_t;
 /* defining data type for comparison result: */
 typedef int8_t cmpresult_t;
+#if uECC_WORD_SIZE == 8
+/* defining data type to store ECC coordinate/point in 64bits words: */
+typedef uint64_t uECC_word_t;
+/* defining data type to store the product of two 64bits words: */
+__extension__ typedef unsigned __int128 uECC_dword_t;
+
+/* defining masks useful for ecc computations: */
+#define HIGH_BIT_SET 0x8000000000000000ull
+#define uECC_WORD_BITS 64
+#define uECC_WORD_BITS_SHIFT 6
+#define uECC_WORD_BITS_MASK 0x03F
+
+/* Number of words of 64 bits to represent an element of the the curve p-256: */
+#define NUM_ECC_WORDS 4
+#elif uECC_WORD_SIZE == 4
 /* defining data type to store ECC coordinate/point in 32bits words: */
 typedef unsigned int uECC_word_t;
 /* defining data type to store an ECC coordinate/point in 64bits words: */
@@ -107,6 +174,9 @@ typedef uint64_t uECC_dword_t;
 
 /* Number of words of 32 bits to represent an element of the the curve p-256: */
 #define NUM_ECC_WORDS 8
+#else
+#error "uECC_WORD_SIZE must be 4 or 8"
+#endif
 /* Number of bytes to represent an element of the the curve p-256: */
 #define NUM_ECC_BYTES (uECC_WORD_SIZE*NUM_ECC_WORDS)
 
@@ -152,12 +222,17 @@ void x_side_default(uECC_word_t *result, const uECC_word_t *x,
  * @param result OUT -- product % curve_p
  * @param product IN -- value to be reduced mod curve_p
  */
-void vli_mmod_fast_secp256r1(unsigned int *result, unsigned int *product);
-void vli_mmod_fast_secp256k1(unsigned int *result, unsigned int *product);
+void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product);
+void vli_mmod_fast_secp256k1(uECC_word_t *result, uECC_word_t *product);
 
 /* Bytes to words ordering: */
+#if uECC_WORD_SIZE == 8
+#define BYTES_TO_WORDS_8(a, b, c, d, e, f, g, h) 0x##h##g##f##e##d##c##b##a##ull
+#define BYTES_TO_WORDS_4(a, b, c, d) 0x##d##c##b##a##ull
+#else
 #define BYTES_TO_WORDS_8(a, b, c, d, e, f, g, h) 0x##d##c##b##a, 0x##h##g##f##e
 #define BYTES_TO_WORDS_4(a, b, c, d) 0x##d##c##b##a
+#endif
 #define BITS_TO_WORDS(num_bits) \
 	((num_bits + ((uECC_WORD_SIZE * 8) - 1)) / (uECC_WORD_SIZE * 8))
 #define BITS_TO_BYTES(num_bits) ((num_bits + 7) / 8)
@@ -308,6 +383,20 @@ int uECC_curve_public_key_size(uECC_Curve curve);
 int uECC_compute_public_key(const uint8_t *private_key,
 			    uint8_t *public_key, uECC_Curve curve);
 
+/*
+ * @brief Compute the public point for a private key, in native word order.
+ * @param private_key IN -- The private key to compute the public point for
+ * @param public_point OUT -- Will be filled in with X followed by Y, each
+ * curve->num_words words long
+ * @param curve
+ * @return Returns 1 if the point was computed successfully, 0 if an error
+ * occurred.
+ * @note Keeping the native point lets a caller verify many signatures with
+ * uECC_verify_native() without converting the public key each time.
+ */
+int uECC_compute_public_point(const uint8_t *private_key,
+			      uECC_word_t *public_point, uECC_Curve curve);
+
 /*
  * @brief Compute public-key.
  * @return corresponding public-key.
@@ -345,6 +434,75 @@ void EccPoint_mult(uECC_word_t * result, const uECC_word_t * point,
 		   const uECC_word_t * scalar, const uECC_word_t * initial_Z,
 		   bitcount_t num_bits, uECC_Curve curve);
 
+#if uECC_BASE_COMB_WIDTH
+/*
+ * @brief Multiplication of the curve generator with a fixed-base comb.
+ * The scalar is recoded into signed odd digits, so every step is one point
+ * doubling and one addition of a table point selected in constant time.
+ * @param result OUT -- returns scalar*G in affine coordinates
+ * @param scalar IN -- scalar, 0 < scalar < n
+ * @param initial_Z IN -- random value in [1, p) to randomize the projective
+ * coordinates with, or 0 to leave them unrandomized
+ * @param curve IN -- elliptic curve
+ * @return 1 on success, 0 if the result is the point at infinity
+ */
+uECC_word_t EccPoint_mult_base(uECC_word_t * result,
+			       const uECC_word_t * scalar,
+			       const uECC_word_t * initial_Z, uECC_Curve curve);
+#endif
+
+#if uECC_VERIFY_WNAF_WIDTH
+/*
+ * @brief Computes u1*G + u2*Q with interleaved wNAF expansions of the two
+ * scalars. Runs in variable time, so it must only see public values such as
+ * the scalars of a signature verification.
+ * @param result OUT -- returns u1*G + u2*Q in affine coordinates
+ * @param u1 IN -- scalar for the generator, u1 < n
+ * @param u2 IN -- scalar for the point, u2 < n
+ * @param point IN -- point Q, must be a valid point on the curve
+ * @param curve IN -- elliptic curve
+ * @return 1 on success, 0 if the result is the point at infinity
+ */
+uECC_word_t EccPoint_mult_add_unsafe(uECC_word_t * result,
+				     const uECC_word_t * u1,
+				     const uECC_word_t * u2,
+				     const uECC_word_t * point, uECC_Curve curve);
+
+/*
+ * @brief Same as EccPoint_mult_add_unsafe(), but leaves the result in
+ * Jacobian coordinates so that callers can share the final inversion.
+ * @param result OUT -- returns X and Y of u1*G + u2*Q
+ * @param z OUT -- returns Z of u1*G + u2*Q
+ * @return 1 on success, 0 if the result is the point at infinity
+ */
+uECC_word_t EccPoint_mult_add_jacobian_unsafe(uECC_word_t * result,
+					      uECC_word_t * z,
+					      const uECC_word_t * u1,
+					      const uECC_word_t * u2,
+					      const uECC_word_t * point,
+					      uECC_Curve curve);
+
+#if uECC_SECP256K1_GLV
+/*
+ * @brief secp256k1 point multiplication with the GLV endomorphism. The two
+ * halves of the scalar are recoded into signed odd digits, so every window
+ * is the same number of doublings and two additions of table points
+ * selected in constant time.
+ * @note Result may overlap point.
+ * @param result OUT -- returns scalar*point in affine coordinates
+ * @param point IN -- point P, must be a valid point on the curve
+ * @param scalar IN -- scalar, reduced mod n if it is not already
+ * @param initial_Z IN -- random value in [1, p) to randomize the projective
+ * coordinates with, or 0 to leave them unrandomized
+ * @param curve IN -- elliptic curve, must be secp256k1
+ * @return 1 on success, 0 if the result is the point at infinity
+ */
+uECC_word_t EccPoint_mult_glv(uECC_word_t * result, const uECC_word_t * point,
+			      const uECC_word_t * scalar,
+			      const uECC_word_t * initial_Z, uECC_Curve curve);
+#endif
+#endif
+
 /*
  * @brief Constant-time comparison to zero - secure way to compare long integers
  * @param vli IN -- very long integer
@@ -484,6 +642,18 @@ void uECC_vli_modMult(uECC_word_t *result, const uECC_word_t *left,
 		      const uECC_word_t *right, const uECC_word_t *mod,
 	              wordcount_t num_words);
 
+/*
+ * @brief Computes (left * right) % curve->n with Barrett reduction, which
+ * costs about three multiplications where uECC_vli_modMult() reduces one
+ * bit at a time.
+ * @param result OUT -- (left * right) % n
+ * @param left IN -- left term in product
+ * @param right IN -- right term in product
+ * @param curve IN -- elliptic curve
+ */
+void uECC_vli_modMult_n(uECC_word_t *result, const uECC_word_t *left,
+			const uECC_word_t *right, uECC_Curve curve);
+
 /*
  * @brief Computes (1 / input) % mod
  * @note All VLIs are the same size.
@@ -496,6 +666,29 @@ void uECC_vli_modMult(uECC_word_t *result, const uECC_word_t *left,
 void uECC_vli_modInv(uECC_word_t *result, const uECC_word_t *input,
 		     const uECC_word_t *mod, wordcount_t num_words);
 
+/*
+ * @brief Computes a square root of a modulo curve->p, which must be 3 mod 4.
+ * @note If a is not a square, a is left with the root of -a instead, so
+ * callers must square the result to check it.
+ * @param a IN/OUT -- value to take the root of, a < p; returns the root
+ * @param curve IN -- elliptic curve
+ */
+void uECC_vli_mod_sqrt(uECC_word_t *a, uECC_Curve curve);
+
+/*
+ * @brief Replaces each of count values by its inverse modulo mod, paying for
+ * a single uECC_vli_modInv() plus three multiplications per value
+ * (Montgomery's trick). Zero values are left as they are.
+ * @param values IN/OUT -- count values of NUM_ECC_WORDS words each
+ * @param scratch IN -- room for count values of NUM_ECC_WORDS words each
+ * @param count IN -- number of values
+ * @param mod IN -- curve->p or curve->n
+ * @param curve IN -- elliptic curve
+ */
+void uECC_vli_modInv_batch(uECC_word_t *values, uECC_word_t *scratch,
+			   unsigned int count, const uECC_word_t *mod,
+			   uECC_Curve curve);
+
 /*
  * @brief Sets dest = src.
  * @param dest OUT -- destination buffer
@@ -569,7 +762,7 @@ int uECC_valid_public_key(const uint8_t *public_key, uECC_Curve curve);
   * @param native IN -- uECC native representation
   */
 void uECC_vli_nativeToBytes(uint8_t *bytes, int num_bytes,
-    			    const unsigned int *native);
+    			    const uECC_word_t *native);
 
 /*
  * @brief Converts big-endian bytes to an integer in uECC native format.
@@ -577,7 +770,7 @@ void uECC_vli_nativeToBytes(uint8_t *bytes, int num_bytes,
  * @param bytes IN -- bytes representation
  * @param num_bytes IN -- number of bytes
  */
-void uECC_vli_bytesToNative(unsigned int *native, const uint8_t *bytes,
+void uECC_vli_bytesToNative(uECC_word_t *native, const uint8_t *bytes,
 			    int num_bytes);
 
 #ifdef __cplusplus
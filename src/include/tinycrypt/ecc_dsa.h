@@ -105,6 +105,51 @@ extern "C" {
 int uECC_sign(const uint8_t *p_private_key, const uint8_t *p_message_hash,
 	      unsigned p_hash_size, uint8_t *p_signature, uECC_Curve curve);
 
+/**
+ * @brief Generate a deterministic ECDSA signature (RFC 6979) for a hash value.
+ * The nonce is derived from the private key and the hash with the TinyCrypt
+ * HMAC-DRBG (HMAC-SHA-256), so this follows RFC 6979 exactly when the hash is
+ * SHA-256. The side-channel blinding values come from a second generator
+ * seeded the same way; no RNG function is needed.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if an error occurred.
+ *
+ * @param p_private_key IN -- Your private key.
+ * @param p_message_hash IN -- The hash of the message to sign.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature OUT -- Will be filled in with the signature value, 2 *
+ * curve size bytes long.
+ */
+int uECC_sign_deterministic(const uint8_t *p_private_key,
+			    const uint8_t *p_message_hash, unsigned p_hash_size,
+			    uint8_t *p_signature, uECC_Curve curve);
+
+/**
+ * @brief Generate an ECDSA signature as uECC_sign() does, together with the
+ * recovery id that uECC_recover_public_key() needs to find the public key.
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if an error occurred.
+ *
+ * @param p_recovery_id OUT -- Will be filled in with the recovery id, 0 to 3.
+ * Bit 0 is the parity of the y coordinate of the nonce point R, bit 1 is set
+ * when the x coordinate of R was n or more and r is that value minus n.
+ */
+int uECC_sign_recoverable(const uint8_t *p_private_key,
+			  const uint8_t *p_message_hash, unsigned p_hash_size,
+			  uint8_t *p_signature, uint8_t *p_recovery_id,
+			  uECC_Curve curve);
+
+/**
+ * @brief Generate a deterministic ECDSA signature as uECC_sign_deterministic()
+ * does, together with its recovery id (see uECC_sign_recoverable()).
+ * @return returns TC_CRYPTO_SUCCESS (1) if the signature generated successfully
+ *         returns TC_CRYPTO_FAIL (0) if an error occurred.
+ */
+int uECC_sign_deterministic_recoverable(const uint8_t *p_private_key,
+					const uint8_t *p_message_hash,
+					unsigned p_hash_size, uint8_t *p_signature,
+					uint8_t *p_recovery_id, uECC_Curve curve);
+
 #ifdef ENABLE_TESTS
 /*
  * THIS FUNCTION SHOULD BE CALLED FOR TEST PURPOSES ONLY.
@@ -132,6 +177,77 @@ int uECC_sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
 int uECC_verify(const uint8_t *p_public_key, const uint8_t *p_message_hash,
 		unsigned int p_hash_size, const uint8_t *p_signature, uECC_Curve curve);
 
+/**
+ * @brief Verify an ECDSA signature against a public point in native form.
+ * @return returns TC_SUCCESS (1) if the signature is valid
+ * 	   returns TC_FAIL (0) if the signature is invalid.
+ *
+ * @param p_public_point IN -- The signer's public point, X followed by Y in
+ * uECC native word order, as produced by uECC_compute_public_point() or
+ * uECC_vli_bytesToNative(). It is not checked to lie on the curve.
+ * @param p_message_hash IN -- The hash of the signed data.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature IN -- The signature values.
+ *
+ * @note Same as uECC_verify() minus the conversion of the public key.
+ */
+int uECC_verify_native(const uECC_word_t *p_public_point,
+		       const uint8_t *p_message_hash, unsigned int p_hash_size,
+		       const uint8_t *p_signature, uECC_Curve curve);
+
+/**
+ * @brief Recover the public key that made an ECDSA signature.
+ * @return returns TC_SUCCESS (1) and the public key if the signature and the
+ * recovery id are well formed; the key is then the only one that the
+ * signature verifies under.
+ * 	   returns TC_FAIL (0) if no key can have made the signature.
+ *
+ * @param p_message_hash IN -- The hash of the signed data.
+ * @param p_hash_size IN -- The size of p_message_hash in bytes.
+ * @param p_signature IN -- The signature values.
+ * @param p_recovery_id IN -- The recovery id from uECC_sign_recoverable().
+ * @param p_public_key OUT -- Will be filled in with the public key, 2 * curve
+ * size bytes long.
+ *
+ * @note Runs in variable time, it only handles public values.
+ */
+int uECC_recover_public_key(const uint8_t *p_message_hash,
+			    unsigned int p_hash_size, const uint8_t *p_signature,
+			    uint8_t p_recovery_id, uint8_t *p_public_key,
+			    uECC_Curve curve);
+
+/*
+ * Number of signatures uECC_verify_batch_native() works on at a time. Each
+ * one costs 160 bytes of stack (for 256-bit curves) and saves two modular
+ * inversions out of four.
+ */
+#ifndef uECC_VERIFY_BATCH_CHUNK
+#define uECC_VERIFY_BATCH_CHUNK 8
+#endif
+
+/* One signature of a uECC_verify_batch_native() call. */
+typedef struct uECC_VerifyItem {
+	const uECC_word_t *public_point; /* native, as uECC_verify_native() */
+	const uint8_t *message_hash;
+	unsigned int hash_size;
+	const uint8_t *signature;
+} uECC_VerifyItem;
+
+/**
+ * @brief Verify several ECDSA signatures made on the same curve.
+ * Every signature is checked as by uECC_verify_native(), but the inversions
+ * of s and of the final Z coordinates are shared between
+ * uECC_VERIFY_BATCH_CHUNK signatures at a time.
+ *
+ * @param items IN -- The signatures, with their public points and hashes.
+ * @param count IN -- The number of items.
+ * @param results OUT -- results[i] is set to TC_SUCCESS (1) if item i is
+ * valid and TC_FAIL (0) if not.
+ * @param curve IN -- The curve of all the public points.
+ */
+void uECC_verify_batch_native(const uECC_VerifyItem *items, unsigned int count,
+			      int *results, uECC_Curve curve);
+
 #ifdef __cplusplus
 }
 #endif
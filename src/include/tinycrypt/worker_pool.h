@@ -0,0 +1,154 @@
+/* worker_pool.h - TinyCrypt interface to a thread pool for batch workloads */
+
+/**
+ * @file
+ * @brief Interface to a POSIX thread pool that shards batches of ECDSA
+ * verifications and SHA-256 digests across several cores.
+ *
+ *  Overview:   The pool keeps a fixed set of threads. Each batch is split
+ *              into one contiguous shard per thread; a thread works through
+ *              its own shard from the front and, once that is empty, steals
+ *              the back half of another thread's shard. The jobs run on the
+ *              plain uECC_verify() and tc_sha256_* kernels with their
+ *              scratch on the worker's stack, so the only state the threads
+ *              share is the shard bounds.
+ *
+ *  Usage:      1) call tc_worker_pool_init to start the threads of a struct
+ *              tc_worker_pool_struct.
+ *
+ *              2) call tc_worker_pool_verify or tc_worker_pool_sha256 with a
+ *              batch; the call returns once every job of the batch is done.
+ *              Batches submitted from several threads run one after another.
+ *
+ *              3) call tc_worker_pool_free to stop and join the threads.
+ *
+ *  Availability: only built when TC_WORKER_POOL is set to 1, which the CMake
+ *              build does for hosts with POSIX threads. Arduino builds leave
+ *              it at 0 and compile none of this.
+ */
+
+#ifndef __TC_WORKER_POOL_H__
+#define __TC_WORKER_POOL_H__
+
+#ifndef TC_WORKER_POOL
+#define TC_WORKER_POOL 0
+#endif
+
+#if TC_WORKER_POOL
+
+#include "include/tinycrypt/ecc.h"
+
+#include <pthread.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Upper bound on the number of threads of one pool. */
+#ifndef TC_WORKER_POOL_MAX_THREADS
+#define TC_WORKER_POOL_MAX_THREADS 32
+#endif
+
+/* One signature of a tc_worker_pool_verify() call. */
+typedef struct tc_verify_job {
+	const uint8_t *public_key; /* X || Y, as uECC_verify() */
+	const uint8_t *message_hash;
+	unsigned int hash_size;
+	const uint8_t *signature;
+	uECC_Curve curve;
+} tc_verify_job;
+
+/* One message of a tc_worker_pool_sha256() call. */
+typedef struct tc_sha256_job {
+	const uint8_t *data;
+	size_t data_length;
+	uint8_t *digest; /* OUT, TC_SHA256_DIGEST_SIZE bytes */
+} tc_sha256_job;
+
+/* Range of job indices [begin, end) owned by one thread. */
+struct tc_worker_shard {
+	pthread_mutex_t lock;
+	size_t begin;
+	size_t end;
+};
+
+struct tc_worker_pool_struct;
+
+struct tc_worker_thread {
+	struct tc_worker_pool_struct *pool;
+	unsigned int index;
+	pthread_t thread;
+};
+
+struct tc_worker_pool_struct {
+	pthread_mutex_t submit; /* one batch at a time */
+	pthread_mutex_t lock;   /* guards everything below */
+	pthread_cond_t work_ready;
+	pthread_cond_t work_done;
+	unsigned int thread_count;
+	unsigned int generation; /* bumped for every batch */
+	unsigned int busy;       /* threads still working on the batch */
+	int shutdown;
+	void (*run)(const void *jobs, size_t index, void *results);
+	const void *jobs;
+	void *results;
+	size_t grain; /* jobs a thread takes from its own shard at once */
+	struct tc_worker_thread threads[TC_WORKER_POOL_MAX_THREADS];
+	struct tc_worker_shard shards[TC_WORKER_POOL_MAX_THREADS];
+};
+
+typedef struct tc_worker_pool_struct *TCWorkerPool_t;
+
+/**
+ *  @brief Start the threads of a pool
+ *  @return returns TC_CRYPTO_SUCCESS (1)
+ *          returns TC_CRYPTO_FAIL (0) if: pool == NULL or
+ *                threads is 0 or larger than TC_WORKER_POOL_MAX_THREADS or
+ *                a thread could not be created
+ *  @param pool IN/OUT -- the pool to start
+ *  @param threads IN -- number of worker threads
+ */
+int tc_worker_pool_init(TCWorkerPool_t pool, unsigned int threads);
+
+/**
+ *  @brief Stop and join the threads of a pool started by tc_worker_pool_init
+ *  @param pool IN/OUT -- the pool to stop; must not be running a batch
+ */
+void tc_worker_pool_free(TCWorkerPool_t pool);
+
+/**
+ *  @brief Verify a batch of ECDSA signatures
+ *  Every job is checked as by uECC_verify(); jobs may mix curves.
+ *  @return returns TC_CRYPTO_SUCCESS (1) once every job has run
+ *          returns TC_CRYPTO_FAIL (0) if: pool == NULL or
+ *                count > 0 and jobs == NULL or results == NULL
+ *  @param pool IN -- a started pool
+ *  @param jobs IN -- the signatures, with their public keys and hashes
+ *  @param count IN -- the number of jobs
+ *  @param results OUT -- results[i] is set to TC_CRYPTO_SUCCESS (1) if job i
+ *                is valid and TC_CRYPTO_FAIL (0) if not
+ */
+int tc_worker_pool_verify(TCWorkerPool_t pool, const tc_verify_job *jobs,
+			  size_t count, int *results);
+
+/**
+ *  @brief Compute the SHA-256 digests of a batch of messages
+ *  @return returns TC_CRYPTO_SUCCESS (1) once every digest is written
+ *          returns TC_CRYPTO_FAIL (0) if: pool == NULL or
+ *                count > 0 and jobs == NULL
+ *  @param pool IN -- a started pool
+ *  @param jobs IN -- the messages and where to write their digests
+ *  @param count IN -- the number of jobs
+ */
+int tc_worker_pool_sha256(TCWorkerPool_t pool, const tc_sha256_job *jobs,
+			  size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TC_WORKER_POOL */
+
+#endif /* __TC_WORKER_POOL_H__ */
@@ -101,15 +101,15 @@ static void* ccm_ctx_alloc(void)
 {
 	void* ctx = iotex_calloc(1, sizeof(iotex_ccm_context));
 
-	// if( ctx != NULL )
-	//     iotex_ccm_init( (iotex_ccm_context *) ctx );
+	if(ctx != NULL)
+		iotex_ccm_init((iotex_ccm_context*)ctx);
 
 	return (ctx);
 }
 
 static void ccm_ctx_free(void* ctx)
 {
-	//    iotex_ccm_free( ctx );
+	iotex_ccm_free(ctx);
 	iotex_free(ctx);
 }
 	#endif /* IOTEX_CCM_C */
@@ -418,9 +418,7 @@ static const iotex_cipher_info_t aes_256_gcm_info = {IOTEX_CIPHER_AES_256_GCM,
 		#if defined(IOTEX_CCM_C)
 static int ccm_aes_setkey_wrap(void* ctx, const unsigned char* key, unsigned int key_bitlen)
 {
-	// return iotex_ccm_setkey( (iotex_ccm_context *) ctx, IOTEX_CIPHER_ID_AES,
-	//                  key, key_bitlen );
-	return 0;
+	return iotex_ccm_setkey((iotex_ccm_context*)ctx, IOTEX_CIPHER_ID_AES, key, key_bitlen);
 }
 
 static const iotex_cipher_base_t ccm_aes_info = {
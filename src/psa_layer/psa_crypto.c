@@ -473,7 +473,7 @@ psa_status_t psa_allocate_buffer_to_slot(psa_key_slot_t* slot, size_t buffer_len
 	if(slot->key.data != NULL)
 		return (PSA_ERROR_ALREADY_EXISTS);
 
-	slot->key.data = (uint8_t*)iotex_calloc(1, buffer_length);
+	slot->key.data = iotex_psa_key_arena_alloc(buffer_length);
 	if(slot->key.data == NULL)
 		return (PSA_ERROR_INSUFFICIENT_MEMORY);
 
@@ -864,9 +864,19 @@ psa_status_t psa_remove_key_data_from_memory(psa_key_slot_t* slot)
 	/* Data pointer will always be either a valid pointer or NULL in an
 	 * initialized slot, so we can just free it. */
 	if(slot->key.data != NULL)
+	{
+	#if defined(IOTEX_PSA_BUILTIN_KEY_TYPE_AES)
+		/* Drop any expanded copy of the key before the key itself. */
+		if(slot->attr.type == PSA_KEY_TYPE_AES)
+			iotex_aes_key_cache_purge(slot->key.data, PSA_BYTES_TO_BITS(slot->key.bytes));
+	#endif
+	#if defined(IOTEX_PSA_BUILTIN_MAC)
+		iotex_psa_mac_key_cache_purge(slot->attr.id);
+	#endif
 		iotex_platform_zeroize(slot->key.data, slot->key.bytes);
+	}
 
-	iotex_free(slot->key.data);
+	iotex_psa_key_arena_free(slot->key.data);
 	slot->key.data = NULL;
 	slot->key.bytes = 0;
 
@@ -884,6 +894,7 @@ psa_status_t psa_wipe_key_slot(psa_key_slot_t* slot)
 		status = PSA_ERROR_CORRUPTION_DETECTED;
 	}
 
+	psa_release_key_slot(slot);
 	memset(slot, 0, sizeof(*slot));
 	return (status);
 }
@@ -1239,8 +1250,14 @@ psa_status_t psa_export_public_key(psa_key_id_t key, uint8_t* data, size_t data_
 		goto exit;
 	}
 
-	status = psa_driver_wrapper_export_public_key(&attributes, slot->key.data, slot->key.bytes,
-												  data, data_size, data_length);
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	if(slot->ecc_public.valid)
+		status = iotex_psa_ecp_export_public_point(slot, data, data_size, data_length);
+	else
+	#endif
+		status = psa_driver_wrapper_export_public_key(&attributes, slot->key.data,
+													  slot->key.bytes, data, data_size,
+													  data_length);
 
 exit:
 	unlock_status = psa_unlock_key_slot(slot);
@@ -1380,6 +1397,8 @@ static psa_status_t psa_start_key_creation(psa_key_creation_method_t method,
 	{
 		slot->attr.id = volatile_key_id;
 	}
+	else
+		psa_index_key_slot(slot);
 
 	slot->attr.flags &= ~IOTEX_PSA_KA_MASK_EXTERNAL_ONLY;
 
@@ -1458,6 +1477,16 @@ static psa_status_t psa_finish_key_creation(psa_key_slot_t* slot, psa_se_drv_tab
 	(void)slot;
 	(void)driver;
 
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	/* A key pair taken from the ephemeral pool comes with its point. */
+	if(!slot->ecc_public.valid)
+	{
+		status = iotex_psa_ecp_cache_public_point(slot);
+		if(status != PSA_SUCCESS)
+			return (status);
+	}
+	#endif
+
 	#if defined(IOTEX_PSA_CRYPTO_STORAGE_C)
 	if(!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime))
 	{
@@ -2403,6 +2432,36 @@ exit:
 	return ((status == PSA_SUCCESS) ? unlock_status : status);
 }
 
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+/* ECDSA verification with the public point cached in the slot, skipping the
+ * driver entry points that only see the export representation of the key. */
+static psa_status_t psa_verify_with_public_point(const psa_key_slot_t* slot,
+												 int input_is_message, psa_algorithm_t alg,
+												 const uint8_t* input, size_t input_length,
+												 const uint8_t* signature,
+												 size_t signature_length)
+{
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	size_t hash_length;
+	uint8_t hash[PSA_HASH_MAX_SIZE];
+
+	if(!input_is_message)
+		return (iotex_psa_ecdsa_verify_hash_with_point(slot, input, input_length, signature,
+														signature_length));
+
+	if(!PSA_ALG_IS_SIGN_HASH(alg))
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	status = psa_driver_wrapper_hash_compute(PSA_ALG_SIGN_GET_HASH(alg), input, input_length,
+											 hash, sizeof(hash), &hash_length);
+	if(status != PSA_SUCCESS)
+		return (status);
+
+	return (iotex_psa_ecdsa_verify_hash_with_point(slot, hash, hash_length, signature,
+												   signature_length));
+}
+	#endif /* IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED */
+
 static psa_status_t psa_verify_internal(psa_key_id_t key, int input_is_message, psa_algorithm_t alg,
 										const uint8_t* input, size_t input_length,
 										const uint8_t* signature, size_t signature_length)
@@ -2424,6 +2483,14 @@ static psa_status_t psa_verify_internal(psa_key_id_t key, int input_is_message,
 
 	psa_key_attributes_t attributes = {.core = slot->attr};
 
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	if(slot->ecc_public.valid && PSA_ALG_IS_ECDSA(alg))
+	{
+		status = psa_verify_with_public_point(slot, input_is_message, alg, input, input_length,
+											  signature, signature_length);
+	}
+	else
+	#endif
 	if(input_is_message)
 	{
 		status =
@@ -2617,6 +2684,206 @@ psa_status_t psa_verify_hash(psa_key_id_t key, psa_algorithm_t alg, const uint8_
 	return psa_verify_internal(key, 0, alg, hash, hash_length, signature, signature_length);
 }
 
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+		/* Number of items whose key slots are locked at the same time. */
+		#define PSA_VERIFY_HASH_BATCH_WINDOW 32
+
+/* Checks the policy for one item of a batch. An ECDSA signature with a cached
+ * public point is left for the batch, with its slot locked and returned in
+ * batch_slot; anything else is verified right away. */
+static psa_status_t psa_verify_hash_batch_item(const iotex_psa_verify_hash_batch_item_t* item,
+											   psa_key_slot_t** batch_slot)
+{
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
+	psa_key_slot_t* slot;
+
+	*batch_slot = NULL;
+
+	status = psa_sign_verify_check_alg(0, item->alg);
+	if(status != PSA_SUCCESS)
+		return status;
+
+	status = psa_get_and_lock_key_slot_with_policy(item->key, &slot, PSA_KEY_USAGE_VERIFY_HASH,
+												   item->alg);
+	if(status != PSA_SUCCESS)
+		return (status);
+
+	if(slot->ecc_public.valid && PSA_ALG_IS_ECDSA(item->alg))
+	{
+		*batch_slot = slot;
+		return (PSA_SUCCESS);
+	}
+
+	psa_key_attributes_t attributes = {.core = slot->attr};
+	status = psa_driver_wrapper_verify_hash(&attributes, slot->key.data, slot->key.bytes,
+											item->alg, item->hash, item->hash_length,
+											item->signature, item->signature_length);
+
+	unlock_status = psa_unlock_key_slot(slot);
+
+	return ((status == PSA_SUCCESS) ? unlock_status : status);
+}
+	#endif /* IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED */
+
+psa_status_t iotex_psa_verify_hash_batch(const iotex_psa_verify_hash_batch_item_t* items,
+										 size_t count, psa_status_t* results)
+{
+	size_t i;
+
+	if(count > 0 && (items == NULL || results == NULL))
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	psa_key_slot_t* slots[PSA_VERIFY_HASH_BATCH_WINDOW];
+	psa_status_t unlock_status;
+	size_t done, n;
+
+	for(done = 0; done < count; done += n)
+	{
+		n = count - done;
+		if(n > PSA_VERIFY_HASH_BATCH_WINDOW)
+			n = PSA_VERIFY_HASH_BATCH_WINDOW;
+
+		for(i = 0; i < n; i++)
+		{
+			results[done + i] = psa_verify_hash_batch_item(&items[done + i], &slots[i]);
+			/* A persistent key may find every free slot locked by this
+			 * window: finish the window and retry the item in the next. */
+			if(results[done + i] == PSA_ERROR_INSUFFICIENT_MEMORY && i > 0)
+			{
+				n = i;
+				break;
+			}
+		}
+
+		iotex_psa_ecdsa_verify_hash_batch_with_points(slots, items + done, n, results + done);
+
+		for(i = 0; i < n; i++)
+		{
+			if(slots[i] == NULL)
+				continue;
+			unlock_status = psa_unlock_key_slot(slots[i]);
+			if(results[done + i] == PSA_SUCCESS)
+				results[done + i] = unlock_status;
+		}
+	}
+	#else
+	for(i = 0; i < count; i++)
+		results[i] = psa_verify_hash(items[i].key, items[i].alg, items[i].hash,
+									 items[i].hash_length, items[i].signature,
+									 items[i].signature_length);
+	#endif
+
+	for(i = 0; i < count; i++)
+	{
+		if(results[i] != PSA_SUCCESS)
+			return (results[i]);
+	}
+
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_sign_hash_recoverable(psa_key_id_t key, psa_algorithm_t alg,
+											 const uint8_t* hash, size_t hash_length,
+											 uint8_t* signature, size_t signature_size,
+											 size_t* signature_length)
+{
+	#if defined(IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED)
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	psa_status_t unlock_status = PSA_ERROR_CORRUPTION_DETECTED;
+	psa_key_slot_t* slot = NULL;
+
+	*signature_length = 0;
+
+	status = psa_sign_verify_check_alg(0, alg);
+	if(status != PSA_SUCCESS)
+		return status;
+
+	if(!PSA_ALG_IS_ECDSA(alg))
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	if(signature_size == 0)
+		return (PSA_ERROR_BUFFER_TOO_SMALL);
+
+	status = psa_get_and_lock_key_slot_with_policy(key, &slot, PSA_KEY_USAGE_SIGN_HASH, alg);
+	if(status != PSA_SUCCESS)
+		goto exit;
+
+	if(!PSA_KEY_TYPE_IS_ECC_KEY_PAIR(slot->attr.type))
+	{
+		status = PSA_ERROR_INVALID_ARGUMENT;
+		goto exit;
+	}
+
+	/* The key material is only at hand for keys in local storage. */
+	if(PSA_KEY_LIFETIME_GET_LOCATION(slot->attr.lifetime) != PSA_KEY_LOCATION_LOCAL_STORAGE)
+	{
+		status = PSA_ERROR_NOT_SUPPORTED;
+		goto exit;
+	}
+
+	psa_key_attributes_t attributes = {.core = slot->attr};
+	status = iotex_psa_ecdsa_sign_hash_recoverable(&attributes, slot->key.data, slot->key.bytes,
+												   alg, hash, hash_length, signature,
+												   signature_size, signature_length);
+
+exit:
+	/* Same as psa_sign_internal(): never leave something that looks like a
+	 * signature in the buffer on error. */
+	if(status == PSA_SUCCESS)
+		memset(signature + *signature_length, '!', signature_size - *signature_length);
+	else
+		memset(signature, '!', signature_size);
+
+	unlock_status = psa_unlock_key_slot(slot);
+
+	return ((status == PSA_SUCCESS) ? unlock_status : status);
+	#else
+	(void)key;
+	(void)alg;
+	(void)hash;
+	(void)hash_length;
+	(void)signature;
+	(void)signature_size;
+	*signature_length = 0;
+	return (PSA_ERROR_NOT_SUPPORTED);
+	#endif /* IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED */
+}
+
+psa_status_t iotex_psa_recover_public_key(psa_ecc_family_t family, psa_algorithm_t alg,
+										  const uint8_t* hash, size_t hash_length,
+										  const uint8_t* signature, size_t signature_length,
+										  uint8_t* public_key, size_t public_key_size,
+										  size_t* public_key_length)
+{
+	psa_status_t status;
+
+	*public_key_length = 0;
+
+	status = psa_sign_verify_check_alg(0, alg);
+	if(status != PSA_SUCCESS)
+		return status;
+
+	if(!PSA_ALG_IS_ECDSA(alg))
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	#if defined(IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED)
+	return (iotex_psa_ecdsa_recover_public_key(family, hash, hash_length, signature,
+											   signature_length, public_key, public_key_size,
+											   public_key_length));
+	#else
+	(void)family;
+	(void)hash;
+	(void)hash_length;
+	(void)signature;
+	(void)signature_length;
+	(void)public_key;
+	(void)public_key_size;
+	return (PSA_ERROR_NOT_SUPPORTED);
+	#endif
+}
+
 psa_status_t psa_asymmetric_encrypt(psa_key_id_t key, psa_algorithm_t alg, const uint8_t* input,
 									size_t input_length, const uint8_t* salt, size_t salt_length,
 									uint8_t* output, size_t output_size, size_t* output_length)
@@ -5009,7 +5276,8 @@ psa_status_t psa_key_derivation_input_key(psa_key_derivation_operation_t* operat
 /* Key agreement */
 /****************************************************************/
 
-	#if defined(IOTEX_PSA_BUILTIN_ALG_ECDH)
+	#if defined(IOTEX_PSA_BUILTIN_ALG_ECDH) &&                                                     \
+		((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS))
 static psa_status_t psa_key_agreement_ecdh(const uint8_t* peer_key, size_t peer_key_length,
 										   const iotex_ecp_keypair* our_key, uint8_t* shared_secret,
 										   size_t shared_secret_size, size_t* shared_secret_length)
@@ -5050,7 +5318,7 @@ exit:
 
 	return (status);
 }
-	#endif /* IOTEX_PSA_BUILTIN_ALG_ECDH */
+	#endif /* IOTEX_PSA_BUILTIN_ALG_ECDH && CRYPTO_USE_MBEDTLS */
 
 	#define PSA_KEY_AGREEMENT_MAX_SHARED_SECRET_SIZE IOTEX_ECP_MAX_BYTES
 
@@ -5066,6 +5334,17 @@ static psa_status_t psa_key_agreement_raw_internal(psa_algorithm_t alg, psa_key_
 		case PSA_ALG_ECDH:
 			if(!PSA_KEY_TYPE_IS_ECC_KEY_PAIR(private_key->attr.type))
 				return (PSA_ERROR_INVALID_ARGUMENT);
+		#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+		{
+			psa_status_t status = iotex_ecdh_compute_shared_raw(
+				PSA_KEY_TYPE_ECC_GET_FAMILY(private_key->attr.type), private_key->key.data,
+				private_key->key.bytes, peer_key, peer_key_length, shared_secret,
+				shared_secret_size, shared_secret_length);
+			if(status != PSA_SUCCESS)
+				iotex_platform_zeroize(shared_secret, shared_secret_size);
+			return (status);
+		}
+		#else
 			iotex_ecp_keypair* ecp = NULL;
 			psa_status_t status = iotex_psa_ecp_load_representation(
 				private_key->attr.type, private_key->attr.bits, private_key->key.data,
@@ -5077,6 +5356,7 @@ static psa_status_t psa_key_agreement_raw_internal(psa_algorithm_t alg, psa_key_
 			iotex_ecp_keypair_free(ecp);
 			iotex_free(ecp);
 			return (status);
+		#endif
 	#endif /* IOTEX_PSA_BUILTIN_ALG_ECDH */
 		default:
 			(void)private_key;
@@ -5457,6 +5737,12 @@ psa_status_t psa_generate_key(const psa_key_attributes_t* attributes, psa_key_id
 			goto exit;
 	}
 
+	#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+	if(PSA_KEY_LIFETIME_IS_VOLATILE(attributes->core.lifetime) &&
+	   iotex_psa_ecp_ephemeral_pool_take(slot) == PSA_SUCCESS)
+		goto exit;
+	#endif
+
 	status = psa_driver_wrapper_generate_key(attributes, slot->key.data, slot->key.bytes,
 											 &slot->key.bytes);
 	if(status != PSA_SUCCESS)
@@ -5472,6 +5758,29 @@ exit:
 	return (status);
 }
 
+psa_status_t iotex_psa_ecc_ephemeral_pool_fill(psa_ecc_family_t family, size_t count)
+{
+	#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+	GUARD_MODULE_INITIALIZED;
+
+	return (iotex_psa_ecp_ephemeral_pool_fill(family, count));
+	#else
+	(void)family;
+	(void)count;
+	return (PSA_ERROR_NOT_SUPPORTED);
+	#endif
+}
+
+size_t iotex_psa_ecc_ephemeral_pool_count(psa_ecc_family_t family)
+{
+	#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+	return (iotex_psa_ecp_ephemeral_pool_count(family));
+	#else
+	(void)family;
+	return (0);
+	#endif
+}
+
 /****************************************************************/
 /* Module setup */
 /****************************************************************/
@@ -5492,6 +5801,14 @@ psa_status_t
 void iotex_psa_crypto_free(void)
 {
 	psa_wipe_all_key_slots();
+	iotex_psa_key_arena_release();
+	#if defined(IOTEX_PSA_BUILTIN_KEY_TYPE_AES)
+	/* Also the schedules of keys that never were in a key slot */
+	iotex_aes_key_cache_purge(NULL, 0);
+	#endif
+	#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+	iotex_psa_ecp_ephemeral_pool_wipe();
+	#endif
 	if(global_data.rng_state != RNG_NOT_INITIALIZED)
 	{
 		iotex_psa_random_free(&global_data.rng);
@@ -5598,6 +5915,9 @@ bool global_data_is_initialized(void)
 void reset_global_data(void)
 {
 	memset(&global_data, 0, sizeof(global_data));
+		#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+	iotex_psa_ecp_ephemeral_pool_wipe();
+		#endif
 }
 
 	#endif /* UNIT_TEST_BUILD */
@@ -1,6 +1,18 @@
+#include "include/common.h"
+
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#include "include/svc/crypto.h"
+#endif
+
 #include "include/iotex/ecdh.h"
 #include "include/iotex/error.h"
 
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	#include "include/tinycrypt/ecc.h"
+	#include "include/tinycrypt/ecc_dh.h"
+	#include "include/tinycrypt/utils.h"
+#endif
+
 void iotex_ecdh_free(iotex_ecdh_context* ctx)
 {
 	return;
@@ -8,7 +20,12 @@ void iotex_ecdh_free(iotex_ecdh_context* ctx)
 
 int iotex_ecdh_can_do(iotex_ecp_group_id gid)
 {
-	return IOTEX_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	return (gid == IOTEX_ECP_DP_SECP256R1 || gid == IOTEX_ECP_DP_SECP256K1);
+#else
+	(void)gid;
+	return 0;
+#endif
 }
 
 int iotex_ecdh_gen_public(iotex_ecp_group* grp, iotex_mpi* d, iotex_ecp_point* Q,
@@ -73,3 +90,48 @@ void iotex_ecdh_enable_restart(iotex_ecdh_context* ctx)
 {
 	return;
 }
+
+#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+int iotex_ecdh_compute_shared_raw(psa_ecc_family_t family, const uint8_t* key_buffer,
+								  size_t key_buffer_size, const uint8_t* peer_key,
+								  size_t peer_key_length, uint8_t* shared_secret,
+								  size_t shared_secret_size, size_t* shared_secret_length)
+{
+	uECC_Curve curve;
+
+	switch(family)
+	{
+		case PSA_ECC_FAMILY_SECP_R1:
+			curve = uECC_secp256r1();
+			break;
+		case PSA_ECC_FAMILY_SECP_K1:
+			curve = uECC_secp256k1();
+			break;
+		default:
+			return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if(key_buffer_size != NUM_ECC_BYTES)
+		return PSA_ERROR_CORRUPTION_DETECTED;
+
+	/* uECC_shared_secret() trusts its input, so reject anything that is not
+	 * a point of the curve before multiplying with our private value. */
+	if(peer_key_length != 1 + 2 * NUM_ECC_BYTES || peer_key[0] != 0x04)
+		return PSA_ERROR_INVALID_ARGUMENT;
+	if(uECC_valid_public_key(peer_key + 1, curve) != 0)
+		return PSA_ERROR_INVALID_ARGUMENT;
+
+	if(shared_secret_size < NUM_ECC_BYTES)
+		return PSA_ERROR_BUFFER_TOO_SMALL;
+
+	if(!uECC_shared_secret(peer_key + 1, key_buffer, shared_secret, curve))
+	{
+		_set_secure(shared_secret, 0, NUM_ECC_BYTES);
+		return PSA_ERROR_GENERIC_ERROR;
+	}
+
+	*shared_secret_length = NUM_ECC_BYTES;
+
+	return PSA_SUCCESS;
+}
+#endif
@@ -38,6 +38,31 @@
 	#include "include/iotex/ecp.h"
 	#include "include/iotex/error.h"
 
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+		#include "include/tinycrypt/ecc.h"
+		#include "include/tinycrypt/ecc_dh.h"
+		#include "include/tinycrypt/ecc_dsa.h"
+		#include "include/tinycrypt/ecc_platform_specific.h"
+
+/* The TinyCrypt curve for a key type and size, or NULL if it has none. A
+ * size of 0 stands for the only size TinyCrypt knows. */
+static uECC_Curve iotex_psa_ecp_tinycrypt_curve(psa_key_type_t type, size_t bits)
+{
+	if(bits != 0 && bits != PSA_BYTES_TO_BITS(NUM_ECC_BYTES))
+		return (NULL);
+
+	switch(PSA_KEY_TYPE_ECC_GET_FAMILY(type))
+	{
+		case PSA_ECC_FAMILY_SECP_R1:
+			return (uECC_secp256r1());
+		case PSA_ECC_FAMILY_SECP_K1:
+			return (uECC_secp256k1());
+		default:
+			return (NULL);
+	}
+}
+	#endif
+
 	#if defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_KEY_PAIR) ||                                        \
 		defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_PUBLIC_KEY) ||                                      \
 		defined(IOTEX_PSA_BUILTIN_ALG_ECDSA) ||                                                    \
@@ -186,13 +211,33 @@ exit:
 
 	return (status);
 		#else
+	uECC_Curve curve = iotex_psa_ecp_tinycrypt_curve(attributes->core.type, 0);
+
+	if(curve == NULL)
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	if(PSA_KEY_TYPE_IS_PUBLIC_KEY(attributes->core.type))
+	{
+		/* Only the uncompressed 0x04 || X || Y representation is supported. */
+		if(data_length != 1 + 2 * NUM_ECC_BYTES || data[0] != 0x04)
+			return (PSA_ERROR_INVALID_ARGUMENT);
+		if(uECC_valid_public_key(data + 1, curve) != 0)
+			return (PSA_ERROR_INVALID_ARGUMENT);
+	}
+	else if(data_length != NUM_ECC_BYTES)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
 	/* Copy the key material. */
 	memcpy(key_buffer, data, data_length);
 	*key_buffer_length = data_length;
+	*bits = PSA_BYTES_TO_BITS(NUM_ECC_BYTES);
 	(void)key_buffer_size;
 
-	iotex_ecp_calc_pub_key(PSA_KEY_TYPE_ECC_GET_FAMILY(attributes->core.type), key_buffer,
-						   data_length);
+			#if !defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	if(!PSA_KEY_TYPE_IS_PUBLIC_KEY(attributes->core.type))
+		iotex_ecp_calc_pub_key(PSA_KEY_TYPE_ECC_GET_FAMILY(attributes->core.type), key_buffer,
+							   data_length);
+			#endif
 
 	return (PSA_SUCCESS);
 		#endif
@@ -242,6 +287,30 @@ psa_status_t iotex_psa_ecp_export_public_key(const psa_key_attributes_t* attribu
 											 const uint8_t* key_buffer, size_t key_buffer_size,
 											 uint8_t* data, size_t data_size, size_t* data_length)
 {
+		#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	uECC_Curve curve = iotex_psa_ecp_tinycrypt_curve(attributes->core.type, attributes->core.bits);
+
+	if(curve == NULL)
+		return (PSA_ERROR_NOT_SUPPORTED);
+	if(data_size < 1 + 2 * NUM_ECC_BYTES)
+		return (PSA_ERROR_BUFFER_TOO_SMALL);
+
+	if(PSA_KEY_TYPE_IS_PUBLIC_KEY(attributes->core.type))
+	{
+		if(key_buffer_size != 1 + 2 * NUM_ECC_BYTES)
+			return (PSA_ERROR_CORRUPTION_DETECTED);
+		memcpy(data, key_buffer, key_buffer_size);
+	}
+	else
+	{
+		data[0] = 0x04;
+		if(!uECC_compute_public_key(key_buffer, data + 1, curve))
+			return (PSA_ERROR_CORRUPTION_DETECTED);
+	}
+	*data_length = 1 + 2 * NUM_ECC_BYTES;
+
+	return (PSA_SUCCESS);
+		#else
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
 	iotex_ecp_keypair* ecp = NULL;
 
@@ -259,6 +328,7 @@ psa_status_t iotex_psa_ecp_export_public_key(const psa_key_attributes_t* attribu
 	iotex_free(ecp);
 
 	return (status);
+		#endif
 }
 	#endif /* defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_KEY_PAIR) ||                                  \
 			* defined(IOTEX_PSA_BUILTIN_KEY_TYPE_ECC_PUBLIC_KEY) */
@@ -386,6 +456,21 @@ cleanup:
 	return (iotex_to_psa_error(ret));
 		#else
 
+	if(PSA_ALG_ECDSA_IS_DETERMINISTIC(alg))
+	{
+			#if defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA)
+		/* The TinyCrypt HMAC-DRBG that derives the nonce is HMAC-SHA-256 only */
+		if(PSA_ALG_SIGN_GET_HASH(alg) != PSA_ALG_SHA_256)
+			return PSA_ERROR_NOT_SUPPORTED;
+
+		return iotex_ecdsa_sign_det(PSA_KEY_TYPE_ECC_GET_FAMILY(attributes->core.type),
+									key_buffer, key_buffer_size, hash, hash_length, signature,
+									signature_length);
+			#else
+		return PSA_ERROR_NOT_SUPPORTED;
+			#endif /* defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) */
+	}
+
 	return iotex_ecdsa_sign(PSA_KEY_TYPE_ECC_GET_FAMILY(attributes->core.type), key_buffer,
 							key_buffer_size, hash, hash_length, signature, signature_length);
 
@@ -444,6 +529,22 @@ cleanup:
 
 	return (iotex_to_psa_error(ret));
 		#else
+	if(PSA_KEY_TYPE_IS_PUBLIC_KEY(attributes->core.type))
+	{
+		uECC_Curve curve =
+			iotex_psa_ecp_tinycrypt_curve(attributes->core.type, attributes->core.bits);
+
+		(void)alg;
+
+		if(curve == NULL || key_buffer_size != 1 + 2 * NUM_ECC_BYTES)
+			return (PSA_ERROR_NOT_SUPPORTED);
+		if(signature_length != 2 * NUM_ECC_BYTES ||
+		   !uECC_verify(key_buffer + 1, hash, hash_length, signature, curve))
+			return (PSA_ERROR_INVALID_SIGNATURE);
+
+		return (PSA_SUCCESS);
+	}
+
 	return iotex_ecdsa_verify(PSA_KEY_TYPE_ECC_GET_FAMILY(attributes->core.type), key_buffer,
 							  key_buffer_size, hash, hash_length, (uint8_t*)signature,
 							  signature_length);
@@ -453,4 +554,309 @@ cleanup:
 	#endif /* defined(IOTEX_PSA_BUILTIN_ALG_ECDSA) ||                                              \
 			* defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) */
 
+/****************************************************************/
+/* Public point cache */
+/****************************************************************/
+
+	#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+psa_status_t iotex_psa_ecp_cache_public_point(psa_key_slot_t* slot)
+{
+	uECC_Curve curve;
+
+	slot->ecc_public.valid = 0;
+
+	if(!PSA_KEY_TYPE_IS_ECC(slot->attr.type) ||
+	   PSA_KEY_LIFETIME_GET_LOCATION(slot->attr.lifetime) != PSA_KEY_LOCATION_LOCAL_STORAGE)
+		return (PSA_SUCCESS);
+
+	curve = iotex_psa_ecp_tinycrypt_curve(slot->attr.type, slot->attr.bits);
+	if(curve == NULL)
+		return (PSA_SUCCESS);
+
+	if(PSA_KEY_TYPE_IS_PUBLIC_KEY(slot->attr.type))
+	{
+		if(slot->key.bytes != 1 + 2 * NUM_ECC_BYTES || slot->key.data[0] != 0x04)
+			return (PSA_ERROR_INVALID_ARGUMENT);
+
+		uECC_vli_bytesToNative(slot->ecc_public.point, slot->key.data + 1, NUM_ECC_BYTES);
+		uECC_vli_bytesToNative(slot->ecc_public.point + NUM_ECC_WORDS,
+							   slot->key.data + 1 + NUM_ECC_BYTES, NUM_ECC_BYTES);
+		if(uECC_valid_point(slot->ecc_public.point, curve) != 0)
+			return (PSA_ERROR_INVALID_ARGUMENT);
+	}
+	else
+	{
+		if(slot->key.bytes != NUM_ECC_BYTES)
+			return (PSA_ERROR_INVALID_ARGUMENT);
+		if(!uECC_compute_public_point(slot->key.data, slot->ecc_public.point, curve))
+			return (PSA_ERROR_INVALID_ARGUMENT);
+	}
+
+	slot->ecc_public.valid = 1;
+
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_ecp_export_public_point(const psa_key_slot_t* slot, uint8_t* data,
+											   size_t data_size, size_t* data_length)
+{
+	if(data_size < 1 + 2 * NUM_ECC_BYTES)
+		return (PSA_ERROR_BUFFER_TOO_SMALL);
+
+	data[0] = 0x04;
+	uECC_vli_nativeToBytes(data + 1, NUM_ECC_BYTES, slot->ecc_public.point);
+	uECC_vli_nativeToBytes(data + 1 + NUM_ECC_BYTES, NUM_ECC_BYTES,
+						   slot->ecc_public.point + NUM_ECC_WORDS);
+	*data_length = 1 + 2 * NUM_ECC_BYTES;
+
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_ecdsa_verify_hash_with_point(const psa_key_slot_t* slot,
+													const uint8_t* hash, size_t hash_length,
+													const uint8_t* signature,
+													size_t signature_length)
+{
+	uECC_Curve curve = iotex_psa_ecp_tinycrypt_curve(slot->attr.type, slot->attr.bits);
+
+	if(signature_length != 2 * NUM_ECC_BYTES)
+		return (PSA_ERROR_INVALID_SIGNATURE);
+
+	if(!uECC_verify_native(slot->ecc_public.point, hash, hash_length, signature, curve))
+		return (PSA_ERROR_INVALID_SIGNATURE);
+
+	return (PSA_SUCCESS);
+}
+
+static void iotex_psa_ecdsa_verify_batch_flush(const uECC_VerifyItem* batch, const size_t* index,
+											   unsigned count, psa_status_t* results,
+											   uECC_Curve curve)
+{
+	int valid[uECC_VERIFY_BATCH_CHUNK];
+	unsigned i;
+
+	uECC_verify_batch_native(batch, count, valid, curve);
+	for(i = 0; i < count; i++)
+		results[index[i]] = valid[i] ? PSA_SUCCESS : PSA_ERROR_INVALID_SIGNATURE;
+}
+
+void iotex_psa_ecdsa_verify_hash_batch_with_points(psa_key_slot_t* const* slots,
+												   const iotex_psa_verify_hash_batch_item_t* items,
+												   size_t count, psa_status_t* results)
+{
+	const uECC_Curve curves[] = {uECC_secp256r1(), uECC_secp256k1()};
+	uECC_VerifyItem batch[uECC_VERIFY_BATCH_CHUNK];
+	size_t index[uECC_VERIFY_BATCH_CHUNK];
+	unsigned batched;
+	size_t c, i;
+
+	for(c = 0; c < sizeof(curves) / sizeof(curves[0]); c++)
+	{
+		batched = 0;
+		for(i = 0; i < count; i++)
+		{
+			if(slots[i] == NULL ||
+			   iotex_psa_ecp_tinycrypt_curve(slots[i]->attr.type, slots[i]->attr.bits) !=
+				   curves[c])
+				continue;
+
+			if(items[i].signature_length != 2 * NUM_ECC_BYTES)
+			{
+				results[i] = PSA_ERROR_INVALID_SIGNATURE;
+				continue;
+			}
+
+			batch[batched].public_point = slots[i]->ecc_public.point;
+			batch[batched].message_hash = items[i].hash;
+			batch[batched].hash_size = items[i].hash_length;
+			batch[batched].signature = items[i].signature;
+			index[batched] = i;
+			if(++batched == uECC_VERIFY_BATCH_CHUNK)
+			{
+				iotex_psa_ecdsa_verify_batch_flush(batch, index, batched, results, curves[c]);
+				batched = 0;
+			}
+		}
+		if(batched > 0)
+			iotex_psa_ecdsa_verify_batch_flush(batch, index, batched, results, curves[c]);
+	}
+}
+	#endif /* IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED */
+
+/****************************************************************/
+/* Ephemeral key pool */
+/****************************************************************/
+
+	#if defined(IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED)
+/* Key pairs generated ahead of time. Entries [0, count) are in use. */
+static struct
+{
+	struct
+	{
+		psa_ecc_family_t family;
+		uint8_t private_key[NUM_ECC_BYTES];
+		uECC_word_t point[2 * NUM_ECC_WORDS];
+	} entries[IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE];
+	size_t count;
+} ephemeral_pool;
+
+psa_status_t iotex_psa_ecp_ephemeral_pool_fill(psa_ecc_family_t family, size_t count)
+{
+	uECC_Curve curve = iotex_psa_ecp_tinycrypt_curve(PSA_KEY_TYPE_ECC_KEY_PAIR(family), 0);
+	uint8_t public_key[2 * NUM_ECC_BYTES];
+
+	if(curve == NULL)
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	while(count-- > 0 && ephemeral_pool.count < IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE)
+	{
+		size_t i = ephemeral_pool.count;
+
+		if(!uECC_make_key(public_key, ephemeral_pool.entries[i].private_key, curve))
+			return (PSA_ERROR_INSUFFICIENT_ENTROPY);
+
+		uECC_vli_bytesToNative(ephemeral_pool.entries[i].point, public_key, NUM_ECC_BYTES);
+		uECC_vli_bytesToNative(ephemeral_pool.entries[i].point + NUM_ECC_WORDS,
+							   public_key + NUM_ECC_BYTES, NUM_ECC_BYTES);
+		ephemeral_pool.entries[i].family = family;
+		ephemeral_pool.count++;
+	}
+
+	return (PSA_SUCCESS);
+}
+
+size_t iotex_psa_ecp_ephemeral_pool_count(psa_ecc_family_t family)
+{
+	size_t i, n = 0;
+
+	for(i = 0; i < ephemeral_pool.count; i++)
+		if(ephemeral_pool.entries[i].family == family)
+			n++;
+
+	return (n);
+}
+
+psa_status_t iotex_psa_ecp_ephemeral_pool_take(psa_key_slot_t* slot)
+{
+	psa_ecc_family_t family = PSA_KEY_TYPE_ECC_GET_FAMILY(slot->attr.type);
+	size_t i, last;
+
+	if(!PSA_KEY_TYPE_IS_ECC_KEY_PAIR(slot->attr.type) ||
+	   PSA_KEY_LIFETIME_GET_LOCATION(slot->attr.lifetime) != PSA_KEY_LOCATION_LOCAL_STORAGE ||
+	   iotex_psa_ecp_tinycrypt_curve(slot->attr.type, slot->attr.bits) == NULL ||
+	   slot->key.bytes != NUM_ECC_BYTES)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+
+	/* Take the newest entry of the curve and move the last one into its place. */
+	for(i = ephemeral_pool.count; i > 0; i--)
+		if(ephemeral_pool.entries[i - 1].family == family)
+			break;
+	if(i == 0)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	i--;
+
+	memcpy(slot->key.data, ephemeral_pool.entries[i].private_key, NUM_ECC_BYTES);
+	memcpy(slot->ecc_public.point, ephemeral_pool.entries[i].point,
+		   sizeof(slot->ecc_public.point));
+	slot->ecc_public.valid = 1;
+
+	last = --ephemeral_pool.count;
+	if(i != last)
+		memcpy(&ephemeral_pool.entries[i], &ephemeral_pool.entries[last],
+			   sizeof(ephemeral_pool.entries[i]));
+	iotex_platform_zeroize(&ephemeral_pool.entries[last], sizeof(ephemeral_pool.entries[last]));
+
+	return (PSA_SUCCESS);
+}
+
+void iotex_psa_ecp_ephemeral_pool_wipe(void)
+{
+	iotex_platform_zeroize(&ephemeral_pool, sizeof(ephemeral_pool));
+}
+	#endif /* IOTEX_PSA_ECC_EPHEMERAL_POOL_ENABLED */
+
+/****************************************************************/
+/* Recoverable ECDSA */
+/****************************************************************/
+
+	#if defined(IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED)
+psa_status_t iotex_psa_ecdsa_sign_hash_recoverable(const psa_key_attributes_t* attributes,
+												   const uint8_t* key_buffer,
+												   size_t key_buffer_size, psa_algorithm_t alg,
+												   const uint8_t* hash, size_t hash_length,
+												   uint8_t* signature, size_t signature_size,
+												   size_t* signature_length)
+{
+	uECC_Curve curve = iotex_psa_ecp_tinycrypt_curve(attributes->core.type, attributes->core.bits);
+	uint8_t recovery_id;
+	int ret;
+
+	if(curve == NULL || !PSA_ALG_IS_ECDSA(alg))
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	if(key_buffer_size != NUM_ECC_BYTES)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	if(signature_size < 2 * NUM_ECC_BYTES + 1)
+		return (PSA_ERROR_BUFFER_TOO_SMALL);
+
+	if(PSA_ALG_ECDSA_IS_DETERMINISTIC(alg))
+	{
+		#if defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA)
+		/* The TinyCrypt HMAC-DRBG that derives the nonce is HMAC-SHA-256 only */
+		if(PSA_ALG_SIGN_GET_HASH(alg) != PSA_ALG_SHA_256)
+			return (PSA_ERROR_NOT_SUPPORTED);
+
+		ret = uECC_sign_deterministic_recoverable(key_buffer, hash, hash_length, signature,
+												  &recovery_id, curve);
+		#else
+		return (PSA_ERROR_NOT_SUPPORTED);
+		#endif
+	}
+	else
+	{
+		#if defined(IOTEX_PSA_BUILTIN_ALG_ECDSA)
+		uECC_set_rng(&default_CSPRNG);
+		ret = uECC_sign_recoverable(key_buffer, hash, hash_length, signature, &recovery_id, curve);
+		#else
+		return (PSA_ERROR_NOT_SUPPORTED);
+		#endif
+	}
+
+	if(!ret)
+		return (PSA_ERROR_GENERIC_ERROR);
+
+	signature[2 * NUM_ECC_BYTES] = recovery_id;
+	*signature_length = 2 * NUM_ECC_BYTES + 1;
+
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_ecdsa_recover_public_key(psa_ecc_family_t family, const uint8_t* hash,
+												size_t hash_length, const uint8_t* signature,
+												size_t signature_length, uint8_t* data,
+												size_t data_size, size_t* data_length)
+{
+	uECC_Curve curve = iotex_psa_ecp_tinycrypt_curve(PSA_KEY_TYPE_ECC_PUBLIC_KEY(family), 0);
+
+	if(curve == NULL)
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	if(signature_length != 2 * NUM_ECC_BYTES + 1)
+		return (PSA_ERROR_INVALID_SIGNATURE);
+
+	if(data_size < 1 + 2 * NUM_ECC_BYTES)
+		return (PSA_ERROR_BUFFER_TOO_SMALL);
+
+	if(!uECC_recover_public_key(hash, hash_length, signature, signature[2 * NUM_ECC_BYTES],
+								data + 1, curve))
+		return (PSA_ERROR_INVALID_SIGNATURE);
+
+	data[0] = 0x04;
+	*data_length = 1 + 2 * NUM_ECC_BYTES;
+
+	return (PSA_SUCCESS);
+}
+	#endif /* IOTEX_PSA_ECDSA_RECOVERABLE_ENABLED */
+
 #endif /* IOTEX_PSA_CRYPTO_C */
@@ -13,7 +13,8 @@
 
 	#if defined(IOTEX_PSA_BUILTIN_ALG_RSA_PKCS1V15_SIGN) ||                                        \
 		defined(IOTEX_PSA_BUILTIN_ALG_RSA_OAEP) || defined(IOTEX_PSA_BUILTIN_ALG_RSA_PSS) ||       \
-		defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA)
+		(defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) &&                                      \
+		 ((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS)))
 const iotex_md_info_t* iotex_md_info_from_psa(psa_algorithm_t alg)
 {
 	switch(alg)
@@ -53,7 +54,7 @@ const iotex_md_info_t* iotex_md_info_from_psa(psa_algorithm_t alg)
 	#endif /* defined(IOTEX_PSA_BUILTIN_ALG_RSA_PKCS1V15_SIGN) ||                                  \
 			* defined(IOTEX_PSA_BUILTIN_ALG_RSA_OAEP) ||                                           \
 			* defined(IOTEX_PSA_BUILTIN_ALG_RSA_PSS) ||                                            \
-			* defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) */
+			* (defined(IOTEX_PSA_BUILTIN_ALG_DETERMINISTIC_ECDSA) && CRYPTO_USE_MBEDTLS) */
 
 	#if defined(IOTEX_PSA_BUILTIN_HASH)
 psa_status_t iotex_psa_hash_abort(iotex_psa_hash_operation_t* operation)
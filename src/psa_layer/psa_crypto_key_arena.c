@@ -0,0 +1,212 @@
+/*
+ *  Size-classed allocator for the key material held in key slots
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include "include/common.h"
+
+#include "include/iotex/platform.h"
+
+#if defined(IOTEX_PSA_CRYPTO_C)
+
+	#include "include/iotex/platform_util.h"
+	#include "include/svc/crypto/psa_crypto_key_arena.h"
+
+	#include <stdlib.h>
+	#include <string.h>
+	#if !defined(IOTEX_PLATFORM_C)
+		#define iotex_calloc calloc
+		#define iotex_free free
+	#endif
+
+	#define ARRAY_LENGTH(array) (sizeof(array) / sizeof(*(array)))
+
+/* Every block starts with its capacity, which keeps the key bytes 8-byte
+ * aligned and tells iotex_psa_key_arena_free() where the block goes back. */
+typedef union
+{
+	size_t capacity;
+	uint64_t align;
+} psa_key_arena_header_t;
+
+	/* Set in the capacity of blocks that came from the heap */
+	#define PSA_KEY_ARENA_HEAP ((size_t)1)
+
+/* Raw AES and HMAC keys, ECC private keys and public points fall into the
+ * first classes. */
+static const uint16_t size_classes[] = {16, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+
+	#define PSA_KEY_ARENA_CLASSES ARRAY_LENGTH(size_classes)
+
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+/* Pages come from the heap as the arena fills up, and go back all at once in
+ * iotex_psa_key_arena_release(). */
+typedef union psa_key_arena_page_u
+{
+	union psa_key_arena_page_u* next;
+	uint64_t align;
+} psa_key_arena_page_t;
+	#elif IOTEX_PSA_KEY_ARENA_SIZE > 0
+static uint64_t arena_storage[(IOTEX_PSA_KEY_ARENA_SIZE + 7) / 8];
+	#endif
+
+static struct
+{
+	/* Freed blocks of each class, linked through their first bytes */
+	psa_key_arena_header_t* free_blocks[PSA_KEY_ARENA_CLASSES];
+	uint8_t* bump;
+	size_t bump_left;
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	psa_key_arena_page_t* pages;
+	#endif
+	size_t reserved_bytes;
+	size_t used_bytes;
+	size_t heap_bytes;
+} arena;
+
+static uint8_t* psa_key_arena_heap_alloc(size_t size)
+{
+	psa_key_arena_header_t* header = iotex_calloc(1, sizeof(*header) + size);
+
+	if(header == NULL)
+		return (NULL);
+
+	header->capacity = (size << 1) | PSA_KEY_ARENA_HEAP;
+	arena.heap_bytes += size;
+	return ((uint8_t*)(header + 1));
+}
+
+/* Make room for a block of block_size bytes at the bump pointer. */
+static int psa_key_arena_refill(size_t block_size)
+{
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	size_t page_size = IOTEX_PSA_KEY_ARENA_SIZE;
+	psa_key_arena_page_t* page;
+
+	if(page_size == 0)
+		return (0);
+	if(page_size < block_size)
+		page_size = block_size;
+
+	page = iotex_calloc(1, sizeof(*page) + page_size);
+	if(page == NULL)
+		return (0);
+
+	page->next = arena.pages;
+	arena.pages = page;
+	arena.bump = (uint8_t*)(page + 1);
+	arena.bump_left = page_size;
+	arena.reserved_bytes += page_size;
+	return (1);
+	#elif IOTEX_PSA_KEY_ARENA_SIZE > 0
+	/* The static arena is used once, freed blocks are recycled by class */
+	if(arena.reserved_bytes != 0 || block_size > sizeof(arena_storage))
+		return (0);
+
+	arena.bump = (uint8_t*)arena_storage;
+	arena.bump_left = sizeof(arena_storage);
+	arena.reserved_bytes = sizeof(arena_storage);
+	return (1);
+	#else
+	(void)block_size;
+	return (0);
+	#endif
+}
+
+uint8_t* iotex_psa_key_arena_alloc(size_t size)
+{
+	psa_key_arena_header_t* header;
+	size_t cls, block_size;
+
+	for(cls = 0; cls < PSA_KEY_ARENA_CLASSES; cls++)
+	{
+		if(size <= size_classes[cls])
+			break;
+	}
+	if(cls == PSA_KEY_ARENA_CLASSES)
+		return (psa_key_arena_heap_alloc(size));
+
+	header = arena.free_blocks[cls];
+	if(header != NULL)
+	{
+		memcpy(&arena.free_blocks[cls], header + 1, sizeof(arena.free_blocks[0]));
+		memset(header + 1, 0, sizeof(psa_key_arena_header_t*));
+	}
+	else
+	{
+		block_size = sizeof(*header) + size_classes[cls];
+		if(arena.bump_left < block_size && !psa_key_arena_refill(block_size))
+			return (psa_key_arena_heap_alloc(size));
+
+		header = (psa_key_arena_header_t*)arena.bump;
+		arena.bump += block_size;
+		arena.bump_left -= block_size;
+	}
+
+	header->capacity = cls << 1;
+	arena.used_bytes += size_classes[cls];
+	return ((uint8_t*)(header + 1));
+}
+
+void iotex_psa_key_arena_free(uint8_t* data)
+{
+	psa_key_arena_header_t* header;
+	size_t cls;
+
+	if(data == NULL)
+		return;
+
+	header = (psa_key_arena_header_t*)data - 1;
+	if(header->capacity & PSA_KEY_ARENA_HEAP)
+	{
+		size_t size = header->capacity >> 1;
+		iotex_platform_zeroize(data, size);
+		arena.heap_bytes -= size;
+		iotex_free(header);
+		return;
+	}
+
+	cls = header->capacity >> 1;
+	iotex_platform_zeroize(data, size_classes[cls]);
+	memcpy(data, &arena.free_blocks[cls], sizeof(arena.free_blocks[0]));
+	arena.free_blocks[cls] = header;
+	arena.used_bytes -= size_classes[cls];
+}
+
+void iotex_psa_key_arena_release(void)
+{
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	while(arena.pages != NULL)
+	{
+		psa_key_arena_page_t* page = arena.pages;
+		arena.pages = page->next;
+		iotex_free(page);
+	}
+	#elif IOTEX_PSA_KEY_ARENA_SIZE > 0
+	iotex_platform_zeroize(arena_storage, sizeof(arena_storage));
+	#endif
+	memset(&arena, 0, sizeof(arena));
+}
+
+void iotex_psa_key_arena_get_stats(size_t* reserved_bytes, size_t* used_bytes,
+								   size_t* heap_bytes)
+{
+	*reserved_bytes = arena.reserved_bytes;
+	*used_bytes = arena.used_bytes;
+	*heap_bytes = arena.heap_bytes;
+}
+
+#endif /* IOTEX_PSA_CRYPTO_C */
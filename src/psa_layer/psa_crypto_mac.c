@@ -1,14 +1,410 @@
-#include "include/crypto/psa_crypto_mac.h"
+#include "include/common.h"
+
+#include "include/iotex/platform.h"
+
+#if defined(IOTEX_PSA_CRYPTO_C)
+
+	#include "include/svc/crypto.h"
+	#include "include/svc/crypto/psa_crypto_core.h"
+	#include "include/svc/crypto/psa_crypto_mac.h"
+
+	#include "include/iotex/platform_util.h"
+	#include <string.h>
+
+	#if defined(IOTEX_PSA_BUILTIN_ALG_HMAC) &&                                                     \
+		((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+		#define BUILTIN_ALG_HMAC_TINYCRYPT
+
+		#include "include/tinycrypt/hmac.h"
+	#endif
+
+	#if defined(IOTEX_PSA_BUILTIN_ALG_CMAC) &&                                                     \
+		((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+		#define BUILTIN_ALG_CMAC_TINYCRYPT
+
+		#include "include/tinycrypt/aes.h"
+		#include "include/tinycrypt/cmac_mode.h"
+	#endif
+
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT) || defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+		#include "include/tinycrypt/constants.h"
+
+		#if(IOTEX_PSA_MAC_KEY_CACHE_SIZE > 0)
+			#define BUILTIN_MAC_KEY_CACHE
+		#endif
+	#endif
+
+	#if defined(BUILTIN_MAC_KEY_CACHE)
+/*
+ * What recently used key slots derived for a MAC before seeing any data. A
+ * hit copies the state into the operation, so no operation ever references
+ * an entry and entries can be recycled at any time.
+ */
+typedef struct
+{
+	psa_key_id_t key; /* 0 marks a free entry */
+	psa_algorithm_t alg;
+	uint32_t last_use;
+	union
+	{
+		#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+		struct
+		{
+			struct tc_sha256_state_struct inner;
+			struct tc_sha256_state_struct outer;
+		} hmac;
+		#endif
+		#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+		struct
+		{
+			uint8_t K1[TC_AES_BLOCK_SIZE];
+			uint8_t K2[TC_AES_BLOCK_SIZE];
+			struct tc_aes_key_sched_struct sched;
+		} cmac;
+		#endif
+	} u;
+} mac_key_cache_entry_t;
+
+static mac_key_cache_entry_t mac_key_cache[IOTEX_PSA_MAC_KEY_CACHE_SIZE];
+static uint32_t mac_key_cache_clock = 0;
+
+static mac_key_cache_entry_t* mac_key_cache_find(psa_key_id_t key, psa_algorithm_t alg)
+{
+	size_t i;
+
+	/* Only keys held in a slot have an identifier, and only those are
+	 * wiped from the cache when they go away. */
+	if(key == 0)
+		return (NULL);
+
+	for(i = 0; i < IOTEX_PSA_MAC_KEY_CACHE_SIZE; i++)
+	{
+		if(mac_key_cache[i].key == key && mac_key_cache[i].alg == alg)
+		{
+			mac_key_cache[i].last_use = ++mac_key_cache_clock;
+			return (&mac_key_cache[i]);
+		}
+	}
+
+	return (NULL);
+}
+
+/* Returns the entry to fill in for the key, or NULL if it cannot be cached. */
+static mac_key_cache_entry_t* mac_key_cache_claim(psa_key_id_t key, psa_algorithm_t alg)
+{
+	mac_key_cache_entry_t* victim = &mac_key_cache[0];
+	size_t i;
+
+	if(key == 0)
+		return (NULL);
+
+	/* Take a free entry if there is one, the least recently used otherwise. */
+	for(i = 0; i < IOTEX_PSA_MAC_KEY_CACHE_SIZE && victim->key != 0; i++)
+	{
+		if(mac_key_cache[i].key == 0 || mac_key_cache[i].last_use < victim->last_use)
+			victim = &mac_key_cache[i];
+	}
+
+	victim->key = key;
+	victim->alg = alg;
+	victim->last_use = ++mac_key_cache_clock;
+
+	return (victim);
+}
+	#endif /* BUILTIN_MAC_KEY_CACHE */
+
+void iotex_psa_mac_key_cache_purge(psa_key_id_t key)
+{
+	#if defined(BUILTIN_MAC_KEY_CACHE)
+	size_t i;
+
+	if(key == 0)
+		return;
+
+	for(i = 0; i < IOTEX_PSA_MAC_KEY_CACHE_SIZE; i++)
+	{
+		if(mac_key_cache[i].key == key)
+			iotex_platform_zeroize(&mac_key_cache[i], sizeof(mac_key_cache[i]));
+	}
+	#else
+	(void)key;
+	#endif
+}
+
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+static psa_status_t psa_hmac_abort_internal(iotex_psa_hmac_operation_t* hmac)
+{
+	iotex_platform_zeroize(hmac, sizeof(*hmac));
+
+	return (PSA_SUCCESS);
+}
+
+static psa_status_t psa_hmac_setup_internal(iotex_psa_hmac_operation_t* hmac, psa_key_id_t key_id,
+											const uint8_t* key, size_t key_length,
+											psa_algorithm_t hash_alg)
+{
+	/* The key is zero-padded to the block size, so an empty key is the same
+	 * as a single zero byte. TinyCrypt refuses empty keys. */
+	static const uint8_t empty_key[1] = {0};
+	struct tc_hmac_state_struct state;
+		#if defined(BUILTIN_MAC_KEY_CACHE)
+	mac_key_cache_entry_t* entry;
+		#endif
+
+	if(hash_alg != PSA_ALG_SHA_256)
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+	hmac->alg = hash_alg;
+
+		#if defined(BUILTIN_MAC_KEY_CACHE)
+	entry = mac_key_cache_find(key_id, PSA_ALG_HMAC(hash_alg));
+	if(entry != NULL)
+	{
+		hmac->inner = entry->u.hmac.inner;
+		hmac->outer = entry->u.hmac.outer;
+		return (PSA_SUCCESS);
+	}
+		#else
+	(void)key_id;
+		#endif
+
+	if(key_length == 0)
+	{
+		key = empty_key;
+		key_length = sizeof(empty_key);
+	}
+
+	if(tc_hmac_set_key(&state, key, (unsigned int)key_length) != TC_CRYPTO_SUCCESS ||
+	   tc_hmac_init(&state) != TC_CRYPTO_SUCCESS)
+	{
+		iotex_platform_zeroize(&state, sizeof(state));
+		return (PSA_ERROR_CORRUPTION_DETECTED);
+	}
+
+	/* tc_hmac_init() has absorbed the inner pad. Absorb the outer pad now as
+	 * well instead of once per MAC in tc_hmac_final(). */
+	hmac->inner = state.hash_state;
+	(void)tc_sha256_init(&hmac->outer);
+	(void)tc_sha256_update(&hmac->outer, &state.key[TC_SHA256_BLOCK_SIZE], TC_SHA256_BLOCK_SIZE);
+	iotex_platform_zeroize(&state, sizeof(state));
+
+		#if defined(BUILTIN_MAC_KEY_CACHE)
+	entry = mac_key_cache_claim(key_id, PSA_ALG_HMAC(hash_alg));
+	if(entry != NULL)
+	{
+		entry->u.hmac.inner = hmac->inner;
+		entry->u.hmac.outer = hmac->outer;
+	}
+		#endif
+
+	return (PSA_SUCCESS);
+}
+
+static psa_status_t psa_hmac_update_internal(iotex_psa_hmac_operation_t* hmac, const uint8_t* data,
+											 size_t data_length)
+{
+	/* TinyCrypt rejects a NULL pointer even when there is nothing to hash. */
+	if(data_length == 0)
+		return (PSA_SUCCESS);
+
+	if(tc_sha256_update(&hmac->inner, data, data_length) != TC_CRYPTO_SUCCESS)
+		return (PSA_ERROR_CORRUPTION_DETECTED);
+
+	return (PSA_SUCCESS);
+}
+
+static psa_status_t psa_hmac_finish_internal(iotex_psa_hmac_operation_t* hmac, uint8_t* mac,
+											 size_t mac_size)
+{
+	uint8_t tmp[TC_SHA256_DIGEST_SIZE];
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+	if(mac_size > sizeof(tmp))
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	if(tc_sha256_final(tmp, &hmac->inner) != TC_CRYPTO_SUCCESS)
+		goto exit;
+
+	if(tc_sha256_update(&hmac->outer, tmp, sizeof(tmp)) != TC_CRYPTO_SUCCESS)
+		goto exit;
+
+	if(tc_sha256_final(tmp, &hmac->outer) != TC_CRYPTO_SUCCESS)
+		goto exit;
+
+	memcpy(mac, tmp, mac_size);
+	status = PSA_SUCCESS;
+
+exit:
+	iotex_platform_zeroize(tmp, sizeof(tmp));
+
+	return (status);
+}
+	#endif /* BUILTIN_ALG_HMAC_TINYCRYPT */
+
+	#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+static psa_status_t cmac_setup(iotex_psa_cmac_operation_t* cmac,
+							   const psa_key_attributes_t* attributes, const uint8_t* key_buffer,
+							   size_t key_buffer_size)
+{
+		#if defined(BUILTIN_MAC_KEY_CACHE)
+	mac_key_cache_entry_t* entry;
+		#endif
+
+	/* TinyCrypt only does AES-128. */
+	if(psa_get_key_type(attributes) != PSA_KEY_TYPE_AES || key_buffer_size != TC_AES_KEY_SIZE)
+		return (PSA_ERROR_NOT_SUPPORTED);
+
+		#if defined(BUILTIN_MAC_KEY_CACHE)
+	entry = mac_key_cache_find(psa_get_key_id(attributes), PSA_ALG_CMAC);
+	if(entry != NULL)
+	{
+		/* What tc_cmac_setup() would derive, without the key expansion and
+		 * the block encryption. */
+		memset(&cmac->cmac, 0, sizeof(cmac->cmac));
+		cmac->sched = entry->u.cmac.sched;
+		cmac->cmac.sched = &cmac->sched;
+		memcpy(cmac->cmac.K1, entry->u.cmac.K1, TC_AES_BLOCK_SIZE);
+		memcpy(cmac->cmac.K2, entry->u.cmac.K2, TC_AES_BLOCK_SIZE);
+		(void)tc_cmac_init(&cmac->cmac);
+		return (PSA_SUCCESS);
+	}
+		#endif
+
+	if(tc_cmac_setup(&cmac->cmac, key_buffer, &cmac->sched) != TC_CRYPTO_SUCCESS)
+		return (PSA_ERROR_CORRUPTION_DETECTED);
+
+		#if defined(BUILTIN_MAC_KEY_CACHE)
+	entry = mac_key_cache_claim(psa_get_key_id(attributes), PSA_ALG_CMAC);
+	if(entry != NULL)
+	{
+		entry->u.cmac.sched = cmac->sched;
+		memcpy(entry->u.cmac.K1, cmac->cmac.K1, TC_AES_BLOCK_SIZE);
+		memcpy(entry->u.cmac.K2, cmac->cmac.K2, TC_AES_BLOCK_SIZE);
+	}
+		#endif
+
+	return (PSA_SUCCESS);
+}
+
+static psa_status_t cmac_finish(iotex_psa_cmac_operation_t* cmac, uint8_t* mac, size_t mac_size)
+{
+	uint8_t tmp[TC_AES_BLOCK_SIZE];
+
+	/* Consistency check: requested MAC length fits the block size. */
+	if(mac_size > sizeof(tmp))
+		return (PSA_ERROR_CORRUPTION_DETECTED);
+
+	if(tc_cmac_final(tmp, &cmac->cmac) != TC_CRYPTO_SUCCESS)
+		return (PSA_ERROR_CORRUPTION_DETECTED);
+
+	memcpy(mac, tmp, mac_size);
+	iotex_platform_zeroize(tmp, sizeof(tmp));
+
+	return (PSA_SUCCESS);
+}
+	#endif /* BUILTIN_ALG_CMAC_TINYCRYPT */
+
+static psa_status_t mac_init(iotex_psa_mac_operation_t* operation, psa_algorithm_t alg)
+{
+	operation->alg = PSA_ALG_FULL_LENGTH_MAC(alg);
+
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+	if(PSA_ALG_IS_HMAC(operation->alg))
+	{
+		/* We'll set up the hash operation later in psa_hmac_setup_internal. */
+		operation->ctx.hmac.alg = 0;
+		return (PSA_SUCCESS);
+	}
+	#endif
+
+	#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+	if(PSA_ALG_FULL_LENGTH_MAC(alg) == PSA_ALG_CMAC)
+	{
+		memset(&operation->ctx.cmac, 0, sizeof(operation->ctx.cmac));
+		return (PSA_SUCCESS);
+	}
+	#endif
+
+	memset(operation, 0, sizeof(*operation));
+
+	return (PSA_ERROR_NOT_SUPPORTED);
+}
 
 psa_status_t iotex_psa_mac_abort(iotex_psa_mac_operation_t* operation)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	if(operation->alg == 0)
+	{
+		/* The object has (apparently) been initialized but it is not
+		 * in use. It's ok to call abort on such an object, and there's
+		 * nothing to do. */
+		return (PSA_SUCCESS);
+	}
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+	else if(PSA_ALG_IS_HMAC(operation->alg))
+	{
+		psa_hmac_abort_internal(&operation->ctx.hmac);
+	}
+	#endif
+	#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+	else if(operation->alg == PSA_ALG_CMAC)
+	{
+		iotex_platform_zeroize(&operation->ctx.cmac, sizeof(operation->ctx.cmac));
+	}
+	#endif
+	else
+	{
+		/* Sanity check (shouldn't happen: operation->alg should
+		 * always have been initialized to a valid value). */
+		memset(operation, 0, sizeof(*operation));
+		return (PSA_ERROR_BAD_STATE);
+	}
+
+	operation->alg = 0;
+
+	return (PSA_SUCCESS);
 }
 
-psa_status_t iotex_psa_mac_sign_finish(iotex_psa_mac_operation_t* operation, uint8_t* mac,
-									   size_t mac_size, size_t* mac_length)
+static psa_status_t psa_mac_setup(iotex_psa_mac_operation_t* operation,
+								  const psa_key_attributes_t* attributes,
+								  const uint8_t* key_buffer, size_t key_buffer_size,
+								  psa_algorithm_t alg)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+	/* A context must be freshly initialized before it can be set up. */
+	if(operation->alg != 0)
+		return (PSA_ERROR_BAD_STATE);
+
+	status = mac_init(operation, alg);
+	if(status != PSA_SUCCESS)
+		return (status);
+
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+	if(PSA_ALG_IS_HMAC(alg))
+	{
+		status = psa_hmac_setup_internal(&operation->ctx.hmac, psa_get_key_id(attributes),
+										 key_buffer, key_buffer_size, PSA_ALG_HMAC_GET_HASH(alg));
+	}
+	else
+	#endif
+	#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+		if(PSA_ALG_FULL_LENGTH_MAC(alg) == PSA_ALG_CMAC)
+	{
+		status = cmac_setup(&operation->ctx.cmac, attributes, key_buffer, key_buffer_size);
+	}
+	else
+	#endif
+	{
+		(void)attributes;
+		(void)key_buffer;
+		(void)key_buffer_size;
+		status = PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if(status != PSA_SUCCESS)
+		iotex_psa_mac_abort(operation);
+
+	return (status);
 }
 
 psa_status_t iotex_psa_mac_sign_setup(iotex_psa_mac_operation_t* operation,
@@ -16,27 +412,105 @@ psa_status_t iotex_psa_mac_sign_setup(iotex_psa_mac_operation_t* operation,
 									  const uint8_t* key_buffer, size_t key_buffer_size,
 									  psa_algorithm_t alg)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	return (psa_mac_setup(operation, attributes, key_buffer, key_buffer_size, alg));
+}
+
+psa_status_t iotex_psa_mac_verify_setup(iotex_psa_mac_operation_t* operation,
+										const psa_key_attributes_t* attributes,
+										const uint8_t* key_buffer, size_t key_buffer_size,
+										psa_algorithm_t alg)
+{
+	return (psa_mac_setup(operation, attributes, key_buffer, key_buffer_size, alg));
 }
 
 psa_status_t iotex_psa_mac_update(iotex_psa_mac_operation_t* operation, const uint8_t* input,
 								  size_t input_length)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	if(operation->alg == 0)
+		return (PSA_ERROR_BAD_STATE);
+
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+	if(PSA_ALG_IS_HMAC(operation->alg))
+		return (psa_hmac_update_internal(&operation->ctx.hmac, input, input_length));
+	#endif
+	#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+	if(operation->alg == PSA_ALG_CMAC)
+	{
+		if(tc_cmac_update(&operation->ctx.cmac.cmac, input, input_length) != TC_CRYPTO_SUCCESS)
+			return (PSA_ERROR_CORRUPTION_DETECTED);
+
+		return (PSA_SUCCESS);
+	}
+	#endif
+
+	/* This shouldn't happen if `operation` was initialized by
+	 * a setup function. */
+	(void)input;
+	(void)input_length;
+
+	return (PSA_ERROR_BAD_STATE);
+}
+
+static psa_status_t psa_mac_finish_internal(iotex_psa_mac_operation_t* operation, uint8_t* mac,
+											size_t mac_size)
+{
+	#if defined(BUILTIN_ALG_HMAC_TINYCRYPT)
+	if(PSA_ALG_IS_HMAC(operation->alg))
+		return (psa_hmac_finish_internal(&operation->ctx.hmac, mac, mac_size));
+	#endif
+	#if defined(BUILTIN_ALG_CMAC_TINYCRYPT)
+	if(operation->alg == PSA_ALG_CMAC)
+		return (cmac_finish(&operation->ctx.cmac, mac, mac_size));
+	#endif
+
+	/* This shouldn't happen if `operation` was initialized by
+	 * a setup function. */
+	(void)operation;
+	(void)mac;
+	(void)mac_size;
+
+	return (PSA_ERROR_BAD_STATE);
 }
 
-psa_status_t iotex_psa_mac_verify_finish(iotex_psa_mac_operation_t* operation, const uint8_t* mac,
-										 size_t mac_length)
+psa_status_t iotex_psa_mac_sign_finish(iotex_psa_mac_operation_t* operation, uint8_t* mac,
+									   size_t mac_size, size_t* mac_length)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+
+	if(operation->alg == 0)
+		return (PSA_ERROR_BAD_STATE);
+
+	status = psa_mac_finish_internal(operation, mac, mac_size);
+	if(status == PSA_SUCCESS)
+		*mac_length = mac_size;
+
+	return (status);
 }
 
-psa_status_t iotex_psa_mac_verify_setup(iotex_psa_mac_operation_t* operation,
-										const psa_key_attributes_t* attributes,
-										const uint8_t* key_buffer, size_t key_buffer_size,
-										psa_algorithm_t alg)
+psa_status_t iotex_psa_mac_verify_finish(iotex_psa_mac_operation_t* operation, const uint8_t* mac,
+										 size_t mac_length)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	uint8_t actual_mac[PSA_MAC_MAX_SIZE];
+
+	if(operation->alg == 0)
+		return (PSA_ERROR_BAD_STATE);
+
+	/* Consistency check: requested MAC length fits our local buffer */
+	if(mac_length > sizeof(actual_mac))
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	status = psa_mac_finish_internal(operation, actual_mac, mac_length);
+	if(status != PSA_SUCCESS)
+		goto cleanup;
+
+	if(iotex_psa_safer_memcmp(mac, actual_mac, mac_length) != 0)
+		status = PSA_ERROR_INVALID_SIGNATURE;
+
+cleanup:
+	iotex_platform_zeroize(actual_mac, sizeof(actual_mac));
+
+	return (status);
 }
 
 psa_status_t iotex_psa_mac_compute(const psa_key_attributes_t* attributes,
@@ -44,5 +518,28 @@ psa_status_t iotex_psa_mac_compute(const psa_key_attributes_t* attributes,
 								   psa_algorithm_t alg, const uint8_t* input, size_t input_length,
 								   uint8_t* mac, size_t mac_size, size_t* mac_length)
 {
-	return PSA_ERROR_NOT_SUPPORTED;
+	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
+	iotex_psa_mac_operation_t operation = IOTEX_PSA_MAC_OPERATION_INIT;
+
+	status = psa_mac_setup(&operation, attributes, key_buffer, key_buffer_size, alg);
+	if(status != PSA_SUCCESS)
+		goto exit;
+
+	if(input_length > 0)
+	{
+		status = iotex_psa_mac_update(&operation, input, input_length);
+		if(status != PSA_SUCCESS)
+			goto exit;
+	}
+
+	status = psa_mac_finish_internal(&operation, mac, mac_size);
+	if(status == PSA_SUCCESS)
+		*mac_length = mac_size;
+
+exit:
+	iotex_psa_mac_abort(&operation);
+
+	return (status);
 }
+
+#endif /* IOTEX_PSA_CRYPTO_C */
@@ -59,6 +59,7 @@
 	#elif((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
 
 		#include "include/tinycrypt/aes.h"
+		#include "include/tinycrypt/cmac_mode.h"
 		#include "include/tinycrypt/constants.h"
 		#include "include/tinycrypt/ctr_mode.h"
 		#include "include/tinycrypt/ecc.h"
@@ -79,8 +80,6 @@
 	#define ECP_CURVE25519_KEY_SIZE 32
 	#define ECP_CURVE448_KEY_SIZE 56
 
-struct tc_aes_key_sched_struct s;
-
 	/****************************************************************/
 	/* Static */
 	/****************************************************************/
@@ -370,10 +369,7 @@ inline int iotex_sha1(const unsigned char* input, size_t ilen, unsigned char out
 inline void iotex_sha256_init(iotex_sha256_context* ctx)
 {
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
-	ctx->sha256_ctx = malloc(sizeof(struct tc_sha256_state_struct));
-
-	if(ctx->sha256_ctx)
-		(void)tc_sha256_init((TCSha256State_t)ctx->sha256_ctx);
+	(void)tc_sha256_init(&ctx->sha256_ctx);
 	#endif
 
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS))
@@ -384,11 +380,10 @@ inline void iotex_sha256_init(iotex_sha256_context* ctx)
 inline void iotex_sha256_free(iotex_sha256_context* ctx)
 {
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
-	if(ctx->sha256_ctx)
-	{
-		free(ctx->sha256_ctx);
-		ctx->sha256_ctx = NULL;
-	}
+	if(ctx == NULL)
+		return;
+
+	iotex_platform_zeroize(ctx, sizeof(iotex_sha256_context));
 	#endif
 
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS))
@@ -399,15 +394,8 @@ inline void iotex_sha256_free(iotex_sha256_context* ctx)
 inline void iotex_sha256_clone(iotex_sha256_context* dst, const iotex_sha256_context* src)
 {
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
-	if(NULL == dst->sha256_ctx)
-		iotex_sha256_init(dst);
-
-	memcpy(dst, src, sizeof(iotex_sha256_context));
-	// Deep clone the sha256 context, which is dynamically allocated
-	// Otherwise, when aborting the source operation, the sha256 context of the destination will be
-	// freed.
-	dst->sha256_ctx = malloc(sizeof(struct tc_sha256_state_struct));
-	memcpy(dst->sha256_ctx, src->sha256_ctx, sizeof(struct tc_sha256_state_struct));
+	// The tinycrypt state lives inside the context, so a flat copy is a full clone.
+	*dst = *src;
 	#endif
 
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS))
@@ -420,6 +408,9 @@ inline int iotex_sha256_starts(iotex_sha256_context* ctx, int is224)
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_MBEDTLS))
 	return mbedtls_sha256_starts((mbedtls_sha256_context*)ctx, is224);
 	#else
+	(void)is224;
+	(void)tc_sha256_init(&ctx->sha256_ctx);
+
 	return 0;
 	#endif
 }
@@ -427,7 +418,7 @@ inline int iotex_sha256_starts(iotex_sha256_context* ctx, int is224)
 inline int iotex_sha256_update(iotex_sha256_context* ctx, const unsigned char* input, size_t ilen)
 {
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
-	(void)tc_sha256_update((TCSha256State_t)ctx->sha256_ctx, input, ilen);
+	(void)tc_sha256_update(&ctx->sha256_ctx, input, ilen);
 
 	return 0;
 	#endif
@@ -440,7 +431,7 @@ inline int iotex_sha256_update(iotex_sha256_context* ctx, const unsigned char* i
 inline int iotex_sha256_finish(iotex_sha256_context* ctx, unsigned char* output)
 {
 	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
-	(void)tc_sha256_final(output, (TCSha256State_t)ctx->sha256_ctx);
+	(void)tc_sha256_final(output, &ctx->sha256_ctx);
 
 	return 0;
 	#endif
@@ -591,13 +582,43 @@ inline int iotex_cipher_cmac_reset(iotex_cipher_context_t* ctx)
 	return 0;
 }
 
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+static int aes128_cmac(const unsigned char* key, const unsigned char* input, size_t ilen,
+					   unsigned char* output)
+{
+	struct tc_cmac_struct state;
+	struct tc_aes_key_sched_struct sched;
+	int ret = IOTEX_ERR_CIPHER_BAD_INPUT_DATA;
+
+	if(tc_cmac_setup(&state, key, &sched) == TC_CRYPTO_SUCCESS &&
+	   tc_cmac_update(&state, input, ilen) == TC_CRYPTO_SUCCESS &&
+	   tc_cmac_final(output, &state) == TC_CRYPTO_SUCCESS)
+		ret = 0;
+
+	iotex_platform_zeroize(&state, sizeof(state));
+	iotex_platform_zeroize(&sched, sizeof(sched));
+
+	return (ret);
+}
+	#endif
+
 inline int iotex_cipher_cmac(const iotex_cipher_info_t* cipher_info, const unsigned char* key,
 							 size_t keylen, const unsigned char* input, size_t ilen,
 							 unsigned char* output)
 {
+	#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	if(cipher_info == NULL || key == NULL || output == NULL)
+		return (IOTEX_ERR_CIPHER_BAD_INPUT_DATA);
+
+	if(cipher_info->type != IOTEX_CIPHER_AES_128_ECB || keylen != 128)
+		return (IOTEX_ERR_CIPHER_FEATURE_UNAVAILABLE);
+
+	return aes128_cmac(key, input, ilen, output);
+	#else
 	// TODO iotex_cipher_cmac( (iotex_cipher_info_t *)cipher_info, key, keylen, input, ilen, output
 	// );
 	return 0;
+	#endif
 }
 
 	#if defined(IOTEX_AES_C)
@@ -605,8 +626,30 @@ inline int iotex_aes_cmac_prf_128(const unsigned char* key, size_t key_len,
 								  const unsigned char* input, size_t in_len,
 								  unsigned char output[16])
 {
+		#if((IOTEX_PSA_CRYPTO_MODULE_USE) == (CRYPTO_USE_TINYCRYPO))
+	static const unsigned char zero_key[TC_AES_KEY_SIZE] = {0};
+	unsigned char int_key[TC_AES_KEY_SIZE];
+	int ret;
+
+	if(key == NULL || input == NULL || output == NULL)
+		return (IOTEX_ERR_CIPHER_BAD_INPUT_DATA);
+
+	/* RFC 4615: keys of any other length are first compressed with CMAC. */
+	if(key_len == TC_AES_KEY_SIZE)
+		memcpy(int_key, key, TC_AES_KEY_SIZE);
+	else if((ret = aes128_cmac(zero_key, key, key_len, int_key)) != 0)
+		goto exit;
+
+	ret = aes128_cmac(int_key, input, in_len, output);
+
+exit:
+	iotex_platform_zeroize(int_key, sizeof(int_key));
+
+	return (ret);
+		#else
 	// TODO iotex_aes_cmac_prf_128( key, key_len, input, in_len, output );
 	return 0;
+		#endif
 }
 	#endif /* IOTEX_AES_C */
 
@@ -1353,36 +1396,134 @@ inline void iotex_aes_free(iotex_aes_context* ctx)
 	iotex_platform_zeroize(ctx, sizeof(iotex_aes_context));
 }
 
-inline int iotex_aes_setkey_enc(iotex_aes_context* ctx, const unsigned char* key,
-								unsigned int keybits)
+	/* The key schedule of a context lives in its own buffer; an AES-256
+	 * schedule and its round count take 61 of the 68 words. */
+	#define AES_CTX_SCHED(ctx) ((TCAesKeySched_t)(ctx)->buf)
+
+	#if(IOTEX_AES_KEY_CACHE_SIZE > 0)
+/*
+ * Recently expanded key schedules. A hit copies the schedule into the
+ * caller's context, so no context ever references an entry and entries can
+ * be recycled at any time.
+ */
+typedef struct
 {
-	int ret = 0;
+	unsigned int keybits; /* 0 marks a free entry */
+	uint32_t last_use;
+	unsigned char key[TC_AES_MAX_KEY_SIZE];
+	struct tc_aes_key_sched_struct sched;
+} aes_key_cache_entry_t;
 
-	if(keybits != 128)
-		return PSA_ERROR_NOT_SUPPORTED;
+static aes_key_cache_entry_t aes_key_cache[IOTEX_AES_KEY_CACHE_SIZE];
+static uint32_t aes_key_cache_clock = 0;
 
-	ret = tc_aes128_set_encrypt_key(&s, key);
-	if(ret == 0)
-		return IOTEX_ERR_AES_INVALID_KEY_LENGTH;
+static aes_key_cache_entry_t* aes_key_cache_find(const unsigned char* key, unsigned int keybits)
+{
+	size_t i;
 
-	return 0;
+	for(i = 0; i < IOTEX_AES_KEY_CACHE_SIZE; i++)
+	{
+		aes_key_cache_entry_t* entry = &aes_key_cache[i];
+
+		if(entry->keybits == keybits &&
+		   iotex_psa_safer_memcmp(entry->key, key, keybits / 8) == 0)
+			return (entry);
+	}
+
+	return (NULL);
 }
 
-inline int iotex_aes_setkey_dec(iotex_aes_context* ctx, const unsigned char* key,
-								unsigned int keybits)
+static void aes_key_cache_insert(const unsigned char* key, unsigned int keybits,
+								 const struct tc_aes_key_sched_struct* sched)
 {
-	int ret = 0;
+	aes_key_cache_entry_t* victim = &aes_key_cache[0];
+	size_t i;
 
-	if(keybits != 128)
-		return PSA_ERROR_NOT_SUPPORTED;
+	/* Take a free entry if there is one, the least recently used otherwise. */
+	for(i = 0; i < IOTEX_AES_KEY_CACHE_SIZE && victim->keybits != 0; i++)
+	{
+		if(aes_key_cache[i].keybits == 0 || aes_key_cache[i].last_use < victim->last_use)
+			victim = &aes_key_cache[i];
+	}
 
-	ret = tc_aes128_set_decrypt_key(&s, key);
-	if(ret == 0)
+	victim->keybits = keybits;
+	victim->last_use = ++aes_key_cache_clock;
+	memcpy(victim->key, key, keybits / 8);
+	memcpy(&victim->sched, sched, sizeof(victim->sched));
+}
+	#endif /* IOTEX_AES_KEY_CACHE_SIZE > 0 */
+
+void iotex_aes_key_cache_purge(const unsigned char* key, unsigned int keybits)
+{
+	#if(IOTEX_AES_KEY_CACHE_SIZE > 0)
+	aes_key_cache_entry_t* entry;
+
+	if(key == NULL)
+	{
+		iotex_platform_zeroize(aes_key_cache, sizeof(aes_key_cache));
+		aes_key_cache_clock = 0;
+		return;
+	}
+
+	while((entry = aes_key_cache_find(key, keybits)) != NULL)
+		iotex_platform_zeroize(entry, sizeof(*entry));
+	#else
+	(void)key;
+	(void)keybits;
+	#endif
+}
+
+/*
+ * TinyCrypt runs the straightforward inverse cipher, so encryption and
+ * decryption share one key schedule.
+ */
+static int aes_setkey(iotex_aes_context* ctx, const unsigned char* key, unsigned int keybits)
+{
+	#if(IOTEX_AES_KEY_CACHE_SIZE > 0)
+	aes_key_cache_entry_t* entry;
+	#endif
+
+	if(ctx == NULL || key == NULL)
+		return (IOTEX_ERR_AES_BAD_INPUT_DATA);
+
+	if(keybits != 128 && keybits != 192 && keybits != 256)
+		return (IOTEX_ERR_AES_INVALID_KEY_LENGTH);
+
+	ctx->nr = keybits / 32 + 6;
+	ctx->rk = ctx->buf;
+
+	#if(IOTEX_AES_KEY_CACHE_SIZE > 0)
+	entry = aes_key_cache_find(key, keybits);
+	if(entry != NULL)
+	{
+		memcpy(AES_CTX_SCHED(ctx), &entry->sched, sizeof(entry->sched));
+		entry->last_use = ++aes_key_cache_clock;
+		return 0;
+	}
+	#endif
+
+	if(tc_aes_set_encrypt_key(AES_CTX_SCHED(ctx), key, keybits) != TC_CRYPTO_SUCCESS)
 		return IOTEX_ERR_AES_INVALID_KEY_LENGTH;
 
+	#if(IOTEX_AES_KEY_CACHE_SIZE > 0)
+	aes_key_cache_insert(key, keybits, AES_CTX_SCHED(ctx));
+	#endif
+
 	return 0;
 }
 
+inline int iotex_aes_setkey_enc(iotex_aes_context* ctx, const unsigned char* key,
+								unsigned int keybits)
+{
+	return aes_setkey(ctx, key, keybits);
+}
+
+inline int iotex_aes_setkey_dec(iotex_aes_context* ctx, const unsigned char* key,
+								unsigned int keybits)
+{
+	return aes_setkey(ctx, key, keybits);
+}
+
 inline int iotex_aes_crypt_ecb(iotex_aes_context* ctx, int mode, const unsigned char input[16],
 							   unsigned char output[16])
 {
@@ -1397,13 +1538,13 @@ inline int iotex_aes_crypt_ecb(iotex_aes_context* ctx, int mode, const unsigned
 
 	if(mode == IOTEX_AES_DECRYPT)
 	{
-		ret = tc_aes_decrypt(output, input, &s);
+		ret = tc_aes_decrypt(output, input, AES_CTX_SCHED(ctx));
 		if(ret != 1)
 			return IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
 	}
 	else
 	{
-		ret = tc_aes_encrypt(output, output, &s);
+		ret = tc_aes_encrypt(output, input, AES_CTX_SCHED(ctx));
 		if(ret != 1)
 			return IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
 	}
@@ -1435,7 +1576,7 @@ int iotex_aes_crypt_cbc(iotex_aes_context* ctx, int mode, size_t length, unsigne
 		while(length > 0)
 		{
 			memcpy(temp, input, 16);
-			ret = tc_aes_decrypt(output, input, &s);
+			ret = tc_aes_decrypt(output, input, AES_CTX_SCHED(ctx));
 			if(ret != 1)
 				goto exit;
 
@@ -1456,7 +1597,7 @@ int iotex_aes_crypt_cbc(iotex_aes_context* ctx, int mode, size_t length, unsigne
 			for(i = 0; i < 16; i++)
 				output[i] = (unsigned char)(input[i] ^ iv[i]);
 
-			ret = tc_aes_encrypt(output, output, &s);
+			ret = tc_aes_encrypt(output, output, AES_CTX_SCHED(ctx));
 			if(ret != 1)
 				goto exit;
 			memcpy(iv, output, 16);
@@ -1516,7 +1657,7 @@ inline int iotex_aes_crypt_ctr(iotex_aes_context* ctx, size_t length, size_t* nc
 							   unsigned char nonce_counter[16], unsigned char stream_block[16],
 							   const unsigned char* input, unsigned char* output)
 {
-	int ret = tc_ctr_mode(output, length, input, length, nonce_counter, &s);
+	int ret = tc_ctr_mode(output, length, input, length, nonce_counter, AES_CTX_SCHED(ctx));
 	if(ret == TC_CRYPTO_SUCCESS)
 	{
 		return 0;
@@ -1526,148 +1667,2364 @@ inline int iotex_aes_crypt_ctr(iotex_aes_context* ctx, size_t length, size_t* nc
 	#endif /* IOTEX_CIPHER_MODE_CTR */
 
 /****************************************************************/
-/* RSA */
+/* CCM */
 /****************************************************************/
-inline void iotex_rsa_init(iotex_rsa_context* ctx)
-{
-	// TODO iotex_rsa_init( (iotex_rsa_context *)ctx );
-}
+	#if defined(IOTEX_CCM_C)
 
-inline int iotex_rsa_set_padding(iotex_rsa_context* ctx, int padding, iotex_md_type_t hash_id)
-{
-	// TODO iotex_rsa_set_padding((iotex_rsa_context *)ctx, padding, hash_id );
-	return 0;
-}
+		#define CCM_STATE__CLEAR 0
+		#define CCM_STATE__STARTED (1 << 0)
+		#define CCM_STATE__LENGTHS_SET (1 << 1)
+		#define CCM_STATE__AUTH_DATA_STARTED (1 << 2)
+		#define CCM_STATE__AUTH_DATA_FINISHED (1 << 3)
+		#define CCM_STATE__ERROR (1 << 4)
 
-inline int iotex_rsa_import(iotex_rsa_context* ctx, const iotex_mpi* N, const iotex_mpi* P,
-							const iotex_mpi* Q, const iotex_mpi* D, const iotex_mpi* E)
+static void ccm_clear_state(iotex_ccm_context* ctx)
 {
-	// TODO iotex_rsa_import( (iotex_rsa_context *)ctx, (iotex_mpi *)N, (iotex_mpi *)P, (iotex_mpi
-	// *)Q, (iotex_mpi *)D, (iotex_mpi *)E );
-	return 0;
+	ctx->state = CCM_STATE__CLEAR;
+	memset(ctx->y, 0, 16);
+	memset(ctx->ctr, 0, 16);
 }
 
-inline int iotex_rsa_import_raw(iotex_rsa_context* ctx, unsigned char const* N, size_t N_len,
-								unsigned char const* P, size_t P_len, unsigned char const* Q,
-								size_t Q_len, unsigned char const* D, size_t D_len,
-								unsigned char const* E, size_t E_len)
+void iotex_ccm_init(iotex_ccm_context* ctx)
 {
-	// TODO iotex_rsa_import_raw( (iotex_rsa_context *)ctx, N, N_len, P, P_len, Q, Q_len, D, D_len,
-	// E, E_len );
-	return 0;
-}
+	if(ctx == NULL)
+		return;
 
-inline int iotex_rsa_complete(iotex_rsa_context* ctx)
-{
-	// TODO iotex_rsa_complete( (iotex_rsa_context *)ctx );
-	return 0;
+	memset(ctx, 0, sizeof(iotex_ccm_context));
 }
 
-inline int iotex_rsa_export(const iotex_rsa_context* ctx, iotex_mpi* N, iotex_mpi* P, iotex_mpi* Q,
-							iotex_mpi* D, iotex_mpi* E)
+int iotex_ccm_setkey(iotex_ccm_context* ctx, iotex_cipher_id_t cipher, const unsigned char* key,
+					 unsigned int keybits)
 {
-	// TODO iotex_rsa_export( (iotex_rsa_context *)ctx,
-	//                    (iotex_mpi *)N, (iotex_mpi *)P, (iotex_mpi *)Q, (iotex_mpi *)D, (iotex_mpi
-	//                    *)E );
-	return 0;
-}
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
 
-inline int iotex_rsa_export_raw(const iotex_rsa_context* ctx, unsigned char* N, size_t N_len,
-								unsigned char* P, size_t P_len, unsigned char* Q, size_t Q_len,
-								unsigned char* D, size_t D_len, unsigned char* E, size_t E_len)
-{
-	// TODO iotex_rsa_export_raw( (iotex_rsa_context *)ctx, N, N_len, P, P_len, Q, Q_len, D, D_len,
-	// E, E_len );
-	return 0;
-}
+	if(ctx == NULL || key == NULL)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
 
-inline int iotex_rsa_export_crt(const iotex_rsa_context* ctx, iotex_mpi* DP, iotex_mpi* DQ,
-								iotex_mpi* QP)
-{
-	// TODO iotex_rsa_export_crt( (iotex_rsa_context *)ctx,
-	//                        (iotex_mpi *)DP, (iotex_mpi *)DQ, (iotex_mpi *)QP );
-	return 0;
-}
+	/* TinyCrypt only provides the AES block cipher. */
+	if(cipher != IOTEX_CIPHER_ID_AES)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
 
-inline size_t iotex_rsa_get_len(const iotex_rsa_context* ctx)
-{
-	// TODO iotex_rsa_get_len( (iotex_rsa_context *)ctx );
-	return 0;
-}
+	iotex_aes_free(&ctx->aes);
+	iotex_aes_init(&ctx->aes);
+	if((ret = iotex_aes_setkey_enc(&ctx->aes, key, keybits)) != 0)
+		return (ret);
 
-inline int iotex_rsa_gen_key(iotex_rsa_context* ctx, int (*f_rng)(void*, unsigned char*, size_t),
-							 void* p_rng, unsigned int nbits, int exponent)
-{
-	// TODO iotex_rsa_gen_key( (iotex_rsa_context *)ctx, f_rng, p_rng, nbits, exponent );
-	return 0;
-}
+	ccm_clear_state(ctx);
 
-inline int iotex_rsa_check_pubkey(const iotex_rsa_context* ctx)
-{
-	// TODO iotex_rsa_check_pubkey( (iotex_rsa_context *)ctx );
-	return 0;
+	return (0);
 }
 
-inline int iotex_rsa_check_privkey(const iotex_rsa_context* ctx)
+void iotex_ccm_free(iotex_ccm_context* ctx)
 {
-	// TODO iotex_rsa_check_privkey( (iotex_rsa_context *)ctx );
-	return 0;
-}
+	if(ctx == NULL)
+		return;
 
-inline int iotex_rsa_check_pub_priv(const iotex_rsa_context* pub, const iotex_rsa_context* prv)
-{
-	// TODO iotex_rsa_check_pub_priv( (iotex_rsa_context *)pub, (iotex_rsa_context *)prv );
-	return 0;
+	iotex_aes_free(&ctx->aes);
+	iotex_platform_zeroize(ctx, sizeof(iotex_ccm_context));
 }
 
-inline int iotex_rsa_public(iotex_rsa_context* ctx, const unsigned char* input,
-							unsigned char* output)
+/*
+ * Encrypt or decrypt a partial block with CTR. The keystream block is
+ * derived from the current counter, which the caller advances once a whole
+ * block has been consumed.
+ */
+static int ccm_crypt(iotex_ccm_context* ctx, size_t offset, size_t use_len,
+					 const unsigned char* input, unsigned char* output)
 {
-	// TODO iotex_rsa_public( (iotex_rsa_context *)ctx,  input, output );
-	return 0;
-}
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char tmp_buf[16];
+	size_t i;
 
-inline int iotex_rsa_private(iotex_rsa_context* ctx, int (*f_rng)(void*, unsigned char*, size_t),
-							 void* p_rng, const unsigned char* input, unsigned char* output)
-{
-	// TODO iotex_rsa_private( (iotex_rsa_context *)ctx, f_rng, p_rng, input, output );
-	return 0;
+	if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->ctr, tmp_buf)) != 0)
+	{
+		ctx->state |= CCM_STATE__ERROR;
+		iotex_platform_zeroize(tmp_buf, sizeof(tmp_buf));
+		return (ret);
+	}
+
+	for(i = 0; i < use_len; i++)
+		output[i] = input[i] ^ tmp_buf[offset + i];
+
+	iotex_platform_zeroize(tmp_buf, sizeof(tmp_buf));
+	return (0);
 }
 
-inline int iotex_rsa_pkcs1_encrypt(iotex_rsa_context* ctx,
-								   int (*f_rng)(void*, unsigned char*, size_t), void* p_rng,
-								   size_t ilen, const unsigned char* input, unsigned char* output)
+static int ccm_calculate_first_block_if_ready(iotex_ccm_context* ctx)
 {
-	// TODO iotex_rsa_pkcs1_encrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, ilen, input, output );
-	return 0;
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char i;
+	size_t len_left;
+
+	/* B_0 needs both the nonce and the lengths, which may come in either
+	 * order. */
+	if(!(ctx->state & CCM_STATE__STARTED) || !(ctx->state & CCM_STATE__LENGTHS_SET))
+		return (0);
+
+	/* CCM expects a non-empty tag. CCM* allows an empty tag, in which case
+	 * the plaintext length is irrelevant. */
+	if(ctx->tag_len == 0)
+	{
+		if(ctx->mode == IOTEX_CCM_STAR_ENCRYPT || ctx->mode == IOTEX_CCM_STAR_DECRYPT)
+			ctx->plaintext_len = 0;
+		else
+			return (IOTEX_ERR_CCM_BAD_INPUT);
+	}
+
+	/*
+	 * First block B_0:
+	 * 0        .. 0        flags
+	 * 1        .. iv_len   nonce - set by iotex_ccm_starts()
+	 * iv_len+1 .. 15       length
+	 *
+	 * With flags as (bits):
+	 * 7        0
+	 * 6        add present?
+	 * 5 .. 3   (t - 2) / 2
+	 * 2 .. 0   q - 1
+	 */
+	ctx->y[0] |= (ctx->add_len > 0) << 6;
+	ctx->y[0] |= ((ctx->tag_len - 2) / 2) << 3;
+	ctx->y[0] |= ctx->q - 1;
+
+	for(i = 0, len_left = ctx->plaintext_len; i < ctx->q; i++, len_left >>= 8)
+		ctx->y[15 - i] = (unsigned char)(len_left & 0xFF);
+
+	if(len_left > 0)
+	{
+		ctx->state |= CCM_STATE__ERROR;
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+	}
+
+	/* Start CBC-MAC with the first block. */
+	if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->y, ctx->y)) != 0)
+	{
+		ctx->state |= CCM_STATE__ERROR;
+		return (ret);
+	}
+
+	return (0);
 }
 
-inline int iotex_rsa_rsaes_pkcs1_v15_encrypt(iotex_rsa_context* ctx,
-											 int (*f_rng)(void*, unsigned char*, size_t),
-											 void* p_rng, size_t ilen, const unsigned char* input,
-											 unsigned char* output)
+int iotex_ccm_starts(iotex_ccm_context* ctx, int mode, const unsigned char* iv, size_t iv_len)
 {
-	// TODO iotex_rsa_rsaes_pkcs1_v15_encrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, ilen, input,
-	// output );
-	return 0;
+	if(ctx == NULL || iv == NULL)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	/* Also implies q is within bounds */
+	if(iv_len < 7 || iv_len > 13)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	ctx->mode = mode;
+	ctx->q = 16 - 1 - (unsigned char)iv_len;
+
+	/*
+	 * Prepare counter block for encryption:
+	 * 0        .. 0        flags
+	 * 1        .. iv_len   nonce
+	 * iv_len+1 .. 15       counter (initially 1)
+	 *
+	 * With flags as (bits):
+	 * 7 .. 3   0
+	 * 2 .. 0   q - 1
+	 */
+	memset(ctx->ctr, 0, 16);
+	ctx->ctr[0] = ctx->q - 1;
+	memcpy(ctx->ctr + 1, iv, iv_len);
+	ctx->ctr[15] = 1;
+
+	/* See ccm_calculate_first_block_if_ready() for the block layout. */
+	memcpy(ctx->y + 1, iv, iv_len);
+
+	ctx->state |= CCM_STATE__STARTED;
+	return (ccm_calculate_first_block_if_ready(ctx));
 }
 
-inline int iotex_rsa_rsaes_oaep_encrypt(iotex_rsa_context* ctx,
-										int (*f_rng)(void*, unsigned char*, size_t), void* p_rng,
-										const unsigned char* label, size_t label_len, size_t ilen,
-										const unsigned char* input, unsigned char* output)
+int iotex_ccm_set_lengths(iotex_ccm_context* ctx, size_t total_ad_len, size_t plaintext_len,
+						  size_t tag_len)
 {
-	// TODO iotex_rsa_rsaes_oaep_encrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, label, label_len,
-	// ilen, input, output );
-	return 0;
+	if(ctx == NULL)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	/*
+	 * Check length requirements: SP800-38C A.1
+	 * Additional requirement: a < 2^16 - 2^8 to simplify the code.
+	 * 'length' checked later (when writing it to the first block)
+	 *
+	 * Also, loosen the requirements to enable support for CCM* (IEEE 802.15.4).
+	 */
+	if(tag_len == 2 || tag_len > 16 || tag_len % 2 != 0)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(total_ad_len >= 0xFF00)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	ctx->plaintext_len = plaintext_len;
+	ctx->add_len = total_ad_len;
+	ctx->tag_len = tag_len;
+	ctx->processed = 0;
+
+	ctx->state |= CCM_STATE__LENGTHS_SET;
+	return (ccm_calculate_first_block_if_ready(ctx));
 }
 
-inline int iotex_rsa_pkcs1_decrypt(iotex_rsa_context* ctx,
-								   int (*f_rng)(void*, unsigned char*, size_t), void* p_rng,
-								   size_t* olen, const unsigned char* input, unsigned char* output,
-								   size_t output_max_len)
+int iotex_ccm_update_ad(iotex_ccm_context* ctx, const unsigned char* add, size_t add_len)
 {
-	// TODO iotex_rsa_pkcs1_decrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, olen, input, output,
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	size_t use_len, offset, i;
+
+	if(ctx == NULL || (add_len > 0 && add == NULL))
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(ctx->state & CCM_STATE__ERROR)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(add_len > 0)
+	{
+		if(ctx->state & CCM_STATE__AUTH_DATA_FINISHED)
+			return (IOTEX_ERR_CCM_BAD_INPUT);
+
+		if(!(ctx->state & CCM_STATE__AUTH_DATA_STARTED))
+		{
+			if(add_len > ctx->add_len)
+				return (IOTEX_ERR_CCM_BAD_INPUT);
+
+			ctx->y[0] ^= (unsigned char)((ctx->add_len >> 8) & 0xFF);
+			ctx->y[1] ^= (unsigned char)((ctx->add_len) & 0xFF);
+
+			ctx->state |= CCM_STATE__AUTH_DATA_STARTED;
+		}
+		else if(ctx->processed + add_len > ctx->add_len)
+			return (IOTEX_ERR_CCM_BAD_INPUT);
+
+		while(add_len > 0)
+		{
+			/* Account for y[0] and y[1], which hold the encoded length. */
+			offset = (ctx->processed + 2) % 16;
+
+			use_len = 16 - offset;
+			if(use_len > add_len)
+				use_len = add_len;
+
+			for(i = 0; i < use_len; i++)
+				ctx->y[offset + i] ^= add[i];
+
+			ctx->processed += use_len;
+			add_len -= use_len;
+			add += use_len;
+
+			if(use_len + offset == 16 || ctx->processed == ctx->add_len)
+			{
+				if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->y, ctx->y)) != 0)
+				{
+					ctx->state |= CCM_STATE__ERROR;
+					return (ret);
+				}
+			}
+		}
+
+		if(ctx->processed == ctx->add_len)
+		{
+			ctx->state |= CCM_STATE__AUTH_DATA_FINISHED;
+			ctx->processed = 0; /* prepare for iotex_ccm_update() */
+		}
+	}
+
+	return (0);
+}
+
+int iotex_ccm_update(iotex_ccm_context* ctx, const unsigned char* input, size_t input_len,
+					 unsigned char* output, size_t output_size, size_t* output_len)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char i;
+	size_t use_len, offset, j;
+	unsigned char local_output[16];
+
+	if(ctx == NULL || output_len == NULL)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(input_len > 0 && (input == NULL || output == NULL))
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(ctx->state & CCM_STATE__ERROR)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	/* Check against plaintext length only if performing operation with
+	 * authentication. */
+	if(ctx->tag_len != 0 && ctx->processed + input_len > ctx->plaintext_len)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(output_size < input_len)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+	*output_len = input_len;
+
+	ret = 0;
+
+	while(input_len > 0)
+	{
+		offset = ctx->processed % 16;
+
+		use_len = 16 - offset;
+		if(use_len > input_len)
+			use_len = input_len;
+
+		ctx->processed += use_len;
+
+		if(ctx->mode == IOTEX_CCM_ENCRYPT || ctx->mode == IOTEX_CCM_STAR_ENCRYPT)
+		{
+			for(j = 0; j < use_len; j++)
+				ctx->y[offset + j] ^= input[j];
+
+			if(use_len + offset == 16 || ctx->processed == ctx->plaintext_len)
+			{
+				if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->y, ctx->y)) != 0)
+				{
+					ctx->state |= CCM_STATE__ERROR;
+					goto exit;
+				}
+			}
+
+			if((ret = ccm_crypt(ctx, offset, use_len, input, output)) != 0)
+				goto exit;
+		}
+
+		if(ctx->mode == IOTEX_CCM_DECRYPT || ctx->mode == IOTEX_CCM_STAR_DECRYPT)
+		{
+			/* The output buffer may be shared with the input, so the MAC is
+			 * fed from a local copy of the plaintext. */
+			if((ret = ccm_crypt(ctx, offset, use_len, input, local_output)) != 0)
+				goto exit;
+
+			for(j = 0; j < use_len; j++)
+				ctx->y[offset + j] ^= local_output[j];
+
+			memcpy(output, local_output, use_len);
+
+			if(use_len + offset == 16 || ctx->processed == ctx->plaintext_len)
+			{
+				if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->y, ctx->y)) != 0)
+				{
+					ctx->state |= CCM_STATE__ERROR;
+					goto exit;
+				}
+			}
+		}
+
+		if(use_len + offset == 16 || ctx->processed == ctx->plaintext_len)
+		{
+			for(i = 0; i < ctx->q; i++)
+				if(++(ctx->ctr)[15 - i] != 0)
+					break;
+		}
+
+		input_len -= use_len;
+		input += use_len;
+		output += use_len;
+	}
+
+exit:
+	iotex_platform_zeroize(local_output, 16);
+
+	return (ret);
+}
+
+int iotex_ccm_finish(iotex_ccm_context* ctx, unsigned char* tag, size_t tag_len)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char i;
+
+	if(ctx == NULL)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(ctx->state & CCM_STATE__ERROR)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(ctx->add_len > 0 && !(ctx->state & CCM_STATE__AUTH_DATA_FINISHED))
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	if(ctx->plaintext_len > 0 && ctx->processed != ctx->plaintext_len)
+		return (IOTEX_ERR_CCM_BAD_INPUT);
+
+	/* Authentication: reset counter and crypt/mask internal tag */
+	for(i = 0; i < ctx->q; i++)
+		ctx->ctr[15 - i] = 0;
+
+	if((ret = ccm_crypt(ctx, 0, 16, ctx->y, ctx->y)) != 0)
+		return (ret);
+
+	if(tag != NULL)
+		memcpy(tag, ctx->y, tag_len);
+
+	ccm_clear_state(ctx);
+
+	return (0);
+}
+
+/*
+ * Authenticated encryption or decryption
+ */
+static int ccm_auth_crypt(iotex_ccm_context* ctx, int mode, size_t length, const unsigned char* iv,
+						  size_t iv_len, const unsigned char* add, size_t add_len,
+						  const unsigned char* input, unsigned char* output, unsigned char* tag,
+						  size_t tag_len)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	size_t olen;
+
+	if((ret = iotex_ccm_starts(ctx, mode, iv, iv_len)) != 0)
+		return (ret);
+
+	if((ret = iotex_ccm_set_lengths(ctx, add_len, length, tag_len)) != 0)
+		return (ret);
+
+	if((ret = iotex_ccm_update_ad(ctx, add, add_len)) != 0)
+		return (ret);
+
+	if((ret = iotex_ccm_update(ctx, input, length, output, length, &olen)) != 0)
+		return (ret);
+
+	if((ret = iotex_ccm_finish(ctx, tag, tag_len)) != 0)
+		return (ret);
+
+	return (0);
+}
+
+int iotex_ccm_star_encrypt_and_tag(iotex_ccm_context* ctx, size_t length, const unsigned char* iv,
+								   size_t iv_len, const unsigned char* add, size_t add_len,
+								   const unsigned char* input, unsigned char* output,
+								   unsigned char* tag, size_t tag_len)
+{
+	return (ccm_auth_crypt(ctx, IOTEX_CCM_STAR_ENCRYPT, length, iv, iv_len, add, add_len, input,
+						   output, tag, tag_len));
+}
+
+int iotex_ccm_encrypt_and_tag(iotex_ccm_context* ctx, size_t length, const unsigned char* iv,
+							  size_t iv_len, const unsigned char* add, size_t add_len,
+							  const unsigned char* input, unsigned char* output, unsigned char* tag,
+							  size_t tag_len)
+{
+	return (ccm_auth_crypt(ctx, IOTEX_CCM_ENCRYPT, length, iv, iv_len, add, add_len, input, output,
+						   tag, tag_len));
+}
+
+/*
+ * Authenticated decryption
+ */
+static int ccm_auth_decrypt(iotex_ccm_context* ctx, int mode, size_t length,
+							const unsigned char* iv, size_t iv_len, const unsigned char* add,
+							size_t add_len, const unsigned char* input, unsigned char* output,
+							const unsigned char* tag, size_t tag_len)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char check_tag[16];
+
+	if((ret = ccm_auth_crypt(ctx, mode, length, iv, iv_len, add, add_len, input, output, check_tag,
+							 tag_len)) != 0)
+		return (ret);
+
+	if(iotex_psa_safer_memcmp(tag, check_tag, tag_len) != 0)
+	{
+		iotex_platform_zeroize(output, length);
+		iotex_platform_zeroize(check_tag, sizeof(check_tag));
+		return (IOTEX_ERR_CCM_AUTH_FAILED);
+	}
+
+	iotex_platform_zeroize(check_tag, sizeof(check_tag));
+	return (0);
+}
+
+int iotex_ccm_star_auth_decrypt(iotex_ccm_context* ctx, size_t length, const unsigned char* iv,
+								size_t iv_len, const unsigned char* add, size_t add_len,
+								const unsigned char* input, unsigned char* output,
+								const unsigned char* tag, size_t tag_len)
+{
+	return (ccm_auth_decrypt(ctx, IOTEX_CCM_STAR_DECRYPT, length, iv, iv_len, add, add_len, input,
+							 output, tag, tag_len));
+}
+
+int iotex_ccm_auth_decrypt(iotex_ccm_context* ctx, size_t length, const unsigned char* iv,
+						   size_t iv_len, const unsigned char* add, size_t add_len,
+						   const unsigned char* input, unsigned char* output,
+						   const unsigned char* tag, size_t tag_len)
+{
+	return (ccm_auth_decrypt(ctx, IOTEX_CCM_DECRYPT, length, iv, iv_len, add, add_len, input,
+							 output, tag, tag_len));
+}
+	#endif /* IOTEX_CCM_C */
+
+/****************************************************************/
+/* GCM */
+/****************************************************************/
+	#if defined(IOTEX_GCM_C)
+
+		#if defined(IOTEX_AESNI_C) && defined(IOTEX_HAVE_ASM) && defined(__x86_64__) &&           \
+			(defined(__GNUC__) || defined(__clang__))
+			#define GCM_PCLMUL
+
+			#include <immintrin.h>
+		#endif
+
+		/* Table entries are indexed by bit-reflected polynomials, so the
+		 * middle entry holds H itself. */
+		#define GHASH_TABLE_SIZE (1 << IOTEX_GCM_GHASH_TABLE_BITS)
+		#define GHASH_ONE (GHASH_TABLE_SIZE >> 1)
+
+void iotex_gcm_init(iotex_gcm_context* ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	memset(ctx, 0, sizeof(iotex_gcm_context));
+}
+
+/*
+ * Precompute small multiples of H, that is set
+ *      HH[i] || HL[i] = H times i,
+ * where i is seen as a field element as in [MGV], ie high-order bits
+ * correspond to low powers of P. The result is stored in the same way, that
+ * is the high-order bit of HH corresponds to P^0 and the low-order bit of HL
+ * corresponds to P^127.
+ */
+static int gcm_gen_table(iotex_gcm_context* ctx)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	int i, j;
+	uint64_t u64h[2] = {0};
+	uint8_t* h = (uint8_t*)u64h;
+	uint64_t vl, vh;
+
+	if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, h, h)) != 0)
+		return (ret);
+
+	/* pack h as two 64-bits ints, big-endian */
+	vh = IOTEX_GET_UINT64_BE(h, 0);
+	vl = IOTEX_GET_UINT64_BE(h, 8);
+
+	ctx->HL[GHASH_ONE] = vl;
+	ctx->HH[GHASH_ONE] = vh;
+
+	/* 0 corresponds to 0 in GF(2^128) */
+	ctx->HH[0] = 0;
+	ctx->HL[0] = 0;
+
+	for(i = GHASH_ONE >> 1; i > 0; i >>= 1)
+	{
+		uint32_t T = (vl & 1) * 0xe1000000U;
+		vl = (vh << 63) | (vl >> 1);
+		vh = (vh >> 1) ^ ((uint64_t)T << 32);
+
+		ctx->HL[i] = vl;
+		ctx->HH[i] = vh;
+	}
+
+	for(i = 2; i <= GHASH_ONE; i *= 2)
+	{
+		uint64_t *HiL = ctx->HL + i, *HiH = ctx->HH + i;
+		vh = *HiH;
+		vl = *HiL;
+		for(j = 1; j < i; j++)
+		{
+			HiH[j] = vh ^ ctx->HH[j];
+			HiL[j] = vl ^ ctx->HL[j];
+		}
+	}
+
+	iotex_platform_zeroize(u64h, sizeof(u64h));
+	return (0);
+}
+
+int iotex_gcm_setkey(iotex_gcm_context* ctx, iotex_cipher_id_t cipher, const unsigned char* key,
+					 unsigned int keybits)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+
+	if(ctx == NULL || key == NULL)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	/* TinyCrypt only provides the AES block cipher. */
+	if(cipher != IOTEX_CIPHER_ID_AES)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	iotex_aes_free(&ctx->aes);
+	iotex_aes_init(&ctx->aes);
+	if((ret = iotex_aes_setkey_enc(&ctx->aes, key, keybits)) != 0)
+		return (ret);
+
+	return (gcm_gen_table(ctx));
+}
+
+		#if defined(GCM_PCLMUL)
+static int gcm_pclmul_support = -1;
+
+static int gcm_has_pclmul(void)
+{
+	if(gcm_pclmul_support < 0)
+	{
+		__builtin_cpu_init();
+		gcm_pclmul_support =
+			(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) ? 1 : 0;
+	}
+
+	return (gcm_pclmul_support);
+}
+
+/*
+ * Carry-less multiplication dd:cc = aa * bb using [CLMUL-WP] algorithm 1
+ * (p. 12).
+ */
+__attribute__((target("pclmul,ssse3"))) static void gcm_clmul(const __m128i aa, const __m128i bb,
+															  __m128i* cc, __m128i* dd)
+{
+	__m128i ee, ff;
+
+	*cc = _mm_clmulepi64_si128(aa, bb, 0x00); /* a0*b0 = c1:c0 */
+	*dd = _mm_clmulepi64_si128(aa, bb, 0x11); /* a1*b1 = d1:d0 */
+	ee = _mm_clmulepi64_si128(aa, bb, 0x10);  /* a0*b1 = e1:e0 */
+	ff = _mm_clmulepi64_si128(aa, bb, 0x01);  /* a1*b0 = f1:f0 */
+	ff = _mm_xor_si128(ff, ee);				  /* e1+f1:e0+f0 */
+	ee = ff;								  /* e1+f1:e0+f0 */
+	ff = _mm_srli_si128(ff, 8);				  /* 0:e1+f1 */
+	ee = _mm_slli_si128(ee, 8);				  /* e0+f0:0 */
+	*dd = _mm_xor_si128(*dd, ff);			  /* d1:d0+e1+f1 */
+	*cc = _mm_xor_si128(*cc, ee);			  /* c1+e0+f0:c0 */
+}
+
+/*
+ * [CLMUL-WP] algorithm 5 step 1: shift cc:dd one bit to the left, taking
+ * advantage of [CLMUL-WP] eq 27 (p. 18).
+ */
+__attribute__((target("pclmul,ssse3"))) static void gcm_shift(__m128i* cc, __m128i* dd)
+{
+	__m128i cc_lo = _mm_slli_epi64(*cc, 1);	 /* r1<<1:r0<<1 */
+	__m128i dd_lo = _mm_slli_epi64(*dd, 1);	 /* r3<<1:r2<<1 */
+	__m128i cc_hi = _mm_srli_epi64(*cc, 63); /* r1>>63:r0>>63 */
+	__m128i dd_hi = _mm_srli_epi64(*dd, 63); /* r3>>63:r2>>63 */
+	__m128i xmm5 = _mm_srli_si128(cc_hi, 8); /* 0:r1>>63 */
+	cc_hi = _mm_slli_si128(cc_hi, 8);		 /* r0>>63:0 */
+	dd_hi = _mm_slli_si128(dd_hi, 8);		 /* 0:r1>>63 */
+
+	*cc = _mm_or_si128(cc_lo, cc_hi);						/* r1<<1|r0>>63:r0<<1 */
+	*dd = _mm_or_si128(_mm_or_si128(dd_lo, dd_hi), xmm5); /* r3<<1|r2>>62:r2<<1|r1>>63 */
+}
+
+/* [CLMUL-WP] algorithm 5 step 2 */
+__attribute__((target("pclmul,ssse3"))) static __m128i gcm_reduce(__m128i xx)
+{
+	__m128i aa = _mm_slli_epi64(xx, 63); /* x1<<63:x0<<63 = stuff:a */
+	__m128i bb = _mm_slli_epi64(xx, 62); /* x1<<62:x0<<62 = stuff:b */
+	__m128i cc = _mm_slli_epi64(xx, 57); /* x1<<57:x0<<57 = stuff:c */
+	__m128i dd = _mm_slli_si128(_mm_xor_si128(_mm_xor_si128(aa, bb), cc), 8); /* a+b+c:0 */
+
+	return (_mm_xor_si128(dd, xx)); /* x1+a+b+c:x0 = d:x0 */
+}
+
+/* [CLMUL-WP] algorithm 5 steps 3 and 4 */
+__attribute__((target("pclmul,ssse3"))) static __m128i gcm_mix(__m128i dx)
+{
+	__m128i ee = _mm_srli_epi64(dx, 1); /* e1:x0>>1 = e1:e0' */
+	__m128i ff = _mm_srli_epi64(dx, 2); /* f1:x0>>2 = f1:f0' */
+	__m128i gg = _mm_srli_epi64(dx, 7); /* g1:x0>>7 = g1:g0' */
+
+	/* e0'+f0'+g0' is almost e0+f0+g0, except for some missing bits carried
+	 * from d. Now get those bits back in. */
+	__m128i eh = _mm_slli_epi64(dx, 63); /* d<<63:stuff */
+	__m128i fh = _mm_slli_epi64(dx, 62); /* d<<62:stuff */
+	__m128i gh = _mm_slli_epi64(dx, 57); /* d<<57:stuff */
+	__m128i hh = _mm_srli_si128(_mm_xor_si128(_mm_xor_si128(eh, fh), gh), 8); /* 0:missing bits */
+
+	return (_mm_xor_si128(_mm_xor_si128(_mm_xor_si128(_mm_xor_si128(ee, ff), gg), hh), dx));
+}
+
+/*
+ * c = x * H in GF(2^128). x and c are in the big-endian GCM byte order; H is
+ * taken from the table, whose two halves already form H byte-reversed.
+ */
+__attribute__((target("pclmul,ssse3"))) static void gcm_clmul_mult(const iotex_gcm_context* ctx,
+																	const unsigned char x[16],
+																	unsigned char c[16])
+{
+	const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	__m128i aa, bb, cc, dd, dx, xh;
+
+	aa = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)x), reverse);
+	bb = _mm_set_epi64x((long long)ctx->HH[GHASH_ONE], (long long)ctx->HL[GHASH_ONE]);
+
+	gcm_clmul(aa, bb, &cc, &dd);
+	gcm_shift(&cc, &dd);
+
+	/* Now reduce modulo the GCM polynomial x^128 + x^7 + x^2 + x + 1 using
+	 * [CLMUL-WP] algorithm 5 (p. 18). dd:cc holds x3:x2:x1:x0 (already
+	 * shifted). */
+	dx = gcm_reduce(cc);
+	xh = gcm_mix(dx);
+	cc = _mm_xor_si128(xh, dd); /* x3+h1:x2+h0 */
+
+	_mm_storeu_si128((__m128i*)c, _mm_shuffle_epi8(cc, reverse));
+}
+		#endif /* GCM_PCLMUL */
+
+		#if(IOTEX_GCM_GHASH_TABLE_BITS == 4)
+/*
+ * Shoup's method for multiplication use this table with
+ *      last4[x] = x times P^128
+ * where x and last4[x] are seen as elements of GF(2^128) as in [MGV]
+ */
+static const uint16_t last4[16] = {0x0000, 0x1c20, 0x3840, 0x2460, 0x7080, 0x6ca0,
+								   0x48c0, 0x54e0, 0xe100, 0xfd20, 0xd940, 0xc560,
+								   0x9180, 0x8da0, 0xa9c0, 0xb5e0};
+		#else
+/* The same reduction table as last4, for a whole byte shifted out at once. */
+static const uint16_t last8[256] = {
+	0x0000, 0x01c2, 0x0384, 0x0246, 0x0708, 0x06ca, 0x048c, 0x054e,
+	0x0e10, 0x0fd2, 0x0d94, 0x0c56, 0x0918, 0x08da, 0x0a9c, 0x0b5e,
+	0x1c20, 0x1de2, 0x1fa4, 0x1e66, 0x1b28, 0x1aea, 0x18ac, 0x196e,
+	0x1230, 0x13f2, 0x11b4, 0x1076, 0x1538, 0x14fa, 0x16bc, 0x177e,
+	0x3840, 0x3982, 0x3bc4, 0x3a06, 0x3f48, 0x3e8a, 0x3ccc, 0x3d0e,
+	0x3650, 0x3792, 0x35d4, 0x3416, 0x3158, 0x309a, 0x32dc, 0x331e,
+	0x2460, 0x25a2, 0x27e4, 0x2626, 0x2368, 0x22aa, 0x20ec, 0x212e,
+	0x2a70, 0x2bb2, 0x29f4, 0x2836, 0x2d78, 0x2cba, 0x2efc, 0x2f3e,
+	0x7080, 0x7142, 0x7304, 0x72c6, 0x7788, 0x764a, 0x740c, 0x75ce,
+	0x7e90, 0x7f52, 0x7d14, 0x7cd6, 0x7998, 0x785a, 0x7a1c, 0x7bde,
+	0x6ca0, 0x6d62, 0x6f24, 0x6ee6, 0x6ba8, 0x6a6a, 0x682c, 0x69ee,
+	0x62b0, 0x6372, 0x6134, 0x60f6, 0x65b8, 0x647a, 0x663c, 0x67fe,
+	0x48c0, 0x4902, 0x4b44, 0x4a86, 0x4fc8, 0x4e0a, 0x4c4c, 0x4d8e,
+	0x46d0, 0x4712, 0x4554, 0x4496, 0x41d8, 0x401a, 0x425c, 0x439e,
+	0x54e0, 0x5522, 0x5764, 0x56a6, 0x53e8, 0x522a, 0x506c, 0x51ae,
+	0x5af0, 0x5b32, 0x5974, 0x58b6, 0x5df8, 0x5c3a, 0x5e7c, 0x5fbe,
+	0xe100, 0xe0c2, 0xe284, 0xe346, 0xe608, 0xe7ca, 0xe58c, 0xe44e,
+	0xef10, 0xeed2, 0xec94, 0xed56, 0xe818, 0xe9da, 0xeb9c, 0xea5e,
+	0xfd20, 0xfce2, 0xfea4, 0xff66, 0xfa28, 0xfbea, 0xf9ac, 0xf86e,
+	0xf330, 0xf2f2, 0xf0b4, 0xf176, 0xf438, 0xf5fa, 0xf7bc, 0xf67e,
+	0xd940, 0xd882, 0xdac4, 0xdb06, 0xde48, 0xdf8a, 0xddcc, 0xdc0e,
+	0xd750, 0xd692, 0xd4d4, 0xd516, 0xd058, 0xd19a, 0xd3dc, 0xd21e,
+	0xc560, 0xc4a2, 0xc6e4, 0xc726, 0xc268, 0xc3aa, 0xc1ec, 0xc02e,
+	0xcb70, 0xcab2, 0xc8f4, 0xc936, 0xcc78, 0xcdba, 0xcffc, 0xce3e,
+	0x9180, 0x9042, 0x9204, 0x93c6, 0x9688, 0x974a, 0x950c, 0x94ce,
+	0x9f90, 0x9e52, 0x9c14, 0x9dd6, 0x9898, 0x995a, 0x9b1c, 0x9ade,
+	0x8da0, 0x8c62, 0x8e24, 0x8fe6, 0x8aa8, 0x8b6a, 0x892c, 0x88ee,
+	0x83b0, 0x8272, 0x8034, 0x81f6, 0x84b8, 0x857a, 0x873c, 0x86fe,
+	0xa9c0, 0xa802, 0xaa44, 0xab86, 0xaec8, 0xaf0a, 0xad4c, 0xac8e,
+	0xa7d0, 0xa612, 0xa454, 0xa596, 0xa0d8, 0xa11a, 0xa35c, 0xa29e,
+	0xb5e0, 0xb422, 0xb664, 0xb7a6, 0xb2e8, 0xb32a, 0xb16c, 0xb0ae,
+	0xbbf0, 0xba32, 0xb874, 0xb9b6, 0xbcf8, 0xbd3a, 0xbf7c, 0xbebe,
+};
+		#endif
+
+/*
+ * Sets output to x times H using the precomputed tables.
+ * x and output are seen as elements of GF(2^128) as in [MGV].
+ */
+static void gcm_mult(iotex_gcm_context* ctx, const unsigned char x[16], unsigned char output[16])
+{
+	int i = 0;
+	unsigned char rem;
+	uint64_t zh, zl;
+
+		#if defined(GCM_PCLMUL)
+	if(gcm_has_pclmul())
+	{
+		gcm_clmul_mult(ctx, x, output);
+		return;
+	}
+		#endif /* GCM_PCLMUL */
+
+		#if(IOTEX_GCM_GHASH_TABLE_BITS == 4)
+	unsigned char lo, hi;
+
+	lo = x[15] & 0xf;
+
+	zh = ctx->HH[lo];
+	zl = ctx->HL[lo];
+
+	for(i = 15; i >= 0; i--)
+	{
+		lo = x[i] & 0xf;
+		hi = (x[i] >> 4) & 0xf;
+
+		if(i != 15)
+		{
+			rem = (unsigned char)zl & 0xf;
+			zl = (zh << 60) | (zl >> 4);
+			zh = (zh >> 4);
+			zh ^= (uint64_t)last4[rem] << 48;
+			zh ^= ctx->HH[lo];
+			zl ^= ctx->HL[lo];
+		}
+
+		rem = (unsigned char)zl & 0xf;
+		zl = (zh << 60) | (zl >> 4);
+		zh = (zh >> 4);
+		zh ^= (uint64_t)last4[rem] << 48;
+		zh ^= ctx->HH[hi];
+		zl ^= ctx->HL[hi];
+	}
+		#else
+	zh = ctx->HH[x[15]];
+	zl = ctx->HL[x[15]];
+
+	for(i = 14; i >= 0; i--)
+	{
+		rem = (unsigned char)zl;
+		zl = (zh << 56) | (zl >> 8);
+		zh = (zh >> 8);
+		zh ^= (uint64_t)last8[rem] << 48;
+		zh ^= ctx->HH[x[i]];
+		zl ^= ctx->HL[x[i]];
+	}
+		#endif
+
+	IOTEX_PUT_UINT64_BE(zh, output, 0);
+	IOTEX_PUT_UINT64_BE(zl, output, 8);
+}
+
+static void gcm_xor(unsigned char* r, const unsigned char* a, const unsigned char* b, size_t n)
+{
+	size_t i;
+
+	for(i = 0; i < n; i++)
+		r[i] = a[i] ^ b[i];
+}
+
+int iotex_gcm_starts(iotex_gcm_context* ctx, int mode, const unsigned char* iv, size_t iv_len)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char work_buf[16];
+	const unsigned char* p;
+	size_t use_len;
+	uint64_t iv_bits;
+
+	if(ctx == NULL || iv == NULL)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	/* IV is limited to 2^64 bits, so 2^61 bytes */
+	/* IV is not allowed to be zero length */
+	if(iv_len == 0 || ((uint64_t)iv_len) >> 61 != 0)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	memset(ctx->y, 0x00, sizeof(ctx->y));
+	memset(ctx->buf, 0x00, sizeof(ctx->buf));
+
+	ctx->mode = mode;
+	ctx->len = 0;
+	ctx->add_len = 0;
+
+	if(iv_len == 12)
+	{
+		memcpy(ctx->y, iv, iv_len);
+		ctx->y[15] = 1;
+	}
+	else
+	{
+		memset(work_buf, 0x00, 16);
+		iv_bits = (uint64_t)iv_len * 8;
+		IOTEX_PUT_UINT64_BE(iv_bits, work_buf, 8);
+
+		p = iv;
+		while(iv_len > 0)
+		{
+			use_len = (iv_len < 16) ? iv_len : 16;
+
+			gcm_xor(ctx->y, ctx->y, p, use_len);
+
+			gcm_mult(ctx, ctx->y, ctx->y);
+
+			iv_len -= use_len;
+			p += use_len;
+		}
+
+		gcm_xor(ctx->y, ctx->y, work_buf, 16);
+
+		gcm_mult(ctx, ctx->y, ctx->y);
+	}
+
+	if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->y, ctx->base_ectr)) != 0)
+		return (ret);
+
+	return (0);
+}
+
+/*
+ * ctx->buf contains the partial state of the computation of the
+ * authentication tag. ctx->add_len and ctx->len indicate different stages
+ * of the computation:
+ *     * len == 0 && add_len == 0:      initial state
+ *     * len == 0 && add_len % 16 != 0: the first `add_len % 16` bytes have
+ *                                      a partial block of AD that has been
+ *                                      xored in but not yet multiplied in.
+ *     * len == 0 && add_len % 16 == 0: the authentication tag is correct if
+ *                                      the data ends now.
+ *     * len % 16 != 0:                 the first `len % 16` bytes have
+ *                                      a partial block of ciphertext that has
+ *                                      been xored in but not yet multiplied in.
+ *     * len > 0 && len % 16 == 0:      the authentication tag is correct if
+ *                                      the data ends now.
+ */
+int iotex_gcm_update_ad(iotex_gcm_context* ctx, const unsigned char* add, size_t add_len)
+{
+	const unsigned char* p;
+	size_t use_len, offset;
+	uint64_t new_add_len;
+
+	if(ctx == NULL || (add_len > 0 && add == NULL))
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	/* AD is limited to 2^64 bits, ie 2^61 bytes. Also check for possible
+	 * overflow. */
+	new_add_len = ctx->add_len + (uint64_t)add_len;
+	if(new_add_len < ctx->add_len || new_add_len >> 61 != 0)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	offset = ctx->add_len % 16;
+	p = add;
+
+	if(offset != 0)
+	{
+		use_len = 16 - offset;
+		if(use_len > add_len)
+			use_len = add_len;
+
+		gcm_xor(ctx->buf + offset, ctx->buf + offset, p, use_len);
+
+		if(offset + use_len == 16)
+			gcm_mult(ctx, ctx->buf, ctx->buf);
+
+		ctx->add_len += use_len;
+		add_len -= use_len;
+		p += use_len;
+	}
+
+	ctx->add_len += add_len;
+
+	while(add_len >= 16)
+	{
+		gcm_xor(ctx->buf, ctx->buf, p, 16);
+
+		gcm_mult(ctx, ctx->buf, ctx->buf);
+
+		add_len -= 16;
+		p += 16;
+	}
+
+	if(add_len > 0)
+		gcm_xor(ctx->buf, ctx->buf, p, add_len);
+
+	return (0);
+}
+
+/* Increment the counter. */
+static void gcm_incr(unsigned char y[16])
+{
+	uint32_t x = IOTEX_GET_UINT32_BE(y, 12);
+	x++;
+	IOTEX_PUT_UINT32_BE(x, y, 12);
+}
+
+/* Calculate and apply the encryption mask. Process use_len bytes of data,
+ * starting at position offset in the mask block. */
+static int gcm_mask(iotex_gcm_context* ctx, unsigned char ectr[16], size_t offset, size_t use_len,
+					const unsigned char* input, unsigned char* output)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+
+	if((ret = iotex_aes_crypt_ecb(&ctx->aes, IOTEX_AES_ENCRYPT, ctx->y, ectr)) != 0)
+	{
+		iotex_platform_zeroize(ectr, 16);
+		return (ret);
+	}
+
+	if(ctx->mode == IOTEX_GCM_DECRYPT)
+		gcm_xor(ctx->buf + offset, ctx->buf + offset, input, use_len);
+
+	gcm_xor(output, ectr + offset, input, use_len);
+
+	if(ctx->mode == IOTEX_GCM_ENCRYPT)
+		gcm_xor(ctx->buf + offset, ctx->buf + offset, output, use_len);
+
+	return (0);
+}
+
+int iotex_gcm_update(iotex_gcm_context* ctx, const unsigned char* input, size_t input_length,
+					 unsigned char* output, size_t output_size, size_t* output_length)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	const unsigned char* p = input;
+	unsigned char* out_p = output;
+	size_t offset;
+	unsigned char ectr[16] = {0};
+
+	if(ctx == NULL || output_length == NULL)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	if(output_size < input_length)
+		return (IOTEX_ERR_GCM_BUFFER_TOO_SMALL);
+	*output_length = input_length;
+
+	/* Exit early if input_length==0 so that we don't do any pointer
+	 * arithmetic on a potentially null pointer. Returning early also means
+	 * that the last partial block of AD remains untouched for
+	 * iotex_gcm_finish. */
+	if(input_length == 0)
+		return (0);
+
+	if(input == NULL || output == NULL)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	if(output > input && (size_t)(output - input) < input_length)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	/* Total length is restricted to 2^39 - 256 bits, ie 2^36 - 2^5 bytes.
+	 * Also check for possible overflow. */
+	if(ctx->len + input_length < ctx->len ||
+	   (uint64_t)ctx->len + input_length > 0xFFFFFFFE0ull)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	if(ctx->len == 0 && ctx->add_len % 16 != 0)
+		gcm_mult(ctx, ctx->buf, ctx->buf);
+
+	offset = ctx->len % 16;
+	if(offset != 0)
+	{
+		size_t use_len = 16 - offset;
+		if(use_len > input_length)
+			use_len = input_length;
+
+		if((ret = gcm_mask(ctx, ectr, offset, use_len, p, out_p)) != 0)
+			return (ret);
+
+		if(offset + use_len == 16)
+			gcm_mult(ctx, ctx->buf, ctx->buf);
+
+		ctx->len += use_len;
+		input_length -= use_len;
+		p += use_len;
+		out_p += use_len;
+	}
+
+	ctx->len += input_length;
+
+	while(input_length >= 16)
+	{
+		gcm_incr(ctx->y);
+		if((ret = gcm_mask(ctx, ectr, 0, 16, p, out_p)) != 0)
+			return (ret);
+
+		gcm_mult(ctx, ctx->buf, ctx->buf);
+
+		input_length -= 16;
+		p += 16;
+		out_p += 16;
+	}
+
+	if(input_length > 0)
+	{
+		gcm_incr(ctx->y);
+		if((ret = gcm_mask(ctx, ectr, 0, input_length, p, out_p)) != 0)
+			return (ret);
+	}
+
+	iotex_platform_zeroize(ectr, sizeof(ectr));
+	return (0);
+}
+
+int iotex_gcm_finish(iotex_gcm_context* ctx, unsigned char* output, size_t output_size,
+					 size_t* output_length, unsigned char* tag, size_t tag_len)
+{
+	unsigned char work_buf[16];
+	uint64_t orig_len;
+	uint64_t orig_add_len;
+
+	if(ctx == NULL || output_length == NULL || tag == NULL)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	/* We never pass any output in finish(). The output parameter exists only
+	 * for the sake of alternative implementations. */
+	(void)output;
+	(void)output_size;
+	*output_length = 0;
+
+	/* Total length is restricted to 2^39 - 256 bits, ie 2^36 - 2^5 bytes and
+	 * AD length is restricted to 2^64 bits, ie 2^61 bytes so neither of the
+	 * two multiplications would overflow. */
+	orig_len = ctx->len * 8;
+	orig_add_len = ctx->add_len * 8;
+
+	if(ctx->len == 0 && ctx->add_len % 16 != 0)
+		gcm_mult(ctx, ctx->buf, ctx->buf);
+
+	if(tag_len > 16 || tag_len < 4)
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	if(ctx->len % 16 != 0)
+		gcm_mult(ctx, ctx->buf, ctx->buf);
+
+	memcpy(tag, ctx->base_ectr, tag_len);
+
+	if(orig_len || orig_add_len)
+	{
+		memset(work_buf, 0x00, 16);
+
+		IOTEX_PUT_UINT64_BE(orig_add_len, work_buf, 0);
+		IOTEX_PUT_UINT64_BE(orig_len, work_buf, 8);
+
+		gcm_xor(ctx->buf, ctx->buf, work_buf, 16);
+
+		gcm_mult(ctx, ctx->buf, ctx->buf);
+
+		gcm_xor(tag, tag, ctx->buf, tag_len);
+	}
+
+	return (0);
+}
+
+int iotex_gcm_crypt_and_tag(iotex_gcm_context* ctx, int mode, size_t length,
+							const unsigned char* iv, size_t iv_len, const unsigned char* add,
+							size_t add_len, const unsigned char* input, unsigned char* output,
+							size_t tag_len, unsigned char* tag)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	size_t olen;
+
+	if((ret = iotex_gcm_starts(ctx, mode, iv, iv_len)) != 0)
+		return (ret);
+
+	if((ret = iotex_gcm_update_ad(ctx, add, add_len)) != 0)
+		return (ret);
+
+	if((ret = iotex_gcm_update(ctx, input, length, output, length, &olen)) != 0)
+		return (ret);
+
+	if((ret = iotex_gcm_finish(ctx, NULL, 0, &olen, tag, tag_len)) != 0)
+		return (ret);
+
+	return (0);
+}
+
+int iotex_gcm_auth_decrypt(iotex_gcm_context* ctx, size_t length, const unsigned char* iv,
+						   size_t iv_len, const unsigned char* add, size_t add_len,
+						   const unsigned char* tag, size_t tag_len, const unsigned char* input,
+						   unsigned char* output)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char check_tag[16];
+
+	if(tag == NULL || tag_len > sizeof(check_tag))
+		return (IOTEX_ERR_GCM_BAD_INPUT);
+
+	if((ret = iotex_gcm_crypt_and_tag(ctx, IOTEX_GCM_DECRYPT, length, iv, iv_len, add, add_len,
+									  input, output, tag_len, check_tag)) != 0)
+		return (ret);
+
+	/* Check tag in "constant-time" */
+	if(iotex_psa_safer_memcmp(tag, check_tag, tag_len) != 0)
+	{
+		iotex_platform_zeroize(output, length);
+		iotex_platform_zeroize(check_tag, sizeof(check_tag));
+		return (IOTEX_ERR_GCM_AUTH_FAILED);
+	}
+
+	iotex_platform_zeroize(check_tag, sizeof(check_tag));
+	return (0);
+}
+
+void iotex_gcm_free(iotex_gcm_context* ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	iotex_aes_free(&ctx->aes);
+	iotex_platform_zeroize(ctx, sizeof(iotex_gcm_context));
+}
+	#endif /* IOTEX_GCM_C */
+
+/****************************************************************/
+/* CHACHA20 */
+/****************************************************************/
+	#if defined(IOTEX_CHACHA20_C)
+
+		#if defined(IOTEX_HAVE_ASM) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+			#define CHACHA20_SIMD
+
+			#include <immintrin.h>
+		#endif
+
+		#define ROTL32(value, amount) ((uint32_t)((value) << (amount)) | ((value) >> (32 - (amount))))
+
+		#define CHACHA20_CTR_INDEX (12U)
+
+		#define CHACHA20_BLOCK_SIZE_BYTES (4U * 16U)
+
+/**
+ * \brief           ChaCha20 quarter round operation.
+ *
+ *                  The quarter round is defined as follows (from RFC 8439):
+ *                  1.  a += b; d ^= a; d <<<= 16;
+ *                  2.  c += d; b ^= c; b <<<= 12;
+ *                  3.  a += b; d ^= a; d <<<= 8;
+ *                  4.  c += d; b ^= c; b <<<= 7;
+ *
+ * \param state     ChaCha20 state to modify.
+ * \param a         The index of 'a' in the state.
+ * \param b         The index of 'b' in the state.
+ * \param c         The index of 'c' in the state.
+ * \param d         The index of 'd' in the state.
+ */
+static inline void chacha20_quarter_round(uint32_t state[16], size_t a, size_t b, size_t c,
+										  size_t d)
+{
+	/* a += b; d ^= a; d <<<= 16; */
+	state[a] += state[b];
+	state[d] ^= state[a];
+	state[d] = ROTL32(state[d], 16);
+
+	/* c += d; b ^= c; b <<<= 12 */
+	state[c] += state[d];
+	state[b] ^= state[c];
+	state[b] = ROTL32(state[b], 12);
+
+	/* a += b; d ^= a; d <<<= 8; */
+	state[a] += state[b];
+	state[d] ^= state[a];
+	state[d] = ROTL32(state[d], 8);
+
+	/* c += d; b ^= c; b <<<= 7; */
+	state[c] += state[d];
+	state[b] ^= state[c];
+	state[b] = ROTL32(state[b], 7);
+}
+
+/**
+ * \brief           Perform the ChaCha20 inner block operation.
+ *
+ *                  This function performs two rounds: the column round and the
+ *                  diagonal round.
+ *
+ * \param state     The ChaCha20 state to update.
+ */
+static void chacha20_inner_block(uint32_t state[16])
+{
+	chacha20_quarter_round(state, 0, 4, 8, 12);
+	chacha20_quarter_round(state, 1, 5, 9, 13);
+	chacha20_quarter_round(state, 2, 6, 10, 14);
+	chacha20_quarter_round(state, 3, 7, 11, 15);
+
+	chacha20_quarter_round(state, 0, 5, 10, 15);
+	chacha20_quarter_round(state, 1, 6, 11, 12);
+	chacha20_quarter_round(state, 2, 7, 8, 13);
+	chacha20_quarter_round(state, 3, 4, 9, 14);
+}
+
+/**
+ * \brief               Generates a keystream block.
+ *
+ * \param initial_state The initial ChaCha20 state (key, nonce, counter).
+ * \param keystream     Generated keystream bytes are written to this buffer.
+ */
+static void chacha20_block(const uint32_t initial_state[16], unsigned char keystream[64])
+{
+	uint32_t working_state[16];
+	size_t i;
+
+	memcpy(working_state, initial_state, CHACHA20_BLOCK_SIZE_BYTES);
+
+	for(i = 0U; i < 10U; i++)
+		chacha20_inner_block(working_state);
+
+	working_state[0] += initial_state[0];
+	working_state[1] += initial_state[1];
+	working_state[2] += initial_state[2];
+	working_state[3] += initial_state[3];
+	working_state[4] += initial_state[4];
+	working_state[5] += initial_state[5];
+	working_state[6] += initial_state[6];
+	working_state[7] += initial_state[7];
+	working_state[8] += initial_state[8];
+	working_state[9] += initial_state[9];
+	working_state[10] += initial_state[10];
+	working_state[11] += initial_state[11];
+	working_state[12] += initial_state[12];
+	working_state[13] += initial_state[13];
+	working_state[14] += initial_state[14];
+	working_state[15] += initial_state[15];
+
+	for(i = 0U; i < 16; i++)
+	{
+		size_t offset = i * 4U;
+
+		IOTEX_PUT_UINT32_LE(working_state[i], keystream, offset);
+	}
+
+	iotex_platform_zeroize(working_state, sizeof(working_state));
+}
+
+		#if defined(CHACHA20_SIMD)
+/*
+ * Multi-block paths: each vector lane holds the same state word of a
+ * different block, so the rounds are the scalar ones applied lane-wise and
+ * the blocks only need transposing back into byte order at the end. The lanes
+ * use counters state[12] + 0, 1, 2, ... with 32-bit wrap-around, exactly as
+ * the scalar path would.
+ */
+
+			#define CHACHA20_SSE2_ROTL(v, n) _mm_or_si128(_mm_slli_epi32(v, n), _mm_srli_epi32(v, 32 - (n)))
+
+			#define CHACHA20_SSE2_QR(a, b, c, d)                                                       \
+				do                                                                                     \
+				{                                                                                      \
+					a = _mm_add_epi32(a, b);                                                           \
+					d = CHACHA20_SSE2_ROTL(_mm_xor_si128(d, a), 16);                                   \
+					c = _mm_add_epi32(c, d);                                                           \
+					b = CHACHA20_SSE2_ROTL(_mm_xor_si128(b, c), 12);                                   \
+					a = _mm_add_epi32(a, b);                                                           \
+					d = CHACHA20_SSE2_ROTL(_mm_xor_si128(d, a), 8);                                    \
+					c = _mm_add_epi32(c, d);                                                           \
+					b = CHACHA20_SSE2_ROTL(_mm_xor_si128(b, c), 7);                                    \
+				} while(0)
+
+/* XOR 4 consecutive keystream blocks into 256 bytes of input. SSE2 is part of
+ * the x86-64 baseline, so this needs no run-time check. */
+static void chacha20_blocks4_sse2(const uint32_t state[16], const unsigned char* input,
+								  unsigned char* output)
+{
+	__m128i x[16], orig[16];
+	size_t i, j;
+
+	for(i = 0; i < 16; i++)
+		orig[i] = _mm_set1_epi32((int)state[i]);
+	orig[CHACHA20_CTR_INDEX] = _mm_add_epi32(orig[CHACHA20_CTR_INDEX], _mm_set_epi32(3, 2, 1, 0));
+
+	for(i = 0; i < 16; i++)
+		x[i] = orig[i];
+
+	for(i = 0U; i < 10U; i++)
+	{
+		CHACHA20_SSE2_QR(x[0], x[4], x[8], x[12]);
+		CHACHA20_SSE2_QR(x[1], x[5], x[9], x[13]);
+		CHACHA20_SSE2_QR(x[2], x[6], x[10], x[14]);
+		CHACHA20_SSE2_QR(x[3], x[7], x[11], x[15]);
+
+		CHACHA20_SSE2_QR(x[0], x[5], x[10], x[15]);
+		CHACHA20_SSE2_QR(x[1], x[6], x[11], x[12]);
+		CHACHA20_SSE2_QR(x[2], x[7], x[8], x[13]);
+		CHACHA20_SSE2_QR(x[3], x[4], x[9], x[14]);
+	}
+
+	for(i = 0; i < 16; i++)
+		x[i] = _mm_add_epi32(x[i], orig[i]);
+
+	/* Transpose each group of four words so that one vector holds 16
+	 * consecutive keystream bytes of a single block. */
+	for(i = 0; i < 16; i += 4)
+	{
+		__m128i t0 = _mm_unpacklo_epi32(x[i], x[i + 1]);
+		__m128i t1 = _mm_unpacklo_epi32(x[i + 2], x[i + 3]);
+		__m128i t2 = _mm_unpackhi_epi32(x[i], x[i + 1]);
+		__m128i t3 = _mm_unpackhi_epi32(x[i + 2], x[i + 3]);
+		__m128i ks[4];
+
+		ks[0] = _mm_unpacklo_epi64(t0, t1);
+		ks[1] = _mm_unpackhi_epi64(t0, t1);
+		ks[2] = _mm_unpacklo_epi64(t2, t3);
+		ks[3] = _mm_unpackhi_epi64(t2, t3);
+
+		for(j = 0; j < 4; j++)
+		{
+			size_t offset = j * CHACHA20_BLOCK_SIZE_BYTES + i * 4U;
+			__m128i in = _mm_loadu_si128((const __m128i*)(input + offset));
+
+			_mm_storeu_si128((__m128i*)(output + offset), _mm_xor_si128(in, ks[j]));
+		}
+	}
+}
+
+			#define CHACHA20_AVX2_ROTL(v, n)                                                           \
+				_mm256_or_si256(_mm256_slli_epi32(v, n), _mm256_srli_epi32(v, 32 - (n)))
+
+			#define CHACHA20_AVX2_QR(a, b, c, d)                                                       \
+				do                                                                                     \
+				{                                                                                      \
+					a = _mm256_add_epi32(a, b);                                                        \
+					d = CHACHA20_AVX2_ROTL(_mm256_xor_si256(d, a), 16);                                \
+					c = _mm256_add_epi32(c, d);                                                        \
+					b = CHACHA20_AVX2_ROTL(_mm256_xor_si256(b, c), 12);                                \
+					a = _mm256_add_epi32(a, b);                                                        \
+					d = CHACHA20_AVX2_ROTL(_mm256_xor_si256(d, a), 8);                                 \
+					c = _mm256_add_epi32(c, d);                                                        \
+					b = CHACHA20_AVX2_ROTL(_mm256_xor_si256(b, c), 7);                                 \
+				} while(0)
+
+static int chacha20_avx2_support = -1;
+
+static int chacha20_has_avx2(void)
+{
+	if(chacha20_avx2_support < 0)
+	{
+		__builtin_cpu_init();
+		chacha20_avx2_support = __builtin_cpu_supports("avx2") ? 1 : 0;
+	}
+
+	return (chacha20_avx2_support);
+}
+
+/* XOR 8 consecutive keystream blocks into 512 bytes of input. */
+__attribute__((target("avx2"))) static void chacha20_blocks8_avx2(const uint32_t state[16],
+																  const unsigned char* input,
+																  unsigned char* output)
+{
+	__m256i x[16], orig[16], ks[16];
+	size_t i, j;
+
+	for(i = 0; i < 16; i++)
+		orig[i] = _mm256_set1_epi32((int)state[i]);
+	orig[CHACHA20_CTR_INDEX] =
+		_mm256_add_epi32(orig[CHACHA20_CTR_INDEX], _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+
+	for(i = 0; i < 16; i++)
+		x[i] = orig[i];
+
+	for(i = 0U; i < 10U; i++)
+	{
+		CHACHA20_AVX2_QR(x[0], x[4], x[8], x[12]);
+		CHACHA20_AVX2_QR(x[1], x[5], x[9], x[13]);
+		CHACHA20_AVX2_QR(x[2], x[6], x[10], x[14]);
+		CHACHA20_AVX2_QR(x[3], x[7], x[11], x[15]);
+
+		CHACHA20_AVX2_QR(x[0], x[5], x[10], x[15]);
+		CHACHA20_AVX2_QR(x[1], x[6], x[11], x[12]);
+		CHACHA20_AVX2_QR(x[2], x[7], x[8], x[13]);
+		CHACHA20_AVX2_QR(x[3], x[4], x[9], x[14]);
+	}
+
+	for(i = 0; i < 16; i++)
+		x[i] = _mm256_add_epi32(x[i], orig[i]);
+
+	/* The unpacks work within each 128-bit half, so after this ks[i + j]
+	 * holds words i..i+3 of block j in its low half and of block j + 4 in its
+	 * high half. */
+	for(i = 0; i < 16; i += 4)
+	{
+		__m256i t0 = _mm256_unpacklo_epi32(x[i], x[i + 1]);
+		__m256i t1 = _mm256_unpacklo_epi32(x[i + 2], x[i + 3]);
+		__m256i t2 = _mm256_unpackhi_epi32(x[i], x[i + 1]);
+		__m256i t3 = _mm256_unpackhi_epi32(x[i + 2], x[i + 3]);
+
+		ks[i + 0] = _mm256_unpacklo_epi64(t0, t1);
+		ks[i + 1] = _mm256_unpackhi_epi64(t0, t1);
+		ks[i + 2] = _mm256_unpacklo_epi64(t2, t3);
+		ks[i + 3] = _mm256_unpackhi_epi64(t2, t3);
+	}
+
+	/* Pair up the halves into 32 consecutive keystream bytes per store. */
+	for(j = 0; j < 4; j++)
+	{
+		for(i = 0; i < 16; i += 8)
+		{
+			__m256i lo = _mm256_permute2x128_si256(ks[i + j], ks[i + 4 + j], 0x20);
+			__m256i hi = _mm256_permute2x128_si256(ks[i + j], ks[i + 4 + j], 0x31);
+			size_t offset_lo = j * CHACHA20_BLOCK_SIZE_BYTES + i * 4U;
+			size_t offset_hi = (j + 4) * CHACHA20_BLOCK_SIZE_BYTES + i * 4U;
+			__m256i in_lo = _mm256_loadu_si256((const __m256i*)(input + offset_lo));
+			__m256i in_hi = _mm256_loadu_si256((const __m256i*)(input + offset_hi));
+
+			_mm256_storeu_si256((__m256i*)(output + offset_lo), _mm256_xor_si256(in_lo, lo));
+			_mm256_storeu_si256((__m256i*)(output + offset_hi), _mm256_xor_si256(in_hi, hi));
+		}
+	}
+}
+		#endif /* CHACHA20_SIMD */
+
+void iotex_chacha20_init(iotex_chacha20_context* ctx)
+{
+	iotex_platform_zeroize(ctx->state, sizeof(ctx->state));
+	iotex_platform_zeroize(ctx->keystream8, sizeof(ctx->keystream8));
+
+	/* Initially, there's no keystream bytes available */
+	ctx->keystream_bytes_used = CHACHA20_BLOCK_SIZE_BYTES;
+}
+
+void iotex_chacha20_free(iotex_chacha20_context* ctx)
+{
+	if(ctx != NULL)
+		iotex_platform_zeroize(ctx, sizeof(iotex_chacha20_context));
+}
+
+int iotex_chacha20_setkey(iotex_chacha20_context* ctx, const unsigned char key[32])
+{
+	/* ChaCha20 constants - the string "expand 32-byte k" */
+	ctx->state[0] = 0x61707865;
+	ctx->state[1] = 0x3320646e;
+	ctx->state[2] = 0x79622d32;
+	ctx->state[3] = 0x6b206574;
+
+	/* Set key */
+	ctx->state[4] = IOTEX_GET_UINT32_LE(key, 0);
+	ctx->state[5] = IOTEX_GET_UINT32_LE(key, 4);
+	ctx->state[6] = IOTEX_GET_UINT32_LE(key, 8);
+	ctx->state[7] = IOTEX_GET_UINT32_LE(key, 12);
+	ctx->state[8] = IOTEX_GET_UINT32_LE(key, 16);
+	ctx->state[9] = IOTEX_GET_UINT32_LE(key, 20);
+	ctx->state[10] = IOTEX_GET_UINT32_LE(key, 24);
+	ctx->state[11] = IOTEX_GET_UINT32_LE(key, 28);
+
+	return (0);
+}
+
+int iotex_chacha20_starts(iotex_chacha20_context* ctx, const unsigned char nonce[12],
+						  uint32_t counter)
+{
+	/* Counter */
+	ctx->state[12] = counter;
+
+	/* Nonce */
+	ctx->state[13] = IOTEX_GET_UINT32_LE(nonce, 0);
+	ctx->state[14] = IOTEX_GET_UINT32_LE(nonce, 4);
+	ctx->state[15] = IOTEX_GET_UINT32_LE(nonce, 8);
+
+	iotex_platform_zeroize(ctx->keystream8, sizeof(ctx->keystream8));
+
+	/* Initially, there's no keystream bytes available */
+	ctx->keystream_bytes_used = CHACHA20_BLOCK_SIZE_BYTES;
+
+	return (0);
+}
+
+int iotex_chacha20_update(iotex_chacha20_context* ctx, size_t size, const unsigned char* input,
+						  unsigned char* output)
+{
+	size_t offset = 0U;
+	size_t i;
+
+	/* Use leftover keystream bytes, if available */
+	while(size > 0U && ctx->keystream_bytes_used < CHACHA20_BLOCK_SIZE_BYTES)
+	{
+		output[offset] = input[offset] ^ ctx->keystream8[ctx->keystream_bytes_used];
+
+		ctx->keystream_bytes_used++;
+		offset++;
+		size--;
+	}
+
+		#if defined(CHACHA20_SIMD)
+	if(size >= 8U * CHACHA20_BLOCK_SIZE_BYTES && chacha20_has_avx2())
+	{
+		do
+		{
+			chacha20_blocks8_avx2(ctx->state, &input[offset], &output[offset]);
+			ctx->state[CHACHA20_CTR_INDEX] += 8U;
+
+			offset += 8U * CHACHA20_BLOCK_SIZE_BYTES;
+			size -= 8U * CHACHA20_BLOCK_SIZE_BYTES;
+		} while(size >= 8U * CHACHA20_BLOCK_SIZE_BYTES);
+	}
+
+	while(size >= 4U * CHACHA20_BLOCK_SIZE_BYTES)
+	{
+		chacha20_blocks4_sse2(ctx->state, &input[offset], &output[offset]);
+		ctx->state[CHACHA20_CTR_INDEX] += 4U;
+
+		offset += 4U * CHACHA20_BLOCK_SIZE_BYTES;
+		size -= 4U * CHACHA20_BLOCK_SIZE_BYTES;
+	}
+		#endif /* CHACHA20_SIMD */
+
+	/* Process full blocks */
+	while(size >= CHACHA20_BLOCK_SIZE_BYTES)
+	{
+		/* Generate new keystream block and increment counter */
+		chacha20_block(ctx->state, ctx->keystream8);
+		ctx->state[CHACHA20_CTR_INDEX]++;
+
+		for(i = 0U; i < CHACHA20_BLOCK_SIZE_BYTES; i++)
+			output[offset + i] = input[offset + i] ^ ctx->keystream8[i];
+
+		offset += CHACHA20_BLOCK_SIZE_BYTES;
+		size -= CHACHA20_BLOCK_SIZE_BYTES;
+	}
+
+	/* Last (partial) block */
+	if(size > 0U)
+	{
+		/* Generate new keystream block and increment counter */
+		chacha20_block(ctx->state, ctx->keystream8);
+		ctx->state[CHACHA20_CTR_INDEX]++;
+
+		for(i = 0U; i < size; i++)
+			output[offset + i] = input[offset + i] ^ ctx->keystream8[i];
+
+		ctx->keystream_bytes_used = size;
+	}
+
+	return (0);
+}
+
+int iotex_chacha20_crypt(const unsigned char key[32], const unsigned char nonce[12],
+						 uint32_t counter, size_t data_len, const unsigned char* input,
+						 unsigned char* output)
+{
+	iotex_chacha20_context ctx;
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+
+	iotex_chacha20_init(&ctx);
+
+	ret = iotex_chacha20_setkey(&ctx, key);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_chacha20_starts(&ctx, nonce, counter);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_chacha20_update(&ctx, data_len, input, output);
+
+cleanup:
+	iotex_chacha20_free(&ctx);
+	return (ret);
+}
+	#endif /* IOTEX_CHACHA20_C */
+
+/****************************************************************/
+/* POLY1305 */
+/****************************************************************/
+	#if defined(IOTEX_POLY1305_C)
+
+		#define POLY1305_BLOCK_SIZE_BYTES (16U)
+
+/*
+ * Our implementation is tuned for 32-bit platforms with a 64-bit multiplier.
+ * However we provided an alternative for platforms without such a multiplier.
+ */
+		#if defined(IOTEX_NO_64BIT_MULTIPLICATION)
+static uint64_t mul64(uint32_t a, uint32_t b)
+{
+	/* a = al + 2**16 ah, b = bl + 2**16 bh */
+	const uint16_t al = (uint16_t)a;
+	const uint16_t bl = (uint16_t)b;
+	const uint16_t ah = a >> 16;
+	const uint16_t bh = b >> 16;
+
+	/* ab = al*bl + 2**16 (ah*bl + bl*bh) + 2**32 ah*bh */
+	const uint32_t lo = (uint32_t)al * bl;
+	const uint64_t me = (uint64_t)((uint32_t)ah * bl) + (uint32_t)al * bh;
+	const uint32_t hi = (uint32_t)ah * bh;
+
+	return (lo + (me << 16) + ((uint64_t)hi << 32));
+}
+		#else
+static inline uint64_t mul64(uint32_t a, uint32_t b)
+{
+	return ((uint64_t)a * b);
+}
+		#endif
+
+/**
+ * \brief                   Process blocks with Poly1305.
+ *
+ * \param ctx               The Poly1305 context.
+ * \param nblocks           Number of blocks to process. Note that this
+ *                          function only processes full blocks.
+ * \param input             Buffer containing the input block(s).
+ * \param needs_padding     Set to 0 if the padding bit has already been
+ *                          applied to the input data before calling this
+ *                          function.  Otherwise, set this parameter to 1.
+ */
+static void poly1305_process(iotex_poly1305_context* ctx, size_t nblocks,
+							 const unsigned char* input, uint32_t needs_padding)
+{
+	uint64_t d0, d1, d2, d3;
+	uint32_t acc0, acc1, acc2, acc3, acc4;
+	uint32_t r0, r1, r2, r3;
+	uint32_t rs1, rs2, rs3;
+	size_t offset = 0U;
+	size_t i;
+
+	r0 = ctx->r[0];
+	r1 = ctx->r[1];
+	r2 = ctx->r[2];
+	r3 = ctx->r[3];
+
+	rs1 = r1 + (r1 >> 2U);
+	rs2 = r2 + (r2 >> 2U);
+	rs3 = r3 + (r3 >> 2U);
+
+	acc0 = ctx->acc[0];
+	acc1 = ctx->acc[1];
+	acc2 = ctx->acc[2];
+	acc3 = ctx->acc[3];
+	acc4 = ctx->acc[4];
+
+	/* Process full blocks */
+	for(i = 0U; i < nblocks; i++)
+	{
+		/* The input block is treated as a 128-bit little-endian integer */
+		d0 = IOTEX_GET_UINT32_LE(input, offset + 0);
+		d1 = IOTEX_GET_UINT32_LE(input, offset + 4);
+		d2 = IOTEX_GET_UINT32_LE(input, offset + 8);
+		d3 = IOTEX_GET_UINT32_LE(input, offset + 12);
+
+		/* Compute: acc += (padded) block as a 130-bit integer */
+		d0 += (uint64_t)acc0;
+		d1 += (uint64_t)acc1 + (d0 >> 32U);
+		d2 += (uint64_t)acc2 + (d1 >> 32U);
+		d3 += (uint64_t)acc3 + (d2 >> 32U);
+		acc0 = (uint32_t)d0;
+		acc1 = (uint32_t)d1;
+		acc2 = (uint32_t)d2;
+		acc3 = (uint32_t)d3;
+		acc4 += (uint32_t)(d3 >> 32U) + needs_padding;
+
+		/* Compute: acc *= r */
+		d0 = mul64(acc0, r0) + mul64(acc1, rs3) + mul64(acc2, rs2) + mul64(acc3, rs1);
+		d1 = mul64(acc0, r1) + mul64(acc1, r0) + mul64(acc2, rs3) + mul64(acc3, rs2) +
+			 mul64(acc4, rs1);
+		d2 = mul64(acc0, r2) + mul64(acc1, r1) + mul64(acc2, r0) + mul64(acc3, rs3) +
+			 mul64(acc4, rs2);
+		d3 = mul64(acc0, r3) + mul64(acc1, r2) + mul64(acc2, r1) + mul64(acc3, r0) +
+			 mul64(acc4, rs3);
+		acc4 *= r0;
+
+		/* Compute: acc %= (2^130 - 5) (partial remainder) */
+		d1 += (d0 >> 32);
+		d2 += (d1 >> 32);
+		d3 += (d2 >> 32);
+		acc0 = (uint32_t)d0;
+		acc1 = (uint32_t)d1;
+		acc2 = (uint32_t)d2;
+		acc3 = (uint32_t)d3;
+		acc4 = (uint32_t)(d3 >> 32) + acc4;
+
+		d0 = (uint64_t)acc0 + (acc4 >> 2) + (acc4 & 0xFFFFFFFCU);
+		acc4 &= 3U;
+		acc0 = (uint32_t)d0;
+		d0 = (uint64_t)acc1 + (d0 >> 32U);
+		acc1 = (uint32_t)d0;
+		d0 = (uint64_t)acc2 + (d0 >> 32U);
+		acc2 = (uint32_t)d0;
+		d0 = (uint64_t)acc3 + (d0 >> 32U);
+		acc3 = (uint32_t)d0;
+		d0 = (uint64_t)acc4 + (d0 >> 32U);
+		acc4 = (uint32_t)d0;
+
+		offset += POLY1305_BLOCK_SIZE_BYTES;
+	}
+
+	ctx->acc[0] = acc0;
+	ctx->acc[1] = acc1;
+	ctx->acc[2] = acc2;
+	ctx->acc[3] = acc3;
+	ctx->acc[4] = acc4;
+}
+
+/**
+ * \brief                   Compute the Poly1305 MAC
+ *
+ * \param ctx               The Poly1305 context.
+ * \param mac               The buffer to where the MAC is written. Must be
+ *                          big enough to contain the 16-byte MAC.
+ */
+static void poly1305_compute_mac(const iotex_poly1305_context* ctx, unsigned char mac[16])
+{
+	uint64_t d;
+	uint32_t g0, g1, g2, g3, g4;
+	uint32_t acc0, acc1, acc2, acc3, acc4;
+	uint32_t mask;
+	uint32_t mask_inv;
+
+	acc0 = ctx->acc[0];
+	acc1 = ctx->acc[1];
+	acc2 = ctx->acc[2];
+	acc3 = ctx->acc[3];
+	acc4 = ctx->acc[4];
+
+	/* Before adding 's' we ensure that the accumulator is mod 2^130 - 5.
+	 * We do this by calculating acc - (2^130 - 5), then checking if
+	 * the 131st bit is set. If it is, then reduce: acc -= (2^130 - 5)
+	 */
+
+	/* Calculate acc + -(2^130 - 5) */
+	d = ((uint64_t)acc0 + 5U);
+	g0 = (uint32_t)d;
+	d = ((uint64_t)acc1 + (d >> 32));
+	g1 = (uint32_t)d;
+	d = ((uint64_t)acc2 + (d >> 32));
+	g2 = (uint32_t)d;
+	d = ((uint64_t)acc3 + (d >> 32));
+	g3 = (uint32_t)d;
+	g4 = acc4 + (uint32_t)(d >> 32U);
+
+	/* mask == 0xFFFFFFFF if 131st bit is set, otherwise mask == 0 */
+	mask = (uint32_t)0U - (g4 >> 2U);
+	mask_inv = ~mask;
+
+	/* If 131st bit is set then acc=g, otherwise, acc is unmodified */
+	acc0 = (acc0 & mask_inv) | (g0 & mask);
+	acc1 = (acc1 & mask_inv) | (g1 & mask);
+	acc2 = (acc2 & mask_inv) | (g2 & mask);
+	acc3 = (acc3 & mask_inv) | (g3 & mask);
+
+	/* Add 's' */
+	d = (uint64_t)acc0 + ctx->s[0];
+	acc0 = (uint32_t)d;
+	d = (uint64_t)acc1 + ctx->s[1] + (d >> 32U);
+	acc1 = (uint32_t)d;
+	d = (uint64_t)acc2 + ctx->s[2] + (d >> 32U);
+	acc2 = (uint32_t)d;
+	acc3 += ctx->s[3] + (uint32_t)(d >> 32U);
+
+	/* Compute MAC (128 least significant bits of the accumulator) */
+	IOTEX_PUT_UINT32_LE(acc0, mac, 0);
+	IOTEX_PUT_UINT32_LE(acc1, mac, 4);
+	IOTEX_PUT_UINT32_LE(acc2, mac, 8);
+	IOTEX_PUT_UINT32_LE(acc3, mac, 12);
+}
+
+void iotex_poly1305_init(iotex_poly1305_context* ctx)
+{
+	iotex_platform_zeroize(ctx, sizeof(iotex_poly1305_context));
+}
+
+void iotex_poly1305_free(iotex_poly1305_context* ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	iotex_platform_zeroize(ctx, sizeof(iotex_poly1305_context));
+}
+
+int iotex_poly1305_starts(iotex_poly1305_context* ctx, const unsigned char key[32])
+{
+	/* r &= 0x0ffffffc0ffffffc0ffffffc0fffffff */
+	ctx->r[0] = IOTEX_GET_UINT32_LE(key, 0) & 0x0FFFFFFFU;
+	ctx->r[1] = IOTEX_GET_UINT32_LE(key, 4) & 0x0FFFFFFCU;
+	ctx->r[2] = IOTEX_GET_UINT32_LE(key, 8) & 0x0FFFFFFCU;
+	ctx->r[3] = IOTEX_GET_UINT32_LE(key, 12) & 0x0FFFFFFCU;
+
+	ctx->s[0] = IOTEX_GET_UINT32_LE(key, 16);
+	ctx->s[1] = IOTEX_GET_UINT32_LE(key, 20);
+	ctx->s[2] = IOTEX_GET_UINT32_LE(key, 24);
+	ctx->s[3] = IOTEX_GET_UINT32_LE(key, 28);
+
+	/* Initial accumulator state */
+	ctx->acc[0] = 0U;
+	ctx->acc[1] = 0U;
+	ctx->acc[2] = 0U;
+	ctx->acc[3] = 0U;
+	ctx->acc[4] = 0U;
+
+	/* Queue initially empty */
+	iotex_platform_zeroize(ctx->queue, sizeof(ctx->queue));
+	ctx->queue_len = 0U;
+
+	return (0);
+}
+
+int iotex_poly1305_update(iotex_poly1305_context* ctx, const unsigned char* input, size_t ilen)
+{
+	size_t offset = 0U;
+	size_t remaining = ilen;
+	size_t queue_free_len;
+	size_t nblocks;
+
+	if((remaining > 0U) && (ctx->queue_len > 0U))
+	{
+		queue_free_len = (POLY1305_BLOCK_SIZE_BYTES - ctx->queue_len);
+
+		if(ilen < queue_free_len)
+		{
+			/* Not enough data to complete the block.
+			 * Store this data with the other leftovers.
+			 */
+			memcpy(&ctx->queue[ctx->queue_len], input, ilen);
+
+			ctx->queue_len += ilen;
+
+			remaining = 0U;
+		}
+		else
+		{
+			/* Enough data to produce a complete block */
+			memcpy(&ctx->queue[ctx->queue_len], input, queue_free_len);
+
+			ctx->queue_len = 0U;
+
+			poly1305_process(ctx, 1U, ctx->queue, 1U); /* add padding bit */
+
+			offset += queue_free_len;
+			remaining -= queue_free_len;
+		}
+	}
+
+	if(remaining >= POLY1305_BLOCK_SIZE_BYTES)
+	{
+		nblocks = remaining / POLY1305_BLOCK_SIZE_BYTES;
+
+		poly1305_process(ctx, nblocks, &input[offset], 1U);
+
+		offset += nblocks * POLY1305_BLOCK_SIZE_BYTES;
+		remaining %= POLY1305_BLOCK_SIZE_BYTES;
+	}
+
+	if(remaining > 0U)
+	{
+		/* Store partial block */
+		ctx->queue_len = remaining;
+		memcpy(ctx->queue, &input[offset], remaining);
+	}
+
+	return (0);
+}
+
+int iotex_poly1305_finish(iotex_poly1305_context* ctx, unsigned char mac[16])
+{
+	/* Process any leftover data */
+	if(ctx->queue_len > 0U)
+	{
+		/* Add padding bit */
+		ctx->queue[ctx->queue_len] = 1U;
+		ctx->queue_len++;
+
+		/* Pad with zeroes */
+		memset(&ctx->queue[ctx->queue_len], 0, POLY1305_BLOCK_SIZE_BYTES - ctx->queue_len);
+
+		poly1305_process(ctx, 1U,		  /* Process 1 block */
+						 ctx->queue, 0U); /* Already padded above */
+	}
+
+	poly1305_compute_mac(ctx, mac);
+
+	return (0);
+}
+
+int iotex_poly1305_mac(const unsigned char key[32], const unsigned char* input, size_t ilen,
+					   unsigned char mac[16])
+{
+	iotex_poly1305_context ctx;
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+
+	iotex_poly1305_init(&ctx);
+
+	ret = iotex_poly1305_starts(&ctx, key);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_poly1305_update(&ctx, input, ilen);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_poly1305_finish(&ctx, mac);
+
+cleanup:
+	iotex_poly1305_free(&ctx);
+	return (ret);
+}
+	#endif /* IOTEX_POLY1305_C */
+
+/****************************************************************/
+/* CHACHAPOLY */
+/****************************************************************/
+	#if defined(IOTEX_CHACHAPOLY_C)
+
+		#define CHACHAPOLY_STATE_INIT (0)
+		#define CHACHAPOLY_STATE_AAD (1)
+		#define CHACHAPOLY_STATE_CIPHERTEXT (2) /* Encrypting or decrypting */
+		#define CHACHAPOLY_STATE_FINISHED (3)
+
+/**
+ * \brief           Adds nul bytes to pad the AAD for Poly1305.
+ *
+ * \param ctx       The ChaCha20-Poly1305 context.
+ */
+static int chachapoly_pad_aad(iotex_chachapoly_context* ctx)
+{
+	uint32_t partial_block_len = (uint32_t)(ctx->aad_len % 16U);
+	unsigned char zeroes[15];
+
+	if(partial_block_len == 0U)
+		return (0);
+
+	memset(zeroes, 0, sizeof(zeroes));
+
+	return (iotex_poly1305_update(&ctx->poly1305_ctx, zeroes, 16U - partial_block_len));
+}
+
+/**
+ * \brief           Adds nul bytes to pad the ciphertext for Poly1305.
+ *
+ * \param ctx       The ChaCha20-Poly1305 context.
+ */
+static int chachapoly_pad_ciphertext(iotex_chachapoly_context* ctx)
+{
+	uint32_t partial_block_len = (uint32_t)(ctx->ciphertext_len % 16U);
+	unsigned char zeroes[15];
+
+	if(partial_block_len == 0U)
+		return (0);
+
+	memset(zeroes, 0, sizeof(zeroes));
+	return (iotex_poly1305_update(&ctx->poly1305_ctx, zeroes, 16U - partial_block_len));
+}
+
+void iotex_chachapoly_init(iotex_chachapoly_context* ctx)
+{
+	iotex_chacha20_init(&ctx->chacha20_ctx);
+	iotex_poly1305_init(&ctx->poly1305_ctx);
+	ctx->aad_len = 0U;
+	ctx->ciphertext_len = 0U;
+	ctx->state = CHACHAPOLY_STATE_INIT;
+	ctx->mode = IOTEX_CHACHAPOLY_ENCRYPT;
+}
+
+void iotex_chachapoly_free(iotex_chachapoly_context* ctx)
+{
+	if(ctx == NULL)
+		return;
+
+	iotex_chacha20_free(&ctx->chacha20_ctx);
+	iotex_poly1305_free(&ctx->poly1305_ctx);
+	ctx->aad_len = 0U;
+	ctx->ciphertext_len = 0U;
+	ctx->state = CHACHAPOLY_STATE_INIT;
+	ctx->mode = IOTEX_CHACHAPOLY_ENCRYPT;
+}
+
+int iotex_chachapoly_setkey(iotex_chachapoly_context* ctx, const unsigned char key[32])
+{
+	return (iotex_chacha20_setkey(&ctx->chacha20_ctx, key));
+}
+
+int iotex_chachapoly_starts(iotex_chachapoly_context* ctx, const unsigned char nonce[12],
+							iotex_chachapoly_mode_t mode)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char poly1305_key[64];
+
+	/* Set counter = 0, will be update to 1 when generating Poly1305 key */
+	ret = iotex_chacha20_starts(&ctx->chacha20_ctx, nonce, 0U);
+	if(ret != 0)
+		goto cleanup;
+
+	/* Generate the Poly1305 key by getting the ChaCha20 keystream output with
+	 * counter = 0.  This is the same as encrypting a buffer of zeroes.
+	 * Only the first 256-bits (32 bytes) of the key is used for Poly1305.
+	 * The other 256 bits are discarded.
+	 */
+	memset(poly1305_key, 0, sizeof(poly1305_key));
+	ret = iotex_chacha20_update(&ctx->chacha20_ctx, sizeof(poly1305_key), poly1305_key,
+								poly1305_key);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_poly1305_starts(&ctx->poly1305_ctx, poly1305_key);
+
+	if(ret == 0)
+	{
+		ctx->aad_len = 0U;
+		ctx->ciphertext_len = 0U;
+		ctx->state = CHACHAPOLY_STATE_AAD;
+		ctx->mode = mode;
+	}
+
+cleanup:
+	iotex_platform_zeroize(poly1305_key, 64U);
+	return (ret);
+}
+
+int iotex_chachapoly_update_aad(iotex_chachapoly_context* ctx, const unsigned char* aad,
+								size_t aad_len)
+{
+	if(ctx->state != CHACHAPOLY_STATE_AAD)
+		return (IOTEX_ERR_CHACHAPOLY_BAD_STATE);
+
+	ctx->aad_len += aad_len;
+
+	return (iotex_poly1305_update(&ctx->poly1305_ctx, aad, aad_len));
+}
+
+int iotex_chachapoly_update(iotex_chachapoly_context* ctx, size_t len, const unsigned char* input,
+							unsigned char* output)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+
+	if((ctx->state != CHACHAPOLY_STATE_AAD) && (ctx->state != CHACHAPOLY_STATE_CIPHERTEXT))
+		return (IOTEX_ERR_CHACHAPOLY_BAD_STATE);
+
+	if(ctx->state == CHACHAPOLY_STATE_AAD)
+	{
+		ctx->state = CHACHAPOLY_STATE_CIPHERTEXT;
+
+		ret = chachapoly_pad_aad(ctx);
+		if(ret != 0)
+			return (ret);
+	}
+
+	ctx->ciphertext_len += len;
+
+	if(ctx->mode == IOTEX_CHACHAPOLY_ENCRYPT)
+	{
+		ret = iotex_chacha20_update(&ctx->chacha20_ctx, len, input, output);
+		if(ret != 0)
+			return (ret);
+
+		ret = iotex_poly1305_update(&ctx->poly1305_ctx, output, len);
+		if(ret != 0)
+			return (ret);
+	}
+	else /* DECRYPT */
+	{
+		ret = iotex_poly1305_update(&ctx->poly1305_ctx, input, len);
+		if(ret != 0)
+			return (ret);
+
+		ret = iotex_chacha20_update(&ctx->chacha20_ctx, len, input, output);
+		if(ret != 0)
+			return (ret);
+	}
+
+	return (0);
+}
+
+int iotex_chachapoly_finish(iotex_chachapoly_context* ctx, unsigned char mac[16])
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char len_block[16];
+
+	if(ctx->state == CHACHAPOLY_STATE_INIT)
+		return (IOTEX_ERR_CHACHAPOLY_BAD_STATE);
+
+	if(ctx->state == CHACHAPOLY_STATE_AAD)
+	{
+		ret = chachapoly_pad_aad(ctx);
+		if(ret != 0)
+			return (ret);
+	}
+	else if(ctx->state == CHACHAPOLY_STATE_CIPHERTEXT)
+	{
+		ret = chachapoly_pad_ciphertext(ctx);
+		if(ret != 0)
+			return (ret);
+	}
+
+	ctx->state = CHACHAPOLY_STATE_FINISHED;
+
+	/* The lengths of the AAD and ciphertext are processed by
+	 * Poly1305 as the final 128-bit block, encoded as little-endian integers.
+	 */
+	IOTEX_PUT_UINT64_LE(ctx->aad_len, len_block, 0);
+	IOTEX_PUT_UINT64_LE(ctx->ciphertext_len, len_block, 8);
+
+	ret = iotex_poly1305_update(&ctx->poly1305_ctx, len_block, 16U);
+	if(ret != 0)
+		return (ret);
+
+	ret = iotex_poly1305_finish(&ctx->poly1305_ctx, mac);
+
+	return (ret);
+}
+
+static int chachapoly_crypt_and_tag(iotex_chachapoly_context* ctx, iotex_chachapoly_mode_t mode,
+									size_t length, const unsigned char nonce[12],
+									const unsigned char* aad, size_t aad_len,
+									const unsigned char* input, unsigned char* output,
+									unsigned char tag[16])
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+
+	ret = iotex_chachapoly_starts(ctx, nonce, mode);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_chachapoly_update_aad(ctx, aad, aad_len);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_chachapoly_update(ctx, length, input, output);
+	if(ret != 0)
+		goto cleanup;
+
+	ret = iotex_chachapoly_finish(ctx, tag);
+
+cleanup:
+	return (ret);
+}
+
+int iotex_chachapoly_encrypt_and_tag(iotex_chachapoly_context* ctx, size_t length,
+									 const unsigned char nonce[12], const unsigned char* aad,
+									 size_t aad_len, const unsigned char* input,
+									 unsigned char* output, unsigned char tag[16])
+{
+	return (chachapoly_crypt_and_tag(ctx, IOTEX_CHACHAPOLY_ENCRYPT, length, nonce, aad, aad_len,
+									 input, output, tag));
+}
+
+int iotex_chachapoly_auth_decrypt(iotex_chachapoly_context* ctx, size_t length,
+								  const unsigned char nonce[12], const unsigned char* aad,
+								  size_t aad_len, const unsigned char tag[16],
+								  const unsigned char* input, unsigned char* output)
+{
+	int ret = IOTEX_ERR_ERROR_CORRUPTION_DETECTED;
+	unsigned char check_tag[16];
+
+	if((ret = chachapoly_crypt_and_tag(ctx, IOTEX_CHACHAPOLY_DECRYPT, length, nonce, aad, aad_len,
+									   input, output, check_tag)) != 0)
+	{
+		return (ret);
+	}
+
+	/* Check tag in "constant-time" */
+	if(iotex_psa_safer_memcmp(tag, check_tag, sizeof(check_tag)) != 0)
+	{
+		iotex_platform_zeroize(output, length);
+		iotex_platform_zeroize(check_tag, sizeof(check_tag));
+		return (IOTEX_ERR_CHACHAPOLY_AUTH_FAILED);
+	}
+
+	iotex_platform_zeroize(check_tag, sizeof(check_tag));
+	return (0);
+}
+	#endif /* IOTEX_CHACHAPOLY_C */
+
+/****************************************************************/
+/* RSA */
+/****************************************************************/
+inline void iotex_rsa_init(iotex_rsa_context* ctx)
+{
+	// TODO iotex_rsa_init( (iotex_rsa_context *)ctx );
+}
+
+inline int iotex_rsa_set_padding(iotex_rsa_context* ctx, int padding, iotex_md_type_t hash_id)
+{
+	// TODO iotex_rsa_set_padding((iotex_rsa_context *)ctx, padding, hash_id );
+	return 0;
+}
+
+inline int iotex_rsa_import(iotex_rsa_context* ctx, const iotex_mpi* N, const iotex_mpi* P,
+							const iotex_mpi* Q, const iotex_mpi* D, const iotex_mpi* E)
+{
+	// TODO iotex_rsa_import( (iotex_rsa_context *)ctx, (iotex_mpi *)N, (iotex_mpi *)P, (iotex_mpi
+	// *)Q, (iotex_mpi *)D, (iotex_mpi *)E );
+	return 0;
+}
+
+inline int iotex_rsa_import_raw(iotex_rsa_context* ctx, unsigned char const* N, size_t N_len,
+								unsigned char const* P, size_t P_len, unsigned char const* Q,
+								size_t Q_len, unsigned char const* D, size_t D_len,
+								unsigned char const* E, size_t E_len)
+{
+	// TODO iotex_rsa_import_raw( (iotex_rsa_context *)ctx, N, N_len, P, P_len, Q, Q_len, D, D_len,
+	// E, E_len );
+	return 0;
+}
+
+inline int iotex_rsa_complete(iotex_rsa_context* ctx)
+{
+	// TODO iotex_rsa_complete( (iotex_rsa_context *)ctx );
+	return 0;
+}
+
+inline int iotex_rsa_export(const iotex_rsa_context* ctx, iotex_mpi* N, iotex_mpi* P, iotex_mpi* Q,
+							iotex_mpi* D, iotex_mpi* E)
+{
+	// TODO iotex_rsa_export( (iotex_rsa_context *)ctx,
+	//                    (iotex_mpi *)N, (iotex_mpi *)P, (iotex_mpi *)Q, (iotex_mpi *)D, (iotex_mpi
+	//                    *)E );
+	return 0;
+}
+
+inline int iotex_rsa_export_raw(const iotex_rsa_context* ctx, unsigned char* N, size_t N_len,
+								unsigned char* P, size_t P_len, unsigned char* Q, size_t Q_len,
+								unsigned char* D, size_t D_len, unsigned char* E, size_t E_len)
+{
+	// TODO iotex_rsa_export_raw( (iotex_rsa_context *)ctx, N, N_len, P, P_len, Q, Q_len, D, D_len,
+	// E, E_len );
+	return 0;
+}
+
+inline int iotex_rsa_export_crt(const iotex_rsa_context* ctx, iotex_mpi* DP, iotex_mpi* DQ,
+								iotex_mpi* QP)
+{
+	// TODO iotex_rsa_export_crt( (iotex_rsa_context *)ctx,
+	//                        (iotex_mpi *)DP, (iotex_mpi *)DQ, (iotex_mpi *)QP );
+	return 0;
+}
+
+inline size_t iotex_rsa_get_len(const iotex_rsa_context* ctx)
+{
+	// TODO iotex_rsa_get_len( (iotex_rsa_context *)ctx );
+	return 0;
+}
+
+inline int iotex_rsa_gen_key(iotex_rsa_context* ctx, int (*f_rng)(void*, unsigned char*, size_t),
+							 void* p_rng, unsigned int nbits, int exponent)
+{
+	// TODO iotex_rsa_gen_key( (iotex_rsa_context *)ctx, f_rng, p_rng, nbits, exponent );
+	return 0;
+}
+
+inline int iotex_rsa_check_pubkey(const iotex_rsa_context* ctx)
+{
+	// TODO iotex_rsa_check_pubkey( (iotex_rsa_context *)ctx );
+	return 0;
+}
+
+inline int iotex_rsa_check_privkey(const iotex_rsa_context* ctx)
+{
+	// TODO iotex_rsa_check_privkey( (iotex_rsa_context *)ctx );
+	return 0;
+}
+
+inline int iotex_rsa_check_pub_priv(const iotex_rsa_context* pub, const iotex_rsa_context* prv)
+{
+	// TODO iotex_rsa_check_pub_priv( (iotex_rsa_context *)pub, (iotex_rsa_context *)prv );
+	return 0;
+}
+
+inline int iotex_rsa_public(iotex_rsa_context* ctx, const unsigned char* input,
+							unsigned char* output)
+{
+	// TODO iotex_rsa_public( (iotex_rsa_context *)ctx,  input, output );
+	return 0;
+}
+
+inline int iotex_rsa_private(iotex_rsa_context* ctx, int (*f_rng)(void*, unsigned char*, size_t),
+							 void* p_rng, const unsigned char* input, unsigned char* output)
+{
+	// TODO iotex_rsa_private( (iotex_rsa_context *)ctx, f_rng, p_rng, input, output );
+	return 0;
+}
+
+inline int iotex_rsa_pkcs1_encrypt(iotex_rsa_context* ctx,
+								   int (*f_rng)(void*, unsigned char*, size_t), void* p_rng,
+								   size_t ilen, const unsigned char* input, unsigned char* output)
+{
+	// TODO iotex_rsa_pkcs1_encrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, ilen, input, output );
+	return 0;
+}
+
+inline int iotex_rsa_rsaes_pkcs1_v15_encrypt(iotex_rsa_context* ctx,
+											 int (*f_rng)(void*, unsigned char*, size_t),
+											 void* p_rng, size_t ilen, const unsigned char* input,
+											 unsigned char* output)
+{
+	// TODO iotex_rsa_rsaes_pkcs1_v15_encrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, ilen, input,
+	// output );
+	return 0;
+}
+
+inline int iotex_rsa_rsaes_oaep_encrypt(iotex_rsa_context* ctx,
+										int (*f_rng)(void*, unsigned char*, size_t), void* p_rng,
+										const unsigned char* label, size_t label_len, size_t ilen,
+										const unsigned char* input, unsigned char* output)
+{
+	// TODO iotex_rsa_rsaes_oaep_encrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, label, label_len,
+	// ilen, input, output );
+	return 0;
+}
+
+inline int iotex_rsa_pkcs1_decrypt(iotex_rsa_context* ctx,
+								   int (*f_rng)(void*, unsigned char*, size_t), void* p_rng,
+								   size_t* olen, const unsigned char* input, unsigned char* output,
+								   size_t output_max_len)
+{
+	// TODO iotex_rsa_pkcs1_decrypt( (iotex_rsa_context *)ctx, f_rng, p_rng, olen, input, output,
 	// output_max_len );
 	return 0;
 }
@@ -1996,6 +4353,38 @@ inline int iotex_ecdsa_sign(psa_key_type_t type, const uint8_t* key_buffer, size
 	return PSA_SUCCESS;
 }
 
+		#if defined(IOTEX_ECDSA_DETERMINISTIC)
+inline int iotex_ecdsa_sign_det(psa_key_type_t type, const uint8_t* key_buffer,
+								size_t key_buffer_size, const uint8_t* hash, size_t hash_length,
+								uint8_t* signature, size_t* signature_length)
+{
+	const struct uECC_Curve_t* curve;
+
+	switch(type)
+	{
+		case PSA_ECC_FAMILY_SECP_R1:
+
+			curve = uECC_secp256r1();
+
+			break;
+		case PSA_ECC_FAMILY_SECP_K1:
+
+			curve = uECC_secp256k1();
+
+			break;
+		default:
+			return PSA_ERROR_NOT_SUPPORTED;
+	}
+
+	if(!uECC_sign_deterministic(key_buffer, hash, hash_length, signature, curve))
+		return PSA_ERROR_GENERIC_ERROR;
+
+	*signature_length = 64;
+
+	return PSA_SUCCESS;
+}
+		#endif /* IOTEX_ECDSA_DETERMINISTIC */
+
 inline int iotex_ecdsa_verify(psa_key_type_t type, const uint8_t* key_buffer,
 							  size_t key_buffer_size, const uint8_t* hash, size_t hash_length,
 							  uint8_t* signature, size_t signature_length)
@@ -2025,7 +4414,7 @@ inline int iotex_ecdsa_verify(psa_key_type_t type, const uint8_t* key_buffer,
 	ret = uECC_verify(public_key, hash, hash_length, signature, curve);
 
 	if(0 == ret)
-		return PSA_ERROR_GENERIC_ERROR;
+		return PSA_ERROR_INVALID_SIGNATURE;
 
 	return PSA_SUCCESS;
 }
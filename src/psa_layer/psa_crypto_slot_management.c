@@ -24,6 +24,8 @@
 
 	#include "include/svc/crypto/psa_crypto_core.h"
 	#include "include/svc/crypto/psa_crypto_driver_wrappers.h"
+	#include "include/svc/crypto/psa_crypto_ecp.h"
+	#include "include/svc/crypto/psa_crypto_key_arena.h"
 	#include "include/svc/crypto/psa_crypto_slot_management.h"
 	#include "include/svc/crypto/psa_crypto_storage.h"
 	#if defined(IOTEX_PSA_CRYPTO_SE_C)
@@ -41,14 +43,389 @@
 
 	#define ARRAY_LENGTH(array) (sizeof(array) / sizeof(*(array)))
 
+	#if IOTEX_PSA_KEY_SLOT_COUNT > 32767
+		#error "IOTEX_PSA_KEY_SLOT_COUNT must fit the 16-bit slot numbers of the key index"
+	#endif
+
+	#define PSA_KEY_SLOT_MAP_WORDS(count) (((count) + 31) / 32)
+
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+		#if IOTEX_PSA_KEY_SLOT_CHUNK < 1
+			#error "IOTEX_PSA_KEY_SLOT_CHUNK must be at least 1"
+		#endif
+		/* Each chunk is twice the size of the previous one, so 16 chunks
+		 * reach any slot count that fits the 16-bit slot numbers. */
+		#define PSA_KEY_SLOT_CHUNKS 16
+	#else
+		/* 2 * IOTEX_PSA_KEY_SLOT_COUNT rounded up to a power of two, so that the
+		 * key identifier index is at most half full and probes wrap with a mask. */
+		#define PSA_KEY_INDEX_SMEAR_1(n) ((n) | ((n) >> 1))
+		#define PSA_KEY_INDEX_SMEAR_2(n) (PSA_KEY_INDEX_SMEAR_1(n) | (PSA_KEY_INDEX_SMEAR_1(n) >> 2))
+		#define PSA_KEY_INDEX_SMEAR_4(n) (PSA_KEY_INDEX_SMEAR_2(n) | (PSA_KEY_INDEX_SMEAR_2(n) >> 4))
+		#define PSA_KEY_INDEX_SMEAR_8(n) (PSA_KEY_INDEX_SMEAR_4(n) | (PSA_KEY_INDEX_SMEAR_4(n) >> 8))
+		#define PSA_KEY_INDEX_SIZE (PSA_KEY_INDEX_SMEAR_8(2 * IOTEX_PSA_KEY_SLOT_COUNT - 1) + 1)
+
+static psa_key_slot_t key_slot_storage[IOTEX_PSA_KEY_SLOT_COUNT];
+static psa_key_slot_index_entry_t key_index_storage[PSA_KEY_INDEX_SIZE];
+static uint16_t free_slot_storage[IOTEX_PSA_KEY_SLOT_COUNT];
+static uint32_t free_slot_map_storage[PSA_KEY_SLOT_MAP_WORDS(IOTEX_PSA_KEY_SLOT_COUNT)];
+static uint16_t lru_next_storage[IOTEX_PSA_KEY_SLOT_COUNT + 1];
+static uint16_t lru_prev_storage[IOTEX_PSA_KEY_SLOT_COUNT + 1];
+	#endif
+
 typedef struct
 {
-	psa_key_slot_t key_slots[IOTEX_PSA_KEY_SLOT_COUNT];
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	/* Chunk k holds IOTEX_PSA_KEY_SLOT_CHUNK << k slots, or fewer for the
+	 * last one, so that slots never move once handed out. */
+	psa_key_slot_t* key_slot_chunks[PSA_KEY_SLOT_CHUNKS];
+	size_t key_slot_chunk_count;
+	#endif
+	/* Number of slots in the table, at most IOTEX_PSA_KEY_SLOT_COUNT */
+	size_t key_slot_count;
+	/* Key identifier to slot number for the slots holding persistent keys */
+	psa_key_slot_index_t key_index;
+	/* Stack of empty slot numbers, and a bit per slot that is on it */
+	uint16_t* free_slots;
+	uint32_t* free_slot_map;
+	size_t free_slot_count;
+	/* Slots holding persistent keys, most recently used first. A circular
+	 * list whose head is node 0, slot n being node n + 1; slots off the list
+	 * link to themselves. */
+	uint16_t* lru_next;
+	uint16_t* lru_prev;
+	size_t cache_hits;
+	size_t cache_misses;
+	size_t cache_evictions;
 	unsigned key_slots_initialized : 1;
 } psa_global_data_t;
 
 static psa_global_data_t global_data;
 
+static psa_key_slot_t* psa_key_slot_at(size_t slot_idx)
+{
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	size_t chunk = 0, chunk_size = IOTEX_PSA_KEY_SLOT_CHUNK;
+
+	while(slot_idx >= chunk_size)
+	{
+		slot_idx -= chunk_size;
+		chunk_size <<= 1;
+		chunk++;
+	}
+	return (&global_data.key_slot_chunks[chunk][slot_idx]);
+	#else
+	return (&key_slot_storage[slot_idx]);
+	#endif
+}
+
+/* The number of a slot of the table, or PSA_KEY_SLOT_INDEX_NOT_FOUND for a
+ * pointer outside of it. */
+static size_t psa_key_slot_number(const psa_key_slot_t* slot)
+{
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	size_t chunk, first = 0, chunk_size = IOTEX_PSA_KEY_SLOT_CHUNK;
+
+	for(chunk = 0; chunk < global_data.key_slot_chunk_count; chunk++)
+	{
+		const psa_key_slot_t* base = global_data.key_slot_chunks[chunk];
+		size_t length = global_data.key_slot_count - first;
+
+		if(length > chunk_size)
+			length = chunk_size;
+		if(slot >= base && slot < base + length)
+			return (first + (size_t)(slot - base));
+
+		first += chunk_size;
+		chunk_size <<= 1;
+	}
+	#else
+	if(slot >= key_slot_storage && slot < key_slot_storage + IOTEX_PSA_KEY_SLOT_COUNT)
+		return ((size_t)(slot - key_slot_storage));
+	#endif
+
+	return (PSA_KEY_SLOT_INDEX_NOT_FOUND);
+}
+
+/* Fibonacci hashing: the multiplier spreads the sequential key identifiers
+ * that applications tend to use over the whole table. */
+static inline size_t psa_key_slot_index_hash(const psa_key_slot_index_t* index,
+											 psa_key_id_t key_id)
+{
+	return (((uint32_t)key_id * 0x9E3779B1u) >> 16) & index->mask;
+}
+
+void psa_key_slot_index_clear(const psa_key_slot_index_t* index)
+{
+	memset(index->entries, 0, (index->mask + 1) * sizeof(*index->entries));
+}
+
+void psa_key_slot_index_insert(const psa_key_slot_index_t* index, psa_key_id_t key_id,
+							   size_t slot_number)
+{
+	size_t i = psa_key_slot_index_hash(index, key_id);
+
+	while(index->entries[i].key_id != 0)
+		i = (i + 1) & index->mask;
+
+	index->entries[i].key_id = key_id;
+	index->entries[i].slot_number = (uint16_t)slot_number;
+}
+
+size_t psa_key_slot_index_find(const psa_key_slot_index_t* index, psa_key_id_t key_id)
+{
+	size_t i = psa_key_slot_index_hash(index, key_id);
+
+	for(; index->entries[i].key_id != 0; i = (i + 1) & index->mask)
+	{
+		if(index->entries[i].key_id == key_id)
+			return (index->entries[i].slot_number);
+	}
+
+	return (PSA_KEY_SLOT_INDEX_NOT_FOUND);
+}
+
+void psa_key_slot_index_remove(const psa_key_slot_index_t* index, psa_key_id_t key_id,
+							   size_t slot_number)
+{
+	size_t i = psa_key_slot_index_hash(index, key_id);
+	size_t j, home;
+
+	for(;; i = (i + 1) & index->mask)
+	{
+		if(index->entries[i].key_id == 0)
+			return;
+		if(index->entries[i].key_id == key_id && index->entries[i].slot_number == slot_number)
+			break;
+	}
+
+	/* Shift the rest of the probe run back instead of leaving a tombstone,
+	 * so lookups never walk over deleted entries. An entry can move into the
+	 * hole only if its home bucket is not between the hole and itself. */
+	for(j = (i + 1) & index->mask; index->entries[j].key_id != 0; j = (j + 1) & index->mask)
+	{
+		home = psa_key_slot_index_hash(index, index->entries[j].key_id);
+		if(((j - home) & index->mask) >= ((j - i) & index->mask))
+		{
+			index->entries[i] = index->entries[j];
+			i = j;
+		}
+	}
+	index->entries[i].key_id = 0;
+	index->entries[i].slot_number = 0;
+}
+
+static void psa_push_free_key_slot(size_t slot_idx)
+{
+	uint32_t bit = (uint32_t)1 << (slot_idx % 32);
+
+	if(global_data.free_slot_map[slot_idx / 32] & bit)
+		return;
+
+	global_data.free_slot_map[slot_idx / 32] |= bit;
+	global_data.free_slots[global_data.free_slot_count++] = (uint16_t)slot_idx;
+}
+
+static psa_key_slot_t* psa_pop_free_key_slot(void)
+{
+	size_t slot_idx;
+
+	if(global_data.free_slot_count == 0)
+		return (NULL);
+
+	slot_idx = global_data.free_slots[--global_data.free_slot_count];
+	global_data.free_slot_map[slot_idx / 32] &= ~((uint32_t)1 << (slot_idx % 32));
+
+	return (psa_key_slot_at(slot_idx));
+}
+
+	#define PSA_LRU_HEAD 0
+	#define PSA_LRU_NODE(slot_idx) ((slot_idx) + 1)
+
+static void psa_lru_unlink(size_t slot_idx)
+{
+	size_t node = PSA_LRU_NODE(slot_idx);
+	uint16_t next = global_data.lru_next[node];
+	uint16_t prev = global_data.lru_prev[node];
+
+	global_data.lru_next[prev] = next;
+	global_data.lru_prev[next] = prev;
+	global_data.lru_next[node] = global_data.lru_prev[node] = (uint16_t)node;
+}
+
+/* Move a slot to the most recently used end, linking it if it was off the
+ * list. */
+static void psa_lru_touch(size_t slot_idx)
+{
+	size_t node = PSA_LRU_NODE(slot_idx);
+	uint16_t first = global_data.lru_next[PSA_LRU_HEAD];
+
+	if(first == node)
+		return;
+
+	psa_lru_unlink(slot_idx);
+	first = global_data.lru_next[PSA_LRU_HEAD];
+	global_data.lru_next[node] = first;
+	global_data.lru_prev[node] = PSA_LRU_HEAD;
+	global_data.lru_prev[first] = (uint16_t)node;
+	global_data.lru_next[PSA_LRU_HEAD] = (uint16_t)node;
+}
+
+/* The least recently used unlocked persistent key slot, or NULL. Locked
+ * slots are skipped; only slots in use by an operation are locked, so the
+ * walk stops after a few steps. */
+static psa_key_slot_t* psa_lru_victim(void)
+{
+	size_t node;
+
+	for(node = global_data.lru_prev[PSA_LRU_HEAD]; node != PSA_LRU_HEAD;
+		node = global_data.lru_prev[node])
+	{
+		psa_key_slot_t* slot = psa_key_slot_at(node - 1);
+		if(!psa_is_key_slot_locked(slot))
+			return (slot);
+	}
+
+	return (NULL);
+}
+
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+static void psa_free_key_slots(void)
+{
+	size_t chunk;
+
+	for(chunk = 0; chunk < global_data.key_slot_chunk_count; chunk++)
+		iotex_free(global_data.key_slot_chunks[chunk]);
+	iotex_free(global_data.key_index.entries);
+	iotex_free(global_data.free_slots);
+	iotex_free(global_data.free_slot_map);
+	iotex_free(global_data.lru_next);
+	iotex_free(global_data.lru_prev);
+	memset(&global_data, 0, sizeof(global_data));
+}
+
+/* Replace *p_array by a zeroed array of new_size bytes starting with the
+ * old_size bytes of the old one. */
+static int psa_resize_key_slot_array(void* p_array, size_t old_size, size_t new_size)
+{
+	void* array = iotex_calloc(1, new_size);
+
+	if(array == NULL)
+		return (0);
+
+	if(*(void**)p_array != NULL)
+	{
+		memcpy(array, *(void**)p_array, old_size);
+		iotex_free(*(void**)p_array);
+	}
+	*(void**)p_array = array;
+	return (1);
+}
+
+/* Add the next chunk of slots to the table and put them on the free list.
+ * Returns 0 if the table is already at IOTEX_PSA_KEY_SLOT_COUNT slots or
+ * memory runs out, in which case the table is left as it was. */
+static int psa_grow_key_slots(void)
+{
+	size_t old_count = global_data.key_slot_count;
+	size_t chunk_size = (size_t)IOTEX_PSA_KEY_SLOT_CHUNK << global_data.key_slot_chunk_count;
+	size_t new_count, index_size, slot_idx, node;
+	psa_key_slot_index_t key_index = {NULL, 0};
+	psa_key_slot_t* chunk;
+
+	if(old_count >= IOTEX_PSA_KEY_SLOT_COUNT)
+		return (0);
+	if(chunk_size > IOTEX_PSA_KEY_SLOT_COUNT - old_count)
+		chunk_size = IOTEX_PSA_KEY_SLOT_COUNT - old_count;
+	new_count = old_count + chunk_size;
+
+	chunk = iotex_calloc(chunk_size, sizeof(*chunk));
+	if(chunk == NULL)
+		return (0);
+
+	/* Keep the key identifier index at most half full */
+	for(index_size = 2; index_size < 2 * new_count; index_size <<= 1)
+		;
+	if(index_size > global_data.key_index.mask + 1)
+	{
+		key_index.entries = iotex_calloc(index_size, sizeof(*key_index.entries));
+		key_index.mask = index_size - 1;
+	}
+
+	/* The side arrays only grow, so one that was resized before a later
+	 * failure stays valid for the old table. */
+	if((index_size > global_data.key_index.mask + 1 && key_index.entries == NULL) ||
+	   !psa_resize_key_slot_array(&global_data.free_slots, old_count * sizeof(uint16_t),
+								  new_count * sizeof(uint16_t)) ||
+	   !psa_resize_key_slot_array(&global_data.free_slot_map,
+								  PSA_KEY_SLOT_MAP_WORDS(old_count) * sizeof(uint32_t),
+								  PSA_KEY_SLOT_MAP_WORDS(new_count) * sizeof(uint32_t)) ||
+	   !psa_resize_key_slot_array(&global_data.lru_next, (old_count + 1) * sizeof(uint16_t),
+								  (new_count + 1) * sizeof(uint16_t)) ||
+	   !psa_resize_key_slot_array(&global_data.lru_prev, (old_count + 1) * sizeof(uint16_t),
+								  (new_count + 1) * sizeof(uint16_t)))
+	{
+		iotex_free(key_index.entries);
+		iotex_free(chunk);
+		return (0);
+	}
+
+	if(key_index.entries != NULL)
+	{
+		if(global_data.key_index.entries != NULL)
+		{
+			for(slot_idx = 0; slot_idx <= global_data.key_index.mask; slot_idx++)
+			{
+				const psa_key_slot_index_entry_t* entry = &global_data.key_index.entries[slot_idx];
+				if(entry->key_id != 0)
+					psa_key_slot_index_insert(&key_index, entry->key_id, entry->slot_number);
+			}
+			iotex_free(global_data.key_index.entries);
+		}
+		global_data.key_index = key_index;
+	}
+
+	if(old_count == 0)
+		global_data.lru_next[PSA_LRU_HEAD] = global_data.lru_prev[PSA_LRU_HEAD] = PSA_LRU_HEAD;
+	for(node = PSA_LRU_NODE(old_count); node <= new_count; node++)
+		global_data.lru_next[node] = global_data.lru_prev[node] = (uint16_t)node;
+
+	global_data.key_slot_chunks[global_data.key_slot_chunk_count++] = chunk;
+	global_data.key_slot_count = new_count;
+	for(slot_idx = new_count; slot_idx-- > old_count;)
+		psa_push_free_key_slot(slot_idx);
+
+	return (1);
+}
+	#endif /* IOTEX_PSA_KEY_SLOT_DYNAMIC */
+
+void psa_index_key_slot(psa_key_slot_t* slot)
+{
+	psa_key_id_t key_id = IOTEX_SVC_KEY_ID_GET_KEY_ID(slot->attr.id);
+	size_t slot_idx = psa_key_slot_number(slot);
+
+	if(key_id != 0 && !psa_key_id_is_volatile(key_id))
+	{
+		psa_key_slot_index_insert(&global_data.key_index, key_id, slot_idx);
+		psa_lru_touch(slot_idx);
+	}
+}
+
+void psa_release_key_slot(psa_key_slot_t* slot)
+{
+	psa_key_id_t key_id = IOTEX_SVC_KEY_ID_GET_KEY_ID(slot->attr.id);
+	size_t slot_idx = psa_key_slot_number(slot);
+
+	if(slot_idx == PSA_KEY_SLOT_INDEX_NOT_FOUND)
+		return;
+
+	if(key_id != 0 && !psa_key_id_is_volatile(key_id))
+		psa_key_slot_index_remove(&global_data.key_index, key_id, slot_idx);
+
+	psa_lru_unlink(slot_idx);
+	psa_push_free_key_slot(slot_idx);
+}
+
 int psa_is_valid_key_id(iotex_svc_key_id_t key, int vendor_ok)
 {
 	psa_key_id_t key_id = IOTEX_SVC_KEY_ID_GET_KEY_ID(key);
@@ -103,7 +480,10 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(iotex_svc_key_id_t key,
 
 	if(psa_key_id_is_volatile(key_id))
 	{
-		slot = &global_data.key_slots[key_id - PSA_KEY_ID_VOLATILE_MIN];
+		slot_idx = key_id - PSA_KEY_ID_VOLATILE_MIN;
+		if(slot_idx >= global_data.key_slot_count)
+			return (PSA_ERROR_DOES_NOT_EXIST);
+		slot = psa_key_slot_at(slot_idx);
 
 		/*
 		 * Check if both the PSA key identifier key_id and the owner
@@ -121,13 +501,11 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(iotex_svc_key_id_t key,
 		if(!psa_is_valid_key_id(key, 1))
 			return (PSA_ERROR_INVALID_HANDLE);
 
-		for(slot_idx = 0; slot_idx < IOTEX_PSA_KEY_SLOT_COUNT; slot_idx++)
-		{
-			slot = &global_data.key_slots[slot_idx];
-			if(iotex_svc_key_id_equal(key, slot->attr.id))
-				break;
-		}
-		status = (slot_idx < IOTEX_PSA_KEY_SLOT_COUNT) ? PSA_SUCCESS : PSA_ERROR_DOES_NOT_EXIST;
+		slot_idx = psa_key_slot_index_find(&global_data.key_index, key_id);
+		if(slot_idx != PSA_KEY_SLOT_INDEX_NOT_FOUND)
+			slot = psa_key_slot_at(slot_idx);
+		status = (slot_idx != PSA_KEY_SLOT_INDEX_NOT_FOUND) ? PSA_SUCCESS
+															: PSA_ERROR_DOES_NOT_EXIST;
 	}
 
 	if(status == PSA_SUCCESS)
@@ -143,9 +521,43 @@ static psa_status_t psa_get_and_lock_key_slot_in_memory(iotex_svc_key_id_t key,
 
 psa_status_t psa_initialize_key_slots(void)
 {
-	/* Nothing to do: program startup and psa_wipe_all_key_slots() both
-	 * guarantee that the key slots are initialized to all-zero, which
-	 * means that all the key slots are in a valid, empty state. */
+	size_t slot_idx;
+
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	/* Start with one chunk, the table grows as keys are created */
+	if(global_data.key_slot_count == 0 && !psa_grow_key_slots())
+		return (PSA_ERROR_INSUFFICIENT_MEMORY);
+	#else
+	global_data.key_slot_count = IOTEX_PSA_KEY_SLOT_COUNT;
+	global_data.key_index.entries = key_index_storage;
+	global_data.key_index.mask = PSA_KEY_INDEX_SIZE - 1;
+	global_data.free_slots = free_slot_storage;
+	global_data.free_slot_map = free_slot_map_storage;
+	global_data.lru_next = lru_next_storage;
+	global_data.lru_prev = lru_prev_storage;
+	#endif
+
+	/* Program startup and psa_wipe_all_key_slots() both guarantee that the
+	 * key slots are initialized to all-zero, which means that all the key
+	 * slots are in a valid, empty state. Rebuild the index, the free list and
+	 * the LRU list to match, lowest slot on top of the free list so that
+	 * slots fill up in order. */
+	psa_key_slot_index_clear(&global_data.key_index);
+	memset(global_data.free_slot_map, 0,
+		   PSA_KEY_SLOT_MAP_WORDS(global_data.key_slot_count) * sizeof(uint32_t));
+	global_data.free_slot_count = 0;
+	for(slot_idx = 0; slot_idx <= global_data.key_slot_count; slot_idx++)
+		global_data.lru_next[slot_idx] = global_data.lru_prev[slot_idx] = (uint16_t)slot_idx;
+	global_data.cache_hits = global_data.cache_misses = global_data.cache_evictions = 0;
+	for(slot_idx = global_data.key_slot_count; slot_idx-- > 0;)
+	{
+		psa_key_slot_t* slot = psa_key_slot_at(slot_idx);
+		if(psa_is_key_slot_occupied(slot) || psa_is_key_slot_locked(slot))
+			psa_index_key_slot(slot);
+		else
+			psa_push_free_key_slot(slot_idx);
+	}
+
 	global_data.key_slots_initialized = 1;
 	return (PSA_SUCCESS);
 }
@@ -154,19 +566,21 @@ void psa_wipe_all_key_slots(void)
 {
 	size_t slot_idx;
 
-	for(slot_idx = 0; slot_idx < IOTEX_PSA_KEY_SLOT_COUNT; slot_idx++)
+	for(slot_idx = 0; slot_idx < global_data.key_slot_count; slot_idx++)
 	{
-		psa_key_slot_t* slot = &global_data.key_slots[slot_idx];
+		psa_key_slot_t* slot = psa_key_slot_at(slot_idx);
 		slot->lock_count = 1;
 		(void)psa_wipe_key_slot(slot);
 	}
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	psa_free_key_slots();
+	#endif
 	global_data.key_slots_initialized = 0;
 }
 
 psa_status_t psa_get_empty_key_slot(psa_key_id_t* volatile_key_id, psa_key_slot_t** p_slot)
 {
 	psa_status_t status = PSA_ERROR_CORRUPTION_DETECTED;
-	size_t slot_idx;
 	psa_key_slot_t *selected_slot, *unlocked_persistent_key_slot;
 
 	if(!global_data.key_slots_initialized)
@@ -175,33 +589,30 @@ psa_status_t psa_get_empty_key_slot(psa_key_id_t* volatile_key_id, psa_key_slot_
 		goto error;
 	}
 
-	selected_slot = unlocked_persistent_key_slot = NULL;
-	for(slot_idx = 0; slot_idx < IOTEX_PSA_KEY_SLOT_COUNT; slot_idx++)
-	{
-		psa_key_slot_t* slot = &global_data.key_slots[slot_idx];
-		if(!psa_is_key_slot_occupied(slot))
-		{
-			selected_slot = slot;
-			break;
-		}
+	selected_slot = psa_pop_free_key_slot();
 
-		if((unlocked_persistent_key_slot == NULL) &&
-		   (!PSA_KEY_LIFETIME_IS_VOLATILE(slot->attr.lifetime)) && (!psa_is_key_slot_locked(slot)))
-			unlocked_persistent_key_slot = slot;
-	}
+	#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	/* Grow the table before evicting anything */
+	if(selected_slot == NULL && psa_grow_key_slots())
+		selected_slot = psa_pop_free_key_slot();
+	#endif
 
 	/*
 	 * If there is no unused key slot and there is at least one unlocked key
-	 * slot containing the description of a persistent key, recycle the first
-	 * such key slot we encountered. If we later need to operate on the
-	 * persistent key we are evicting now, we will reload its description from
-	 * storage.
+	 * slot containing the description of a persistent key, recycle the least
+	 * recently used one. If we later need to operate on the persistent key we
+	 * are evicting now, we will reload its description from storage.
 	 */
-	if((selected_slot == NULL) && (unlocked_persistent_key_slot != NULL))
+	if(selected_slot == NULL)
 	{
-		selected_slot = unlocked_persistent_key_slot;
-		selected_slot->lock_count = 1;
-		psa_wipe_key_slot(selected_slot);
+		unlocked_persistent_key_slot = psa_lru_victim();
+		if(unlocked_persistent_key_slot != NULL)
+		{
+			unlocked_persistent_key_slot->lock_count = 1;
+			psa_wipe_key_slot(unlocked_persistent_key_slot);
+			selected_slot = psa_pop_free_key_slot();
+			++global_data.cache_evictions;
+		}
 	}
 
 	if(selected_slot != NULL)
@@ -211,7 +622,7 @@ psa_status_t psa_get_empty_key_slot(psa_key_id_t* volatile_key_id, psa_key_slot_
 			goto error;
 
 		*volatile_key_id =
-			PSA_KEY_ID_VOLATILE_MIN + ((psa_key_id_t)(selected_slot - global_data.key_slots));
+			PSA_KEY_ID_VOLATILE_MIN + ((psa_key_id_t)psa_key_slot_number(selected_slot));
 		*p_slot = selected_slot;
 
 		return (PSA_SUCCESS);
@@ -259,6 +670,16 @@ static psa_status_t psa_load_persistent_key_into_slot(psa_key_slot_t* slot)
 
 	status = psa_copy_key_material_into_slot(slot, key_data, key_data_length);
 
+		#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE_ENABLED)
+	if(status == PSA_SUCCESS)
+	{
+		/* The material was checked when the key was created, so a failure
+		 * here means the stored copy is damaged. */
+		if(iotex_psa_ecp_cache_public_point(slot) != PSA_SUCCESS)
+			status = PSA_ERROR_DATA_CORRUPT;
+	}
+		#endif
+
 exit:
 	psa_free_persistent_key_data(key_data, key_data_length);
 	return (status);
@@ -343,6 +764,16 @@ psa_status_t psa_get_and_lock_key_slot(iotex_svc_key_id_t key, psa_key_slot_t**
 	 * thus no need to unlock the key slot here.
 	 */
 	status = psa_get_and_lock_key_slot_in_memory(key, p_slot);
+	if(!psa_key_id_is_volatile(IOTEX_SVC_KEY_ID_GET_KEY_ID(key)))
+	{
+		if(status == PSA_SUCCESS)
+		{
+			++global_data.cache_hits;
+			psa_lru_touch(psa_key_slot_number(*p_slot));
+		}
+		else if(status == PSA_ERROR_DOES_NOT_EXIST)
+			++global_data.cache_misses;
+	}
 	if(status != PSA_ERROR_DOES_NOT_EXIST)
 		return (status);
 
@@ -350,12 +781,24 @@ psa_status_t psa_get_and_lock_key_slot(iotex_svc_key_id_t key, psa_key_slot_t**
 	#if defined(IOTEX_PSA_CRYPTO_STORAGE_C) || defined(IOTEX_PSA_CRYPTO_BUILTIN_KEYS)
 	psa_key_id_t volatile_key_id;
 
+		#if defined(IOTEX_PSA_CRYPTO_STORAGE_C)
+	/* Taking a slot can evict a loaded key, so look in storage first rather
+	 * than evict for a key that is not there. */
+	if(
+			#if defined(IOTEX_PSA_CRYPTO_BUILTIN_KEYS)
+		!psa_key_id_is_builtin(IOTEX_SVC_KEY_ID_GET_KEY_ID(key)) &&
+			#endif
+		!psa_is_key_present_in_storage(key))
+		return (PSA_ERROR_INVALID_HANDLE);
+		#endif
+
 	status = psa_get_empty_key_slot(&volatile_key_id, p_slot);
 	if(status != PSA_SUCCESS)
 		return (status);
 
 	(*p_slot)->attr.id = key;
 	(*p_slot)->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+	psa_index_key_slot(*p_slot);
 
 	status = PSA_ERROR_DOES_NOT_EXIST;
 		#if defined(IOTEX_PSA_CRYPTO_BUILTIN_KEYS)
@@ -521,9 +964,9 @@ void iotex_psa_get_stats(iotex_psa_stats_t* stats)
 
 	memset(stats, 0, sizeof(*stats));
 
-	for(slot_idx = 0; slot_idx < IOTEX_PSA_KEY_SLOT_COUNT; slot_idx++)
+	for(slot_idx = 0; slot_idx < global_data.key_slot_count; slot_idx++)
 	{
-		const psa_key_slot_t* slot = &global_data.key_slots[slot_idx];
+		const psa_key_slot_t* slot = psa_key_slot_at(slot_idx);
 		if(psa_is_key_slot_locked(slot))
 		{
 			++stats->locked_slots;
@@ -550,6 +993,24 @@ void iotex_psa_get_stats(iotex_psa_stats_t* stats)
 				stats->max_open_external_key_id = id;
 		}
 	}
+
+	stats->cache_hits = global_data.cache_hits;
+	stats->cache_misses = global_data.cache_misses;
+	stats->cache_evictions = global_data.cache_evictions;
+
+	stats->slot_capacity = global_data.key_slot_count;
+	if(global_data.key_slot_count != 0)
+	{
+		/* The slots, the free list and its map, the two LRU links of each
+		 * slot and of the head, and the key identifier index */
+		stats->slot_table_bytes =
+			global_data.key_slot_count * (sizeof(psa_key_slot_t) + 3 * sizeof(uint16_t)) +
+			PSA_KEY_SLOT_MAP_WORDS(global_data.key_slot_count) * sizeof(uint32_t) +
+			2 * sizeof(uint16_t) +
+			(global_data.key_index.mask + 1) * sizeof(psa_key_slot_index_entry_t);
+	}
+	iotex_psa_key_arena_get_stats(&stats->key_arena_bytes, &stats->key_arena_used_bytes,
+								  &stats->key_heap_bytes);
 }
 
 	#ifdef UNIT_TEST_BUILD
@@ -558,12 +1019,16 @@ void iotex_psa_get_stats(iotex_psa_stats_t* stats)
 
 void crypto_slot_management_reset_global_data(void)
 {
-	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+	for(size_t i = 0; i < global_data.key_slot_count; i++)
 	{
 		// Destroy the key at the slot
-		psa_destroy_key(&global_data.key_slots[i].key);
-		psa_wipe_key_slot(&global_data.key_slots[i]);
+		psa_destroy_key(&psa_key_slot_at(i)->key);
+		psa_wipe_key_slot(psa_key_slot_at(i));
 	}
+		#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+	psa_free_key_slots();
+		#endif
+	iotex_psa_key_arena_release();
 	global_data.key_slots_initialized = false;
 }
 
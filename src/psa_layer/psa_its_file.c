@@ -0,0 +1,464 @@
+/*
+ *  PSA ITS simulator over stdio files.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+/* syncfs() */
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+	#define _GNU_SOURCE
+#endif
+
+#include "include/common.h"
+
+#include "include/iotex/platform.h"
+
+#if defined(IOTEX_PSA_ITS_FILE_C)
+
+	#include "include/svc/crypto.h"
+	#include "include/svc/crypto/psa_crypto_its.h"
+
+	#include <errno.h>
+	#include <stdio.h>
+	#include <stdlib.h>
+	#include <string.h>
+
+	#if !defined(_WIN32)
+		#include <fcntl.h>
+		#include <unistd.h>
+	#endif
+
+	#define PSA_ITS_STORAGE_LOCATION_MAX 192
+	#define PSA_ITS_STORAGE_FILENAME_PATTERN "%08x%08x"
+	#define PSA_ITS_STORAGE_SUFFIX ".psa_its"
+	#define PSA_ITS_STORAGE_TEMP_SUFFIX ".psa_its.tmp"
+	/* The location, a separator, 16 hex digits, the longest suffix and the
+	 * terminating NUL */
+	#define PSA_ITS_STORAGE_FILENAME_LENGTH                                                        \
+		(PSA_ITS_STORAGE_LOCATION_MAX + 1 + 16 + sizeof(PSA_ITS_STORAGE_TEMP_SUFFIX))
+
+	#define PSA_ITS_MAGIC_STRING "PSA\0ITS\0"
+	#define PSA_ITS_MAGIC_LENGTH 8
+
+typedef struct
+{
+	uint8_t magic[PSA_ITS_MAGIC_LENGTH];
+	uint8_t size[sizeof(uint32_t)];
+	uint8_t flags[sizeof(psa_storage_create_flags_t)];
+} psa_its_file_header_t;
+
+static struct
+{
+	char location[PSA_ITS_STORAGE_LOCATION_MAX];
+	unsigned location_set : 1;
+	unsigned batching : 1;
+	/* Entries were removed while batching, and the location is not synced
+	 * since */
+	unsigned location_dirty : 1;
+	/* Entries written to their temporary file while batching, and not
+	 * renamed over the previous version yet */
+	psa_storage_uid_t pending[IOTEX_PSA_ITS_FILE_BATCH_SIZE];
+	size_t pending_count;
+} its_file;
+
+static const char* psa_its_location(void)
+{
+	return (its_file.location_set ? its_file.location : IOTEX_PSA_ITS_FILE_LOCATION);
+}
+
+static void psa_its_fill_filename(psa_storage_uid_t uid, const char* suffix, char* filename)
+{
+	const char* location = psa_its_location();
+	size_t length = strlen(location);
+	const char* separator = (length == 0 || location[length - 1] == '/') ? "" : "/";
+
+	snprintf(filename, PSA_ITS_STORAGE_FILENAME_LENGTH, "%s%s" PSA_ITS_STORAGE_FILENAME_PATTERN "%s",
+			 location, separator, (unsigned)(uid >> 32), (unsigned)(uid & 0xffffffff), suffix);
+}
+
+static size_t psa_its_find_pending(psa_storage_uid_t uid)
+{
+	size_t i;
+
+	for(i = 0; i < its_file.pending_count; i++)
+	{
+		if(its_file.pending[i] == uid)
+			return (i);
+	}
+	return (its_file.pending_count);
+}
+
+static psa_status_t psa_its_storage_error(void)
+{
+	return (errno == ENOSPC ? PSA_ERROR_INSUFFICIENT_STORAGE : PSA_ERROR_STORAGE_FAILURE);
+}
+
+	#if !defined(_WIN32)
+/* Make renames and removals in the storage directory durable */
+static psa_status_t psa_its_sync_location(void)
+{
+	const char* location = psa_its_location();
+	int fd = open(location[0] != '\0' ? location : ".", O_RDONLY);
+	int ret;
+
+	if(fd < 0)
+		return (PSA_ERROR_STORAGE_FAILURE);
+	ret = fsync(fd);
+	close(fd);
+	return (ret == 0 ? PSA_SUCCESS : PSA_ERROR_STORAGE_FAILURE);
+}
+	#endif
+
+static psa_status_t psa_its_replace(const char* temp_filename, const char* filename)
+{
+	#if defined(_WIN32)
+	/* rename() does not replace an existing file on Windows */
+	if(remove(filename) != 0 && errno != ENOENT)
+		return (PSA_ERROR_STORAGE_FAILURE);
+	#endif
+	if(rename(temp_filename, filename) != 0)
+		return (PSA_ERROR_STORAGE_FAILURE);
+	return (PSA_SUCCESS);
+}
+
+static psa_status_t psa_its_read_file(psa_storage_uid_t uid, struct psa_storage_info_t* p_info,
+									  FILE** p_stream)
+{
+	char filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+	psa_its_file_header_t header;
+	size_t n;
+
+	*p_stream = NULL;
+	psa_its_fill_filename(uid,
+						  psa_its_find_pending(uid) < its_file.pending_count
+							  ? PSA_ITS_STORAGE_TEMP_SUFFIX
+							  : PSA_ITS_STORAGE_SUFFIX,
+						  filename);
+	*p_stream = fopen(filename, "rb");
+	if(*p_stream == NULL)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+
+	n = fread(&header, 1, sizeof(header), *p_stream);
+	if(n != sizeof(header))
+		return (PSA_ERROR_DATA_CORRUPT);
+	if(memcmp(header.magic, PSA_ITS_MAGIC_STRING, PSA_ITS_MAGIC_LENGTH) != 0)
+		return (PSA_ERROR_DATA_CORRUPT);
+
+	p_info->size = IOTEX_GET_UINT32_LE(header.size, 0);
+	p_info->flags = IOTEX_GET_UINT32_LE(header.flags, 0);
+
+	return (PSA_SUCCESS);
+}
+
+psa_status_t psa_its_get_info(psa_storage_uid_t uid, struct psa_storage_info_t* p_info)
+{
+	psa_status_t status;
+	FILE* stream = NULL;
+
+	status = psa_its_read_file(uid, p_info, &stream);
+	if(stream != NULL)
+		fclose(stream);
+	return (status);
+}
+
+psa_status_t psa_its_get(psa_storage_uid_t uid, uint32_t data_offset, uint32_t data_length,
+						 void* p_data, size_t* p_data_length)
+{
+	psa_status_t status;
+	FILE* stream = NULL;
+	size_t n;
+	struct psa_storage_info_t info;
+
+	status = psa_its_read_file(uid, &info, &stream);
+	if(status != PSA_SUCCESS)
+		goto exit;
+	status = PSA_ERROR_INVALID_ARGUMENT;
+	if(data_offset + data_length < data_offset)
+		goto exit;
+	if(data_offset + data_length > info.size)
+		goto exit;
+
+	status = PSA_ERROR_STORAGE_FAILURE;
+	if(fseek(stream, (long)data_offset, SEEK_CUR) != 0)
+		goto exit;
+	n = fread(p_data, 1, data_length, stream);
+	if(n != data_length)
+		goto exit;
+	status = PSA_SUCCESS;
+	if(p_data_length != NULL)
+		*p_data_length = n;
+
+exit:
+	if(stream != NULL)
+		fclose(stream);
+	return (status);
+}
+
+psa_status_t psa_its_set(psa_storage_uid_t uid, uint32_t data_length, const void* p_data,
+						 psa_storage_create_flags_t create_flags)
+{
+	psa_status_t status;
+	char filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+	char temp_filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+	struct psa_storage_info_t info;
+	psa_its_file_header_t header;
+	FILE* stream;
+	size_t n;
+	int added;
+
+	if(create_flags & ~(psa_storage_create_flags_t)PSA_STORAGE_FLAG_WRITE_ONCE)
+		return (PSA_ERROR_NOT_SUPPORTED);
+	if(p_data == NULL && data_length != 0)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	status = psa_its_get_info(uid, &info);
+	if(status == PSA_SUCCESS && (info.flags & PSA_STORAGE_FLAG_WRITE_ONCE))
+		return (PSA_ERROR_NOT_PERMITTED);
+
+	/* A new entry needs room in the batch, which is only full if the last
+	 * flush failed */
+	added = its_file.batching && psa_its_find_pending(uid) == its_file.pending_count;
+	if(added && its_file.pending_count == IOTEX_PSA_ITS_FILE_BATCH_SIZE)
+	{
+		status = iotex_psa_its_file_flush();
+		if(status != PSA_SUCCESS)
+			return (status);
+	}
+
+	memcpy(header.magic, PSA_ITS_MAGIC_STRING, PSA_ITS_MAGIC_LENGTH);
+	IOTEX_PUT_UINT32_LE(data_length, header.size, 0);
+	IOTEX_PUT_UINT32_LE(create_flags, header.flags, 0);
+
+	/* Write the new version next to the old one, which stays in place until
+	 * the new one is complete, so a crash leaves one or the other. */
+	psa_its_fill_filename(uid, PSA_ITS_STORAGE_TEMP_SUFFIX, temp_filename);
+	psa_its_fill_filename(uid, PSA_ITS_STORAGE_SUFFIX, filename);
+	stream = fopen(temp_filename, "wb");
+	if(stream == NULL)
+		return (psa_its_storage_error());
+
+	status = PSA_SUCCESS;
+	n = fwrite(&header, 1, sizeof(header), stream);
+	if(n == sizeof(header) && data_length != 0)
+		n += fwrite(p_data, 1, data_length, stream);
+	if(n != sizeof(header) + data_length || fflush(stream) != 0)
+		status = psa_its_storage_error();
+	#if !defined(_WIN32)
+	/* While batching, the data goes to disk in iotex_psa_its_file_flush() */
+	else if(!its_file.batching && fsync(fileno(stream)) != 0)
+		status = psa_its_storage_error();
+	#endif
+	if(fclose(stream) != 0 && status == PSA_SUCCESS)
+		status = psa_its_storage_error();
+
+	if(status != PSA_SUCCESS)
+	{
+		/* Forget a pending earlier version as well; its temporary file was
+		 * truncated by the failed write. */
+		size_t i = psa_its_find_pending(uid);
+		if(i < its_file.pending_count)
+			its_file.pending[i] = its_file.pending[--its_file.pending_count];
+		(void)remove(temp_filename);
+		return (status);
+	}
+
+	if(its_file.batching)
+	{
+		if(!added)
+			return (PSA_SUCCESS);
+		its_file.pending[its_file.pending_count++] = uid;
+		if(its_file.pending_count < IOTEX_PSA_ITS_FILE_BATCH_SIZE)
+			return (PSA_SUCCESS);
+		status = iotex_psa_its_file_flush();
+		if(status != PSA_SUCCESS)
+		{
+			/* The caller sees this write fail, so it must not be committed
+			 * by a later flush */
+			size_t i = psa_its_find_pending(uid);
+			if(i < its_file.pending_count)
+			{
+				its_file.pending[i] = its_file.pending[--its_file.pending_count];
+				(void)remove(temp_filename);
+			}
+		}
+		return (status);
+	}
+
+	status = psa_its_replace(temp_filename, filename);
+	if(status != PSA_SUCCESS)
+	{
+		(void)remove(temp_filename);
+		return (status);
+	}
+	#if !defined(_WIN32)
+	status = psa_its_sync_location();
+	#endif
+	return (status);
+}
+
+psa_status_t psa_its_remove(psa_storage_uid_t uid)
+{
+	psa_status_t status;
+	char filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+	struct psa_storage_info_t info;
+	size_t i;
+
+	status = psa_its_get_info(uid, &info);
+	if(status != PSA_SUCCESS && status != PSA_ERROR_DATA_CORRUPT)
+		return (status);
+	if(status == PSA_SUCCESS && (info.flags & PSA_STORAGE_FLAG_WRITE_ONCE))
+		return (PSA_ERROR_NOT_PERMITTED);
+
+	i = psa_its_find_pending(uid);
+	if(i < its_file.pending_count)
+	{
+		its_file.pending[i] = its_file.pending[--its_file.pending_count];
+		psa_its_fill_filename(uid, PSA_ITS_STORAGE_TEMP_SUFFIX, filename);
+		if(remove(filename) != 0)
+			return (PSA_ERROR_STORAGE_FAILURE);
+	}
+
+	psa_its_fill_filename(uid, PSA_ITS_STORAGE_SUFFIX, filename);
+	if(remove(filename) != 0 && errno != ENOENT)
+		return (PSA_ERROR_STORAGE_FAILURE);
+
+	#if !defined(_WIN32)
+	if(!its_file.batching)
+		return (psa_its_sync_location());
+	its_file.location_dirty = 1;
+	#endif
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_its_file_set_location(const char* directory)
+{
+	/* The pending files are renamed in the current location */
+	if(its_file.pending_count != 0)
+		return (PSA_ERROR_BAD_STATE);
+	#if !defined(_WIN32)
+	/* So are the removals synced */
+	if(its_file.location_dirty)
+	{
+		if(psa_its_sync_location() != PSA_SUCCESS)
+			return (PSA_ERROR_STORAGE_FAILURE);
+		its_file.location_dirty = 0;
+	}
+	#endif
+	if(directory == NULL)
+	{
+		its_file.location_set = 0;
+		return (PSA_SUCCESS);
+	}
+	if(strlen(directory) >= sizeof(its_file.location))
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	strcpy(its_file.location, directory);
+	its_file.location_set = 1;
+	return (PSA_SUCCESS);
+}
+
+void iotex_psa_its_file_begin_batch(void)
+{
+	its_file.batching = 1;
+}
+
+psa_status_t iotex_psa_its_file_flush(void)
+{
+	psa_status_t status = PSA_SUCCESS;
+	char filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+	char temp_filename[PSA_ITS_STORAGE_FILENAME_LENGTH];
+	size_t i, done;
+
+	if(its_file.pending_count == 0)
+	{
+	#if !defined(_WIN32)
+		if(its_file.location_dirty)
+		{
+			status = psa_its_sync_location();
+			if(status == PSA_SUCCESS)
+				its_file.location_dirty = 0;
+		}
+	#endif
+		return (status);
+	}
+
+	#if defined(__linux__)
+	{
+		/* One call writes back every pending file */
+		const char* location = psa_its_location();
+		int fd = open(location[0] != '\0' ? location : ".", O_RDONLY);
+		if(fd < 0)
+			return (PSA_ERROR_STORAGE_FAILURE);
+		if(syncfs(fd) != 0)
+			status = PSA_ERROR_STORAGE_FAILURE;
+		close(fd);
+		if(status != PSA_SUCCESS)
+			return (status);
+	}
+	#elif !defined(_WIN32)
+	for(i = 0; i < its_file.pending_count; i++)
+	{
+		int fd, ret;
+
+		psa_its_fill_filename(its_file.pending[i], PSA_ITS_STORAGE_TEMP_SUFFIX, temp_filename);
+		fd = open(temp_filename, O_RDONLY);
+		if(fd < 0)
+			return (PSA_ERROR_STORAGE_FAILURE);
+		ret = fsync(fd);
+		close(fd);
+		if(ret != 0)
+			return (PSA_ERROR_STORAGE_FAILURE);
+	}
+	#endif
+
+	/* Every new version is on disk, put them in place */
+	for(done = 0; done < its_file.pending_count; done++)
+	{
+		psa_its_fill_filename(its_file.pending[done], PSA_ITS_STORAGE_TEMP_SUFFIX, temp_filename);
+		psa_its_fill_filename(its_file.pending[done], PSA_ITS_STORAGE_SUFFIX, filename);
+		status = psa_its_replace(temp_filename, filename);
+		if(status != PSA_SUCCESS)
+			break;
+	}
+
+	/* Keep the entries that were not renamed for the next attempt */
+	for(i = done; i < its_file.pending_count; i++)
+		its_file.pending[i - done] = its_file.pending[i];
+	its_file.pending_count -= done;
+
+	#if !defined(_WIN32)
+	if(done != 0 || its_file.location_dirty)
+	{
+		psa_status_t sync_status = psa_its_sync_location();
+		if(sync_status == PSA_SUCCESS)
+			its_file.location_dirty = 0;
+		if(status == PSA_SUCCESS)
+			status = sync_status;
+	}
+	#endif
+	return (status);
+}
+
+psa_status_t iotex_psa_its_file_end_batch(void)
+{
+	psa_status_t status = iotex_psa_its_file_flush();
+
+	if(status == PSA_SUCCESS)
+		its_file.batching = 0;
+	return (status);
+}
+
+#endif /* IOTEX_PSA_ITS_FILE_C */
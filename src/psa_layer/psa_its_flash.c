@@ -0,0 +1,711 @@
+/*
+ *  PSA ITS over a log-structured store in flash.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include "include/common.h"
+
+#include "include/iotex/platform.h"
+
+#if defined(IOTEX_PSA_ITS_FLASH_C)
+
+	#include "include/svc/crypto.h"
+	#include "include/svc/crypto/psa_crypto_its.h"
+
+	#include <string.h>
+
+	/*
+	 * Each sector starts with a header:
+	 *   magic          4 bytes  "PLOG"
+	 *   erase count    4 bytes  erases of the sector over its lifetime
+	 *   sequence       4 bytes  position of the sector in the log, left
+	 *                           erased while the sector is free
+	 *   reserved       4 bytes
+	 *
+	 * then holds records up to the first erased header:
+	 *   uid            8 bytes
+	 *   size           4 bytes
+	 *   flags          4 bytes  creation flags, or PSA_ITS_FLASH_TOMBSTONE
+	 *                           for a removal
+	 *   crc            4 bytes  CRC-32 of the fields above and the data
+	 *   data           size bytes, padded with 0xFF to a multiple of 4
+	 *
+	 * All fields are little-endian. The newest record of a uid, in log
+	 * order, is its current version.
+	 */
+	#define PSA_ITS_FLASH_MAGIC "PLOG"
+	#define PSA_ITS_FLASH_SECTOR_HEADER_SIZE 16
+	#define PSA_ITS_FLASH_SEQUENCE_OFFSET 8
+	#define PSA_ITS_FLASH_RECORD_HEADER_SIZE 20
+	#define PSA_ITS_FLASH_TOMBSTONE 0x80000000u
+	#define PSA_ITS_FLASH_FREE 0xFFFFFFFFu
+	#define PSA_ITS_FLASH_NONE ((size_t)-1)
+	/* Erased sectors kept aside so that compaction always has room */
+	#define PSA_ITS_FLASH_RESERVE 1
+	/* Stack buffer for copying and checking records */
+	#define PSA_ITS_FLASH_CHUNK 64
+
+	#define PSA_ITS_FLASH_ALIGN(n) (((n) + 3u) & ~(uint32_t)3u)
+	#define PSA_ITS_FLASH_FOOTPRINT(size) (PSA_ITS_FLASH_RECORD_HEADER_SIZE + PSA_ITS_FLASH_ALIGN(size))
+
+typedef struct
+{
+	psa_storage_uid_t uid;
+	uint32_t address; /* Of the record header */
+	uint32_t size;
+	psa_storage_create_flags_t flags;
+} psa_its_flash_entry_t;
+
+static struct
+{
+	const iotex_psa_flash_t* flash;
+	uint32_t erase_count[IOTEX_PSA_ITS_FLASH_MAX_SECTORS];
+	uint32_t sequence[IOTEX_PSA_ITS_FLASH_MAX_SECTORS];
+	uint32_t next_sequence;
+	size_t free_sectors;
+	/* Sector records are appended to, PSA_ITS_FLASH_NONE until one is
+	 * opened */
+	size_t head;
+	uint32_t head_offset;
+	/* Bytes taken by records in each sector, current or not, and by
+	 * damage; used_bytes is their sum */
+	uint32_t sector_used[IOTEX_PSA_ITS_FLASH_MAX_SECTORS];
+	size_t used_bytes;
+	psa_its_flash_entry_t entries[IOTEX_PSA_ITS_FLASH_MAX_ENTRIES];
+	size_t entry_count;
+	size_t live_bytes;
+	uint32_t compactions;
+	uint32_t erases;
+} its_flash;
+
+static uint32_t psa_its_flash_crc32(uint32_t crc, const uint8_t* data, size_t length)
+{
+	size_t i;
+	int bit;
+
+	crc = ~crc;
+	for(i = 0; i < length; i++)
+	{
+		crc ^= data[i];
+		for(bit = 0; bit < 8; bit++)
+			crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+	}
+	return (~crc);
+}
+
+static psa_status_t psa_its_flash_read(uint32_t address, void* data, size_t length)
+{
+	if(its_flash.flash->read(its_flash.flash->context, address, data, length) != 0)
+		return (PSA_ERROR_STORAGE_FAILURE);
+	return (PSA_SUCCESS);
+}
+
+static psa_status_t psa_its_flash_program(uint32_t address, const void* data, size_t length)
+{
+	if(its_flash.flash->program(its_flash.flash->context, address, data, length) != 0)
+		return (PSA_ERROR_STORAGE_FAILURE);
+	return (PSA_SUCCESS);
+}
+
+static uint32_t psa_its_flash_sector_address(size_t sector)
+{
+	return ((uint32_t)sector * its_flash.flash->sector_size);
+}
+
+static int psa_its_flash_is_erased(const uint8_t* data, size_t length)
+{
+	size_t i;
+
+	for(i = 0; i < length; i++)
+	{
+		if(data[i] != 0xFF)
+			return (0);
+	}
+	return (1);
+}
+
+/* Erase a sector and write the header of a free sector, carrying its erase
+ * count over. Only the magic and the erase count are programmed; the
+ * sequence is programmed once the sector is opened. */
+static psa_status_t psa_its_flash_erase(size_t sector)
+{
+	uint8_t header[PSA_ITS_FLASH_SEQUENCE_OFFSET];
+
+	if(its_flash.flash->erase(its_flash.flash->context, (uint32_t)sector) != 0)
+		return (PSA_ERROR_STORAGE_FAILURE);
+	its_flash.erase_count[sector]++;
+	its_flash.erases++;
+
+	memcpy(header, PSA_ITS_FLASH_MAGIC, 4);
+	IOTEX_PUT_UINT32_LE(its_flash.erase_count[sector], header, 4);
+	return (psa_its_flash_program(psa_its_flash_sector_address(sector), header, sizeof(header)));
+}
+
+static size_t psa_its_flash_find(psa_storage_uid_t uid)
+{
+	size_t i;
+
+	for(i = 0; i < its_flash.entry_count; i++)
+	{
+		if(its_flash.entries[i].uid == uid)
+			return (i);
+	}
+	return (PSA_ITS_FLASH_NONE);
+}
+
+static void psa_its_flash_drop(size_t i)
+{
+	its_flash.live_bytes -= PSA_ITS_FLASH_FOOTPRINT(its_flash.entries[i].size);
+	its_flash.entries[i] = its_flash.entries[--its_flash.entry_count];
+}
+
+/* Point the index at a record, which is the newest one of its uid */
+static psa_status_t psa_its_flash_index(psa_storage_uid_t uid, uint32_t address, uint32_t size,
+										uint32_t flags)
+{
+	size_t i = psa_its_flash_find(uid);
+
+	if(flags & PSA_ITS_FLASH_TOMBSTONE)
+	{
+		if(i != PSA_ITS_FLASH_NONE)
+			psa_its_flash_drop(i);
+		return (PSA_SUCCESS);
+	}
+	if(i == PSA_ITS_FLASH_NONE)
+	{
+		if(its_flash.entry_count == IOTEX_PSA_ITS_FLASH_MAX_ENTRIES)
+			return (PSA_ERROR_INSUFFICIENT_MEMORY);
+		i = its_flash.entry_count++;
+		its_flash.entries[i].uid = uid;
+	}
+	else
+		its_flash.live_bytes -= PSA_ITS_FLASH_FOOTPRINT(its_flash.entries[i].size);
+	its_flash.entries[i].address = address;
+	its_flash.entries[i].size = size;
+	its_flash.entries[i].flags = flags;
+	its_flash.live_bytes += PSA_ITS_FLASH_FOOTPRINT(size);
+	return (PSA_SUCCESS);
+}
+
+/* Make the least worn free sector the head of the log */
+static psa_status_t psa_its_flash_open_sector(void)
+{
+	uint8_t sequence[4];
+	size_t sector, best = PSA_ITS_FLASH_NONE;
+	psa_status_t status;
+
+	for(sector = 0; sector < its_flash.flash->sector_count; sector++)
+	{
+		if(its_flash.sequence[sector] == PSA_ITS_FLASH_FREE &&
+		   (best == PSA_ITS_FLASH_NONE || its_flash.erase_count[sector] < its_flash.erase_count[best]))
+			best = sector;
+	}
+	if(best == PSA_ITS_FLASH_NONE)
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+
+	IOTEX_PUT_UINT32_LE(its_flash.next_sequence, sequence, 0);
+	status = psa_its_flash_program(psa_its_flash_sector_address(best) + PSA_ITS_FLASH_SEQUENCE_OFFSET,
+								   sequence, sizeof(sequence));
+	if(status != PSA_SUCCESS)
+		return (status);
+	its_flash.sequence[best] = its_flash.next_sequence++;
+	its_flash.free_sectors--;
+	its_flash.head = best;
+	its_flash.head_offset = PSA_ITS_FLASH_SECTOR_HEADER_SIZE;
+	return (PSA_SUCCESS);
+}
+
+/* Account for a record programmed at the head of the log */
+static void psa_its_flash_advance(uint32_t footprint)
+{
+	its_flash.head_offset += footprint;
+	its_flash.sector_used[its_flash.head] += footprint;
+	its_flash.used_bytes += footprint;
+}
+
+/* A program failed at the head of the log, and part of it may be on the
+ * device already. After a power cycle the scan of the sector stops there,
+ * so nothing more is appended to it; the rest of the sector is lost until
+ * it is compacted. */
+static void psa_its_flash_close_head(void)
+{
+	psa_its_flash_advance(its_flash.flash->sector_size - its_flash.head_offset);
+}
+
+/* Find room for a record of the given footprint at the head of the log.
+ * Only compaction may take the last free sectors. */
+static psa_status_t psa_its_flash_reserve(uint32_t footprint, int compacting)
+{
+	if(its_flash.head != PSA_ITS_FLASH_NONE &&
+	   its_flash.head_offset + footprint <= its_flash.flash->sector_size)
+		return (PSA_SUCCESS);
+	if(!compacting && its_flash.free_sectors <= PSA_ITS_FLASH_RESERVE)
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+	return (psa_its_flash_open_sector());
+}
+
+/* Copy the current records of the oldest sector to the head of the log,
+ * then erase it. The copies are newer than the originals, so a power loss
+ * before the erase only leaves duplicates behind. */
+static psa_status_t psa_its_flash_compact(void)
+{
+	uint8_t chunk[PSA_ITS_FLASH_CHUNK];
+	size_t sector, oldest = PSA_ITS_FLASH_NONE;
+	uint32_t start, end;
+	psa_status_t status;
+	size_t i;
+
+	for(sector = 0; sector < its_flash.flash->sector_count; sector++)
+	{
+		if(its_flash.sequence[sector] != PSA_ITS_FLASH_FREE &&
+		   (oldest == PSA_ITS_FLASH_NONE || its_flash.sequence[sector] < its_flash.sequence[oldest]))
+			oldest = sector;
+	}
+	if(oldest == PSA_ITS_FLASH_NONE)
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+
+	/* Never copy records into the sector that is about to be erased */
+	if(oldest == its_flash.head)
+		its_flash.head = PSA_ITS_FLASH_NONE;
+
+	start = psa_its_flash_sector_address(oldest);
+	end = start + its_flash.flash->sector_size;
+	for(i = 0; i < its_flash.entry_count; i++)
+	{
+		psa_its_flash_entry_t* entry = &its_flash.entries[i];
+		uint32_t footprint = PSA_ITS_FLASH_FOOTPRINT(entry->size);
+		uint32_t done, target;
+
+		if(entry->address < start || entry->address >= end)
+			continue;
+		status = psa_its_flash_reserve(footprint, 1);
+		if(status != PSA_SUCCESS)
+			return (status);
+		target = psa_its_flash_sector_address(its_flash.head) + its_flash.head_offset;
+		for(done = 0; done < footprint; done += sizeof(chunk))
+		{
+			size_t length = footprint - done < sizeof(chunk) ? footprint - done : sizeof(chunk);
+			status = psa_its_flash_read(entry->address + done, chunk, length);
+			if(status != PSA_SUCCESS)
+				return (status);
+			status = psa_its_flash_program(target + done, chunk, length);
+			if(status != PSA_SUCCESS)
+			{
+				psa_its_flash_close_head();
+				return (status);
+			}
+		}
+		psa_its_flash_advance(footprint);
+		entry->address = target;
+	}
+
+	/* Removals recorded in this sector can go too: every older record of
+	 * their uid was in this sector or an older one, and is gone. */
+	status = psa_its_flash_erase(oldest);
+	its_flash.used_bytes -= its_flash.sector_used[oldest];
+	its_flash.sector_used[oldest] = 0;
+	its_flash.sequence[oldest] = PSA_ITS_FLASH_FREE;
+	its_flash.free_sectors++;
+	its_flash.compactions++;
+	return (status);
+}
+
+static psa_status_t psa_its_flash_append(psa_storage_uid_t uid, uint32_t size, uint32_t flags,
+										 const uint8_t* data)
+{
+	uint8_t header[PSA_ITS_FLASH_RECORD_HEADER_SIZE];
+	uint8_t tail[4];
+	uint32_t footprint = PSA_ITS_FLASH_FOOTPRINT(size);
+	uint32_t address, whole = size & ~(uint32_t)3u;
+	psa_status_t status;
+	size_t j;
+
+	if(footprint > its_flash.flash->sector_size - PSA_ITS_FLASH_SECTOR_HEADER_SIZE)
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+
+	/* Compacting only makes room while the log holds records that are not
+	 * current, or damage: each compaction drops those of the oldest sector
+	 * and moves the others behind the newest. Once none is left, another
+	 * compaction would only wear the device. */
+	for(;;)
+	{
+		status = psa_its_flash_reserve(footprint, 0);
+		if(status != PSA_ERROR_INSUFFICIENT_STORAGE || its_flash.used_bytes == its_flash.live_bytes)
+			break;
+		status = psa_its_flash_compact();
+		if(status != PSA_SUCCESS)
+			return (status);
+	}
+	if(status != PSA_SUCCESS)
+		return (status);
+
+	IOTEX_PUT_UINT32_LE((uint32_t)uid, header, 0);
+	IOTEX_PUT_UINT32_LE((uint32_t)(uid >> 32), header, 4);
+	IOTEX_PUT_UINT32_LE(size, header, 8);
+	IOTEX_PUT_UINT32_LE(flags, header, 12);
+	IOTEX_PUT_UINT32_LE(psa_its_flash_crc32(psa_its_flash_crc32(0, header, 16), data, size), header,
+						16);
+	memset(tail, 0xFF, sizeof(tail));
+	for(j = whole; j < size; j++)
+		tail[j - whole] = data[j];
+
+	address = psa_its_flash_sector_address(its_flash.head) + its_flash.head_offset;
+	status = psa_its_flash_program(address, header, sizeof(header));
+	if(status == PSA_SUCCESS && whole != 0)
+		status = psa_its_flash_program(address + sizeof(header), data, whole);
+	if(status == PSA_SUCCESS && whole != size)
+		status = psa_its_flash_program(address + sizeof(header) + whole, tail, sizeof(tail));
+	if(status != PSA_SUCCESS)
+	{
+		psa_its_flash_close_head();
+		return (status);
+	}
+	psa_its_flash_advance(footprint);
+
+	return (psa_its_flash_index(uid, address, size, flags));
+}
+
+/* Index the records of a sector, and return where its log ends */
+static psa_status_t psa_its_flash_scan(size_t sector, uint32_t* end, int* torn)
+{
+	uint8_t header[PSA_ITS_FLASH_RECORD_HEADER_SIZE];
+	uint8_t chunk[PSA_ITS_FLASH_CHUNK];
+	uint32_t start = psa_its_flash_sector_address(sector);
+	uint32_t offset = PSA_ITS_FLASH_SECTOR_HEADER_SIZE;
+	psa_status_t status;
+
+	*torn = 0;
+	while(offset + sizeof(header) <= its_flash.flash->sector_size)
+	{
+		psa_storage_uid_t uid;
+		uint32_t size, flags, crc, done;
+
+		status = psa_its_flash_read(start + offset, header, sizeof(header));
+		if(status != PSA_SUCCESS)
+			return (status);
+		if(psa_its_flash_is_erased(header, sizeof(header)))
+			break;
+
+		uid = IOTEX_GET_UINT32_LE(header, 0) | ((psa_storage_uid_t)IOTEX_GET_UINT32_LE(header, 4) << 32);
+		size = IOTEX_GET_UINT32_LE(header, 8);
+		flags = IOTEX_GET_UINT32_LE(header, 12);
+		if(size > its_flash.flash->sector_size ||
+		   offset + PSA_ITS_FLASH_FOOTPRINT(size) > its_flash.flash->sector_size)
+		{
+			*torn = 1;
+			break;
+		}
+		crc = psa_its_flash_crc32(0, header, 16);
+		for(done = 0; done < size; done += sizeof(chunk))
+		{
+			size_t length = size - done < sizeof(chunk) ? size - done : sizeof(chunk);
+			status = psa_its_flash_read(start + offset + sizeof(header) + done, chunk, length);
+			if(status != PSA_SUCCESS)
+				return (status);
+			crc = psa_its_flash_crc32(crc, chunk, length);
+		}
+		if(crc != IOTEX_GET_UINT32_LE(header, 16))
+		{
+			*torn = 1;
+			break;
+		}
+
+		status = psa_its_flash_index(uid, start + offset, size, flags);
+		if(status != PSA_SUCCESS)
+			return (status);
+		offset += PSA_ITS_FLASH_FOOTPRINT(size);
+	}
+	*end = offset;
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_its_flash_mount(const iotex_psa_flash_t* flash)
+{
+	uint8_t header[PSA_ITS_FLASH_SECTOR_HEADER_SIZE];
+	size_t sector, newest = PSA_ITS_FLASH_NONE;
+	uint32_t newest_end = 0;
+	psa_status_t status;
+
+	if(flash == NULL || flash->sector_count < 2 ||
+	   flash->sector_count > IOTEX_PSA_ITS_FLASH_MAX_SECTORS || flash->sector_size % 4 != 0 ||
+	   flash->sector_size < PSA_ITS_FLASH_SECTOR_HEADER_SIZE + 2 * PSA_ITS_FLASH_RECORD_HEADER_SIZE)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	memset(&its_flash, 0, sizeof(its_flash));
+	its_flash.flash = flash;
+	its_flash.head = PSA_ITS_FLASH_NONE;
+
+	for(sector = 0; sector < flash->sector_count; sector++)
+	{
+		status = psa_its_flash_read(psa_its_flash_sector_address(sector), header, sizeof(header));
+		if(status != PSA_SUCCESS)
+			goto fail;
+		if(memcmp(header, PSA_ITS_FLASH_MAGIC, 4) == 0)
+		{
+			its_flash.erase_count[sector] = IOTEX_GET_UINT32_LE(header, 4);
+			its_flash.sequence[sector] = IOTEX_GET_UINT32_LE(header, PSA_ITS_FLASH_SEQUENCE_OFFSET);
+		}
+		else
+		{
+			/* A blank sector, or one whose erase was cut short: its erase
+			 * count is lost */
+			status = psa_its_flash_erase(sector);
+			if(status != PSA_SUCCESS)
+				goto fail;
+			its_flash.sequence[sector] = PSA_ITS_FLASH_FREE;
+		}
+		if(its_flash.sequence[sector] == PSA_ITS_FLASH_FREE)
+			its_flash.free_sectors++;
+		else if(its_flash.sequence[sector] >= its_flash.next_sequence)
+			its_flash.next_sequence = its_flash.sequence[sector] + 1;
+	}
+
+	/* Replay the log, oldest sector first */
+	for(;;)
+	{
+		size_t next = PSA_ITS_FLASH_NONE;
+		uint32_t end;
+		int torn;
+
+		for(sector = 0; sector < flash->sector_count; sector++)
+		{
+			uint32_t sequence = its_flash.sequence[sector];
+			if(sequence != PSA_ITS_FLASH_FREE &&
+			   (newest == PSA_ITS_FLASH_NONE || sequence > its_flash.sequence[newest]) &&
+			   (next == PSA_ITS_FLASH_NONE || sequence < its_flash.sequence[next]))
+				next = sector;
+		}
+		if(next == PSA_ITS_FLASH_NONE)
+			break;
+		status = psa_its_flash_scan(next, &end, &torn);
+		if(status != PSA_SUCCESS)
+			goto fail;
+		newest = next;
+		/* Nothing is appended after a damaged record */
+		newest_end = torn ? flash->sector_size : end;
+		its_flash.sector_used[next] = newest_end - PSA_ITS_FLASH_SECTOR_HEADER_SIZE;
+		its_flash.used_bytes += its_flash.sector_used[next];
+	}
+	its_flash.head = newest;
+	its_flash.head_offset = newest_end;
+	return (PSA_SUCCESS);
+
+fail:
+	its_flash.flash = NULL;
+	return (status);
+}
+
+void iotex_psa_its_flash_unmount(void)
+{
+	its_flash.flash = NULL;
+}
+
+psa_status_t iotex_psa_its_flash_get_info(psa_storage_uid_t uid, struct psa_storage_info_t* p_info)
+{
+	size_t i;
+
+	if(its_flash.flash == NULL)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	i = psa_its_flash_find(uid);
+	if(i == PSA_ITS_FLASH_NONE)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	p_info->size = its_flash.entries[i].size;
+	p_info->flags = its_flash.entries[i].flags;
+	return (PSA_SUCCESS);
+}
+
+psa_status_t iotex_psa_its_flash_get(psa_storage_uid_t uid, uint32_t data_offset,
+									 uint32_t data_length, void* p_data, size_t* p_data_length)
+{
+	psa_its_flash_entry_t* entry;
+	psa_status_t status;
+	size_t i;
+
+	if(its_flash.flash == NULL)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	i = psa_its_flash_find(uid);
+	if(i == PSA_ITS_FLASH_NONE)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	entry = &its_flash.entries[i];
+	if(data_offset + data_length < data_offset || data_offset + data_length > entry->size)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	status = psa_its_flash_read(entry->address + PSA_ITS_FLASH_RECORD_HEADER_SIZE + data_offset,
+								p_data, data_length);
+	if(status == PSA_SUCCESS && p_data_length != NULL)
+		*p_data_length = data_length;
+	return (status);
+}
+
+/* Whether the entries but \p skip, with one more of footprint \p extra
+ * unless it is 0, then a record of footprint \p last written after them,
+ * are sure to fit in the M sectors outside the reserve once the log is
+ * compacted.
+ *
+ * Records never cross a sector boundary: a sector is only left behind
+ * when the record that starts the next one does not fit in it, and the
+ * end of the sector is lost. Were M sectors not enough, sector M and the
+ * record starting sector M + 1 would take more than a sector, and each
+ * sector before would hold at least its first record, and more than a
+ * sector minus the largest record. The last record is written last, so
+ * these first records are M - 1 distinct entries. */
+static int psa_its_flash_fits(size_t skip, uint32_t extra, uint32_t last)
+{
+	uint32_t sector = its_flash.flash->sector_size - PSA_ITS_FLASH_SECTOR_HEADER_SIZE;
+	size_t sectors = its_flash.flash->sector_count - PSA_ITS_FLASH_RESERVE;
+	uint32_t smallest[IOTEX_PSA_ITS_FLASH_MAX_SECTORS];
+	uint32_t largest = extra, footprint;
+	uint64_t live = (uint64_t)its_flash.live_bytes + extra + last, least;
+	size_t i, j, count = 0, entries = its_flash.entry_count + (extra != 0);
+
+	if(extra > sector || last > sector)
+		return (0);
+	if(skip != PSA_ITS_FLASH_NONE)
+	{
+		live -= PSA_ITS_FLASH_FOOTPRINT(its_flash.entries[skip].size);
+		entries--;
+	}
+	if(entries < sectors)
+		return (1);
+
+	for(i = 0; i < its_flash.entry_count; i++)
+	{
+		if(i != skip && PSA_ITS_FLASH_FOOTPRINT(its_flash.entries[i].size) > largest)
+			largest = PSA_ITS_FLASH_FOOTPRINT(its_flash.entries[i].size);
+	}
+
+	/* The least each entry lets a sector it starts hold; keep the M - 1
+	 * smallest, sorted */
+	for(i = 0; i <= its_flash.entry_count; i++)
+	{
+		if(i == skip || (i == its_flash.entry_count && extra == 0))
+			continue;
+		footprint = i < its_flash.entry_count ? PSA_ITS_FLASH_FOOTPRINT(its_flash.entries[i].size)
+											  : extra;
+		if(footprint < sector + 4 - largest)
+			footprint = sector + 4 - largest;
+		if(count < sectors - 1)
+			count++;
+		else if(count == 0 || footprint >= smallest[count - 1])
+			continue;
+		for(j = count - 1; j > 0 && smallest[j - 1] > footprint; j--)
+			smallest[j] = smallest[j - 1];
+		smallest[j] = footprint;
+	}
+
+	least = (uint64_t)sector + 4;
+	for(j = 0; j < count; j++)
+		least += smallest[j];
+	return (live < least);
+}
+
+psa_status_t iotex_psa_its_flash_set(psa_storage_uid_t uid, uint32_t data_length,
+									 const void* p_data, psa_storage_create_flags_t create_flags)
+{
+	uint32_t footprint;
+	size_t i;
+
+	if(its_flash.flash == NULL)
+		return (PSA_ERROR_BAD_STATE);
+	if(create_flags & ~(psa_storage_create_flags_t)PSA_STORAGE_FLAG_WRITE_ONCE)
+		return (PSA_ERROR_NOT_SUPPORTED);
+	if(p_data == NULL && data_length != 0)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	i = psa_its_flash_find(uid);
+	if(i != PSA_ITS_FLASH_NONE && (its_flash.entries[i].flags & PSA_STORAGE_FLAG_WRITE_ONCE))
+		return (PSA_ERROR_NOT_PERMITTED);
+	if(i == PSA_ITS_FLASH_NONE && its_flash.entry_count == IOTEX_PSA_ITS_FLASH_MAX_ENTRIES)
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+
+	/* Skip compactions that cannot make room anyway. The previous version
+	 * of the entry stays until the record is written, and room for one
+	 * more record header is kept so that removing an entry never fails for
+	 * lack of space. */
+	if(data_length > its_flash.flash->sector_size)
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+	footprint = PSA_ITS_FLASH_FOOTPRINT(data_length);
+	if(!psa_its_flash_fits(PSA_ITS_FLASH_NONE, 0, footprint) ||
+	   !psa_its_flash_fits(i, footprint, PSA_ITS_FLASH_RECORD_HEADER_SIZE))
+		return (PSA_ERROR_INSUFFICIENT_STORAGE);
+
+	return (psa_its_flash_append(uid, data_length, create_flags, p_data));
+}
+
+psa_status_t iotex_psa_its_flash_remove(psa_storage_uid_t uid)
+{
+	size_t i;
+
+	if(its_flash.flash == NULL)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	i = psa_its_flash_find(uid);
+	if(i == PSA_ITS_FLASH_NONE)
+		return (PSA_ERROR_DOES_NOT_EXIST);
+	if(its_flash.entries[i].flags & PSA_STORAGE_FLAG_WRITE_ONCE)
+		return (PSA_ERROR_NOT_PERMITTED);
+	return (psa_its_flash_append(uid, 0, PSA_ITS_FLASH_TOMBSTONE, NULL));
+}
+
+psa_status_t iotex_psa_its_flash_get_stats(iotex_psa_its_flash_stats_t* stats)
+{
+	size_t sector;
+
+	if(its_flash.flash == NULL)
+		return (PSA_ERROR_BAD_STATE);
+	stats->entries = its_flash.entry_count;
+	stats->live_bytes = its_flash.live_bytes;
+	stats->free_sectors = its_flash.free_sectors;
+	stats->compactions = its_flash.compactions;
+	stats->erases = its_flash.erases;
+	stats->min_erase_count = its_flash.erase_count[0];
+	stats->max_erase_count = its_flash.erase_count[0];
+	for(sector = 1; sector < its_flash.flash->sector_count; sector++)
+	{
+		if(its_flash.erase_count[sector] < stats->min_erase_count)
+			stats->min_erase_count = its_flash.erase_count[sector];
+		if(its_flash.erase_count[sector] > stats->max_erase_count)
+			stats->max_erase_count = its_flash.erase_count[sector];
+	}
+	return (PSA_SUCCESS);
+}
+
+	#if !defined(IOTEX_PSA_ITS_FILE_C)
+psa_status_t psa_its_set(psa_storage_uid_t uid, uint32_t data_length, const void* p_data,
+						 psa_storage_create_flags_t create_flags)
+{
+	return (iotex_psa_its_flash_set(uid, data_length, p_data, create_flags));
+}
+
+psa_status_t psa_its_get(psa_storage_uid_t uid, uint32_t data_offset, uint32_t data_length,
+						 void* p_data, size_t* p_data_length)
+{
+	return (iotex_psa_its_flash_get(uid, data_offset, data_length, p_data, p_data_length));
+}
+
+psa_status_t psa_its_get_info(psa_storage_uid_t uid, struct psa_storage_info_t* p_info)
+{
+	return (iotex_psa_its_flash_get_info(uid, p_info));
+}
+
+psa_status_t psa_its_remove(psa_storage_uid_t uid)
+{
+	return (iotex_psa_its_flash_remove(uid));
+}
+	#endif /* !IOTEX_PSA_ITS_FILE_C */
+
+#endif /* IOTEX_PSA_ITS_FLASH_C */
@@ -0,0 +1,191 @@
+/*
+ *  Simulated NOR flash device over a stdio file, for the log-structured
+ *  PSA ITS store.
+ */
+/*
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include "include/common.h"
+
+#include "include/iotex/platform.h"
+
+#if defined(IOTEX_PSA_ITS_FLASH_C) && defined(IOTEX_FS_IO)
+
+	#include "include/svc/crypto/psa_its_flash_sim.h"
+
+	#include <stdio.h>
+	#include <stdlib.h>
+	#include <string.h>
+
+	/* Typical SPI NOR flash: 45 ms to erase a 4 KiB sector, 0.7 ms to
+	 * program a 256-byte page, reads at 50 MB/s */
+	#define PSA_FLASH_SIM_ERASE_TIME_US 45000
+	#define PSA_FLASH_SIM_PROGRAM_TIME_NS 2700
+	#define PSA_FLASH_SIM_READ_TIME_NS 20
+
+	#define PSA_FLASH_SIM_CHUNK 256
+
+static int psa_flash_sim_in_range(const iotex_psa_flash_sim_t* sim, uint32_t address,
+								  size_t length)
+{
+	uint64_t size = (uint64_t)sim->flash.sector_size * sim->flash.sector_count;
+
+	return ((uint64_t)address + length <= size);
+}
+
+static int psa_flash_sim_read(void* context, uint32_t address, void* data, size_t length)
+{
+	iotex_psa_flash_sim_t* sim = (iotex_psa_flash_sim_t*)context;
+
+	if(!psa_flash_sim_in_range(sim, address, length))
+		return (-1);
+	if(length == 0)
+		return (0);
+	if(fseek(sim->file, (long)address, SEEK_SET) != 0 || fread(data, 1, length, sim->file) != length)
+		return (-1);
+	sim->bytes_read += length;
+	sim->busy_ns += (uint64_t)length * sim->read_time_ns;
+	return (0);
+}
+
+	#define PSA_FLASH_SIM_WORD_BIT(word) ((uint32_t)1 << ((word) % 32))
+
+static int psa_flash_sim_program(void* context, uint32_t address, const void* data, size_t length)
+{
+	iotex_psa_flash_sim_t* sim = (iotex_psa_flash_sim_t*)context;
+	uint8_t old[PSA_FLASH_SIM_CHUNK];
+	size_t done, i;
+
+	if(!psa_flash_sim_in_range(sim, address, length) || address % 4 != 0 || length % 4 != 0)
+		return (-1);
+
+	/* Each word is programmed once between two erases, as ECC-protected
+	 * parts require; check the whole range before touching it. */
+	for(i = address / 4; i < (address + length) / 4; i++)
+	{
+		if(sim->programmed[i / 32] & PSA_FLASH_SIM_WORD_BIT(i))
+			return (-1);
+	}
+	for(done = 0; done < length; done += sizeof(old))
+	{
+		size_t n = length - done < sizeof(old) ? length - done : sizeof(old);
+		if(fseek(sim->file, (long)(address + done), SEEK_SET) != 0 || fread(old, 1, n, sim->file) != n)
+			return (-1);
+		for(i = 0; i < n; i++)
+		{
+			if(old[i] != 0xFF)
+				return (-1);
+		}
+	}
+
+	if(fseek(sim->file, (long)address, SEEK_SET) != 0 || fwrite(data, 1, length, sim->file) != length ||
+	   fflush(sim->file) != 0)
+		return (-1);
+	for(i = address / 4; i < (address + length) / 4; i++)
+		sim->programmed[i / 32] |= PSA_FLASH_SIM_WORD_BIT(i);
+	sim->bytes_programmed += length;
+	sim->busy_ns += (uint64_t)length * sim->program_time_ns;
+	return (0);
+}
+
+static int psa_flash_sim_fill(FILE* file, size_t length)
+{
+	uint8_t erased[PSA_FLASH_SIM_CHUNK];
+	size_t done;
+
+	memset(erased, 0xFF, sizeof(erased));
+	for(done = 0; done < length; done += sizeof(erased))
+	{
+		size_t n = length - done < sizeof(erased) ? length - done : sizeof(erased);
+		if(fwrite(erased, 1, n, file) != n)
+			return (-1);
+	}
+	return (fflush(file));
+}
+
+static int psa_flash_sim_erase(void* context, uint32_t sector)
+{
+	iotex_psa_flash_sim_t* sim = (iotex_psa_flash_sim_t*)context;
+	uint32_t i, words = sim->flash.sector_size / 4;
+
+	if(sector >= sim->flash.sector_count)
+		return (-1);
+	if(fseek(sim->file, (long)sector * (long)sim->flash.sector_size, SEEK_SET) != 0 ||
+	   psa_flash_sim_fill(sim->file, sim->flash.sector_size) != 0)
+		return (-1);
+	for(i = sector * words; i < (sector + 1) * words; i++)
+		sim->programmed[i / 32] &= ~PSA_FLASH_SIM_WORD_BIT(i);
+	sim->erases++;
+	sim->busy_ns += (uint64_t)sim->erase_time_us * 1000;
+	return (0);
+}
+
+psa_status_t iotex_psa_flash_sim_open(iotex_psa_flash_sim_t* sim, const char* path,
+									  uint32_t sector_size, uint32_t sector_count)
+{
+	long size, total;
+
+	if(sector_size == 0 || sector_size % 4 != 0 || sector_count == 0 ||
+	   (uint64_t)sector_size * sector_count > 0x7FFFFFFF)
+		return (PSA_ERROR_INVALID_ARGUMENT);
+
+	memset(sim, 0, sizeof(*sim));
+	sim->programmed = (uint32_t*)calloc(((size_t)sector_size / 4 * sector_count + 31) / 32,
+										sizeof(uint32_t));
+	if(sim->programmed == NULL)
+		return (PSA_ERROR_INSUFFICIENT_MEMORY);
+	sim->file = fopen(path, "r+b");
+	if(sim->file == NULL)
+		sim->file = fopen(path, "w+b");
+	if(sim->file == NULL)
+	{
+		iotex_psa_flash_sim_close(sim);
+		return (PSA_ERROR_STORAGE_FAILURE);
+	}
+
+	/* A new device, or the part of the device past the end of the file,
+	 * is erased */
+	total = (long)sector_size * (long)sector_count;
+	if(fseek(sim->file, 0, SEEK_END) != 0 || (size = ftell(sim->file)) < 0 ||
+	   (size < total && psa_flash_sim_fill(sim->file, (size_t)(total - size)) != 0))
+	{
+		iotex_psa_flash_sim_close(sim);
+		return (PSA_ERROR_STORAGE_FAILURE);
+	}
+
+	sim->flash.sector_size = sector_size;
+	sim->flash.sector_count = sector_count;
+	sim->flash.read = psa_flash_sim_read;
+	sim->flash.program = psa_flash_sim_program;
+	sim->flash.erase = psa_flash_sim_erase;
+	sim->flash.context = sim;
+	sim->erase_time_us = PSA_FLASH_SIM_ERASE_TIME_US;
+	sim->program_time_ns = PSA_FLASH_SIM_PROGRAM_TIME_NS;
+	sim->read_time_ns = PSA_FLASH_SIM_READ_TIME_NS;
+	return (PSA_SUCCESS);
+}
+
+void iotex_psa_flash_sim_close(iotex_psa_flash_sim_t* sim)
+{
+	if(sim->file != NULL)
+		fclose(sim->file);
+	sim->file = NULL;
+	free(sim->programmed);
+	sim->programmed = NULL;
+}
+
+#endif /* IOTEX_PSA_ITS_FLASH_C && IOTEX_FS_IO */
@@ -60,11 +60,108 @@ static const uint8_t inv_sbox[256] = {
 	0x55, 0x21, 0x0c, 0x7d
 };
 
+int tc_aes_set_decrypt_key(TCAesKeySched_t s, const uint8_t *k,
+			   unsigned int keybits)
+{
+	return tc_aes_set_encrypt_key(s, k, keybits);
+}
+
 int tc_aes128_set_decrypt_key(TCAesKeySched_t s, const uint8_t *k)
 {
-	return tc_aes128_set_encrypt_key(s, k);
+	return tc_aes_set_encrypt_key(s, k, 128);
+}
+
+#if TC_AES_TTABLE
+
+#define rotl8(a)(((a) << 8)|((a) >> 24))
+#define rotl16(a)(((a) << 16)|((a) >> 16))
+#define rotl24(a)(((a) << 24)|((a) >> 8))
+
+/* Multiplies each of the four bytes of a column by {02}. */
+#define double_column(a)((((a) & 0x7f7f7f7f) << 1) ^ \
+	((((a) >> 7) & 0x01010101) * 0x1b))
+
+/*
+ * The encryption key schedule is shared with tc_aes_encrypt, so the round
+ * keys cannot be pre-multiplied for an equivalent inverse cipher with
+ * inverse T-tables. InvMixColumns is computed on the whole column instead,
+ * as MixColumns after multiplying by {04}x^2 + {05}.
+ */
+static inline unsigned int inv_mix_column(unsigned int a)
+{
+	a ^= double_column(double_column(a ^ rotl16(a)));
+	return double_column(a ^ rotl8(a)) ^ rotl8(a) ^ rotl16(a) ^ rotl24(a);
 }
 
+#define inv_subbyte(a, o)(inv_sbox[((a) >> (o))&0xff] << (o))
+
+/* InvShiftRows and InvSubBytes for the column starting with s0. */
+#define inv_sub_column(s0, s3, s2, s1)(inv_subbyte(s0, 24)| \
+	inv_subbyte(s3, 16)|inv_subbyte(s2, 8)|inv_subbyte(s1, 0))
+
+static inline unsigned int load_column(const uint8_t *p)
+{
+	return ((unsigned int)p[0] << 24) | ((unsigned int)p[1] << 16) |
+	       ((unsigned int)p[2] << 8) | (unsigned int)p[3];
+}
+
+static inline void store_column(uint8_t *p, unsigned int a)
+{
+	p[0] = (uint8_t)(a >> 24); p[1] = (uint8_t)(a >> 16);
+	p[2] = (uint8_t)(a >> 8); p[3] = (uint8_t)(a);
+}
+
+int tc_aes_decrypt(uint8_t *out, const uint8_t *in, const TCAesKeySched_t s)
+{
+	unsigned int state[Nb];
+	unsigned int t[Nb];
+	const unsigned int *k;
+	unsigned int i;
+
+	if (out == (uint8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	} else if (in == (const uint8_t *) 0) {
+		return TC_CRYPTO_FAIL;
+	} else if (s == (TCAesKeySched_t) 0) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	k = s->words + Nb*s->rounds;
+	for (i = 0; i < Nb; ++i) {
+		state[i] = load_column(in + Nb*i) ^ k[i];
+	}
+
+	for (i = s->rounds - 1; i > 0; --i) {
+		k -= Nb;
+		t[0] = inv_sub_column(state[0], state[3], state[2], state[1]) ^ k[0];
+		t[1] = inv_sub_column(state[1], state[0], state[3], state[2]) ^ k[1];
+		t[2] = inv_sub_column(state[2], state[1], state[0], state[3]) ^ k[2];
+		t[3] = inv_sub_column(state[3], state[2], state[1], state[0]) ^ k[3];
+		state[0] = inv_mix_column(t[0]);
+		state[1] = inv_mix_column(t[1]);
+		state[2] = inv_mix_column(t[2]);
+		state[3] = inv_mix_column(t[3]);
+	}
+
+	k -= Nb;
+	t[0] = inv_sub_column(state[0], state[3], state[2], state[1]) ^ k[0];
+	t[1] = inv_sub_column(state[1], state[0], state[3], state[2]) ^ k[1];
+	t[2] = inv_sub_column(state[2], state[1], state[0], state[3]) ^ k[2];
+	t[3] = inv_sub_column(state[3], state[2], state[1], state[0]) ^ k[3];
+
+	for (i = 0; i < Nb; ++i) {
+		store_column(out + Nb*i, t[i]);
+	}
+
+	/* zeroing out the state buffers */
+	_set(state, TC_ZERO_BYTE, sizeof(state));
+	_set(t, TC_ZERO_BYTE, sizeof(t));
+
+	return TC_CRYPTO_SUCCESS;
+}
+
+#else /* !TC_AES_TTABLE */
+
 #define mult8(a)(_double_byte(_double_byte(_double_byte(a))))
 #define mult9(a)(mult8(a)^(a))
 #define multb(a)(mult8(a)^_double_byte(a)^(a))
@@ -142,9 +239,9 @@ int tc_aes_decrypt(uint8_t *out, const uint8_t *in, const TCAesKeySched_t s)
 
 	(void)_copy(state, sizeof(state), in, sizeof(state));
 
-	add_round_key(state, s->words + Nb*Nr);
+	add_round_key(state, s->words + Nb*s->rounds);
 
-	for (i = Nr - 1; i > 0; --i) {
+	for (i = s->rounds - 1; i > 0; --i) {
 		inv_shift_rows(state);
 		inv_sub_bytes(state);
 		add_round_key(state, s->words + Nb*i);
@@ -163,3 +260,5 @@ int tc_aes_decrypt(uint8_t *out, const uint8_t *in, const TCAesKeySched_t s)
 
 	return TC_CRYPTO_SUCCESS;
 }
+
+#endif /* TC_AES_TTABLE */
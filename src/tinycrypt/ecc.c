@@ -54,6 +54,7 @@
 
 #include "include/tinycrypt/ecc.h"
 #include "include/tinycrypt/ecc_platform_specific.h"
+#include "include/tinycrypt/utils.h"
 #include <string.h>
 
 /* IMPORTANT: Make sure a cryptographically-secure PRNG is set and the platform
@@ -394,6 +395,72 @@ void uECC_vli_modMult_fast(uECC_word_t *result, const uECC_word_t *left,
 	curve->mmod_fast(result, product);
 }
 
+/* floor(2^512 / n), for Barrett reduction modulo the curve orders. */
+static const uECC_word_t barrett_mu_secp256r1[NUM_ECC_WORDS + 1] = {
+	BYTES_TO_WORDS_8(FE, 9B, DF, EE, 85, FD, 2F, 01),
+	BYTES_TO_WORDS_8(21, 6C, 1A, DF, 52, 05, 19, 43),
+	BYTES_TO_WORDS_8(FF, FF, FF, FF, FE, FF, FF, FF),
+	BYTES_TO_WORDS_8(FF, FF, FF, FF, 00, 00, 00, 00),
+	BYTES_TO_WORDS_4(01, 00, 00, 00)
+};
+
+static const uECC_word_t barrett_mu_secp256k1[NUM_ECC_WORDS + 1] = {
+	BYTES_TO_WORDS_8(C0, BE, C9, 2F, 73, A1, 2D, 40),
+	BYTES_TO_WORDS_8(C4, 5F, B7, 50, 19, 23, 51, 45),
+	BYTES_TO_WORDS_8(01, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_4(01, 00, 00, 00)
+};
+
+void uECC_vli_modMult_n(uECC_word_t *result, const uECC_word_t *left,
+			const uECC_word_t *right, uECC_Curve curve)
+{
+	uECC_word_t product[2 * NUM_ECC_WORDS];
+	uECC_word_t tmp[2 * (NUM_ECC_WORDS + 1)];
+	uECC_word_t q[NUM_ECC_WORDS + 1];
+	uECC_word_t n[NUM_ECC_WORDS + 1];
+	uECC_word_t r[NUM_ECC_WORDS + 1];
+	const uECC_word_t *mu;
+	uECC_word_t borrow;
+	wordcount_t i, w;
+
+	switch (uECC_get_curve_type(curve)) {
+		case uECC_CURVE_TYPE_SECP256R1:
+			mu = barrett_mu_secp256r1;
+			break;
+		case uECC_CURVE_TYPE_SECP256K1:
+			mu = barrett_mu_secp256k1;
+			break;
+		default:
+			uECC_vli_modMult(result, left, right, curve->n,
+					 NUM_ECC_WORDS);
+			return;
+	}
+
+	uECC_vli_mult(product, left, right, NUM_ECC_WORDS);
+
+	/* q = floor(floor(x / b^(k-1)) * mu / b^(k+1)), with b = 2^WORD_BITS
+	 * and k = NUM_ECC_WORDS; q is at most 2 below floor(x / n). */
+	uECC_vli_set(q, product + NUM_ECC_WORDS - 1, NUM_ECC_WORDS + 1);
+	uECC_vli_mult(tmp, q, mu, NUM_ECC_WORDS + 1);
+	uECC_vli_set(q, tmp + NUM_ECC_WORDS + 1, NUM_ECC_WORDS + 1);
+
+	/* r = x - q*n, computed modulo b^(k+1) */
+	uECC_vli_set(n, curve->n, NUM_ECC_WORDS);
+	n[NUM_ECC_WORDS] = 0;
+	uECC_vli_mult(tmp, q, n, NUM_ECC_WORDS + 1);
+	uECC_vli_sub(r, product, tmp, NUM_ECC_WORDS + 1);
+
+	/* Two conditional subtractions, without branching on the value. */
+	for (i = 0; i < 2; ++i) {
+		borrow = uECC_vli_sub(tmp, r, n, NUM_ECC_WORDS + 1);
+		for (w = 0; w < NUM_ECC_WORDS + 1; ++w) {
+			r[w] = cond_set(r[w], tmp[w], borrow);
+		}
+	}
+	uECC_vli_set(result, r, NUM_ECC_WORDS);
+}
+
 static void uECC_vli_modSquare_fast(uECC_word_t *result,
 				    const uECC_word_t *left,
 				    uECC_Curve curve)
@@ -465,8 +532,87 @@ void uECC_vli_modInv(uECC_word_t *result, const uECC_word_t *input,
   	uECC_vli_set(result, u, num_words);
 }
 
+void uECC_vli_mod_sqrt(uECC_word_t *a, uECC_Curve curve)
+{
+	bitcount_t i;
+	uECC_word_t p1[NUM_ECC_WORDS] = {1};
+	uECC_word_t l_result[NUM_ECC_WORDS] = {1};
+	wordcount_t num_words = curve->num_words;
+
+	/* p = 3 (mod 4) on both curves, so sqrt(a) = a^((p + 1) / 4) (mod p). */
+	uECC_vli_add(p1, curve->p, p1, num_words); /* p1 = p + 1 */
+	for (i = uECC_vli_numBits(p1, num_words) - 1; i > 1; --i) {
+		uECC_vli_modSquare_fast(l_result, l_result, curve);
+		if (uECC_vli_testBit(p1, i)) {
+			uECC_vli_modMult_fast(l_result, l_result, a, curve);
+		}
+	}
+	/* The fast reductions may leave a value in [p, 2^256). */
+	if (uECC_vli_cmp_unsafe(curve->p, l_result, num_words) != 1) {
+		uECC_vli_sub(l_result, l_result, curve->p, num_words);
+	}
+	uECC_vli_set(a, l_result, num_words);
+}
+
 /* ------ Point operations ------ */
 
+/* Multiplies modulo p or n with the fast reductions, any other modulus goes
+ * through uECC_vli_mmod(). */
+static void vli_modMult_batch(uECC_word_t *result, const uECC_word_t *left,
+			      const uECC_word_t *right, const uECC_word_t *mod,
+			      uECC_Curve curve)
+{
+	if (mod == curve->p) {
+		uECC_vli_modMult_fast(result, left, right, curve);
+	} else if (mod == curve->n) {
+		uECC_vli_modMult_n(result, left, right, curve);
+	} else {
+		uECC_vli_modMult(result, left, right, mod, curve->num_words);
+	}
+}
+
+void uECC_vli_modInv_batch(uECC_word_t *values, uECC_word_t *scratch,
+			   unsigned int count, const uECC_word_t *mod,
+			   uECC_Curve curve)
+{
+	uECC_word_t inv[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	unsigned int i;
+
+	/* scratch[i] = product of the nonzero values[0..i] */
+	uECC_vli_clear(inv, num_words);
+	inv[0] = 1;
+	for (i = 0; i < count; ++i) {
+		uECC_word_t *v = values + i * NUM_ECC_WORDS;
+
+		if (!uECC_vli_isZero(v, num_words)) {
+			vli_modMult_batch(inv, inv, v, mod, curve);
+		}
+		uECC_vli_set(scratch + i * NUM_ECC_WORDS, inv, num_words);
+	}
+
+	uECC_vli_modInv(inv, inv, mod, num_words);
+
+	/* Walk back: 1/values[i] = inv * scratch[i - 1], where inv is the
+	 * inverse of scratch[i]. */
+	for (i = count; i-- > 0;) {
+		uECC_word_t *v = values + i * NUM_ECC_WORDS;
+
+		if (uECC_vli_isZero(v, num_words)) {
+			continue;
+		}
+		if (i > 0) {
+			vli_modMult_batch(tmp, inv, scratch + (i - 1) * NUM_ECC_WORDS,
+					  mod, curve);
+		} else {
+			uECC_vli_set(tmp, inv, num_words);
+		}
+		vli_modMult_batch(inv, inv, v, mod, curve);
+		uECC_vli_set(v, tmp, num_words);
+	}
+}
+
 void double_jacobian_default(uECC_word_t * X1, uECC_word_t * Y1,
 			     uECC_word_t * Z1, uECC_Curve curve)
 {
@@ -561,9 +707,132 @@ uECC_Curve uECC_secp256k1(void)
 	return &curve_secp256k1;
 }
 
-void vli_mmod_fast_secp256r1(unsigned int *result, unsigned int*product)
+#if uECC_WORD_SIZE == 8
+/* The 64-bit versions build the same NIST terms as the 32-bit code below,
+ * two of its words to each of ours. */
+void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product)
 {
-	unsigned int tmp[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	int carry;
+
+	/* t */
+	uECC_vli_set(result, product, NUM_ECC_WORDS);
+
+	/* s1 */
+	tmp[0] = 0;
+	tmp[1] = product[5] & 0xffffffff00000000ull;
+	tmp[2] = product[6];
+	tmp[3] = product[7];
+	carry = uECC_vli_add(tmp, tmp, tmp, NUM_ECC_WORDS);
+	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
+
+	/* s2 */
+	tmp[1] = product[6] << 32;
+	tmp[2] = (product[6] >> 32) | (product[7] << 32);
+	tmp[3] = product[7] >> 32;
+	carry += uECC_vli_add(tmp, tmp, tmp, NUM_ECC_WORDS);
+	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
+
+	/* s3 */
+	tmp[0] = product[4];
+	tmp[1] = product[5] & 0xffffffff;
+	tmp[2] = 0;
+	tmp[3] = product[7];
+	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
+
+	/* s4 */
+	tmp[0] = (product[4] >> 32) | (product[5] << 32);
+	tmp[1] = (product[5] >> 32) | (product[6] & 0xffffffff00000000ull);
+	tmp[2] = product[7];
+	tmp[3] = (product[6] >> 32) | (product[4] << 32);
+	carry += uECC_vli_add(result, result, tmp, NUM_ECC_WORDS);
+
+	/* d1 */
+	tmp[0] = (product[5] >> 32) | (product[6] << 32);
+	tmp[1] = product[6] >> 32;
+	tmp[2] = 0;
+	tmp[3] = (product[4] & 0xffffffff) | (product[5] << 32);
+	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
+
+	/* d2 */
+	tmp[0] = product[6];
+	tmp[1] = product[7];
+	tmp[2] = 0;
+	tmp[3] = (product[4] >> 32) | (product[5] & 0xffffffff00000000ull);
+	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
+
+	/* d3 */
+	tmp[0] = (product[6] >> 32) | (product[7] << 32);
+	tmp[1] = (product[7] >> 32) | (product[4] << 32);
+	tmp[2] = (product[4] >> 32) | (product[5] << 32);
+	tmp[3] = product[6] << 32;
+	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
+
+	/* d4 */
+	tmp[0] = product[7];
+	tmp[1] = product[4] & 0xffffffff00000000ull;
+	tmp[2] = product[5];
+	tmp[3] = product[6] & 0xffffffff00000000ull;
+	carry -= uECC_vli_sub(result, result, tmp, NUM_ECC_WORDS);
+
+	if (carry < 0) {
+		do {
+			carry += uECC_vli_add(result, result, curve_secp256r1.p, NUM_ECC_WORDS);
+		}
+		while (carry < 0);
+	} else  {
+		while (carry ||
+		       uECC_vli_cmp_unsafe(curve_secp256r1.p, result, NUM_ECC_WORDS) != 1) {
+			carry -= uECC_vli_sub(result, result, curve_secp256r1.p, NUM_ECC_WORDS);
+		}
+	}
+}
+
+/* 2^256 = 2^32 + 977 (mod p), which fits in one word, so the high half is
+ * folded in with a word-by-word multiply-accumulate instead of shifts. */
+#define SECP256K1_FOLD 0x1000003D1ull
+
+void vli_mmod_fast_secp256k1(uECC_word_t *result, uECC_word_t *product)
+{
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_dword_t acc = 0;
+	wordcount_t i;
+
+	/* tmp + top*2^256 = c0 + c1*FOLD, with top below 2^34 */
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		acc += (uECC_dword_t)product[NUM_ECC_WORDS + i] * SECP256K1_FOLD +
+		       product[i];
+		tmp[i] = (uECC_word_t)acc;
+		acc >>= uECC_WORD_BITS;
+	}
+
+	/* result + carry*2^256 = tmp + top*FOLD */
+	acc *= SECP256K1_FOLD;
+	for (i = 0; i < NUM_ECC_WORDS; ++i) {
+		acc += tmp[i];
+		result[i] = (uECC_word_t)acc;
+		acc >>= uECC_WORD_BITS;
+	}
+
+	/* A carry leaves result below 2^68, so folding it cannot carry again. */
+	if (acc) {
+		acc = (uECC_dword_t)result[0] + SECP256K1_FOLD;
+		result[0] = (uECC_word_t)acc;
+		for (i = 1; i < NUM_ECC_WORDS && (acc >>= uECC_WORD_BITS); ++i) {
+			acc += result[i];
+			result[i] = (uECC_word_t)acc;
+		}
+	}
+
+	/* result < 2^256 < 2p */
+	if (uECC_vli_cmp_unsafe(curve_secp256k1.p, result, NUM_ECC_WORDS) != 1) {
+		uECC_vli_sub(result, result, curve_secp256k1.p, NUM_ECC_WORDS);
+	}
+}
+#else
+void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product)
+{
+	uECC_word_t tmp[NUM_ECC_WORDS];
 	int carry;
 
 	/* t */
@@ -662,10 +931,10 @@ void vli_mmod_fast_secp256r1(unsigned int *result, unsigned int*product)
 	}
 }
 
-void vli_mmod_fast_secp256k1(unsigned int *result, unsigned int *product)
+void vli_mmod_fast_secp256k1(uECC_word_t *result, uECC_word_t *product)
 {
-	unsigned int tmp[NUM_ECC_WORDS];
-	unsigned int carry;
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	uECC_word_t carry;
 
 	//w0 = c0
 	uECC_vli_set(result, product, NUM_ECC_WORDS);
@@ -813,6 +1082,7 @@ void vli_mmod_fast_secp256k1(unsigned int *result, unsigned int *product)
         *(result + 1) |= 0x1;
 	}  
 }
+#endif
 
 uECC_word_t EccPoint_isZero(const uECC_word_t *point, uECC_Curve curve)
 {
@@ -966,6 +1236,745 @@ void EccPoint_mult(uECC_word_t * result, const uECC_word_t * point,
 	uECC_vli_set(result + num_words, Ry[0], num_words);
 }
 
+#if uECC_BASE_COMB_WIDTH || uECC_VERIFY_WNAF_WIDTH
+
+/* (X1, Y1, Z1) => (X1, Y1, Z1) + (x2, y2), adding an affine point to a
+ * point in Jacobian coordinates. The equal and opposite point cases only
+ * arise for crafted scalars or keys. */
+static void add_mixed(uECC_word_t * X1, uECC_word_t * Y1, uECC_word_t * Z1,
+		      const uECC_word_t * x2, const uECC_word_t * y2,
+		      uECC_Curve curve)
+{
+	uECC_word_t t1[NUM_ECC_WORDS];
+	uECC_word_t t2[NUM_ECC_WORDS];
+	uECC_word_t t3[NUM_ECC_WORDS];
+	uECC_word_t t4[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+
+	if (uECC_vli_isZero(Z1, num_words)) {
+		uECC_vli_set(X1, x2, num_words);
+		uECC_vli_set(Y1, y2, num_words);
+		uECC_vli_clear(Z1, num_words);
+		Z1[0] = 1;
+		return;
+	}
+
+	uECC_vli_modSquare_fast(t1, Z1, curve); /* t1 = z1^2 */
+	uECC_vli_modMult_fast(t2, t1, Z1, curve); /* t2 = z1^3 */
+	uECC_vli_modMult_fast(t1, t1, x2, curve); /* t1 = x2*z1^2 */
+	uECC_vli_modMult_fast(t2, t2, y2, curve); /* t2 = y2*z1^3 */
+	uECC_vli_modSub(t1, t1, X1, curve->p, num_words); /* t1 = x2*z1^2 - x1 = H */
+	uECC_vli_modSub(t2, t2, Y1, curve->p, num_words); /* t2 = y2*z1^3 - y1 = R */
+
+	if (uECC_vli_isZero(t1, num_words)) {
+		if (uECC_vli_isZero(t2, num_words)) {
+			curve->double_jacobian(X1, Y1, Z1, curve);
+		} else {
+			uECC_vli_clear(Z1, num_words);
+		}
+		return;
+	}
+
+	uECC_vli_modMult_fast(Z1, Z1, t1, curve); /* z3 = z1*H */
+	uECC_vli_modSquare_fast(t3, t1, curve); /* t3 = H^2 */
+	uECC_vli_modMult_fast(t4, t3, t1, curve); /* t4 = H^3 */
+	uECC_vli_modMult_fast(t3, t3, X1, curve); /* t3 = x1*H^2 = V */
+	uECC_vli_modSquare_fast(X1, t2, curve); /* t1 = R^2 */
+	uECC_vli_modSub(X1, X1, t4, curve->p, num_words); /* t1 = R^2 - H^3 */
+	uECC_vli_modSub(X1, X1, t3, curve->p, num_words);
+	uECC_vli_modSub(X1, X1, t3, curve->p, num_words); /* t1 = R^2 - H^3 - 2V = x3 */
+	uECC_vli_modSub(t3, t3, X1, curve->p, num_words); /* t3 = V - x3 */
+	uECC_vli_modMult_fast(t3, t3, t2, curve); /* t3 = R*(V - x3) */
+	uECC_vli_modMult_fast(t4, t4, Y1, curve); /* t4 = y1*H^3 */
+	uECC_vli_modSub(Y1, t3, t4, curve->p, num_words); /* y3 = R*(V - x3) - y1*H^3 */
+}
+
+#endif
+
+#if uECC_BASE_COMB_WIDTH
+
+#if uECC_BASE_COMB_WIDTH < 4 || uECC_BASE_COMB_WIDTH > 6
+#error "uECC_BASE_COMB_WIDTH must be 0, 4, 5 or 6"
+#endif
+
+/* The scalar bits are laid out in uECC_BASE_COMB_WIDTH rows of COMB_D bits;
+ * column i of the comb holds bits i, i + COMB_D, i + 2*COMB_D, ... */
+#define COMB_D ((NUM_ECC_BYTES * 8 + uECC_BASE_COMB_WIDTH - 1) / uECC_BASE_COMB_WIDTH)
+#define COMB_POINTS (1 << (uECC_BASE_COMB_WIDTH - 1))
+
+/* Generated by tools/gen_ecc_comb_tables.py, see ecc_comb_tables.c. */
+extern const uECC_word_t ecc_base_comb_secp256r1[];
+extern const uECC_word_t ecc_base_comb_secp256k1[];
+
+/* Recodes an odd scalar into COMB_D + 1 odd comb digits, so that no column
+ * ever selects the point at infinity. The low bits of x[i] are column i, bit
+ * 7 marks a digit whose point is subtracted. Same recoding as Mbed TLS's
+ * ecp_comb_recode_core(). */
+static void comb_recode(uint8_t *x, const uECC_word_t *k)
+{
+	bitcount_t i;
+	bitcount_t j;
+	uint8_t c, cc, adjust;
+
+	for (i = 0; i < COMB_D; ++i) {
+		x[i] = 0;
+		for (j = 0; j < uECC_BASE_COMB_WIDTH; ++j) {
+			if (i + COMB_D * j < NUM_ECC_BYTES * 8) {
+				x[i] |= (!!uECC_vli_testBit(k, i + COMB_D * j)) << j;
+			}
+		}
+	}
+	x[COMB_D] = 0;
+
+	/* Make x[1] .. x[COMB_D] odd, propagating carries without branches. */
+	c = 0;
+	for (i = 1; i <= COMB_D; ++i) {
+		cc = x[i] & c;
+		x[i] = x[i] ^ c;
+		c = cc;
+
+		adjust = 1 - (x[i] & 0x01);
+		c |= x[i] & (uint8_t)(x[i - 1] * adjust);
+		x[i] = x[i] ^ (uint8_t)(x[i - 1] * adjust);
+		x[i - 1] |= adjust << 7;
+	}
+}
+
+/* Copies the table point for a recoded digit, reading every entry so the
+ * access pattern does not depend on the digit, and negates it if the digit
+ * is subtracted. */
+static void comb_select(uECC_word_t *x, uECC_word_t *y,
+			const uECC_word_t *table, uint8_t digit,
+			uECC_Curve curve)
+{
+	uECC_word_t neg[NUM_ECC_WORDS];
+	uECC_word_t index = (digit & 0x7F) >> 1;
+	uECC_word_t mask;
+	uECC_word_t i;
+	wordcount_t w;
+
+	uECC_vli_clear(x, NUM_ECC_WORDS);
+	uECC_vli_clear(y, NUM_ECC_WORDS);
+	for (i = 0; i < COMB_POINTS; ++i) {
+		const uECC_word_t *point = table + i * 2 * NUM_ECC_WORDS;
+
+		mask = (uECC_word_t)0 - (uECC_word_t)(i == index);
+		for (w = 0; w < NUM_ECC_WORDS; ++w) {
+			x[w] |= point[w] & mask;
+			y[w] |= point[NUM_ECC_WORDS + w] & mask;
+		}
+	}
+
+	uECC_vli_sub(neg, curve->p, y, NUM_ECC_WORDS);
+	for (w = 0; w < NUM_ECC_WORDS; ++w) {
+		y[w] = cond_set(neg[w], y[w], digit >> 7);
+	}
+}
+
+uECC_word_t EccPoint_mult_base(uECC_word_t * result,
+			       const uECC_word_t * scalar,
+			       const uECC_word_t * initial_Z, uECC_Curve curve)
+{
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t tx[NUM_ECC_WORDS];
+	uECC_word_t ty[NUM_ECC_WORDS];
+	uECC_word_t *X = result;
+	uECC_word_t *Y = result + NUM_ECC_WORDS;
+	uint8_t digits[COMB_D + 1];
+	const uECC_word_t *table;
+	unsigned int even;
+	bitcount_t i;
+	wordcount_t w;
+
+	switch (uECC_get_curve_type(curve)) {
+		case uECC_CURVE_TYPE_SECP256R1:
+			table = ecc_base_comb_secp256r1;
+			break;
+		case uECC_CURVE_TYPE_SECP256K1:
+			table = ecc_base_comb_secp256k1;
+			break;
+		default:
+			return 0;
+	}
+
+	/* The recoding needs an odd scalar. n is odd, so for an even k use
+	 * n - k and negate the result: (n - k)*G = -(k*G). */
+	even = !uECC_vli_testBit(scalar, 0);
+	uECC_vli_sub(k, curve->n, scalar, NUM_ECC_WORDS);
+	for (w = 0; w < NUM_ECC_WORDS; ++w) {
+		k[w] = cond_set(k[w], scalar[w], even);
+	}
+	comb_recode(digits, k);
+
+	comb_select(X, Y, table, digits[COMB_D], curve);
+	uECC_vli_clear(z, NUM_ECC_WORDS);
+	z[0] = 1;
+
+	/* Randomize the projective representation of the starting point so
+	 * that the intermediate coordinates are unpredictable. */
+	if (initial_Z) {
+		apply_z(X, Y, initial_Z, curve);
+		uECC_vli_set(z, initial_Z, NUM_ECC_WORDS);
+	}
+
+	for (i = COMB_D - 1; i >= 0; --i) {
+		curve->double_jacobian(X, Y, z, curve);
+		comb_select(tx, ty, table, digits[i], curve);
+		add_mixed(X, Y, z, tx, ty, curve);
+	}
+
+	if (uECC_vli_isZero(z, NUM_ECC_WORDS)) {
+		uECC_vli_clear(result, 2 * NUM_ECC_WORDS);
+		return 0;
+	}
+
+	uECC_vli_modInv(z, z, curve->p, NUM_ECC_WORDS);
+	apply_z(X, Y, z, curve);
+
+	uECC_vli_sub(ty, curve->p, Y, NUM_ECC_WORDS);
+	for (w = 0; w < NUM_ECC_WORDS; ++w) {
+		Y[w] = cond_set(ty[w], Y[w], even);
+	}
+	return 1;
+}
+
+#endif /* uECC_BASE_COMB_WIDTH */
+
+#if uECC_VERIFY_WNAF_WIDTH
+
+#if uECC_VERIFY_WNAF_WIDTH < 4 || uECC_VERIFY_WNAF_WIDTH > 5
+#error "uECC_VERIFY_WNAF_WIDTH must be 0, 4 or 5"
+#endif
+
+/* Number of odd multiples G, 3G, ... in each table. */
+#define WNAF_POINTS (1 << (uECC_VERIFY_WNAF_WIDTH - 2))
+/* A wNAF can be one digit longer than the scalar. */
+#define WNAF_DIGITS (NUM_ECC_BYTES * 8 + 1)
+
+/* Generated by tools/gen_ecc_comb_tables.py, see ecc_comb_tables.c. */
+extern const uECC_word_t ecc_base_wnaf_secp256r1[];
+extern const uECC_word_t ecc_base_wnaf_secp256k1[];
+
+/* Writes the width-w NAF of k: every nonzero digit is odd, less than 2^(w-1)
+ * in magnitude and followed by at least w-1 zero digits. Returns the number
+ * of digits up to the highest nonzero one. */
+static bitcount_t wnaf_recode(int8_t *naf, const uECC_word_t *k)
+{
+	bitcount_t bit = 0;
+	bitcount_t length = 0;
+	bitcount_t i;
+	int carry = 0;
+	int digit;
+
+	memset(naf, 0, WNAF_DIGITS);
+	while (bit < WNAF_DIGITS) {
+		if (bit < NUM_ECC_BYTES * 8 &&
+		    !!uECC_vli_testBit(k, bit) != carry) {
+			digit = carry;
+			for (i = 0; i < uECC_VERIFY_WNAF_WIDTH; ++i) {
+				if (bit + i < NUM_ECC_BYTES * 8 &&
+				    uECC_vli_testBit(k, bit + i)) {
+					digit += 1 << i;
+				}
+			}
+			carry = (digit >> (uECC_VERIFY_WNAF_WIDTH - 1)) & 1;
+			digit -= carry << uECC_VERIFY_WNAF_WIDTH;
+			naf[bit] = (int8_t)digit;
+			length = bit + 1;
+			bit += uECC_VERIFY_WNAF_WIDTH;
+		} else if (bit >= NUM_ECC_BYTES * 8 && carry) {
+			naf[bit] = 1;
+			length = bit + 1;
+			carry = 0;
+			++bit;
+		} else {
+			++bit;
+		}
+	}
+	return length;
+}
+
+/* Fills table with the affine odd multiples Q, 3Q, 5Q, ... of a point,
+ * sharing a single inversion between all of them. */
+static void wnaf_point_table(uECC_word_t *table, const uECC_word_t *point,
+			     uECC_Curve curve)
+{
+	uECC_word_t z[WNAF_POINTS][NUM_ECC_WORDS];
+	uECC_word_t prod[WNAF_POINTS][NUM_ECC_WORDS];
+	uECC_word_t dx[NUM_ECC_WORDS];
+	uECC_word_t dy[NUM_ECC_WORDS];
+	uECC_word_t inv[NUM_ECC_WORDS];
+	uECC_word_t tmp[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	int i;
+
+	/* 2Q, made affine so that it can be added with add_mixed(). */
+	uECC_vli_set(dx, point, num_words);
+	uECC_vli_set(dy, point + num_words, num_words);
+	uECC_vli_clear(inv, num_words);
+	inv[0] = 1;
+	curve->double_jacobian(dx, dy, inv, curve);
+	uECC_vli_modInv(inv, inv, curve->p, num_words);
+	apply_z(dx, dy, inv, curve);
+
+	uECC_vli_set(table, point, 2 * num_words);
+	uECC_vli_clear(z[0], num_words);
+	z[0][0] = 1;
+	uECC_vli_set(prod[0], z[0], num_words);
+	for (i = 1; i < WNAF_POINTS; ++i) {
+		uECC_word_t *X = table + i * 2 * NUM_ECC_WORDS;
+
+		uECC_vli_set(X, X - 2 * NUM_ECC_WORDS, 2 * num_words);
+		uECC_vli_set(z[i], z[i - 1], num_words);
+		add_mixed(X, X + NUM_ECC_WORDS, z[i], dx, dy, curve);
+		uECC_vli_modMult_fast(prod[i], prod[i - 1], z[i], curve);
+	}
+
+	/* Montgomery's trick: invert the product of all Z, then peel off one
+	 * entry at a time. */
+	uECC_vli_modInv(inv, prod[WNAF_POINTS - 1], curve->p, num_words);
+	for (i = WNAF_POINTS - 1; i > 0; --i) {
+		uECC_word_t *X = table + i * 2 * NUM_ECC_WORDS;
+
+		uECC_vli_modMult_fast(tmp, inv, prod[i - 1], curve); /* 1/z[i] */
+		uECC_vli_modMult_fast(inv, inv, z[i], curve);
+		apply_z(X, X + NUM_ECC_WORDS, tmp, curve);
+	}
+}
+
+/* Adds the table point for a nonzero wNAF digit to (X, Y, Z). */
+static void wnaf_add(uECC_word_t *X, uECC_word_t *Y, uECC_word_t *Z,
+		     const uECC_word_t *table, int8_t digit, uECC_Curve curve)
+{
+	uECC_word_t neg[NUM_ECC_WORDS];
+	const uECC_word_t *point;
+
+	if (digit > 0) {
+		point = table + ((digit - 1) >> 1) * 2 * NUM_ECC_WORDS;
+		add_mixed(X, Y, Z, point, point + NUM_ECC_WORDS, curve);
+	} else {
+		point = table + ((-digit - 1) >> 1) * 2 * NUM_ECC_WORDS;
+		uECC_vli_sub(neg, curve->p, point + NUM_ECC_WORDS, curve->num_words);
+		add_mixed(X, Y, Z, point, neg, curve);
+	}
+}
+
+#if uECC_SECP256K1_GLV
+
+/* Window of the regular recoding in EccPoint_mult_glv(): its digits are the
+ * odd multiples up to 2^w - 1 that the wNAF tables hold. */
+#define GLV_WINDOW (uECC_VERIFY_WNAF_WIDTH - 1)
+/* Digits for a half scalar below 2^129. */
+#define GLV_DIGITS ((129 + GLV_WINDOW - 1) / GLV_WINDOW)
+/* The split rounds products with g1 and g2 to their top 128 bits. */
+#define GLV_SHIFT_WORDS (384 / uECC_WORD_BITS)
+
+/* beta, a cube root of unity mod p: (beta*x, y) = lambda*(x, y). */
+static const uECC_word_t glv_beta[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(EE, 01, 95, 71, 28, 6C, 39, C1),
+	BYTES_TO_WORDS_8(95, 89, F5, 12, 75, 49, F0, 9C),
+	BYTES_TO_WORDS_8(E9, 34, 34, AC, 9E, 47, 64, 6E),
+	BYTES_TO_WORDS_8(10, 07, 7C, 65, 2B, 6A, E9, 7A)
+};
+
+/* lambda, the matching cube root of unity mod n. */
+static const uECC_word_t glv_lambda[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(72, BD, 23, 1B, 7C, 96, 02, DF),
+	BYTES_TO_WORDS_8(78, 66, 81, 20, EA, 22, 2E, 12),
+	BYTES_TO_WORDS_8(5A, 64, 12, 88, 02, 1C, 26, A5),
+	BYTES_TO_WORDS_8(E0, 30, 5C, C0, 4C, AD, 63, 53)
+};
+
+/* With the short lattice basis (a1, b1), (a2, b2) of {(x, y) : x + y*lambda
+ * = 0 (mod n)}: g1 = round(2^384 * b2 / n), g2 = round(2^384 * -b1 / n),
+ * and -b1, -b2 mod n. */
+static const uECC_word_t glv_g1[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(31, B0, DB, 45, 9A, 20, 93, E8),
+	BYTES_TO_WORDS_8(7F, CA, E8, 71, 14, 8A, AA, 3D),
+	BYTES_TO_WORDS_8(15, EB, 84, 92, E4, 90, 6C, E8),
+	BYTES_TO_WORDS_8(CD, 6B, D4, A7, 21, D2, 86, 30)
+};
+
+static const uECC_word_t glv_g2[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(71, 7F, C4, 8A, AE, B4, 71, 15),
+	BYTES_TO_WORDS_8(C6, 06, F5, 9D, AC, 08, 12, 22),
+	BYTES_TO_WORDS_8(C4, E4, BF, 0A, A9, 7F, 54, 6F),
+	BYTES_TO_WORDS_8(28, 88, 0E, 01, D6, 7E, 43, E4)
+};
+
+static const uECC_word_t glv_minus_b1[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(C3, E4, BF, 0A, A9, 7F, 54, 6F),
+	BYTES_TO_WORDS_8(28, 88, 0E, 01, D6, 7E, 43, E4),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+	BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00)
+};
+
+static const uECC_word_t glv_minus_b2[NUM_ECC_WORDS] = {
+	BYTES_TO_WORDS_8(2C, 56, B1, 3D, A8, CD, 65, D7),
+	BYTES_TO_WORDS_8(6D, 34, 74, 07, C5, 0A, 28, 8A),
+	BYTES_TO_WORDS_8(FE, FF, FF, FF, FF, FF, FF, FF),
+	BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF)
+};
+
+/* c = round(k * g / 2^384) */
+static void glv_round_mult(uECC_word_t *c, const uECC_word_t *k,
+			   const uECC_word_t *g)
+{
+	uECC_word_t product[2 * NUM_ECC_WORDS];
+	uECC_word_t one[NUM_ECC_WORDS];
+
+	uECC_vli_mult(product, k, g, NUM_ECC_WORDS);
+	uECC_vli_clear(c, NUM_ECC_WORDS);
+	uECC_vli_set(c, product + GLV_SHIFT_WORDS,
+		     2 * NUM_ECC_WORDS - GLV_SHIFT_WORDS);
+	uECC_vli_clear(one, NUM_ECC_WORDS);
+	one[0] = !!uECC_vli_testBit(product, 383);
+	uECC_vli_add(c, c, one, NUM_ECC_WORDS);
+}
+
+/* Replaces k (mod n) by n - k if that is smaller, returning 1 if it did. */
+static uECC_word_t glv_abs(uECC_word_t *k, uECC_Curve curve)
+{
+	uECC_word_t t[NUM_ECC_WORDS];
+	uECC_word_t d[NUM_ECC_WORDS];
+	uECC_word_t neg;
+	wordcount_t w;
+
+	uECC_vli_sub(t, curve->n, k, NUM_ECC_WORDS);
+	neg = uECC_vli_sub(d, t, k, NUM_ECC_WORDS);
+	for (w = 0; w < NUM_ECC_WORDS; ++w) {
+		k[w] = cond_set(t[w], k[w], neg);
+	}
+	return neg;
+}
+
+/* Splits k < n into k1 + k2*lambda (mod n), returning |k1| and |k2|, both
+ * below 2^128, with neg[0] and neg[1] set for the negative ones. Same
+ * decomposition as libsecp256k1's scalar_split_lambda(). */
+static void glv_split(uECC_word_t *k1, uECC_word_t *k2, uECC_word_t *neg,
+		      const uECC_word_t *k, uECC_Curve curve)
+{
+	uECC_word_t c1[NUM_ECC_WORDS];
+	uECC_word_t c2[NUM_ECC_WORDS];
+
+	glv_round_mult(c1, k, glv_g1);
+	glv_round_mult(c2, k, glv_g2);
+	uECC_vli_modMult_n(c1, c1, glv_minus_b1, curve);
+	uECC_vli_modMult_n(c2, c2, glv_minus_b2, curve);
+	uECC_vli_modAdd(k2, c1, c2, curve->n, NUM_ECC_WORDS);
+	uECC_vli_modMult_n(c1, k2, glv_lambda, curve);
+	uECC_vli_modSub(k1, k, c1, curve->n, NUM_ECC_WORDS);
+
+	neg[0] = glv_abs(k1, curve);
+	neg[1] = glv_abs(k2, curve);
+}
+
+/* Fills dst with lambda times each point of a wNAF table. */
+static void glv_lambda_table(uECC_word_t *dst, const uECC_word_t *src,
+			     uECC_Curve curve)
+{
+	int i;
+
+	for (i = 0; i < WNAF_POINTS; ++i) {
+		uECC_vli_modMult_fast(dst, src, glv_beta, curve);
+		uECC_vli_set(dst + NUM_ECC_WORDS, src + NUM_ECC_WORDS,
+			     NUM_ECC_WORDS);
+		dst += 2 * NUM_ECC_WORDS;
+		src += 2 * NUM_ECC_WORDS;
+	}
+}
+
+/* u1*G + u2*Q as k1*G + k2*(lambda*G) + k3*Q + k4*(lambda*Q). */
+static uECC_word_t glv_mult_add_jacobian(uECC_word_t * result,
+					 uECC_word_t * z,
+					 const uECC_word_t * u1,
+					 const uECC_word_t * u2,
+					 const uECC_word_t * point,
+					 uECC_Curve curve)
+{
+	uECC_word_t tables[3][WNAF_POINTS * 2 * NUM_ECC_WORDS];
+	const uECC_word_t *table[4];
+	uECC_word_t k[4][NUM_ECC_WORDS];
+	uECC_word_t neg[4];
+	int8_t naf[4][WNAF_DIGITS];
+	uECC_word_t *X = result;
+	uECC_word_t *Y = result + NUM_ECC_WORDS;
+	bitcount_t i;
+	bitcount_t length;
+	int j;
+
+	glv_split(k[0], k[1], neg, u1, curve);
+	glv_split(k[2], k[3], neg + 2, u2, curve);
+
+	table[0] = ecc_base_wnaf_secp256k1;
+	glv_lambda_table(tables[0], ecc_base_wnaf_secp256k1, curve);
+	table[1] = tables[0];
+	wnaf_point_table(tables[1], point, curve);
+	table[2] = tables[1];
+	glv_lambda_table(tables[2], tables[1], curve);
+	table[3] = tables[2];
+
+	length = 0;
+	for (j = 0; j < 4; ++j) {
+		i = wnaf_recode(naf[j], k[j]);
+		if (i > length) {
+			length = i;
+		}
+		if (neg[j]) {
+			for (i = 0; i < WNAF_DIGITS; ++i) {
+				naf[j][i] = -naf[j][i];
+			}
+		}
+	}
+
+	uECC_vli_clear(X, 2 * NUM_ECC_WORDS);
+	uECC_vli_clear(z, NUM_ECC_WORDS);
+	while (length-- > 0) {
+		curve->double_jacobian(X, Y, z, curve);
+		for (j = 0; j < 4; ++j) {
+			if (naf[j][length]) {
+				wnaf_add(X, Y, z, table[j], naf[j][length], curve);
+			}
+		}
+	}
+
+	return !uECC_vli_isZero(z, NUM_ECC_WORDS);
+}
+
+/* Recodes an odd k < 2^129 into GLV_DIGITS odd digits of magnitude below
+ * 2^GLV_WINDOW, least significant first. No digit is zero, so the additions
+ * do not depend on k (Joye and Tunstall's regular recoding). */
+static void glv_recode(int8_t *digits, const uECC_word_t *k)
+{
+	uECC_word_t t[NUM_ECC_WORDS];
+	uECC_word_t low;
+	bitcount_t i;
+	wordcount_t w;
+
+	uECC_vli_set(t, k, NUM_ECC_WORDS);
+	for (i = 0; i < GLV_DIGITS - 1; ++i) {
+		/* d = (t mod 2^(w+1)) - 2^w, then t = (t - d) / 2^w, which is
+		 * t with its low w+1 bits replaced by 2^w, shifted down. */
+		low = t[0] & ((1 << (GLV_WINDOW + 1)) - 1);
+		digits[i] = (int8_t)((int)low - (1 << GLV_WINDOW));
+		t[0] = (t[0] & ~(uECC_word_t)((1 << (GLV_WINDOW + 1)) - 1)) |
+		       (1 << GLV_WINDOW);
+		for (w = 0; w < NUM_ECC_WORDS - 1; ++w) {
+			t[w] = (t[w] >> GLV_WINDOW) |
+			       (t[w + 1] << (uECC_WORD_BITS - GLV_WINDOW));
+		}
+		t[NUM_ECC_WORDS - 1] >>= GLV_WINDOW;
+	}
+	digits[GLV_DIGITS - 1] = (int8_t)t[0];
+	_set_secure(t, 0, sizeof(t));
+}
+
+/* Copies the table point for an odd digit, reading every entry so the
+ * access pattern does not depend on the digit, and negates it if the digit
+ * is negative, or positive with flip set. */
+static void glv_select(uECC_word_t *x, uECC_word_t *y,
+		       const uECC_word_t *table, int8_t digit,
+		       uECC_word_t flip, uECC_Curve curve)
+{
+	uECC_word_t neg[NUM_ECC_WORDS];
+	uint8_t sign = (uint8_t)digit >> 7;
+	uint8_t magnitude = ((uint8_t)digit ^ (uint8_t)(0 - sign)) + sign;
+	uECC_word_t index = magnitude >> 1;
+	uECC_word_t mask;
+	uECC_word_t i;
+	wordcount_t w;
+
+	uECC_vli_clear(x, NUM_ECC_WORDS);
+	uECC_vli_clear(y, NUM_ECC_WORDS);
+	for (i = 0; i < WNAF_POINTS; ++i) {
+		const uECC_word_t *point = table + i * 2 * NUM_ECC_WORDS;
+
+		mask = (uECC_word_t)0 - (uECC_word_t)(i == index);
+		for (w = 0; w < NUM_ECC_WORDS; ++w) {
+			x[w] |= point[w] & mask;
+			y[w] |= point[NUM_ECC_WORDS + w] & mask;
+		}
+	}
+
+	uECC_vli_sub(neg, curve->p, y, NUM_ECC_WORDS);
+	for (w = 0; w < NUM_ECC_WORDS; ++w) {
+		y[w] = cond_set(neg[w], y[w], sign ^ flip);
+	}
+}
+
+uECC_word_t EccPoint_mult_glv(uECC_word_t * result, const uECC_word_t * point,
+			      const uECC_word_t * scalar,
+			      const uECC_word_t * initial_Z, uECC_Curve curve)
+{
+	uECC_word_t table[2][WNAF_POINTS * 2 * NUM_ECC_WORDS];
+	uECC_word_t k[2][NUM_ECC_WORDS];
+	uECC_word_t neg[2];
+	uECC_word_t even[2];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t tx[NUM_ECC_WORDS];
+	uECC_word_t ty[NUM_ECC_WORDS];
+	uECC_word_t cx[NUM_ECC_WORDS];
+	uECC_word_t cy[NUM_ECC_WORDS];
+	uECC_word_t cz[NUM_ECC_WORDS];
+	int8_t digits[2][GLV_DIGITS];
+	uECC_word_t *X = result;
+	uECC_word_t *Y = result + NUM_ECC_WORDS;
+	uECC_word_t borrow;
+	bitcount_t i;
+	wordcount_t w;
+	int j;
+
+	if (uECC_get_curve_type(curve) != uECC_CURVE_TYPE_SECP256K1) {
+		return 0;
+	}
+
+	/* Both halves are built before result is written, as it may be the
+	 * point itself. */
+	wnaf_point_table(table[0], point, curve);
+	glv_lambda_table(table[1], table[0], curve);
+
+	borrow = uECC_vli_sub(tx, scalar, curve->n, NUM_ECC_WORDS);
+	for (w = 0; w < NUM_ECC_WORDS; ++w) {
+		tx[w] = cond_set(scalar[w], tx[w], borrow);
+	}
+	glv_split(k[0], k[1], neg, tx, curve);
+
+	/* The recoding needs odd halves: an even one is made odd by adding 1,
+	 * and the extra point is subtracted again at the end. */
+	for (j = 0; j < 2; ++j) {
+		even[j] = !uECC_vli_testBit(k[j], 0);
+		k[j][0] |= 1;
+		glv_recode(digits[j], k[j]);
+	}
+
+	glv_select(X, Y, table[0], digits[0][GLV_DIGITS - 1], neg[0], curve);
+	uECC_vli_clear(z, NUM_ECC_WORDS);
+	z[0] = 1;
+
+	/* Randomize the projective representation of the starting point so
+	 * that the intermediate coordinates are unpredictable. */
+	if (initial_Z) {
+		apply_z(X, Y, initial_Z, curve);
+		uECC_vli_set(z, initial_Z, NUM_ECC_WORDS);
+	}
+
+	glv_select(tx, ty, table[1], digits[1][GLV_DIGITS - 1], neg[1], curve);
+	add_mixed(X, Y, z, tx, ty, curve);
+	for (i = GLV_DIGITS - 2; i >= 0; --i) {
+		for (j = 0; j < GLV_WINDOW; ++j) {
+			curve->double_jacobian(X, Y, z, curve);
+		}
+		for (j = 0; j < 2; ++j) {
+			glv_select(tx, ty, table[j], digits[j][i], neg[j], curve);
+			add_mixed(X, Y, z, tx, ty, curve);
+		}
+	}
+
+	/* Subtract P, or lambda*P, for a half that was made odd, always doing
+	 * the addition and keeping it only where it was. */
+	for (j = 0; j < 2; ++j) {
+		uECC_vli_set(cx, X, NUM_ECC_WORDS);
+		uECC_vli_set(cy, Y, NUM_ECC_WORDS);
+		uECC_vli_set(cz, z, NUM_ECC_WORDS);
+		glv_select(tx, ty, table[j], 1, !neg[j], curve);
+		add_mixed(cx, cy, cz, tx, ty, curve);
+		for (w = 0; w < NUM_ECC_WORDS; ++w) {
+			X[w] = cond_set(cx[w], X[w], even[j]);
+			Y[w] = cond_set(cy[w], Y[w], even[j]);
+			z[w] = cond_set(cz[w], z[w], even[j]);
+		}
+	}
+
+	_set_secure(k, 0, sizeof(k));
+	_set_secure(digits, 0, sizeof(digits));
+
+	if (uECC_vli_isZero(z, NUM_ECC_WORDS)) {
+		uECC_vli_clear(result, 2 * NUM_ECC_WORDS);
+		return 0;
+	}
+
+	uECC_vli_modInv(z, z, curve->p, NUM_ECC_WORDS);
+	apply_z(X, Y, z, curve);
+	return 1;
+}
+
+#endif /* uECC_SECP256K1_GLV */
+
+uECC_word_t EccPoint_mult_add_jacobian_unsafe(uECC_word_t * result,
+					      uECC_word_t * z,
+					      const uECC_word_t * u1,
+					      const uECC_word_t * u2,
+					      const uECC_word_t * point,
+					      uECC_Curve curve)
+{
+	uECC_word_t table[WNAF_POINTS * 2 * NUM_ECC_WORDS];
+	uECC_word_t *X = result;
+	uECC_word_t *Y = result + NUM_ECC_WORDS;
+	int8_t naf1[WNAF_DIGITS];
+	int8_t naf2[WNAF_DIGITS];
+	const uECC_word_t *base;
+	bitcount_t i;
+	bitcount_t length;
+
+#if uECC_SECP256K1_GLV
+	if (uECC_get_curve_type(curve) == uECC_CURVE_TYPE_SECP256K1) {
+		return glv_mult_add_jacobian(result, z, u1, u2, point, curve);
+	}
+#endif
+
+	switch (uECC_get_curve_type(curve)) {
+		case uECC_CURVE_TYPE_SECP256R1:
+			base = ecc_base_wnaf_secp256r1;
+			break;
+		case uECC_CURVE_TYPE_SECP256K1:
+			base = ecc_base_wnaf_secp256k1;
+			break;
+		default:
+			return 0;
+	}
+
+	wnaf_point_table(table, point, curve);
+	i = wnaf_recode(naf1, u1);
+	length = wnaf_recode(naf2, u2);
+	if (length > i) {
+		i = length;
+	}
+
+	/* Z = 0 is the point at infinity, which add_mixed() replaces by the
+	 * first point added to it and double_jacobian() leaves alone. */
+	uECC_vli_clear(X, 2 * NUM_ECC_WORDS);
+	uECC_vli_clear(z, NUM_ECC_WORDS);
+	while (i-- > 0) {
+		curve->double_jacobian(X, Y, z, curve);
+		if (naf1[i]) {
+			wnaf_add(X, Y, z, base, naf1[i], curve);
+		}
+		if (naf2[i]) {
+			wnaf_add(X, Y, z, table, naf2[i], curve);
+		}
+	}
+
+	return !uECC_vli_isZero(z, NUM_ECC_WORDS);
+}
+
+uECC_word_t EccPoint_mult_add_unsafe(uECC_word_t * result,
+				     const uECC_word_t * u1,
+				     const uECC_word_t * u2,
+				     const uECC_word_t * point, uECC_Curve curve)
+{
+	uECC_word_t z[NUM_ECC_WORDS];
+
+	if (!EccPoint_mult_add_jacobian_unsafe(result, z, u1, u2, point, curve)) {
+		return 0;
+	}
+	uECC_vli_modInv(z, z, curve->p, NUM_ECC_WORDS);
+	apply_z(result, result + NUM_ECC_WORDS, z, curve);
+	return 1;
+}
+
+#endif /* uECC_VERIFY_WNAF_WIDTH */
+
 uECC_word_t regularize_k(const uECC_word_t * const k, uECC_word_t *k0,
 			 uECC_word_t *k1, uECC_Curve curve)
 {
@@ -988,6 +1997,18 @@ uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 					uECC_Curve curve)
 {
 
+#if uECC_BASE_COMB_WIDTH
+	uECC_word_t z[NUM_ECC_WORDS];
+	const uECC_word_t *initial_Z = 0;
+
+	if (g_rng_function &&
+	    uECC_generate_random_int(z, curve->p, NUM_ECC_WORDS)) {
+		initial_Z = z;
+	}
+	if (!EccPoint_mult_base(result, private_key, initial_Z, curve)) {
+		return 0;
+	}
+#else
 	uECC_word_t tmp1[NUM_ECC_WORDS];
  	uECC_word_t tmp2[NUM_ECC_WORDS];
 	uECC_word_t *p2[2] = {tmp1, tmp2};
@@ -998,6 +2019,7 @@ uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 	carry = regularize_k(private_key, tmp1, tmp2, curve);
 
 	EccPoint_mult(result, curve->G, p2[!carry], 0, curve->num_n_bits + 1, curve);
+#endif
 
 	if (EccPoint_isZero(result, curve)) {
 		return 0;
@@ -1007,7 +2029,7 @@ uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
 
 /* Converts an integer in uECC native format to big-endian bytes. */
 void uECC_vli_nativeToBytes(uint8_t *bytes, int num_bytes,
-			    const unsigned int *native)
+			    const uECC_word_t *native)
 {
 	wordcount_t i;
 	for (i = 0; i < num_bytes; ++i) {
@@ -1017,7 +2039,7 @@ void uECC_vli_nativeToBytes(uint8_t *bytes, int num_bytes,
 }
 
 /* Converts big-endian bytes to an integer in uECC native format. */
-void uECC_vli_bytesToNative(unsigned int *native, const uint8_t *bytes,
+void uECC_vli_bytesToNative(uECC_word_t *native, const uint8_t *bytes,
 			    int num_bytes)
 {
 	wordcount_t i;
@@ -1100,12 +2122,11 @@ int uECC_valid_public_key(const uint8_t *public_key, uECC_Curve curve)
 	return uECC_valid_point(_public, curve);
 }
 
-int uECC_compute_public_key(const uint8_t *private_key, uint8_t *public_key,
-			    uECC_Curve curve)
+int uECC_compute_public_point(const uint8_t *private_key,
+			      uECC_word_t *public_point, uECC_Curve curve)
 {
 
 	uECC_word_t _private[NUM_ECC_WORDS];
-	uECC_word_t _public[NUM_ECC_WORDS * 2];
 
 	uECC_vli_bytesToNative(
 	_private,
@@ -1122,7 +2143,20 @@ int uECC_compute_public_key(const uint8_t *private_key, uint8_t *public_key,
 	}
 
 	/* Compute public key. */
-	if (!EccPoint_compute_public_key(_public, _private, curve)) {
+	if (!EccPoint_compute_public_key(public_point, _private, curve)) {
+		return 0;
+	}
+
+	return 1;
+}
+
+int uECC_compute_public_key(const uint8_t *private_key, uint8_t *public_key,
+			    uECC_Curve curve)
+{
+
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+
+	if (!uECC_compute_public_point(private_key, _public, curve)) {
 		return 0;
 	}
 
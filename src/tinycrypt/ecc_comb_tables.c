@@ -0,0 +1,1273 @@
+/* ecc_comb_tables.c - Precomputed generator tables for the TinyCrypt curves */
+
+/* Generated by tools/gen_ecc_comb_tables.py, do not edit. */
+
+#include "include/tinycrypt/ecc.h"
+
+#if uECC_BASE_COMB_WIDTH == 4
+
+const uECC_word_t ecc_base_comb_secp256r1[8 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4),
+	BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+	BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8),
+	BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+	BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB),
+	BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+	BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E),
+	BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F),
+	/* T[1] */
+	BYTES_TO_WORDS_8(AF, 92, 79, 09, E2, 1C, 39, 93),
+	BYTES_TO_WORDS_8(FA, F1, 35, 0D, FD, 98, 6C, E9),
+	BYTES_TO_WORDS_8(89, 27, E0, 95, DE, C0, 57, B2),
+	BYTES_TO_WORDS_8(6F, 72, D6, 89, BC, 4B, 0A, 30),
+	BYTES_TO_WORDS_8(A0, 27, 81, C0, 91, A2, 54, AA),
+	BYTES_TO_WORDS_8(A5, 06, D8, A9, AD, EE, B1, 5B),
+	BYTES_TO_WORDS_8(6F, 3C, 1E, FF, 25, DB, 1D, 7F),
+	BYTES_TO_WORDS_8(44, 46, 9B, D0, E0, C7, AA, 72),
+	/* T[2] */
+	BYTES_TO_WORDS_8(7F, 36, 1D, 2A, 93, 9C, 94, 13),
+	BYTES_TO_WORDS_8(B7, 11, 0A, 1A, 2B, BD, 7F, EF),
+	BYTES_TO_WORDS_8(60, FC, 1D, B9, 8B, 06, C6, DD),
+	BYTES_TO_WORDS_8(FF, 72, 9C, 8A, 32, 19, 95, EF),
+	BYTES_TO_WORDS_8(A8, D8, 76, 73, A7, 35, 60, 19),
+	BYTES_TO_WORDS_8(40, 17, CA, 95, 08, 3B, 18, 23),
+	BYTES_TO_WORDS_8(9C, 21, 2C, 02, 07, 98, EE, C1),
+	BYTES_TO_WORDS_8(9B, 2C, BB, 7D, C3, 9F, 1E, 61),
+	/* T[3] */
+	BYTES_TO_WORDS_8(01, DE, 5C, FC, FF, CA, 8E, E4),
+	BYTES_TO_WORDS_8(26, 5F, 71, 0D, E7, 84, CD, 7C),
+	BYTES_TO_WORDS_8(91, 43, 3E, F4, 83, F4, E8, A2),
+	BYTES_TO_WORDS_8(EA, 41, 11, B2, 45, 77, 5D, EB),
+	BYTES_TO_WORDS_8(79, 34, 1A, 73, E2, 17, C9, CA),
+	BYTES_TO_WORDS_8(45, B6, 44, 28, FE, 2C, F2, 85),
+	BYTES_TO_WORDS_8(EE, 6C, 00, 58, A1, E6, 90, 09),
+	BYTES_TO_WORDS_8(7B, C1, EC, DB, EB, 72, FD, EA),
+	/* T[4] */
+	BYTES_TO_WORDS_8(3E, 8A, 7C, 67, 04, 8C, F4, 2D),
+	BYTES_TO_WORDS_8(6B, A5, 03, 02, 08, 2F, E0, 74),
+	BYTES_TO_WORDS_8(DB, FE, C7, B8, 7D, 5F, 85, 31),
+	BYTES_TO_WORDS_8(AD, DD, C9, 72, 76, 9E, 76, 4E),
+	BYTES_TO_WORDS_8(B0, BB, 24, B8, 65, 61, C3, A4),
+	BYTES_TO_WORDS_8(A5, 22, 91, 3B, 6F, E1, 9A, FB),
+	BYTES_TO_WORDS_8(81, 72, 94, 06, 72, 05, C0, 1E),
+	BYTES_TO_WORDS_8(63, 06, 83, DE, 82, 90, B9, 42),
+	/* T[5] */
+	BYTES_TO_WORDS_8(73, 35, 1A, C3, D2, 1E, 99, 7F),
+	BYTES_TO_WORDS_8(96, B4, 4F, D5, 5B, DD, 82, 5B),
+	BYTES_TO_WORDS_8(AE, FC, 2F, 81, 20, 52, 5C, 59),
+	BYTES_TO_WORDS_8(87, 12, 6B, 71, 4D, BC, 88, 0C),
+	BYTES_TO_WORDS_8(A8, AC, 48, 5F, 63, BF, 57, 3A),
+	BYTES_TO_WORDS_8(F3, 64, 25, DF, F4, 81, 81, 7C),
+	BYTES_TO_WORDS_8(AA, E6, 04, 9C, B3, B5, D1, 18),
+	BYTES_TO_WORDS_8(C6, 1D, 90, F3, A3, DE, 5D, DD),
+	/* T[6] */
+	BYTES_TO_WORDS_8(7F, 2E, 58, A2, 89, 47, 6B, D3),
+	BYTES_TO_WORDS_8(28, 9C, C3, 4E, 14, 10, 1A, 0D),
+	BYTES_TO_WORDS_8(A0, D7, BA, ED, C3, 62, 3C, 66),
+	BYTES_TO_WORDS_8(B9, 1D, 46, 6F, 4B, BF, 52, 40),
+	BYTES_TO_WORDS_8(EB, 25, 8D, 18, C3, 27, 5A, 23),
+	BYTES_TO_WORDS_8(5B, CC, BF, 99, 39, F3, 24, E7),
+	BYTES_TO_WORDS_8(C8, 0C, D7, 71, BD, E6, 2B, 86),
+	BYTES_TO_WORDS_8(61, FC, B0, 90, 51, 4D, CF, FE),
+	/* T[7] */
+	BYTES_TO_WORDS_8(E5, 78, 1D, 0D, 11, B5, 15, 96),
+	BYTES_TO_WORDS_8(4B, 74, C4, 25, 32, DE, B0, 66),
+	BYTES_TO_WORDS_8(3A, 36, AF, 6A, FB, 46, 4A, 0A),
+	BYTES_TO_WORDS_8(1C, A2, F7, 84, B4, 26, 8E, B4),
+	BYTES_TO_WORDS_8(2D, 1B, A0, 21, F6, B0, EB, 06),
+	BYTES_TO_WORDS_8(98, 0F, 7B, 8B, 04, E4, 04, C0),
+	BYTES_TO_WORDS_8(68, F6, D6, FE, CD, 1B, 13, 64),
+	BYTES_TO_WORDS_8(AB, 3D, 4D, 4D, 40, 15, C0, FA)
+};
+
+const uECC_word_t ecc_base_comb_secp256k1[8 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(98, 17, F8, 16, 5B, 81, F2, 59),
+	BYTES_TO_WORDS_8(D9, 28, CE, 2D, DB, FC, 9B, 02),
+	BYTES_TO_WORDS_8(07, 0B, 87, CE, 95, 62, A0, 55),
+	BYTES_TO_WORDS_8(AC, BB, DC, F9, 7E, 66, BE, 79),
+	BYTES_TO_WORDS_8(B8, D4, 10, FB, 8F, D0, 47, 9C),
+	BYTES_TO_WORDS_8(19, 54, 85, A6, 48, B4, 17, FD),
+	BYTES_TO_WORDS_8(A8, 08, 11, 0E, FC, FB, A4, 5D),
+	BYTES_TO_WORDS_8(65, C4, A3, 26, 77, DA, 3A, 48),
+	/* T[1] */
+	BYTES_TO_WORDS_8(2A, 12, 9D, 82, 27, 11, A8, DC),
+	BYTES_TO_WORDS_8(49, 95, E9, 67, 14, F3, 17, 8F),
+	BYTES_TO_WORDS_8(73, 9E, 8A, 6A, 85, 90, 88, 9B),
+	BYTES_TO_WORDS_8(9D, D9, 6D, 84, D9, DF, 3F, 58),
+	BYTES_TO_WORDS_8(C4, EA, C4, 63, 9E, 71, C7, F3),
+	BYTES_TO_WORDS_8(7A, B3, 34, B7, A3, 85, 46, B4),
+	BYTES_TO_WORDS_8(A6, 47, 2A, 57, D6, D2, 92, 9F),
+	BYTES_TO_WORDS_8(81, 7D, F5, 2F, 2F, 23, C6, AB),
+	/* T[2] */
+	BYTES_TO_WORDS_8(09, BF, 4C, 11, 85, E8, C5, 63),
+	BYTES_TO_WORDS_8(3E, 7E, E7, 7B, 93, CE, 27, 2F),
+	BYTES_TO_WORDS_8(33, 3E, 4A, F5, 2D, D1, A6, DA),
+	BYTES_TO_WORDS_8(2C, 87, FF, 3E, 51, 0E, 30, 8B),
+	BYTES_TO_WORDS_8(39, 0A, B1, B3, 28, FF, C6, 26),
+	BYTES_TO_WORDS_8(69, 71, AF, 9A, AA, A7, F6, 08),
+	BYTES_TO_WORDS_8(EA, 38, 82, 6B, 46, 0D, 6F, 44),
+	BYTES_TO_WORDS_8(CC, C0, 43, 7F, 67, 30, EC, 1C),
+	/* T[3] */
+	BYTES_TO_WORDS_8(6C, C9, BD, 6E, 5C, A4, CF, 1B),
+	BYTES_TO_WORDS_8(BA, 84, 75, 1C, 04, BC, 00, E4),
+	BYTES_TO_WORDS_8(1F, 53, CF, 74, 0E, E2, 95, 63),
+	BYTES_TO_WORDS_8(30, 1B, 13, C5, B1, 0B, DD, 1E),
+	BYTES_TO_WORDS_8(9E, CF, 58, E3, 1B, 16, 17, A1),
+	BYTES_TO_WORDS_8(1C, D1, 24, 27, F0, D6, 90, E4),
+	BYTES_TO_WORDS_8(C9, D8, 6D, EE, F6, 62, 50, F7),
+	BYTES_TO_WORDS_8(E4, 73, A3, FB, 2B, 3B, E0, 31),
+	/* T[4] */
+	BYTES_TO_WORDS_8(71, 4D, BB, 27, 33, 1A, 29, CF),
+	BYTES_TO_WORDS_8(32, 48, 52, 33, 6B, 7D, AF, 6C),
+	BYTES_TO_WORDS_8(EE, 84, 65, 76, 31, E1, 0E, 6E),
+	BYTES_TO_WORDS_8(89, C5, 64, D0, F6, B0, 0C, 16),
+	BYTES_TO_WORDS_8(8D, 6E, 13, 17, 54, E5, 5D, 9D),
+	BYTES_TO_WORDS_8(0E, 72, AB, 1A, 68, D4, F2, E3),
+	BYTES_TO_WORDS_8(C2, 5C, F7, CC, 49, 8B, 37, D1),
+	BYTES_TO_WORDS_8(E1, 16, FF, C4, 75, C3, 20, 69),
+	/* T[5] */
+	BYTES_TO_WORDS_8(0A, 66, 88, B1, C7, 85, 0F, B4),
+	BYTES_TO_WORDS_8(36, 3C, BC, 99, 19, 3C, 87, C5),
+	BYTES_TO_WORDS_8(4C, B5, 33, 7F, 41, 45, 7B, 3C),
+	BYTES_TO_WORDS_8(F8, 9B, 8C, 1F, 3C, A9, D3, 4C),
+	BYTES_TO_WORDS_8(B0, 9C, 09, 33, 80, E3, DC, F8),
+	BYTES_TO_WORDS_8(33, 2F, DD, 2E, D6, 7D, 16, 7A),
+	BYTES_TO_WORDS_8(B7, 35, FE, 0F, 87, 89, 6D, 57),
+	BYTES_TO_WORDS_8(5C, CE, 8A, C6, 86, 03, DE, D2),
+	/* T[6] */
+	BYTES_TO_WORDS_8(67, CF, F5, 51, DA, F0, 33, 43),
+	BYTES_TO_WORDS_8(CB, D3, F0, F4, 7C, A4, 3E, 6D),
+	BYTES_TO_WORDS_8(1F, 83, 5A, A0, 14, DA, 2F, 44),
+	BYTES_TO_WORDS_8(81, 3E, 6D, 01, 13, 60, 49, 6A),
+	BYTES_TO_WORDS_8(48, 0F, 2E, E5, 8C, 31, 47, F6),
+	BYTES_TO_WORDS_8(F1, 5F, 0D, 4A, 6E, A6, F3, 5F),
+	BYTES_TO_WORDS_8(A8, 9B, 19, 61, 1A, D8, 6E, 04),
+	BYTES_TO_WORDS_8(3A, C2, 79, 3E, 08, DF, 8E, 57),
+	/* T[7] */
+	BYTES_TO_WORDS_8(E2, B1, B8, BE, 5F, CA, 08, 88),
+	BYTES_TO_WORDS_8(76, DA, 0D, EA, 04, B2, 62, 02),
+	BYTES_TO_WORDS_8(6B, 35, EB, DD, FC, FF, FF, B6),
+	BYTES_TO_WORDS_8(70, 38, B8, FB, 3A, 25, DE, 52),
+	BYTES_TO_WORDS_8(EA, 21, 8D, 8F, C0, 40, 1F, 96),
+	BYTES_TO_WORDS_8(ED, 03, 2F, 00, 78, 62, 68, 89),
+	BYTES_TO_WORDS_8(EA, 21, E4, 38, D7, 34, F8, 0F),
+	BYTES_TO_WORDS_8(DB, B8, 6F, D3, 6F, 0D, 27, 3A)
+};
+
+#elif uECC_BASE_COMB_WIDTH == 5
+
+const uECC_word_t ecc_base_comb_secp256r1[16 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4),
+	BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+	BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8),
+	BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+	BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB),
+	BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+	BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E),
+	BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F),
+	/* T[1] */
+	BYTES_TO_WORDS_8(70, C8, BA, 04, B7, 4B, D2, F7),
+	BYTES_TO_WORDS_8(AB, C6, 23, 3A, A0, 09, 3A, 59),
+	BYTES_TO_WORDS_8(1D, 9D, 4C, F9, 58, 23, CC, DF),
+	BYTES_TO_WORDS_8(02, ED, 7B, 29, 87, 0F, FA, 3C),
+	BYTES_TO_WORDS_8(40, 69, F2, 40, 0B, A3, 98, CE),
+	BYTES_TO_WORDS_8(AF, A8, 48, 02, 0D, 1C, 12, 62),
+	BYTES_TO_WORDS_8(9B, AF, 09, 83, 80, AA, 58, A7),
+	BYTES_TO_WORDS_8(C6, 12, BE, 70, 94, 76, E3, E4),
+	/* T[2] */
+	BYTES_TO_WORDS_8(7D, 7D, EF, 86, FF, E3, 37, DD),
+	BYTES_TO_WORDS_8(DB, 86, 8B, 08, 27, 7C, D7, F6),
+	BYTES_TO_WORDS_8(91, 54, 4C, 25, 4F, 9A, FE, 28),
+	BYTES_TO_WORDS_8(5E, FD, F0, 6D, 37, 03, 69, D6),
+	BYTES_TO_WORDS_8(96, D5, DA, AD, 92, 49, F0, 9F),
+	BYTES_TO_WORDS_8(F9, 73, 43, 9E, AF, A7, D1, F3),
+	BYTES_TO_WORDS_8(67, 41, 07, DF, 78, 95, 3E, A1),
+	BYTES_TO_WORDS_8(22, 3D, D1, E6, 3C, A5, E2, 20),
+	/* T[3] */
+	BYTES_TO_WORDS_8(BF, 6A, 5D, 52, 35, D7, BF, AE),
+	BYTES_TO_WORDS_8(5A, A2, BE, 96, F4, F8, 02, C3),
+	BYTES_TO_WORDS_8(A4, 20, 49, 54, EA, B3, 82, DB),
+	BYTES_TO_WORDS_8(2E, DB, EA, 02, D1, 75, 1C, 62),
+	BYTES_TO_WORDS_8(F0, 85, F4, 9E, 4C, DC, 39, 89),
+	BYTES_TO_WORDS_8(63, 6D, C4, 57, D8, 03, 5D, 22),
+	BYTES_TO_WORDS_8(70, 7F, 2D, 52, 6F, C9, DA, 4F),
+	BYTES_TO_WORDS_8(9D, 64, FA, B4, FE, A4, C4, D7),
+	/* T[4] */
+	BYTES_TO_WORDS_8(2A, 37, B9, C0, AA, 59, C6, 8B),
+	BYTES_TO_WORDS_8(3F, 58, D9, ED, 58, 99, 65, F7),
+	BYTES_TO_WORDS_8(88, 7D, 26, 8C, 4A, F9, 05, 9F),
+	BYTES_TO_WORDS_8(9D, 73, 9A, C9, E7, 46, DC, 00),
+	BYTES_TO_WORDS_8(F2, D0, 55, DF, 00, 0A, F5, 4A),
+	BYTES_TO_WORDS_8(6A, BF, 56, 81, 2D, 20, EB, B5),
+	BYTES_TO_WORDS_8(11, C1, 28, 52, AB, E3, D1, 40),
+	BYTES_TO_WORDS_8(24, 34, 79, 45, 57, A5, 12, 03),
+	/* T[5] */
+	BYTES_TO_WORDS_8(EE, CF, B8, 7E, F7, 92, 96, 8D),
+	BYTES_TO_WORDS_8(3D, 01, 8C, 0D, 23, F2, E3, 05),
+	BYTES_TO_WORDS_8(59, 2E, E3, 84, 52, 7A, 34, 76),
+	BYTES_TO_WORDS_8(E5, A1, B0, 15, 90, E2, 53, 3C),
+	BYTES_TO_WORDS_8(D4, 98, E7, FA, A5, 7D, 8B, 53),
+	BYTES_TO_WORDS_8(91, 35, D2, 00, D1, 1B, 9F, 1B),
+	BYTES_TO_WORDS_8(3F, 69, 08, 9A, 72, F0, A9, 11),
+	BYTES_TO_WORDS_8(B3, FE, 0E, 14, DA, 7C, 0E, D3),
+	/* T[6] */
+	BYTES_TO_WORDS_8(83, F6, E8, F8, 87, F7, FC, 6D),
+	BYTES_TO_WORDS_8(90, BE, 7F, 3F, 7A, 2B, D7, 13),
+	BYTES_TO_WORDS_8(CF, 32, F2, 2D, 94, 6D, 42, FD),
+	BYTES_TO_WORDS_8(AD, 9A, E3, 5F, 42, BB, 84, ED),
+	BYTES_TO_WORDS_8(FC, 95, 29, 73, A1, 67, 3E, 02),
+	BYTES_TO_WORDS_8(E3, 30, 54, 35, 8E, 0A, DD, 67),
+	BYTES_TO_WORDS_8(03, D7, A1, 97, 61, 3B, F8, 0C),
+	BYTES_TO_WORDS_8(F2, 33, 3C, 58, 55, 34, 23, A3),
+	/* T[7] */
+	BYTES_TO_WORDS_8(99, 5D, 16, 5F, 7B, BC, BB, CE),
+	BYTES_TO_WORDS_8(61, EE, 4E, 8A, C1, 51, CC, 50),
+	BYTES_TO_WORDS_8(1F, 0D, 4D, 1B, 53, 23, 1D, B3),
+	BYTES_TO_WORDS_8(DA, 2A, 38, 66, 52, 84, E1, 95),
+	BYTES_TO_WORDS_8(5B, 9B, 83, 0A, 81, 4F, AD, AC),
+	BYTES_TO_WORDS_8(0F, FF, 42, 41, 6E, A9, A2, A0),
+	BYTES_TO_WORDS_8(2F, A1, 4F, 1F, 89, 82, AA, 3E),
+	BYTES_TO_WORDS_8(F3, B8, 0F, 6B, 8F, 8C, D6, 68),
+	/* T[8] */
+	BYTES_TO_WORDS_8(F1, B3, BB, 51, 69, A2, 11, 93),
+	BYTES_TO_WORDS_8(65, 4F, 0F, 8D, BD, 26, 0F, E8),
+	BYTES_TO_WORDS_8(B9, CB, EC, 6B, 34, C3, 3D, 9D),
+	BYTES_TO_WORDS_8(E4, 5D, 1E, 10, D5, 44, E2, 54),
+	BYTES_TO_WORDS_8(28, 9E, B1, F1, 6E, 4C, AD, B3),
+	BYTES_TO_WORDS_8(B7, E3, C2, 58, C0, FB, 34, 43),
+	BYTES_TO_WORDS_8(25, 9C, DF, 35, 07, 41, BD, 19),
+	BYTES_TO_WORDS_8(B6, 6E, 10, EC, 0E, EC, BB, D6),
+	/* T[9] */
+	BYTES_TO_WORDS_8(C8, CF, EF, 3F, 83, 1A, 88, E8),
+	BYTES_TO_WORDS_8(0B, 29, B5, B9, E0, C9, A3, AE),
+	BYTES_TO_WORDS_8(88, 46, 1E, 77, CD, 7E, B3, 10),
+	BYTES_TO_WORDS_8(B6, 21, D0, D4, A3, 16, 08, EE),
+	BYTES_TO_WORDS_8(A1, CA, A8, B3, BF, 29, 99, 8E),
+	BYTES_TO_WORDS_8(D1, F2, 05, C1, CF, 5D, 91, 48),
+	BYTES_TO_WORDS_8(9F, 01, 49, DB, 82, DF, 5F, 3A),
+	BYTES_TO_WORDS_8(E1, 06, 90, AD, E3, 38, A4, C4),
+	/* T[10] */
+	BYTES_TO_WORDS_8(C9, D2, 3A, E8, 03, C5, 6D, 5D),
+	BYTES_TO_WORDS_8(BE, 35, D0, AE, 1D, 7A, 9F, CA),
+	BYTES_TO_WORDS_8(33, 1E, D2, CB, AC, 88, 27, 55),
+	BYTES_TO_WORDS_8(F0, B9, 9C, E0, 31, DD, 99, 86),
+	BYTES_TO_WORDS_8(61, F9, 9B, 32, 96, 41, 58, 38),
+	BYTES_TO_WORDS_8(F9, 5A, 2A, B8, 96, 0E, B2, 4C),
+	BYTES_TO_WORDS_8(C1, 78, 2C, C7, 08, 99, 19, 24),
+	BYTES_TO_WORDS_8(B7, 59, 28, E9, 84, 54, E6, 16),
+	/* T[11] */
+	BYTES_TO_WORDS_8(DD, 38, 30, DB, 70, 2C, 0A, A2),
+	BYTES_TO_WORDS_8(7C, 5C, 9D, E9, D5, 46, 0B, 5F),
+	BYTES_TO_WORDS_8(83, 0B, 60, 4B, 37, 7D, B9, C9),
+	BYTES_TO_WORDS_8(5E, 24, F3, 3D, 79, 7F, 6C, 18),
+	BYTES_TO_WORDS_8(7F, E5, 1C, 4F, 60, 24, F7, 2A),
+	BYTES_TO_WORDS_8(ED, D8, E2, 91, 7F, 89, 49, 92),
+	BYTES_TO_WORDS_8(97, A7, 2E, 8D, 6A, B3, 39, 81),
+	BYTES_TO_WORDS_8(13, 89, B5, 9A, B8, 8D, 42, 9C),
+	/* T[12] */
+	BYTES_TO_WORDS_8(8D, 45, E6, 4B, 3F, 4F, 1E, 1F),
+	BYTES_TO_WORDS_8(47, 65, 5E, 59, 22, CC, 72, 5F),
+	BYTES_TO_WORDS_8(F1, 93, 1A, 27, 1E, 34, C5, 5B),
+	BYTES_TO_WORDS_8(63, F2, A5, 58, 5C, 15, 2E, C6),
+	BYTES_TO_WORDS_8(F4, 7F, BA, 58, 5A, 84, 6F, 5F),
+	BYTES_TO_WORDS_8(AD, A6, 36, 7E, DC, F7, E1, 67),
+	BYTES_TO_WORDS_8(04, 4D, AA, EE, 57, 76, 3A, D3),
+	BYTES_TO_WORDS_8(4E, 7E, 26, 18, 22, 23, 9F, FF),
+	/* T[13] */
+	BYTES_TO_WORDS_8(1D, 4C, 64, C7, 55, 02, 3F, E3),
+	BYTES_TO_WORDS_8(D8, 02, 90, BB, C3, EC, 30, 40),
+	BYTES_TO_WORDS_8(9F, 6F, 64, F4, 16, 69, 48, A4),
+	BYTES_TO_WORDS_8(FA, 44, 9C, 95, 0C, 7D, 67, 5E),
+	BYTES_TO_WORDS_8(44, 91, 8B, D8, D0, D7, E7, E2),
+	BYTES_TO_WORDS_8(1F, F9, 48, 62, 6F, A8, 93, 5D),
+	BYTES_TO_WORDS_8(EA, 3A, 99, 02, D5, 0B, 3D, E3),
+	BYTES_TO_WORDS_8(1E, D3, 00, 31, E6, 0C, 9F, 44),
+	/* T[14] */
+	BYTES_TO_WORDS_8(56, B2, AA, FD, 88, 15, DF, 52),
+	BYTES_TO_WORDS_8(4C, 35, 27, 31, 44, CD, C0, 68),
+	BYTES_TO_WORDS_8(53, F8, 91, A5, 71, 94, 84, 2A),
+	BYTES_TO_WORDS_8(92, CB, D0, 93, E9, 88, DA, E4),
+	BYTES_TO_WORDS_8(24, C6, 39, 16, 5D, A3, 1E, 6D),
+	BYTES_TO_WORDS_8(BA, 07, 37, 26, 36, 2A, FE, 60),
+	BYTES_TO_WORDS_8(51, BC, F3, D0, DE, 50, FC, 97),
+	BYTES_TO_WORDS_8(80, 2E, 06, 10, 15, 4D, FA, F7),
+	/* T[15] */
+	BYTES_TO_WORDS_8(27, 65, 69, 5B, 66, A2, 75, 2E),
+	BYTES_TO_WORDS_8(9C, 16, 00, 5A, B0, 30, 25, 1A),
+	BYTES_TO_WORDS_8(42, FB, 86, 42, 80, C1, C4, 76),
+	BYTES_TO_WORDS_8(5B, 1D, 83, 8E, 94, 01, 5F, 82),
+	BYTES_TO_WORDS_8(39, 37, 70, EF, 1F, A1, F0, DB),
+	BYTES_TO_WORDS_8(6A, 10, 5B, CE, C4, 9B, 6F, 10),
+	BYTES_TO_WORDS_8(50, 11, 11, 24, 4F, 4C, 79, 61),
+	BYTES_TO_WORDS_8(17, 3A, 72, BC, FE, 72, 58, 43)
+};
+
+const uECC_word_t ecc_base_comb_secp256k1[16 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(98, 17, F8, 16, 5B, 81, F2, 59),
+	BYTES_TO_WORDS_8(D9, 28, CE, 2D, DB, FC, 9B, 02),
+	BYTES_TO_WORDS_8(07, 0B, 87, CE, 95, 62, A0, 55),
+	BYTES_TO_WORDS_8(AC, BB, DC, F9, 7E, 66, BE, 79),
+	BYTES_TO_WORDS_8(B8, D4, 10, FB, 8F, D0, 47, 9C),
+	BYTES_TO_WORDS_8(19, 54, 85, A6, 48, B4, 17, FD),
+	BYTES_TO_WORDS_8(A8, 08, 11, 0E, FC, FB, A4, 5D),
+	BYTES_TO_WORDS_8(65, C4, A3, 26, 77, DA, 3A, 48),
+	/* T[1] */
+	BYTES_TO_WORDS_8(E7, EE, D7, 1E, 67, 86, 32, 74),
+	BYTES_TO_WORDS_8(23, 73, B1, A9, D5, CC, 27, 78),
+	BYTES_TO_WORDS_8(1F, 0E, 11, 01, 71, FE, 92, 73),
+	BYTES_TO_WORDS_8(C6, 28, 63, 6D, 72, 09, A6, C0),
+	BYTES_TO_WORDS_8(CE, E1, 69, DC, 3E, 2C, 75, C3),
+	BYTES_TO_WORDS_8(E5, B7, 3F, 30, 26, 3C, DF, 8E),
+	BYTES_TO_WORDS_8(3D, BE, B9, 5D, 0E, E8, 5E, 14),
+	BYTES_TO_WORDS_8(01, C3, 05, D6, B7, D5, 24, FC),
+	/* T[2] */
+	BYTES_TO_WORDS_8(13, CF, 7B, DC, CD, C3, 39, 9D),
+	BYTES_TO_WORDS_8(42, DA, B9, E5, 64, A7, 47, 91),
+	BYTES_TO_WORDS_8(76, 46, A8, 61, F6, 23, EB, 58),
+	BYTES_TO_WORDS_8(5C, C1, FF, E4, 55, D5, C2, BF),
+	BYTES_TO_WORDS_8(C9, BE, B9, 59, 24, 13, 4A, 2A),
+	BYTES_TO_WORDS_8(64, 45, 12, DE, BA, 4F, EF, 56),
+	BYTES_TO_WORDS_8(BE, 08, BF, C1, 66, AA, 0A, BC),
+	BYTES_TO_WORDS_8(36, FE, 30, 55, 31, 86, A7, B4),
+	/* T[3] */
+	BYTES_TO_WORDS_8(1D, BF, 18, 81, 67, 27, 42, BD),
+	BYTES_TO_WORDS_8(08, 05, 83, A4, DD, 57, D3, 50),
+	BYTES_TO_WORDS_8(20, 63, AB, E4, 90, 70, D0, 7C),
+	BYTES_TO_WORDS_8(71, 5D, FD, A0, EF, CF, 1C, 54),
+	BYTES_TO_WORDS_8(13, 80, E4, F6, 09, BC, 57, 90),
+	BYTES_TO_WORDS_8(21, 9F, 6E, 88, 54, 6E, 51, F2),
+	BYTES_TO_WORDS_8(F5, 5F, 85, FB, 84, 3E, 4A, AA),
+	BYTES_TO_WORDS_8(A8, 19, F5, 55, C9, 07, D8, CE),
+	/* T[4] */
+	BYTES_TO_WORDS_8(1A, B4, C3, D9, 5C, A0, D4, 90),
+	BYTES_TO_WORDS_8(0D, 30, AF, 59, 9B, F8, 04, 85),
+	BYTES_TO_WORDS_8(4D, A6, FD, 66, 7B, C3, 39, 85),
+	BYTES_TO_WORDS_8(E0, BF, F0, C2, E9, 71, A4, 9E),
+	BYTES_TO_WORDS_8(14, 2D, B9, 88, 28, F1, BE, 78),
+	BYTES_TO_WORDS_8(14, F3, 1A, 0E, B9, 01, 66, 34),
+	BYTES_TO_WORDS_8(77, A7, A4, F4, 05, D0, AA, 53),
+	BYTES_TO_WORDS_8(00, 39, 1E, 47, E5, 68, C8, C0),
+	/* T[5] */
+	BYTES_TO_WORDS_8(DD, B9, FC, E0, 33, 8A, 7D, 96),
+	BYTES_TO_WORDS_8(4F, 93, A5, 53, 55, 16, B4, 6E),
+	BYTES_TO_WORDS_8(E9, 5F, EA, 9B, 29, 52, 71, DA),
+	BYTES_TO_WORDS_8(B2, F0, 24, B8, 7D, B7, A0, 9B),
+	BYTES_TO_WORDS_8(C2, 00, 27, B2, DF, 73, A2, E0),
+	BYTES_TO_WORDS_8(1D, 2E, 4D, 7C, DE, 7A, 23, 32),
+	BYTES_TO_WORDS_8(AC, 65, 60, C7, 97, 1E, A4, 22),
+	BYTES_TO_WORDS_8(CD, 13, 5B, 77, 59, CB, 36, E1),
+	/* T[6] */
+	BYTES_TO_WORDS_8(99, BC, 9F, 9E, 2D, 53, 2A, A8),
+	BYTES_TO_WORDS_8(87, 5F, 64, 9F, 1A, 19, E6, 77),
+	BYTES_TO_WORDS_8(9E, 7B, 39, D2, DB, 85, 84, D5),
+	BYTES_TO_WORDS_8(83, C7, 0D, 58, 6E, 3F, 52, 15),
+	BYTES_TO_WORDS_8(21, 68, 19, 0B, 68, C9, 1E, FB),
+	BYTES_TO_WORDS_8(D2, 4E, 21, 49, 3D, 55, CC, 25),
+	BYTES_TO_WORDS_8(F5, F9, 25, 45, 54, 45, B1, 0F),
+	BYTES_TO_WORDS_8(A9, B3, F7, CD, 80, A4, 04, 05),
+	/* T[7] */
+	BYTES_TO_WORDS_8(D4, 1E, 88, C4, AA, 18, 7E, 45),
+	BYTES_TO_WORDS_8(4B, AC, D9, B2, A1, C0, 71, 5D),
+	BYTES_TO_WORDS_8(A9, A2, F1, 15, A6, 5F, 6C, 86),
+	BYTES_TO_WORDS_8(4F, 5B, 05, BC, B7, C6, 4E, 72),
+	BYTES_TO_WORDS_8(1D, 80, F8, 5C, 20, 2A, E1, E2),
+	BYTES_TO_WORDS_8(7C, 48, 2E, 68, 82, 7F, EB, 5F),
+	BYTES_TO_WORDS_8(A2, 3B, 25, DB, 32, 4D, 88, 42),
+	BYTES_TO_WORDS_8(EE, 6E, A6, B6, 6D, 62, 78, 22),
+	/* T[8] */
+	BYTES_TO_WORDS_8(1F, 4D, 3E, 86, 58, C3, EB, BA),
+	BYTES_TO_WORDS_8(1A, 89, 33, 18, 21, 1D, 9B, E7),
+	BYTES_TO_WORDS_8(0B, 9D, FF, C3, 79, C1, 88, F8),
+	BYTES_TO_WORDS_8(28, D4, 48, 53, E8, AD, 21, 16),
+	BYTES_TO_WORDS_8(F5, 7B, DE, CB, D8, 39, 17, 7C),
+	BYTES_TO_WORDS_8(D3, F3, 03, F2, 5C, BC, C8, 8A),
+	BYTES_TO_WORDS_8(27, AE, 4C, B0, 16, A4, 93, 86),
+	BYTES_TO_WORDS_8(71, 8B, 6B, DC, D7, 9A, 3E, 7E),
+	/* T[9] */
+	BYTES_TO_WORDS_8(D6, 2D, 7A, D2, 59, 05, A2, 82),
+	BYTES_TO_WORDS_8(57, 56, 09, 32, F1, E8, E3, 72),
+	BYTES_TO_WORDS_8(03, CA, E5, 2E, F0, FB, 18, 19),
+	BYTES_TO_WORDS_8(BA, 85, A9, 23, 15, 31, 1F, 0E),
+	BYTES_TO_WORDS_8(76, E5, B1, 86, B9, 6E, 8D, D3),
+	BYTES_TO_WORDS_8(6C, 77, FC, C9, A3, 3F, 89, D2),
+	BYTES_TO_WORDS_8(DB, 6A, DC, 25, B0, C7, 41, 54),
+	BYTES_TO_WORDS_8(02, 11, 6B, A6, 11, 62, D4, 2D),
+	/* T[10] */
+	BYTES_TO_WORDS_8(19, 7D, 34, B3, 20, 7F, 37, AA),
+	BYTES_TO_WORDS_8(BD, D4, 45, E8, C2, E9, C5, EA),
+	BYTES_TO_WORDS_8(5A, 32, 3B, 25, 7E, 79, AF, E7),
+	BYTES_TO_WORDS_8(3F, E4, 54, 71, BE, 35, 4E, D0),
+	BYTES_TO_WORDS_8(B0, 94, DD, 8F, B5, C2, DD, 75),
+	BYTES_TO_WORDS_8(07, 49, E9, 1C, 2F, 08, 49, C6),
+	BYTES_TO_WORDS_8(77, B6, 03, 88, 6F, B8, 15, 67),
+	BYTES_TO_WORDS_8(A4, D3, 1C, F3, A5, EB, 79, 01),
+	/* T[11] */
+	BYTES_TO_WORDS_8(25, F9, 43, 88, 89, 0D, 06, EA),
+	BYTES_TO_WORDS_8(02, 2D, F5, 98, 32, F6, B1, 05),
+	BYTES_TO_WORDS_8(23, 73, 8F, 2B, 50, 27, 0A, E7),
+	BYTES_TO_WORDS_8(A7, E3, BD, 16, 05, C8, 93, 12),
+	BYTES_TO_WORDS_8(0A, 6A, F7, E3, 3D, DE, 5F, 2F),
+	BYTES_TO_WORDS_8(47, A3, 9C, 22, 3C, 33, 36, 5D),
+	BYTES_TO_WORDS_8(20, 24, 4C, 69, 45, 78, 14, AE),
+	BYTES_TO_WORDS_8(59, F8, D4, BF, B8, C0, A1, 25),
+	/* T[12] */
+	BYTES_TO_WORDS_8(7E, 88, E1, 91, 03, EB, B3, 2B),
+	BYTES_TO_WORDS_8(5C, 11, A1, EF, 14, 0D, C4, 7D),
+	BYTES_TO_WORDS_8(FE, D4, 0D, 1D, 96, 33, 5C, 19),
+	BYTES_TO_WORDS_8(70, 45, 2A, 1A, E6, 57, 04, 9B),
+	BYTES_TO_WORDS_8(70, B5, A7, 80, E9, 93, 97, 8D),
+	BYTES_TO_WORDS_8(5D, B9, 7C, A0, C9, 57, 26, 43),
+	BYTES_TO_WORDS_8(9E, EF, 56, DA, 66, F6, 1B, 9A),
+	BYTES_TO_WORDS_8(1F, 89, 6B, 91, E0, A9, 65, 2B),
+	/* T[13] */
+	BYTES_TO_WORDS_8(91, 98, 96, 9B, 06, 7D, 5E, 5A),
+	BYTES_TO_WORDS_8(0A, FA, C1, 5F, 19, 37, 94, 9D),
+	BYTES_TO_WORDS_8(CF, BE, 6B, 1A, 05, E4, BF, 9F),
+	BYTES_TO_WORDS_8(84, CD, 5D, 35, B4, 51, F7, 64),
+	BYTES_TO_WORDS_8(6C, EF, 96, DB, F2, 61, 63, 59),
+	BYTES_TO_WORDS_8(CB, 04, 88, C9, 9F, 1B, 94, B9),
+	BYTES_TO_WORDS_8(DB, 30, 79, 7E, 24, E7, 5F, B8),
+	BYTES_TO_WORDS_8(3F, B8, 90, B7, 94, 25, BB, 0F),
+	/* T[14] */
+	BYTES_TO_WORDS_8(62, 79, EA, AD, C0, 6D, 18, 57),
+	BYTES_TO_WORDS_8(E9, A4, 58, 2A, 8D, 95, B3, E6),
+	BYTES_TO_WORDS_8(C8, C4, C2, 12, 0D, 79, E2, 2B),
+	BYTES_TO_WORDS_8(02, 6F, BE, 97, 4D, A4, 20, 07),
+	BYTES_TO_WORDS_8(CA, 31, 71, C6, A6, 91, EB, 1F),
+	BYTES_TO_WORDS_8(B4, 9B, A8, 4A, E7, 77, E1, AA),
+	BYTES_TO_WORDS_8(A9, 06, D3, 3D, 94, 30, EF, 8C),
+	BYTES_TO_WORDS_8(E7, DF, CA, FA, F5, 28, F8, C9),
+	/* T[15] */
+	BYTES_TO_WORDS_8(CC, E1, 32, FD, 3E, 81, F8, 11),
+	BYTES_TO_WORDS_8(CD, F2, 4B, 1D, 19, C9, 0F, CC),
+	BYTES_TO_WORDS_8(59, B1, 8A, 22, 8B, 05, 6B, 56),
+	BYTES_TO_WORDS_8(35, 21, EF, 30, EC, 09, 2A, 89),
+	BYTES_TO_WORDS_8(15, 84, 4A, 46, 07, 6C, 3C, 4C),
+	BYTES_TO_WORDS_8(DD, 18, 3A, F4, CC, F5, B2, F2),
+	BYTES_TO_WORDS_8(4F, 8F, CD, 0A, 9C, F4, BD, 95),
+	BYTES_TO_WORDS_8(37, 89, 7F, 8A, B1, 52, 3A, AB)
+};
+
+#elif uECC_BASE_COMB_WIDTH == 6
+
+const uECC_word_t ecc_base_comb_secp256r1[32 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4),
+	BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+	BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8),
+	BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+	BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB),
+	BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+	BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E),
+	BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F),
+	/* T[1] */
+	BYTES_TO_WORDS_8(B1, 3F, 1C, 5A, 7C, 16, DB, 59),
+	BYTES_TO_WORDS_8(B2, 8E, 31, BF, 2A, CE, B3, 98),
+	BYTES_TO_WORDS_8(A6, 2F, BC, D2, 1E, C4, F1, 2D),
+	BYTES_TO_WORDS_8(AF, B2, D1, 6E, 43, 2C, CC, EF),
+	BYTES_TO_WORDS_8(13, 55, B2, 97, F1, 07, FE, 17),
+	BYTES_TO_WORDS_8(89, A5, 34, 37, 33, 45, 82, 46),
+	BYTES_TO_WORDS_8(43, F5, 34, ED, 77, 4A, 38, A5),
+	BYTES_TO_WORDS_8(63, 38, 9F, 8D, 9C, 4F, 68, F3),
+	/* T[2] */
+	BYTES_TO_WORDS_8(8E, 18, 18, 73, 64, 02, C9, AE),
+	BYTES_TO_WORDS_8(99, 70, 16, CA, 28, EC, 0B, 41),
+	BYTES_TO_WORDS_8(2B, 20, 9C, 09, 2F, 4D, 66, BF),
+	BYTES_TO_WORDS_8(5C, 62, FA, 55, 34, CA, CC, 13),
+	BYTES_TO_WORDS_8(0C, 1C, 42, 05, 31, C2, 84, AA),
+	BYTES_TO_WORDS_8(71, 0D, DB, 6C, 21, 75, 64, 6B),
+	BYTES_TO_WORDS_8(5E, 6A, 21, FB, B1, 46, 04, E9),
+	BYTES_TO_WORDS_8(3D, 89, 46, AF, A5, A5, 5B, 4B),
+	/* T[3] */
+	BYTES_TO_WORDS_8(78, 1C, DB, CB, 09, 28, B2, D3),
+	BYTES_TO_WORDS_8(A4, CD, F6, 30, EB, C8, 91, 55),
+	BYTES_TO_WORDS_8(8B, 0F, E8, BF, 40, 87, E2, B6),
+	BYTES_TO_WORDS_8(E7, E7, E7, 40, 2A, 34, 74, 0F),
+	BYTES_TO_WORDS_8(F2, 51, 1C, 35, 87, 8E, 96, D2),
+	BYTES_TO_WORDS_8(5E, 7B, E1, F5, 81, C5, C5, 65),
+	BYTES_TO_WORDS_8(2E, 4E, 99, 9D, 2A, F0, 58, 6F),
+	BYTES_TO_WORDS_8(07, EC, C1, F5, 00, 0B, 1C, 53),
+	/* T[4] */
+	BYTES_TO_WORDS_8(51, AA, 21, 8B, 7D, C4, 52, 2B),
+	BYTES_TO_WORDS_8(0D, 87, 7E, 5A, 29, 36, 50, 0F),
+	BYTES_TO_WORDS_8(27, 51, B4, 88, 14, 28, A9, BA),
+	BYTES_TO_WORDS_8(50, E0, 02, C4, 1E, 45, D6, 27),
+	BYTES_TO_WORDS_8(2D, 43, 67, 55, 14, EC, 96, 5C),
+	BYTES_TO_WORDS_8(C7, 50, 41, 0F, 29, 98, EB, CD),
+	BYTES_TO_WORDS_8(66, F5, EE, CD, 0C, 74, 91, 5D),
+	BYTES_TO_WORDS_8(83, E5, E9, 1B, 5E, FA, 58, 2A),
+	/* T[5] */
+	BYTES_TO_WORDS_8(79, A9, 95, 21, 50, C5, B7, 73),
+	BYTES_TO_WORDS_8(13, 58, DD, B8, 74, D4, 7E, 2D),
+	BYTES_TO_WORDS_8(AC, E9, 04, E1, D2, EC, B9, C0),
+	BYTES_TO_WORDS_8(D8, 0E, BD, A2, 75, D9, 90, DC),
+	BYTES_TO_WORDS_8(2E, EB, D6, 4D, 03, 52, B5, 9F),
+	BYTES_TO_WORDS_8(E8, FD, 1D, C0, BB, 54, D5, 50),
+	BYTES_TO_WORDS_8(30, 7A, 97, F0, 77, 32, FD, 4C),
+	BYTES_TO_WORDS_8(C4, 74, 53, 81, 32, E2, 7C, C8),
+	/* T[6] */
+	BYTES_TO_WORDS_8(6D, 40, 03, 17, 5B, C3, 4D, CB),
+	BYTES_TO_WORDS_8(4C, C5, DA, 75, C9, AF, D3, 4F),
+	BYTES_TO_WORDS_8(78, 28, F0, 29, EB, 21, 23, 11),
+	BYTES_TO_WORDS_8(5F, 22, 6B, AD, 2F, 8D, B1, AF),
+	BYTES_TO_WORDS_8(67, 6A, 77, F1, 73, 82, F5, DD),
+	BYTES_TO_WORDS_8(2F, 6C, B9, F6, 55, 97, 88, 96),
+	BYTES_TO_WORDS_8(FB, 8F, 20, 22, 63, D6, A8, 31),
+	BYTES_TO_WORDS_8(77, 48, CA, FC, 10, 1C, D8, 5E),
+	/* T[7] */
+	BYTES_TO_WORDS_8(40, AF, 6A, 33, 1B, 1E, C6, 2D),
+	BYTES_TO_WORDS_8(B7, F5, 51, 42, BD, 87, 7E, 89),
+	BYTES_TO_WORDS_8(70, B3, 11, 65, 23, 20, B3, 2F),
+	BYTES_TO_WORDS_8(99, F4, 41, 23, CF, A9, 0F, 46),
+	BYTES_TO_WORDS_8(A7, 01, AF, CB, 79, 3B, E6, 03),
+	BYTES_TO_WORDS_8(34, 74, 15, 44, 3F, 12, 7E, 93),
+	BYTES_TO_WORDS_8(1A, 4A, 9E, 80, 6E, 22, 59, 9D),
+	BYTES_TO_WORDS_8(62, 5E, 77, 41, 3A, F6, D6, 18),
+	/* T[8] */
+	BYTES_TO_WORDS_8(EA, 76, 64, 01, D0, B6, E4, C6),
+	BYTES_TO_WORDS_8(10, 25, EC, D4, E5, A7, B9, 71),
+	BYTES_TO_WORDS_8(D2, 90, E4, CB, 1E, B7, 75, 19),
+	BYTES_TO_WORDS_8(25, CD, 2A, B5, 2F, 47, 6B, DF),
+	BYTES_TO_WORDS_8(EB, 55, 40, 78, 16, 87, 73, F1),
+	BYTES_TO_WORDS_8(9E, 39, 7D, B8, B3, B0, C7, CC),
+	BYTES_TO_WORDS_8(19, 11, B5, 1B, 37, 13, 9A, 3C),
+	BYTES_TO_WORDS_8(93, D5, 8F, A8, E1, 39, 26, B4),
+	/* T[9] */
+	BYTES_TO_WORDS_8(97, D6, B4, 20, 06, 42, E9, 41),
+	BYTES_TO_WORDS_8(F9, 0D, FA, 29, D9, D0, 0F, A1),
+	BYTES_TO_WORDS_8(38, 2C, 02, 76, A7, B0, 1E, F1),
+	BYTES_TO_WORDS_8(63, 1C, 62, A5, DC, 7D, CB, FF),
+	BYTES_TO_WORDS_8(5A, 96, 27, 09, 1B, 7B, E3, 24),
+	BYTES_TO_WORDS_8(9E, 19, 2C, BD, 02, C1, 9F, 8D),
+	BYTES_TO_WORDS_8(85, 3F, 7F, 90, 5E, E7, 2D, 86),
+	BYTES_TO_WORDS_8(8E, 77, 9C, 5A, 29, 51, 98, D3),
+	/* T[10] */
+	BYTES_TO_WORDS_8(CC, B8, 19, F1, E7, 08, 6A, 54),
+	BYTES_TO_WORDS_8(6A, 69, FC, 8A, 23, D5, B7, 03),
+	BYTES_TO_WORDS_8(B4, 70, 9F, 45, 32, 61, 89, 0A),
+	BYTES_TO_WORDS_8(16, 91, 6A, A8, 57, 62, A4, 57),
+	BYTES_TO_WORDS_8(65, 4C, 31, BB, EF, 6F, A5, FA),
+	BYTES_TO_WORDS_8(6D, 5C, 79, 74, 40, 1F, E6, F4),
+	BYTES_TO_WORDS_8(D6, 50, 78, 43, 52, 56, 3C, 1A),
+	BYTES_TO_WORDS_8(11, EC, 21, 66, 7D, 12, 4B, 7C),
+	/* T[11] */
+	BYTES_TO_WORDS_8(5E, 81, C8, 56, 07, 03, 1E, F4),
+	BYTES_TO_WORDS_8(F1, A2, 37, 7D, E3, 47, F6, BA),
+	BYTES_TO_WORDS_8(F5, FB, FA, FE, 36, EB, 91, 77),
+	BYTES_TO_WORDS_8(06, F6, B7, 35, FB, 62, 82, 15),
+	BYTES_TO_WORDS_8(E5, E9, DC, 32, 55, 22, C3, F6),
+	BYTES_TO_WORDS_8(80, 47, 1B, 36, CE, D4, 7C, 6C),
+	BYTES_TO_WORDS_8(8F, 28, 85, 3F, 70, 5E, BE, E5),
+	BYTES_TO_WORDS_8(4A, 62, 8E, C9, A3, 1A, 28, 4C),
+	/* T[12] */
+	BYTES_TO_WORDS_8(EF, 3D, 6A, 4D, DD, 11, 29, 5B),
+	BYTES_TO_WORDS_8(F1, 08, 60, B9, 7C, D0, ED, 4B),
+	BYTES_TO_WORDS_8(64, 7D, 6E, E3, 6F, 8A, 74, EE),
+	BYTES_TO_WORDS_8(F4, 5C, BF, 4B, 34, 99, C4, BF),
+	BYTES_TO_WORDS_8(0F, 75, 74, 8E, 2D, F6, C6, 55),
+	BYTES_TO_WORDS_8(02, 99, 91, 48, 87, 9F, 63, 22),
+	BYTES_TO_WORDS_8(8F, 24, 8A, 95, 94, AA, 01, FA),
+	BYTES_TO_WORDS_8(40, AA, 51, ED, 8A, AE, 43, 27),
+	/* T[13] */
+	BYTES_TO_WORDS_8(15, 78, EB, 86, 21, A8, DD, 9C),
+	BYTES_TO_WORDS_8(65, 32, 41, CE, 12, 36, 00, 8C),
+	BYTES_TO_WORDS_8(F5, 77, B5, 91, AB, 1F, CE, 8B),
+	BYTES_TO_WORDS_8(0C, 73, 8F, 48, FF, 29, 3F, 0F),
+	BYTES_TO_WORDS_8(55, 0D, 96, E6, 63, 80, B0, EB),
+	BYTES_TO_WORDS_8(67, F4, CB, AE, E2, 99, 96, 1A),
+	BYTES_TO_WORDS_8(1B, 76, E5, 4C, A4, 64, 15, 6B),
+	BYTES_TO_WORDS_8(96, 29, 38, 81, A5, 0E, F0, 08),
+	/* T[14] */
+	BYTES_TO_WORDS_8(21, 4A, 51, 70, 39, FF, 17, 0D),
+	BYTES_TO_WORDS_8(EE, 80, DD, DA, BA, B5, A7, D2),
+	BYTES_TO_WORDS_8(C4, C8, 26, 81, C3, 33, 1E, 94),
+	BYTES_TO_WORDS_8(DE, C1, 57, 1D, D0, 56, E1, B9),
+	BYTES_TO_WORDS_8(AD, 05, 81, EA, 0D, 50, 0D, 22),
+	BYTES_TO_WORDS_8(AE, F3, 02, 02, 62, A4, 2A, 6A),
+	BYTES_TO_WORDS_8(56, 63, C9, 3D, AB, 56, 00, 45),
+	BYTES_TO_WORDS_8(C3, 42, 21, 45, AA, B6, 6A, 50),
+	/* T[15] */
+	BYTES_TO_WORDS_8(CD, 31, 51, C0, 5B, 73, 97, F1),
+	BYTES_TO_WORDS_8(67, B5, BE, 22, 68, 07, 65, 05),
+	BYTES_TO_WORDS_8(1F, 5B, F5, F7, 89, B1, F2, DB),
+	BYTES_TO_WORDS_8(14, 26, 2C, 13, 82, 4C, 14, AA),
+	BYTES_TO_WORDS_8(51, 22, 82, B3, 14, BE, 1C, F4),
+	BYTES_TO_WORDS_8(BE, AF, D0, FF, B2, 72, CE, B1),
+	BYTES_TO_WORDS_8(FA, 43, 47, 84, 18, 4D, A1, 01),
+	BYTES_TO_WORDS_8(B8, 39, 37, 92, E3, 9F, D8, C1),
+	/* T[16] */
+	BYTES_TO_WORDS_8(80, 5B, 3F, 5F, 5C, 6A, 41, 12),
+	BYTES_TO_WORDS_8(22, 24, 52, DA, DB, 03, E9, 58),
+	BYTES_TO_WORDS_8(7E, 86, 91, 42, F1, 80, CC, 18),
+	BYTES_TO_WORDS_8(2B, 2C, 15, 7A, F8, 5C, 03, B2),
+	BYTES_TO_WORDS_8(DE, 0E, C8, 95, 91, 56, 12, 71),
+	BYTES_TO_WORDS_8(B0, C5, 97, AF, 68, 25, E0, BF),
+	BYTES_TO_WORDS_8(93, E4, 14, 8A, C5, 1D, 3E, 60),
+	BYTES_TO_WORDS_8(DE, 80, 96, 74, 9C, 35, 2F, F1),
+	/* T[17] */
+	BYTES_TO_WORDS_8(0C, 7B, A7, FE, 1B, 9D, 42, 40),
+	BYTES_TO_WORDS_8(31, 9A, 5E, 59, DC, A4, 51, 46),
+	BYTES_TO_WORDS_8(3A, 69, 12, E7, B1, AA, 00, 89),
+	BYTES_TO_WORDS_8(2D, 61, BF, 84, 67, 77, EA, 90),
+	BYTES_TO_WORDS_8(B6, F2, 02, 0D, 25, 04, D1, BD),
+	BYTES_TO_WORDS_8(4F, 59, 4D, FB, CC, 3B, 58, F5),
+	BYTES_TO_WORDS_8(A1, B6, A7, 5B, 62, 44, 75, 75),
+	BYTES_TO_WORDS_8(F4, 86, 1E, 10, D3, 21, A3, D1),
+	/* T[18] */
+	BYTES_TO_WORDS_8(69, A0, 2D, E6, 6C, B2, 90, 68),
+	BYTES_TO_WORDS_8(65, 62, 58, 7C, 19, 23, 70, A5),
+	BYTES_TO_WORDS_8(AB, 72, 56, 86, BF, 19, 4E, E6),
+	BYTES_TO_WORDS_8(93, 98, 7D, A0, F5, 03, 65, A6),
+	BYTES_TO_WORDS_8(43, 47, FE, 21, C0, B7, DE, E4),
+	BYTES_TO_WORDS_8(BE, 00, 71, 7D, 7D, 84, AE, 3B),
+	BYTES_TO_WORDS_8(29, 1D, 7B, E1, A7, FC, 69, 17),
+	BYTES_TO_WORDS_8(60, FC, 0A, 32, EC, 60, BA, AD),
+	/* T[19] */
+	BYTES_TO_WORDS_8(58, 81, E4, C4, 14, D6, C9, A3),
+	BYTES_TO_WORDS_8(08, C5, 8F, AE, 98, 4A, 6B, B2),
+	BYTES_TO_WORDS_8(18, 8E, B6, 38, E0, 8B, EF, 44),
+	BYTES_TO_WORDS_8(CD, 1F, 27, DB, 96, F5, 9C, BE),
+	BYTES_TO_WORDS_8(AD, 95, 6F, 8E, 3E, 65, 7B, 73),
+	BYTES_TO_WORDS_8(0A, 4D, 9E, 9B, FF, E6, DB, 73),
+	BYTES_TO_WORDS_8(59, 9F, 13, A4, 8C, 2A, 77, 4B),
+	BYTES_TO_WORDS_8(8A, 7E, C6, 66, E5, 35, F3, A1),
+	/* T[20] */
+	BYTES_TO_WORDS_8(52, F1, 7C, F7, FB, 61, B1, C0),
+	BYTES_TO_WORDS_8(43, 00, E3, 8C, ED, 4F, 3C, 24),
+	BYTES_TO_WORDS_8(DF, 20, 0E, 05, D0, A2, B4, B1),
+	BYTES_TO_WORDS_8(AE, 99, 49, C3, 86, A2, 61, 5A),
+	BYTES_TO_WORDS_8(B7, 4E, 21, 70, 68, AF, 7B, 8C),
+	BYTES_TO_WORDS_8(FE, 61, C2, F2, 7D, CA, 5B, 97),
+	BYTES_TO_WORDS_8(E8, 1A, D9, 1E, 31, DF, C6, 03),
+	BYTES_TO_WORDS_8(38, 0D, 38, A1, AD, AA, CF, E8),
+	/* T[21] */
+	BYTES_TO_WORDS_8(DD, 28, 6D, 96, 78, 31, 9E, C7),
+	BYTES_TO_WORDS_8(C1, A2, F8, 89, 86, 86, BA, 67),
+	BYTES_TO_WORDS_8(42, 8D, CF, 4A, 6D, 9C, 1F, AF),
+	BYTES_TO_WORDS_8(7D, 7F, 84, E0, 73, 42, 2B, 2D),
+	BYTES_TO_WORDS_8(EC, 0C, 13, 69, 90, 1A, 9E, 1D),
+	BYTES_TO_WORDS_8(B5, E7, 83, 93, FD, 10, CB, 95),
+	BYTES_TO_WORDS_8(AE, 71, CC, 44, 26, 8A, 43, 73),
+	BYTES_TO_WORDS_8(49, EA, E4, 1E, 10, EB, EA, 37),
+	/* T[22] */
+	BYTES_TO_WORDS_8(DE, 37, 4A, D8, CB, B5, 12, 1C),
+	BYTES_TO_WORDS_8(1A, EA, B1, C7, B4, 6D, D6, 56),
+	BYTES_TO_WORDS_8(9A, 1E, E3, 2C, 20, E4, 2B, 85),
+	BYTES_TO_WORDS_8(48, AF, 0F, E4, 2D, 9C, BE, 17),
+	BYTES_TO_WORDS_8(97, 87, CC, 38, CB, 3C, 5B, 73),
+	BYTES_TO_WORDS_8(3E, 09, B1, 34, 80, 9D, 8D, 1F),
+	BYTES_TO_WORDS_8(C0, 81, 5B, E7, 86, 6E, CC, D8),
+	BYTES_TO_WORDS_8(97, E6, DB, 3F, 94, BF, 14, 69),
+	/* T[23] */
+	BYTES_TO_WORDS_8(35, 6F, B1, 00, 33, 4D, B4, 54),
+	BYTES_TO_WORDS_8(07, 57, 2D, 00, F3, 8E, 98, 59),
+	BYTES_TO_WORDS_8(94, 4F, 49, D0, EB, E1, 6F, 25),
+	BYTES_TO_WORDS_8(E4, 0D, 71, 7F, 69, 41, F8, AE),
+	BYTES_TO_WORDS_8(04, 96, D4, 8B, 1F, FB, 38, CA),
+	BYTES_TO_WORDS_8(5C, B1, A0, BF, AE, DA, C9, AE),
+	BYTES_TO_WORDS_8(DD, F6, 2C, 64, 5E, 36, 51, 15),
+	BYTES_TO_WORDS_8(FF, 8F, 0E, 16, FA, B0, B8, 75),
+	/* T[24] */
+	BYTES_TO_WORDS_8(B9, 9C, AB, ED, 13, D1, 33, 60),
+	BYTES_TO_WORDS_8(EE, 45, 9D, E6, A3, 7B, F8, 1D),
+	BYTES_TO_WORDS_8(03, 5A, D6, E4, 36, 62, 43, 93),
+	BYTES_TO_WORDS_8(08, A5, 98, 3F, F9, F6, 93, 58),
+	BYTES_TO_WORDS_8(AB, 4F, D5, AA, 15, 2E, 83, B3),
+	BYTES_TO_WORDS_8(5E, 36, C7, 6B, 0D, FF, 77, 32),
+	BYTES_TO_WORDS_8(B8, 4F, 0C, 20, 18, 11, 30, E8),
+	BYTES_TO_WORDS_8(4D, 38, E9, D4, BC, 71, E4, 26),
+	/* T[25] */
+	BYTES_TO_WORDS_8(D8, 27, 24, C5, A4, C5, 76, 32),
+	BYTES_TO_WORDS_8(64, 4B, A3, F5, 43, 82, 95, 66),
+	BYTES_TO_WORDS_8(92, 0D, 6E, F3, 98, 67, 16, 04),
+	BYTES_TO_WORDS_8(3F, E6, E9, C6, 27, 39, E3, 43),
+	BYTES_TO_WORDS_8(2B, 8D, CA, F0, 76, ED, 9A, 89),
+	BYTES_TO_WORDS_8(D8, 0D, F5, 0A, DE, 9C, B8, 43),
+	BYTES_TO_WORDS_8(3B, E1, 51, 59, 1E, A2, 5E, 80),
+	BYTES_TO_WORDS_8(43, 30, 41, 28, A4, DA, 10, E2),
+	/* T[26] */
+	BYTES_TO_WORDS_8(5B, 03, 58, 07, 65, A1, 46, CE),
+	BYTES_TO_WORDS_8(C9, A0, 70, E0, AD, F1, 3D, B3),
+	BYTES_TO_WORDS_8(C9, 34, 69, 68, 38, FB, 01, BF),
+	BYTES_TO_WORDS_8(D0, 6E, F1, F0, 57, 62, BA, 1C),
+	BYTES_TO_WORDS_8(9C, 40, 93, EE, B6, A9, 38, E5),
+	BYTES_TO_WORDS_8(DA, 38, 6B, 4A, A1, 29, 24, D8),
+	BYTES_TO_WORDS_8(B1, 15, C2, A5, 0D, 77, 88, 14),
+	BYTES_TO_WORDS_8(58, 76, 1D, 89, 8E, 1F, DE, 4A),
+	/* T[27] */
+	BYTES_TO_WORDS_8(3F, E6, AD, 27, 4B, 2B, 70, FE),
+	BYTES_TO_WORDS_8(3A, 67, 05, A1, 33, 1A, F1, 5D),
+	BYTES_TO_WORDS_8(CE, B9, 62, A3, 80, CB, 33, 0D),
+	BYTES_TO_WORDS_8(09, B2, 5B, 85, F5, 42, BB, A7),
+	BYTES_TO_WORDS_8(75, E5, 5F, C9, 96, 60, CC, FD),
+	BYTES_TO_WORDS_8(C6, DE, 51, 23, D7, 08, 0E, FF),
+	BYTES_TO_WORDS_8(28, 5B, 6A, BB, F5, 3F, 32, A3),
+	BYTES_TO_WORDS_8(AB, A2, F7, 89, AE, 2D, AA, 2C),
+	/* T[28] */
+	BYTES_TO_WORDS_8(49, EB, A7, 2D, 76, D6, 96, 20),
+	BYTES_TO_WORDS_8(41, 5E, 77, FB, 8E, 76, 04, 6E),
+	BYTES_TO_WORDS_8(6C, F7, 24, AF, 3D, 9C, 34, C3),
+	BYTES_TO_WORDS_8(F6, 90, 0C, DE, CA, 6C, DB, E6),
+	BYTES_TO_WORDS_8(87, FD, 16, A4, F5, 01, AA, 98),
+	BYTES_TO_WORDS_8(27, C4, 1E, 78, 0B, 27, C3, 84),
+	BYTES_TO_WORDS_8(B2, 34, 10, 02, 04, 0F, 68, 37),
+	BYTES_TO_WORDS_8(35, F7, 4B, 65, 3C, FE, 90, EB),
+	/* T[29] */
+	BYTES_TO_WORDS_8(76, 19, 57, B3, 16, BF, 35, 8E),
+	BYTES_TO_WORDS_8(E7, 64, 68, 34, 63, 0C, EB, E2),
+	BYTES_TO_WORDS_8(7F, 6C, 9B, 7E, E0, 57, 7B, 2B),
+	BYTES_TO_WORDS_8(98, 5A, B3, 70, 6F, CF, 57, 31),
+	BYTES_TO_WORDS_8(A5, 9E, C4, 5A, 14, 4C, C2, FE),
+	BYTES_TO_WORDS_8(AE, 32, 1A, 6B, 90, 56, 0C, C2),
+	BYTES_TO_WORDS_8(35, A3, 5F, 34, 4E, 7B, EF, EA),
+	BYTES_TO_WORDS_8(5F, 47, 77, 40, 5D, 65, C9, B4),
+	/* T[30] */
+	BYTES_TO_WORDS_8(B9, 66, F8, FC, FE, E3, F4, F3),
+	BYTES_TO_WORDS_8(D5, 0A, 8B, E1, 07, 08, 2A, 15),
+	BYTES_TO_WORDS_8(7B, 2E, 9B, 1B, 06, C7, C4, 2E),
+	BYTES_TO_WORDS_8(6F, 00, DD, DA, 2B, E9, D7, 41),
+	BYTES_TO_WORDS_8(F7, 6E, 4B, 1D, 79, 8A, 0A, FF),
+	BYTES_TO_WORDS_8(47, 2F, AA, B2, FF, 4D, 34, 02),
+	BYTES_TO_WORDS_8(81, 06, 7A, 35, 04, D7, 26, 17),
+	BYTES_TO_WORDS_8(F4, 85, BC, C1, 77, BB, E6, 4C),
+	/* T[31] */
+	BYTES_TO_WORDS_8(EF, 2B, CC, AF, F4, 37, E4, B9),
+	BYTES_TO_WORDS_8(53, 2B, DA, 3A, D6, B2, 1F, 4F),
+	BYTES_TO_WORDS_8(9A, 0C, 58, BB, 2D, E1, C0, E6),
+	BYTES_TO_WORDS_8(6D, 54, C7, 33, 34, 37, 18, 25),
+	BYTES_TO_WORDS_8(B9, 2F, D9, BF, 0F, D9, 12, AB),
+	BYTES_TO_WORDS_8(46, AE, 85, A1, B3, B9, B9, 2C),
+	BYTES_TO_WORDS_8(9F, F4, E6, 9C, 7E, 7A, 0C, 2A),
+	BYTES_TO_WORDS_8(F2, 21, 8F, B4, 7F, 30, 1F, 53)
+};
+
+const uECC_word_t ecc_base_comb_secp256k1[32 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(98, 17, F8, 16, 5B, 81, F2, 59),
+	BYTES_TO_WORDS_8(D9, 28, CE, 2D, DB, FC, 9B, 02),
+	BYTES_TO_WORDS_8(07, 0B, 87, CE, 95, 62, A0, 55),
+	BYTES_TO_WORDS_8(AC, BB, DC, F9, 7E, 66, BE, 79),
+	BYTES_TO_WORDS_8(B8, D4, 10, FB, 8F, D0, 47, 9C),
+	BYTES_TO_WORDS_8(19, 54, 85, A6, 48, B4, 17, FD),
+	BYTES_TO_WORDS_8(A8, 08, 11, 0E, FC, FB, A4, 5D),
+	BYTES_TO_WORDS_8(65, C4, A3, 26, 77, DA, 3A, 48),
+	/* T[1] */
+	BYTES_TO_WORDS_8(04, D3, 0F, B1, 57, D0, 27, BE),
+	BYTES_TO_WORDS_8(26, 3A, 7F, 34, 38, 06, 96, 86),
+	BYTES_TO_WORDS_8(AD, A8, E4, 18, D6, B2, D0, 8C),
+	BYTES_TO_WORDS_8(D4, 88, 4D, 8B, 54, D5, 76, 65),
+	BYTES_TO_WORDS_8(7E, 5A, B3, 74, F6, FB, 14, 32),
+	BYTES_TO_WORDS_8(3C, A5, DC, 19, FF, C8, 91, DE),
+	BYTES_TO_WORDS_8(CD, A2, 71, 74, BD, 82, A2, 4B),
+	BYTES_TO_WORDS_8(39, 8C, 1E, 3A, 3E, E6, 81, B4),
+	/* T[2] */
+	BYTES_TO_WORDS_8(96, 61, 86, F7, C8, FC, 73, 3E),
+	BYTES_TO_WORDS_8(AA, F4, B3, 81, 36, 1C, E2, 25),
+	BYTES_TO_WORDS_8(07, AE, 39, 93, 80, 5E, 56, 52),
+	BYTES_TO_WORDS_8(C0, 3C, 1E, 89, AB, 7E, C4, 29),
+	BYTES_TO_WORDS_8(CD, 3D, AC, 26, A9, 8A, 9D, 3D),
+	BYTES_TO_WORDS_8(DF, 0F, F1, 2F, 5B, 81, 49, 3E),
+	BYTES_TO_WORDS_8(F4, 3E, CA, 6A, EC, 8D, 5A, D5),
+	BYTES_TO_WORDS_8(F0, 3D, B8, 88, B7, 94, 0D, 4E),
+	/* T[3] */
+	BYTES_TO_WORDS_8(B1, E6, 7F, 2B, C4, F9, 6F, 8F),
+	BYTES_TO_WORDS_8(30, D4, DE, 65, B0, B5, 47, A6),
+	BYTES_TO_WORDS_8(4B, 5F, AA, 29, 26, C3, 53, 5D),
+	BYTES_TO_WORDS_8(C5, 26, D3, 63, 72, E1, A2, CE),
+	BYTES_TO_WORDS_8(D1, 7B, CF, B3, E5, 11, 51, 7E),
+	BYTES_TO_WORDS_8(A7, 47, C5, 99, A2, 7F, 15, 2C),
+	BYTES_TO_WORDS_8(E4, B9, 51, C2, AB, 42, 4E, 88),
+	BYTES_TO_WORDS_8(6F, D9, 97, 9B, B5, 5D, 68, 31),
+	/* T[4] */
+	BYTES_TO_WORDS_8(45, 9A, 27, CE, 89, 79, 2F, 04),
+	BYTES_TO_WORDS_8(BF, 23, 0F, 27, A8, 0F, 8B, EA),
+	BYTES_TO_WORDS_8(D6, 23, 26, BD, E5, 7C, 5C, 50),
+	BYTES_TO_WORDS_8(C6, 23, 01, CD, 87, 45, 0E, 2C),
+	BYTES_TO_WORDS_8(A8, 8D, 85, 79, ED, 91, 54, AA),
+	BYTES_TO_WORDS_8(BE, 8E, 34, C5, F3, DB, 81, C8),
+	BYTES_TO_WORDS_8(EB, 01, 68, 94, 5C, AA, 5B, F4),
+	BYTES_TO_WORDS_8(62, 27, D4, 07, 27, 61, 2F, A0),
+	/* T[5] */
+	BYTES_TO_WORDS_8(0A, 1F, F4, 16, BA, 69, 55, 35),
+	BYTES_TO_WORDS_8(70, 0C, 85, A5, 05, BB, 1E, 4D),
+	BYTES_TO_WORDS_8(8A, 5D, E5, 57, 98, 76, 95, 5A),
+	BYTES_TO_WORDS_8(33, D8, E7, 1C, F8, E5, 43, 25),
+	BYTES_TO_WORDS_8(8C, 23, 96, 05, A0, 13, E9, 50),
+	BYTES_TO_WORDS_8(DD, C3, BF, 2F, 31, 40, 0E, EF),
+	BYTES_TO_WORDS_8(AD, 34, 36, 57, 66, B5, 3E, C2),
+	BYTES_TO_WORDS_8(1F, 88, 3C, 17, 33, 05, F0, 9A),
+	/* T[6] */
+	BYTES_TO_WORDS_8(DA, E9, E4, 78, 21, 2E, AC, F4),
+	BYTES_TO_WORDS_8(67, C8, 3D, D3, 70, D8, B8, 37),
+	BYTES_TO_WORDS_8(A9, 6E, BA, 39, E4, 13, 08, B7),
+	BYTES_TO_WORDS_8(AC, 0B, 0C, 7D, 04, CE, 56, 3D),
+	BYTES_TO_WORDS_8(31, 5F, 00, 6E, C7, 05, 72, 1A),
+	BYTES_TO_WORDS_8(FA, 0E, BF, 0B, 92, 18, 5B, 0B),
+	BYTES_TO_WORDS_8(AB, 28, D9, 79, BB, D9, B4, 8A),
+	BYTES_TO_WORDS_8(D6, 16, B1, 2C, 97, 98, 50, 42),
+	/* T[7] */
+	BYTES_TO_WORDS_8(20, BA, CF, FA, 66, 61, 77, BD),
+	BYTES_TO_WORDS_8(91, F4, B1, 32, 62, 41, A9, BD),
+	BYTES_TO_WORDS_8(6D, D6, 09, 79, A1, A1, D8, 25),
+	BYTES_TO_WORDS_8(80, F3, 92, 21, D8, 5D, D8, 8F),
+	BYTES_TO_WORDS_8(8D, D6, 75, 12, 3B, 97, F5, 0B),
+	BYTES_TO_WORDS_8(B6, 9A, 5B, 7B, 19, C7, 56, CA),
+	BYTES_TO_WORDS_8(E9, B9, 3F, CB, 4F, B3, 4C, 14),
+	BYTES_TO_WORDS_8(F6, FF, B2, AF, 91, 05, E0, 90),
+	/* T[8] */
+	BYTES_TO_WORDS_8(67, 13, ED, 48, DD, 72, B0, 92),
+	BYTES_TO_WORDS_8(97, 12, 03, 3D, DD, CE, 02, 9C),
+	BYTES_TO_WORDS_8(7E, 94, 8E, B3, A0, A5, B0, FD),
+	BYTES_TO_WORDS_8(07, 66, 2F, A8, 80, 75, 20, 0D),
+	BYTES_TO_WORDS_8(8E, D2, 93, F6, 26, 73, 60, 97),
+	BYTES_TO_WORDS_8(5F, 04, D7, 73, D4, E9, F8, 4B),
+	BYTES_TO_WORDS_8(21, A8, 06, 78, 5E, 10, 9D, 24),
+	BYTES_TO_WORDS_8(E6, 5A, 2E, 9F, 8E, 57, 6F, 7F),
+	/* T[9] */
+	BYTES_TO_WORDS_8(95, 24, E8, 48, 51, 19, 0F, B3),
+	BYTES_TO_WORDS_8(7A, DE, 0A, 98, 87, 67, 7F, 0F),
+	BYTES_TO_WORDS_8(B5, 26, 72, 8F, 50, D0, 1E, ED),
+	BYTES_TO_WORDS_8(A7, 13, 8C, FA, 0E, 4E, 96, C1),
+	BYTES_TO_WORDS_8(2C, 5F, AB, DD, 7C, 05, 8B, 24),
+	BYTES_TO_WORDS_8(01, 5B, E3, 5E, 62, E3, D4, 74),
+	BYTES_TO_WORDS_8(4C, 22, 8E, 3B, BF, 9B, 01, 9B),
+	BYTES_TO_WORDS_8(FE, 1F, C2, 01, 16, 05, C3, 9B),
+	/* T[10] */
+	BYTES_TO_WORDS_8(68, EA, 2A, 1B, 26, 85, 66, F9),
+	BYTES_TO_WORDS_8(81, A3, AD, 3F, 2B, BC, AC, 6F),
+	BYTES_TO_WORDS_8(3E, 51, CD, 23, EF, 4B, 13, CE),
+	BYTES_TO_WORDS_8(7B, CA, 35, FA, 5C, FC, AB, C7),
+	BYTES_TO_WORDS_8(1C, 8C, 65, 92, D1, AB, B5, A1),
+	BYTES_TO_WORDS_8(B0, 0E, 9D, D1, 30, B7, 85, BC),
+	BYTES_TO_WORDS_8(C5, CC, A3, 29, A0, FB, C5, CF),
+	BYTES_TO_WORDS_8(D9, 55, F7, 38, F1, B7, 58, 87),
+	/* T[11] */
+	BYTES_TO_WORDS_8(0D, 0A, 7B, 95, 48, 36, 66, 30),
+	BYTES_TO_WORDS_8(45, 37, 64, F7, 55, B6, D9, F0),
+	BYTES_TO_WORDS_8(91, 48, 61, 46, 46, 0C, 0B, 2A),
+	BYTES_TO_WORDS_8(25, 3F, 4E, 2C, 24, 4E, E9, 40),
+	BYTES_TO_WORDS_8(05, 3E, 0E, A6, F5, F6, 58, 8D),
+	BYTES_TO_WORDS_8(6C, D6, A1, E5, 6F, 1D, 73, 6D),
+	BYTES_TO_WORDS_8(DF, 84, 3E, BD, 1D, 8E, E0, EC),
+	BYTES_TO_WORDS_8(23, 5C, 74, AB, 13, E3, 9E, 16),
+	/* T[12] */
+	BYTES_TO_WORDS_8(71, 36, D6, 35, C7, 81, FA, 87),
+	BYTES_TO_WORDS_8(A9, 49, EB, F2, 62, 53, 88, 64),
+	BYTES_TO_WORDS_8(C1, B3, 7E, 3D, 7F, 48, EB, F5),
+	BYTES_TO_WORDS_8(DF, 84, 7B, 45, E5, EA, A5, F1),
+	BYTES_TO_WORDS_8(A7, DC, 57, AF, 95, 4B, 66, 1F),
+	BYTES_TO_WORDS_8(C2, AF, 62, 1B, 9C, CE, 94, A3),
+	BYTES_TO_WORDS_8(91, 81, 2C, A2, FE, 40, 89, 9A),
+	BYTES_TO_WORDS_8(B4, B5, 8C, CB, 38, C9, EB, 0A),
+	/* T[13] */
+	BYTES_TO_WORDS_8(30, A2, 53, 01, 8F, 5B, 20, 76),
+	BYTES_TO_WORDS_8(21, 1A, DD, 20, 6F, F8, B7, E7),
+	BYTES_TO_WORDS_8(7E, C3, C0, 83, 6D, 5D, AE, D3),
+	BYTES_TO_WORDS_8(7D, 82, C2, 32, A5, 48, 10, 5C),
+	BYTES_TO_WORDS_8(33, A5, 73, BC, D1, D4, F3, 2C),
+	BYTES_TO_WORDS_8(AD, B3, A8, 98, 41, B6, FF, 91),
+	BYTES_TO_WORDS_8(D0, 2A, 3E, 0F, C7, 69, 24, BF),
+	BYTES_TO_WORDS_8(91, C8, 80, 26, 33, FC, 59, 68),
+	/* T[14] */
+	BYTES_TO_WORDS_8(26, 10, 0F, 71, 19, C4, C3, DD),
+	BYTES_TO_WORDS_8(4A, 7C, 26, CA, 62, 23, 6F, 94),
+	BYTES_TO_WORDS_8(90, C1, 53, A7, 08, B8, 04, 06),
+	BYTES_TO_WORDS_8(E7, E2, CE, FE, 13, BB, 34, 0A),
+	BYTES_TO_WORDS_8(96, 45, 7B, 83, 51, 05, 66, BC),
+	BYTES_TO_WORDS_8(58, 75, E1, 0E, FE, 1C, 41, D9),
+	BYTES_TO_WORDS_8(55, 0F, 5F, C1, 02, AF, 1E, 0C),
+	BYTES_TO_WORDS_8(3C, 90, 8A, E0, 2C, 73, 69, 1D),
+	/* T[15] */
+	BYTES_TO_WORDS_8(70, 6A, 50, 48, CF, 5F, 21, 4B),
+	BYTES_TO_WORDS_8(AC, 1F, 27, E7, 9A, BF, 58, 87),
+	BYTES_TO_WORDS_8(2B, BB, CA, C0, A2, FB, 70, AD),
+	BYTES_TO_WORDS_8(FE, F3, 06, 1D, 9F, C3, 7A, 0E),
+	BYTES_TO_WORDS_8(A9, E7, 0A, 10, 0E, FA, 55, 14),
+	BYTES_TO_WORDS_8(81, 7A, 3C, 76, 41, 47, 46, 93),
+	BYTES_TO_WORDS_8(92, 78, CD, ED, EA, C5, 0A, 2D),
+	BYTES_TO_WORDS_8(8D, A2, C7, 94, 99, 78, 71, 25),
+	/* T[16] */
+	BYTES_TO_WORDS_8(EF, 52, 09, 70, CC, DD, F3, AE),
+	BYTES_TO_WORDS_8(41, 91, CA, 53, BD, F9, 97, 32),
+	BYTES_TO_WORDS_8(DA, EA, 3A, 55, D1, 8F, D2, 2D),
+	BYTES_TO_WORDS_8(8E, D4, CC, B0, B6, 17, C8, 1C),
+	BYTES_TO_WORDS_8(8E, 53, 7F, 12, 83, DD, B1, 26),
+	BYTES_TO_WORDS_8(22, 6A, 3D, 78, DD, 09, E3, CB),
+	BYTES_TO_WORDS_8(5A, 3D, 03, 75, 3C, 28, 44, E4),
+	BYTES_TO_WORDS_8(9C, C2, 85, DA, C7, 58, 3E, 1E),
+	/* T[17] */
+	BYTES_TO_WORDS_8(AD, AC, 9B, 95, 00, 85, D4, 53),
+	BYTES_TO_WORDS_8(3D, 2A, 2A, 60, 7A, 12, 9B, 33),
+	BYTES_TO_WORDS_8(81, CB, 41, E6, F4, BE, 48, 14),
+	BYTES_TO_WORDS_8(3E, AE, 0D, 7E, 42, 3F, A5, EF),
+	BYTES_TO_WORDS_8(2A, FD, 6A, CA, 5E, A1, A2, CF),
+	BYTES_TO_WORDS_8(25, 9E, 1F, 89, 47, C8, D7, 25),
+	BYTES_TO_WORDS_8(F7, 9D, 94, DD, 70, 7E, A2, 07),
+	BYTES_TO_WORDS_8(C7, 65, BB, A2, E1, BA, 5B, 6F),
+	/* T[18] */
+	BYTES_TO_WORDS_8(71, 0F, 2F, 12, 99, 51, 08, 4F),
+	BYTES_TO_WORDS_8(19, 36, 4B, 56, 1D, F2, BF, 98),
+	BYTES_TO_WORDS_8(F7, 44, 13, EA, 18, 49, 55, 3C),
+	BYTES_TO_WORDS_8(53, F9, 29, C7, A6, 18, F1, 80),
+	BYTES_TO_WORDS_8(A2, 9C, 1A, 1F, 60, 7C, 20, 26),
+	BYTES_TO_WORDS_8(3D, 56, B6, 04, A1, 24, 66, 2B),
+	BYTES_TO_WORDS_8(ED, 7F, DE, 9D, 2F, 03, AF, 92),
+	BYTES_TO_WORDS_8(48, AF, 56, 77, 8C, 40, C9, 43),
+	/* T[19] */
+	BYTES_TO_WORDS_8(ED, 81, F7, 5F, 04, C2, 08, 54),
+	BYTES_TO_WORDS_8(0E, 90, 87, 76, A7, 05, 02, 67),
+	BYTES_TO_WORDS_8(B2, 53, 79, 11, 7C, 84, F2, 44),
+	BYTES_TO_WORDS_8(0C, 51, 89, 97, 7A, 89, C5, 38),
+	BYTES_TO_WORDS_8(68, 39, 6F, FD, C9, 87, E3, 9F),
+	BYTES_TO_WORDS_8(1B, FD, AE, 1C, 26, 48, EB, FF),
+	BYTES_TO_WORDS_8(11, 73, CA, 23, 64, 31, 4D, 1B),
+	BYTES_TO_WORDS_8(09, 3C, FB, 6D, D5, 58, 78, 94),
+	/* T[20] */
+	BYTES_TO_WORDS_8(91, AF, AD, FB, 43, D1, A6, E6),
+	BYTES_TO_WORDS_8(48, 71, E4, 39, 03, F2, 5A, E4),
+	BYTES_TO_WORDS_8(13, 9C, 4B, D0, 74, 1B, C6, 9B),
+	BYTES_TO_WORDS_8(F4, AE, 6E, D2, 5F, 48, 92, 2F),
+	BYTES_TO_WORDS_8(26, 89, 2D, 19, 95, 37, 6A, 0B),
+	BYTES_TO_WORDS_8(FA, 99, 76, 4A, AD, 5C, 6B, 12),
+	BYTES_TO_WORDS_8(BA, F4, C6, 7F, 33, 62, 17, 1A),
+	BYTES_TO_WORDS_8(A8, 4C, 82, F3, 88, 0B, 07, 20),
+	/* T[21] */
+	BYTES_TO_WORDS_8(BA, A0, B8, 99, 6C, 2B, 8E, 5C),
+	BYTES_TO_WORDS_8(C2, AF, 6E, 77, BB, AA, CB, D2),
+	BYTES_TO_WORDS_8(41, C5, 6B, BC, C2, 24, 20, 1D),
+	BYTES_TO_WORDS_8(18, DC, D0, 90, 5A, FD, B0, 75),
+	BYTES_TO_WORDS_8(EC, E2, 9C, 60, 8E, F1, 9E, C0),
+	BYTES_TO_WORDS_8(F6, D2, 31, 40, EB, E1, B2, FB),
+	BYTES_TO_WORDS_8(34, F4, F1, FC, 4C, 73, 9D, E5),
+	BYTES_TO_WORDS_8(58, 26, BF, 58, 4B, A4, F9, 3C),
+	/* T[22] */
+	BYTES_TO_WORDS_8(A6, 02, B0, AE, 9D, 9C, D5, 2C),
+	BYTES_TO_WORDS_8(4A, D0, 32, 8E, DB, 98, 2C, 5C),
+	BYTES_TO_WORDS_8(05, AA, F6, ED, 91, 9E, 90, A7),
+	BYTES_TO_WORDS_8(DC, 16, 77, 45, C6, DD, 2D, 80),
+	BYTES_TO_WORDS_8(02, 4D, A3, 20, EB, 3A, BB, C1),
+	BYTES_TO_WORDS_8(58, 6C, FD, C7, 8A, E0, 20, 99),
+	BYTES_TO_WORDS_8(A0, E4, 1B, D9, EA, 4F, 42, E4),
+	BYTES_TO_WORDS_8(62, 8E, 84, DB, 27, 7E, 6B, D4),
+	/* T[23] */
+	BYTES_TO_WORDS_8(95, 69, D3, C9, 14, CC, CD, 24),
+	BYTES_TO_WORDS_8(E6, B6, 97, 3B, 7A, A7, 82, C3),
+	BYTES_TO_WORDS_8(B3, EF, CD, BC, 79, D0, A6, 85),
+	BYTES_TO_WORDS_8(E2, 67, 38, 69, 48, 16, A6, 7A),
+	BYTES_TO_WORDS_8(90, 9E, 4E, AD, C1, 3D, A3, 6F),
+	BYTES_TO_WORDS_8(89, 0B, 21, 0C, 43, B2, 15, 97),
+	BYTES_TO_WORDS_8(1C, 1D, 99, 99, EE, 7A, 1D, 6B),
+	BYTES_TO_WORDS_8(D6, B7, C3, 56, 06, A7, 5E, 21),
+	/* T[24] */
+	BYTES_TO_WORDS_8(3D, 03, 76, 5D, 5D, 0D, 5B, 31),
+	BYTES_TO_WORDS_8(E7, A2, A2, 39, 2C, 52, 25, 17),
+	BYTES_TO_WORDS_8(DD, C1, 70, 12, 89, 96, 13, 8E),
+	BYTES_TO_WORDS_8(B1, 5B, E6, 77, 0E, 99, CF, 97),
+	BYTES_TO_WORDS_8(89, 40, D3, 64, 3C, 0E, 15, AB),
+	BYTES_TO_WORDS_8(92, CD, 79, 0A, 4A, E2, 27, A4),
+	BYTES_TO_WORDS_8(4E, 02, B4, 6E, 3C, 94, A8, 66),
+	BYTES_TO_WORDS_8(B1, F3, 9B, F3, 6A, 12, 6F, 0C),
+	/* T[25] */
+	BYTES_TO_WORDS_8(0D, 35, 99, 14, 7C, 6A, 75, 19),
+	BYTES_TO_WORDS_8(B0, 27, 61, 47, C1, 3A, E3, 0C),
+	BYTES_TO_WORDS_8(59, 10, EC, 2B, 23, 90, BD, DD),
+	BYTES_TO_WORDS_8(8D, E5, CC, F5, E6, 2F, CA, 6F),
+	BYTES_TO_WORDS_8(9F, F1, E0, 01, 3A, F8, F0, E0),
+	BYTES_TO_WORDS_8(B1, 24, 3B, 3A, 5A, C8, 3C, 90),
+	BYTES_TO_WORDS_8(2B, B6, 9B, F7, 64, 1B, F6, D1),
+	BYTES_TO_WORDS_8(F7, AD, 2D, 7B, 64, 22, BF, 81),
+	/* T[26] */
+	BYTES_TO_WORDS_8(A7, 5B, 7E, 60, 60, 08, B9, 40),
+	BYTES_TO_WORDS_8(9B, 54, C5, F5, BF, 84, A5, 1A),
+	BYTES_TO_WORDS_8(2C, D9, 62, E9, 5C, 6E, F7, 57),
+	BYTES_TO_WORDS_8(44, 91, 4E, 2B, FB, 5E, D4, 60),
+	BYTES_TO_WORDS_8(D3, E3, 17, 04, 0E, AF, 84, AC),
+	BYTES_TO_WORDS_8(6C, 5B, AE, 0F, AD, 3D, 8E, 24),
+	BYTES_TO_WORDS_8(6E, 34, A1, E9, 61, 09, EE, 26),
+	BYTES_TO_WORDS_8(6C, 08, A9, 8B, BE, 90, AD, CA),
+	/* T[27] */
+	BYTES_TO_WORDS_8(C1, EE, AE, 40, CE, B0, A6, A1),
+	BYTES_TO_WORDS_8(26, ED, 52, 82, 97, 55, 1B, 86),
+	BYTES_TO_WORDS_8(49, F8, EF, 78, E2, 6D, 5F, 6C),
+	BYTES_TO_WORDS_8(A0, AE, BD, 18, 6D, 44, FB, B0),
+	BYTES_TO_WORDS_8(4B, CB, 52, CC, 4E, 2E, 4C, DD),
+	BYTES_TO_WORDS_8(62, 9A, 4F, A9, 8C, 65, 4F, 61),
+	BYTES_TO_WORDS_8(C2, 23, 48, 73, 3E, 45, 02, 4A),
+	BYTES_TO_WORDS_8(54, 07, 57, CB, 4F, 3F, 57, 44),
+	/* T[28] */
+	BYTES_TO_WORDS_8(6C, 7B, 6E, 71, 2C, A9, 2E, 79),
+	BYTES_TO_WORDS_8(FF, 22, C8, B2, AA, D0, A2, 91),
+	BYTES_TO_WORDS_8(4B, A7, E2, 45, 71, 12, AF, 39),
+	BYTES_TO_WORDS_8(F6, F5, C8, 05, FF, 13, C6, AD),
+	BYTES_TO_WORDS_8(F4, CB, 00, FB, 3E, 79, D9, E9),
+	BYTES_TO_WORDS_8(A7, D7, B4, 71, CC, A7, B7, 31),
+	BYTES_TO_WORDS_8(C1, 03, 87, E3, 04, 4C, 25, B5),
+	BYTES_TO_WORDS_8(E9, 80, 22, F2, 92, 9A, 7F, C9),
+	/* T[29] */
+	BYTES_TO_WORDS_8(59, 52, 60, 93, 32, 0C, 6E, 88),
+	BYTES_TO_WORDS_8(0B, B9, 59, 8D, 8A, 12, DF, 78),
+	BYTES_TO_WORDS_8(94, 30, 22, 40, 02, A2, EB, 93),
+	BYTES_TO_WORDS_8(7F, EF, 7B, 06, 14, 7F, AC, 37),
+	BYTES_TO_WORDS_8(4A, E7, 29, DA, 5D, BB, BB, 83),
+	BYTES_TO_WORDS_8(01, 9B, 6E, A7, 8F, 5F, 45, 5F),
+	BYTES_TO_WORDS_8(C4, B4, EC, B5, 33, 35, BA, 58),
+	BYTES_TO_WORDS_8(BD, C6, C1, 57, 1F, 32, 8E, 28),
+	/* T[30] */
+	BYTES_TO_WORDS_8(E5, 59, DA, 95, 90, B7, 71, 86),
+	BYTES_TO_WORDS_8(75, 85, 74, 0A, F6, 4F, A0, 7A),
+	BYTES_TO_WORDS_8(6E, A2, D6, D5, 47, 99, B5, C9),
+	BYTES_TO_WORDS_8(3E, 5A, 89, 3B, 38, EE, 7D, 9E),
+	BYTES_TO_WORDS_8(5B, 48, EE, 53, 1A, BA, 0F, 3E),
+	BYTES_TO_WORDS_8(4F, A8, 6C, 02, 21, 19, 4A, 35),
+	BYTES_TO_WORDS_8(2F, CC, C7, 0A, C3, B3, 1A, DD),
+	BYTES_TO_WORDS_8(A4, 22, 07, 78, FA, 1B, 83, 49),
+	/* T[31] */
+	BYTES_TO_WORDS_8(EE, 0F, 53, 1F, 49, AD, CC, 93),
+	BYTES_TO_WORDS_8(98, 1B, 3B, FB, 7F, 1D, E9, 5A),
+	BYTES_TO_WORDS_8(45, BF, 91, BA, FD, 93, 28, 14),
+	BYTES_TO_WORDS_8(39, BA, 0F, 57, D2, 8A, 89, 25),
+	BYTES_TO_WORDS_8(E3, 80, 71, 1B, 82, 59, AA, 0B),
+	BYTES_TO_WORDS_8(52, 4C, C5, C7, 4C, E3, 89, 8A),
+	BYTES_TO_WORDS_8(DB, 03, 82, F2, D1, AA, D4, C9),
+	BYTES_TO_WORDS_8(81, 76, 26, B0, D4, B6, 88, 21)
+};
+
+#endif
+
+#if uECC_VERIFY_WNAF_WIDTH == 4
+
+const uECC_word_t ecc_base_wnaf_secp256r1[4 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4),
+	BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+	BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8),
+	BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+	BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB),
+	BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+	BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E),
+	BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F),
+	/* T[1] */
+	BYTES_TO_WORDS_8(6C, FD, E7, C6, 1B, 66, 41, FB),
+	BYTES_TO_WORDS_8(85, A9, AD, EF, 21, B7, C6, E6),
+	BYTES_TO_WORDS_8(65, F1, 4B, 1D, 95, EF, F7, C8),
+	BYTES_TO_WORDS_8(44, 0A, 33, A6, D1, E4, CB, 5E),
+	BYTES_TO_WORDS_8(32, 50, 7D, A2, 27, B1, 79, 9A),
+	BYTES_TO_WORDS_8(3D, B8, 4F, 38, 36, B0, 2A, D8),
+	BYTES_TO_WORDS_8(EC, A2, 64, 1A, CE, 06, 4B, 37),
+	BYTES_TO_WORDS_8(7E, FF, 98, 49, 0C, 64, 34, 87),
+	/* T[2] */
+	BYTES_TO_WORDS_8(ED, 33, D0, C3, 0D, 4A, 55, 21),
+	BYTES_TO_WORDS_8(24, E5, 5B, 1F, FD, 82, 8C, EF),
+	BYTES_TO_WORDS_8(DF, 8F, 66, 08, 56, C8, 84, D7),
+	BYTES_TO_WORDS_8(D2, 40, 51, 51, 7A, 0B, 59, 51),
+	BYTES_TO_WORDS_8(A4, 6D, A1, FD, 44, BB, D0, D1),
+	BYTES_TO_WORDS_8(88, 08, D8, D4, 00, 2F, 01, 0D),
+	BYTES_TO_WORDS_8(26, 79, 8A, BF, 36, BF, E1, 8A),
+	BYTES_TO_WORDS_8(7D, 72, 4A, 90, A8, 7D, C1, E0),
+	/* T[3] */
+	BYTES_TO_WORDS_8(A3, B2, 87, 31, 70, 28, 06, 30),
+	BYTES_TO_WORDS_8(5B, EF, 0F, A8, B8, F8, F9, 7E),
+	BYTES_TO_WORDS_8(60, FB, 01, 7C, 66, 30, BB, 25),
+	BYTES_TO_WORDS_8(46, 7B, BF, A0, 6F, 3B, 53, 8E),
+	BYTES_TO_WORDS_8(B4, 00, F4, C1, 86, 1A, 5E, C5),
+	BYTES_TO_WORDS_8(21, 1B, 04, CB, 33, 36, C7, 53),
+	BYTES_TO_WORDS_8(00, 90, F5, A6, 83, 9F, 06, 6D),
+	BYTES_TO_WORDS_8(36, 18, 33, E0, BD, 1D, EB, 73)
+};
+
+const uECC_word_t ecc_base_wnaf_secp256k1[4 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(98, 17, F8, 16, 5B, 81, F2, 59),
+	BYTES_TO_WORDS_8(D9, 28, CE, 2D, DB, FC, 9B, 02),
+	BYTES_TO_WORDS_8(07, 0B, 87, CE, 95, 62, A0, 55),
+	BYTES_TO_WORDS_8(AC, BB, DC, F9, 7E, 66, BE, 79),
+	BYTES_TO_WORDS_8(B8, D4, 10, FB, 8F, D0, 47, 9C),
+	BYTES_TO_WORDS_8(19, 54, 85, A6, 48, B4, 17, FD),
+	BYTES_TO_WORDS_8(A8, 08, 11, 0E, FC, FB, A4, 5D),
+	BYTES_TO_WORDS_8(65, C4, A3, 26, 77, DA, 3A, 48),
+	/* T[1] */
+	BYTES_TO_WORDS_8(F9, 36, E0, BC, 13, F1, 01, 86),
+	BYTES_TO_WORDS_8(B0, 99, 6F, 83, 45, C8, 31, B5),
+	BYTES_TO_WORDS_8(29, 52, 9D, F8, 85, 4F, 34, 49),
+	BYTES_TO_WORDS_8(10, C3, 58, 92, 01, 8A, 30, F9),
+	BYTES_TO_WORDS_8(72, E6, B8, 84, 75, FD, B9, 6C),
+	BYTES_TO_WORDS_8(1B, 23, C2, 34, 99, A9, 00, 65),
+	BYTES_TO_WORDS_8(56, F3, 37, 2A, E6, 37, E3, 0F),
+	BYTES_TO_WORDS_8(14, E8, 2D, 63, 0F, 7B, 8F, 38),
+	/* T[2] */
+	BYTES_TO_WORDS_8(E4, EF, 40, B2, 69, D5, A8, CB),
+	BYTES_TO_WORDS_8(B7, 9A, 61, DC, BD, 84, 8B, E8),
+	BYTES_TO_WORDS_8(28, 51, 5C, 0A, 25, A7, B4, 55),
+	BYTES_TO_WORDS_8(93, 20, 07, 1A, 4D, DE, 8B, 2F),
+	BYTES_TO_WORDS_8(D6, 62, AC, A6, 3A, 7D, A8, DC),
+	BYTES_TO_WORDS_8(40, 68, 0D, AB, 1B, 27, 88, F7),
+	BYTES_TO_WORDS_8(26, C4, C9, A6, DD, A9, DB, D4),
+	BYTES_TO_WORDS_8(D6, E3, E5, 36, 26, 22, AC, D8),
+	/* T[3] */
+	BYTES_TO_WORDS_8(BC, F9, C4, CA, ED, DD, 2B, E9),
+	BYTES_TO_WORDS_8(9C, E3, 30, 03, 7E, 9B, 41, 3D),
+	BYTES_TO_WORDS_8(0E, 7A, EA, F2, 65, F3, 98, A3),
+	BYTES_TO_WORDS_8(EA, B4, 5D, 6E, 64, F0, BD, 5C),
+	BYTES_TO_WORDS_8(DA, 64, 72, 08, 28, 26, 08, A5),
+	BYTES_TO_WORDS_8(B5, E7, FD, 13, B8, D0, 13, A8),
+	BYTES_TO_WORDS_8(DB, 54, 1A, 86, 6D, 8D, 17, A3),
+	BYTES_TO_WORDS_8(60, 59, 25, BA, 40, CA, EB, 6A)
+};
+
+#elif uECC_VERIFY_WNAF_WIDTH == 5
+
+const uECC_word_t ecc_base_wnaf_secp256r1[8 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4),
+	BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+	BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8),
+	BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+	BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB),
+	BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+	BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E),
+	BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F),
+	/* T[1] */
+	BYTES_TO_WORDS_8(6C, FD, E7, C6, 1B, 66, 41, FB),
+	BYTES_TO_WORDS_8(85, A9, AD, EF, 21, B7, C6, E6),
+	BYTES_TO_WORDS_8(65, F1, 4B, 1D, 95, EF, F7, C8),
+	BYTES_TO_WORDS_8(44, 0A, 33, A6, D1, E4, CB, 5E),
+	BYTES_TO_WORDS_8(32, 50, 7D, A2, 27, B1, 79, 9A),
+	BYTES_TO_WORDS_8(3D, B8, 4F, 38, 36, B0, 2A, D8),
+	BYTES_TO_WORDS_8(EC, A2, 64, 1A, CE, 06, 4B, 37),
+	BYTES_TO_WORDS_8(7E, FF, 98, 49, 0C, 64, 34, 87),
+	/* T[2] */
+	BYTES_TO_WORDS_8(ED, 33, D0, C3, 0D, 4A, 55, 21),
+	BYTES_TO_WORDS_8(24, E5, 5B, 1F, FD, 82, 8C, EF),
+	BYTES_TO_WORDS_8(DF, 8F, 66, 08, 56, C8, 84, D7),
+	BYTES_TO_WORDS_8(D2, 40, 51, 51, 7A, 0B, 59, 51),
+	BYTES_TO_WORDS_8(A4, 6D, A1, FD, 44, BB, D0, D1),
+	BYTES_TO_WORDS_8(88, 08, D8, D4, 00, 2F, 01, 0D),
+	BYTES_TO_WORDS_8(26, 79, 8A, BF, 36, BF, E1, 8A),
+	BYTES_TO_WORDS_8(7D, 72, 4A, 90, A8, 7D, C1, E0),
+	/* T[3] */
+	BYTES_TO_WORDS_8(A3, B2, 87, 31, 70, 28, 06, 30),
+	BYTES_TO_WORDS_8(5B, EF, 0F, A8, B8, F8, F9, 7E),
+	BYTES_TO_WORDS_8(60, FB, 01, 7C, 66, 30, BB, 25),
+	BYTES_TO_WORDS_8(46, 7B, BF, A0, 6F, 3B, 53, 8E),
+	BYTES_TO_WORDS_8(B4, 00, F4, C1, 86, 1A, 5E, C5),
+	BYTES_TO_WORDS_8(21, 1B, 04, CB, 33, 36, C7, 53),
+	BYTES_TO_WORDS_8(00, 90, F5, A6, 83, 9F, 06, 6D),
+	BYTES_TO_WORDS_8(36, 18, 33, E0, BD, 1D, EB, 73),
+	/* T[4] */
+	BYTES_TO_WORDS_8(E0, 9E, 94, 90, 4B, 8A, 9E, D7),
+	BYTES_TO_WORDS_8(B3, F8, 6D, 2C, 8C, CB, 0A, 9E),
+	BYTES_TO_WORDS_8(72, F8, 71, 1D, D5, 38, 89, 87),
+	BYTES_TO_WORDS_8(71, 0B, DF, FE, B6, D7, 68, EA),
+	BYTES_TO_WORDS_8(FA, 48, D0, 4D, 4A, 22, 5A, E8),
+	BYTES_TO_WORDS_8(3F, 82, DE, A4, EA, 4F, 71, 4D),
+	BYTES_TO_WORDS_8(C8, A0, 8E, 4A, 96, 4A, 01, 87),
+	BYTES_TO_WORDS_8(E7, FC, C9, 72, C9, 44, 27, 2A),
+	/* T[5] */
+	BYTES_TO_WORDS_8(D1, 21, BC, 74, D3, 91, 33, 43),
+	BYTES_TO_WORDS_8(BF, 48, 50, 25, D0, 2E, 74, 16),
+	BYTES_TO_WORDS_8(DA, 1C, C2, B0, 9D, 37, 38, 06),
+	BYTES_TO_WORDS_8(59, 4C, 3B, 88, B7, 13, D1, 3E),
+	BYTES_TO_WORDS_8(40, 37, 2A, E8, FC, EE, F8, E2),
+	BYTES_TO_WORDS_8(DA, 89, 98, 5E, DA, 04, 0D, 09),
+	BYTES_TO_WORDS_8(8A, C6, F4, A4, AF, 43, C8, 24),
+	BYTES_TO_WORDS_8(A2, C8, C4, CC, 9A, 20, 99, 90),
+	/* T[6] */
+	BYTES_TO_WORDS_8(01, 2C, 07, 46, 9D, 5D, E1, 98),
+	BYTES_TO_WORDS_8(8A, D5, EA, 65, 4B, 28, 2E, 79),
+	BYTES_TO_WORDS_8(FC, E2, 5E, D8, F2, 5D, 80, 61),
+	BYTES_TO_WORDS_8(5A, 49, AC, E0, 7A, 83, 7C, 17),
+	BYTES_TO_WORDS_8(D8, BF, C7, EF, E2, BB, 43, 9C),
+	BYTES_TO_WORDS_8(F3, 4D, FB, A1, C3, 14, EE, 26),
+	BYTES_TO_WORDS_8(72, 4E, 0F, B4, AD, 91, 40, A2),
+	BYTES_TO_WORDS_8(58, A5, BE, 4E, CD, 58, BB, 63),
+	/* T[7] */
+	BYTES_TO_WORDS_8(5F, 9D, 9B, E5, 63, 8C, 66, 63),
+	BYTES_TO_WORDS_8(F1, 0E, 3A, DE, 92, AF, 03, AE),
+	BYTES_TO_WORDS_8(65, 82, 88, 99, 89, 37, FB, AD),
+	BYTES_TO_WORDS_8(E7, BA, 1A, 97, C6, 4D, 45, F0),
+	BYTES_TO_WORDS_8(36, 4F, 03, 0D, DE, 9C, E5, 47),
+	BYTES_TO_WORDS_8(3F, FA, B5, 75, CE, 21, 3B, 2A),
+	BYTES_TO_WORDS_8(E6, 43, 96, 1F, E5, 94, 65, 4E),
+	BYTES_TO_WORDS_8(1F, 2D, 2E, 59, E3, 3E, B9, B5)
+};
+
+const uECC_word_t ecc_base_wnaf_secp256k1[8 * 2 * NUM_ECC_WORDS] = {
+	/* T[0] */
+	BYTES_TO_WORDS_8(98, 17, F8, 16, 5B, 81, F2, 59),
+	BYTES_TO_WORDS_8(D9, 28, CE, 2D, DB, FC, 9B, 02),
+	BYTES_TO_WORDS_8(07, 0B, 87, CE, 95, 62, A0, 55),
+	BYTES_TO_WORDS_8(AC, BB, DC, F9, 7E, 66, BE, 79),
+	BYTES_TO_WORDS_8(B8, D4, 10, FB, 8F, D0, 47, 9C),
+	BYTES_TO_WORDS_8(19, 54, 85, A6, 48, B4, 17, FD),
+	BYTES_TO_WORDS_8(A8, 08, 11, 0E, FC, FB, A4, 5D),
+	BYTES_TO_WORDS_8(65, C4, A3, 26, 77, DA, 3A, 48),
+	/* T[1] */
+	BYTES_TO_WORDS_8(F9, 36, E0, BC, 13, F1, 01, 86),
+	BYTES_TO_WORDS_8(B0, 99, 6F, 83, 45, C8, 31, B5),
+	BYTES_TO_WORDS_8(29, 52, 9D, F8, 85, 4F, 34, 49),
+	BYTES_TO_WORDS_8(10, C3, 58, 92, 01, 8A, 30, F9),
+	BYTES_TO_WORDS_8(72, E6, B8, 84, 75, FD, B9, 6C),
+	BYTES_TO_WORDS_8(1B, 23, C2, 34, 99, A9, 00, 65),
+	BYTES_TO_WORDS_8(56, F3, 37, 2A, E6, 37, E3, 0F),
+	BYTES_TO_WORDS_8(14, E8, 2D, 63, 0F, 7B, 8F, 38),
+	/* T[2] */
+	BYTES_TO_WORDS_8(E4, EF, 40, B2, 69, D5, A8, CB),
+	BYTES_TO_WORDS_8(B7, 9A, 61, DC, BD, 84, 8B, E8),
+	BYTES_TO_WORDS_8(28, 51, 5C, 0A, 25, A7, B4, 55),
+	BYTES_TO_WORDS_8(93, 20, 07, 1A, 4D, DE, 8B, 2F),
+	BYTES_TO_WORDS_8(D6, 62, AC, A6, 3A, 7D, A8, DC),
+	BYTES_TO_WORDS_8(40, 68, 0D, AB, 1B, 27, 88, F7),
+	BYTES_TO_WORDS_8(26, C4, C9, A6, DD, A9, DB, D4),
+	BYTES_TO_WORDS_8(D6, E3, E5, 36, 26, 22, AC, D8),
+	/* T[3] */
+	BYTES_TO_WORDS_8(BC, F9, C4, CA, ED, DD, 2B, E9),
+	BYTES_TO_WORDS_8(9C, E3, 30, 03, 7E, 9B, 41, 3D),
+	BYTES_TO_WORDS_8(0E, 7A, EA, F2, 65, F3, 98, A3),
+	BYTES_TO_WORDS_8(EA, B4, 5D, 6E, 64, F0, BD, 5C),
+	BYTES_TO_WORDS_8(DA, 64, 72, 08, 28, 26, 08, A5),
+	BYTES_TO_WORDS_8(B5, E7, FD, 13, B8, D0, 13, A8),
+	BYTES_TO_WORDS_8(DB, 54, 1A, 86, 6D, 8D, 17, A3),
+	BYTES_TO_WORDS_8(60, 59, 25, BA, 40, CA, EB, 6A),
+	/* T[4] */
+	BYTES_TO_WORDS_8(BE, CC, 27, FC, 0D, 11, 5F, C3),
+	BYTES_TO_WORDS_8(14, E7, 57, 4C, 97, 96, 97, E0),
+	BYTES_TO_WORDS_8(BD, 9A, 55, 9F, 8A, 17, AD, 09),
+	BYTES_TO_WORDS_8(53, F6, C7, F0, E2, 84, D4, AC),
+	BYTES_TO_WORDS_8(37, 9C, 4F, C6, 2A, 26, CC, 05),
+	BYTES_TO_WORDS_8(0F, 8E, 5F, 37, A4, 88, D8, AD),
+	BYTES_TO_WORDS_8(E9, 61, 3B, 76, 71, 09, 38, 64),
+	BYTES_TO_WORDS_8(FD, D9, A7, B0, 21, 89, 33, CC),
+	/* T[5] */
+	BYTES_TO_WORDS_8(CB, 08, A0, 5D, 89, 17, EC, BB),
+	BYTES_TO_WORDS_8(91, 78, C1, E5, 0B, 98, 49, 56),
+	BYTES_TO_WORDS_8(AC, 5A, C6, 70, 6B, 24, F4, 5E),
+	BYTES_TO_WORDS_8(1E, 41, A9, 58, F8, E7, 4A, 77),
+	BYTES_TO_WORDS_8(1B, C6, 53, C9, C9, 74, 1D, 30),
+	BYTES_TO_WORDS_8(A8, D6, F9, DF, E2, B1, 2D, 37),
+	BYTES_TO_WORDS_8(65, B3, B7, D7, 56, DD, 43, 02),
+	BYTES_TO_WORDS_8(19, 5E, 6B, EB, 32, A0, 84, D9),
+	/* T[6] */
+	BYTES_TO_WORDS_8(A8, 5A, 40, 19, 8F, DF, ED, DE),
+	BYTES_TO_WORDS_8(CD, 58, 0E, 61, C6, FB, 75, B0),
+	BYTES_TO_WORDS_8(51, 86, 74, C3, 05, D2, D1, C7),
+	BYTES_TO_WORDS_8(8B, 28, 75, D9, C2, 73, 87, F2),
+	BYTES_TO_WORDS_8(81, ED, 03, DB, 52, CB, B5, 29),
+	BYTES_TO_WORDS_8(1F, A9, 1F, 52, DA, 06, 1A, 3A),
+	BYTES_TO_WORDS_8(47, AF, CD, 65, EB, 12, 82, 75),
+	BYTES_TO_WORDS_8(89, 0A, 88, 8D, 2E, 90, B0, 0A),
+	/* T[7] */
+	BYTES_TO_WORDS_8(0E, 08, 7E, E2, F8, BC, AD, 44),
+	BYTES_TO_WORDS_8(9E, F7, 85, 3C, 6F, 94, E5, 31),
+	BYTES_TO_WORDS_8(11, F4, 5F, 09, E3, 5A, 46, 5A),
+	BYTES_TO_WORDS_8(96, EA, 43, 7D, 4F, 4D, 92, D7),
+	BYTES_TO_WORDS_8(58, 6B, A2, F6, 9F, DC, 04, C5),
+	BYTES_TO_WORDS_8(A5, D3, 96, D8, 2B, AF, 40, EA),
+	BYTES_TO_WORDS_8(EF, 6D, CC, 28, C2, 2E, 84, 83),
+	BYTES_TO_WORDS_8(A6, 72, 6C, A8, 72, 28, 1E, 58)
+};
+
+#endif
@@ -162,6 +162,23 @@ int uECC_shared_secret(const uint8_t *public_key, const uint8_t *private_key,
 			       public_key + num_bytes,
 			       num_bytes);
 
+#if uECC_VERIFY_WNAF_WIDTH && uECC_SECP256K1_GLV
+	/* The GLV multiplication takes the same steps for every scalar, so it
+	 * does not need the regularized one. */
+	if (curve == uECC_secp256k1()) {
+		if (uECC_get_rng()) {
+			if (!uECC_generate_random_int(tmp, curve->p, num_words)) {
+				r = 0;
+				goto clear_and_out;
+			}
+			initial_Z = tmp;
+		}
+		r = EccPoint_mult_glv(_public, _public, _private, initial_Z, curve);
+		uECC_vli_nativeToBytes(secret, num_bytes, _public);
+		goto clear_and_out;
+	}
+#endif
+
 	/* Regularize the bitcount for the private key so that attackers cannot use a
 	 * side channel attack to learn the number of leading zeros. */
 	carry = regularize_k(_private, _private, tmp, curve);
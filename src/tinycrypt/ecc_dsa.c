@@ -56,6 +56,8 @@
 #include "include/tinycrypt/constants.h"
 #include "include/tinycrypt/ecc.h"
 #include "include/tinycrypt/ecc_dsa.h"
+#include "include/tinycrypt/hmac_prng.h"
+#include "include/tinycrypt/utils.h"
 
 
 static void bits2int(uECC_word_t *native, const uint8_t *bits,
@@ -91,19 +93,28 @@ static void bits2int(uECC_word_t *native, const uint8_t *bits,
 	}
 }
 
-int uECC_sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
-		     unsigned hash_size, uECC_word_t *k, uint8_t *signature,
-		     uECC_Curve curve)
+/* Signs with the nonce k. initial_Z (mod p, or 0) randomizes the projective
+ * coordinates of k*G and blind (mod n, nonzero) masks k while it is inverted;
+ * neither changes the signature. If recovery_id is not 0 it receives the
+ * parity of the y coordinate of k*G in bit 0 and whether its x coordinate
+ * was reduced mod n in bit 1. */
+static int sign_with_k_blinded(const uint8_t *private_key,
+			       const uint8_t *message_hash, unsigned hash_size,
+			       uECC_word_t *k, const uECC_word_t *initial_Z,
+			       const uECC_word_t *blind, uint8_t *signature,
+			       uint8_t *recovery_id, uECC_Curve curve)
 {
 
 	uECC_word_t tmp[NUM_ECC_WORDS];
 	uECC_word_t s[NUM_ECC_WORDS];
-	uECC_word_t *k2[2] = {tmp, s};
 	uECC_word_t p[NUM_ECC_WORDS * 2];
-	uECC_word_t carry;
 	wordcount_t num_words = curve->num_words;
 	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+#if !uECC_BASE_COMB_WIDTH
+	uECC_word_t *k2[2] = {tmp, s};
+	uECC_word_t carry;
 	bitcount_t num_n_bits = curve->num_n_bits;
+#endif
 
 	/* Make sure 0 < k < curve_n */
   	if (uECC_vli_isZero(k, num_words) ||
@@ -111,27 +122,35 @@ int uECC_sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
 		return 0;
 	}
 
+#if uECC_BASE_COMB_WIDTH
+	EccPoint_mult_base(p, k, initial_Z, curve);
+#else
 	carry = regularize_k(k, tmp, s, curve);
-	EccPoint_mult(p, curve->G, k2[!carry], 0, num_n_bits + 1, curve);
+	EccPoint_mult(p, curve->G, k2[!carry], initial_Z, num_n_bits + 1, curve);
+#endif
 	if (uECC_vli_isZero(p, num_words)) {
 		return 0;
 	}
+	if (recovery_id) {
+		*recovery_id = (uint8_t)(p[num_words] & 1);
+	}
 
-	/* If an RNG function was specified, get a random number
-	to prevent side channel analysis of k. */
-	if (!uECC_get_rng()) {
-		uECC_vli_clear(tmp, num_n_words);
-		tmp[0] = 1;
+	/* r = x mod n. p < 2n on both curves, so one subtraction will do. */
+	if (uECC_vli_cmp_unsafe(curve->n, p, num_n_words) != 1) {
+		uECC_vli_sub(p, p, curve->n, num_n_words);
+		if (recovery_id) {
+			*recovery_id |= 2;
+		}
 	}
-	else if (!uECC_generate_random_int(tmp, curve->n, num_n_words)) {
+	if (uECC_vli_isZero(p, num_n_words)) {
 		return 0;
 	}
 
 	/* Prevent side channel analysis of uECC_vli_modInv() to determine
 	bits of k / the private key by premultiplying by a random number */
-	uECC_vli_modMult(k, k, tmp, curve->n, num_n_words); /* k' = rand * k */
+	uECC_vli_modMult(k, k, blind, curve->n, num_n_words); /* k' = rand * k */
 	uECC_vli_modInv(k, k, curve->n, num_n_words);       /* k = 1 / k' */
-	uECC_vli_modMult(k, k, tmp, curve->n, num_n_words); /* k = 1 / k */
+	uECC_vli_modMult(k, k, blind, curve->n, num_n_words); /* k = 1 / k */
 
 	uECC_vli_nativeToBytes(signature, curve->num_bytes, p); /* store r */
 
@@ -153,8 +172,44 @@ int uECC_sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
 	return 1;
 }
 
-int uECC_sign(const uint8_t *private_key, const uint8_t *message_hash,
-	      unsigned hash_size, uint8_t *signature, uECC_Curve curve)
+static int sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
+		       unsigned hash_size, uECC_word_t *k, uint8_t *signature,
+		       uint8_t *recovery_id, uECC_Curve curve)
+{
+
+	uECC_word_t blind[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	const uECC_word_t *initial_Z = 0;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	/* If an RNG function was specified, get random numbers
+	to prevent side channel analysis of k. */
+	if (!uECC_get_rng()) {
+		uECC_vli_clear(blind, num_n_words);
+		blind[0] = 1;
+	}
+	else if (!uECC_generate_random_int(blind, curve->n, num_n_words)) {
+		return 0;
+	}
+	else if (uECC_generate_random_int(z, curve->p, curve->num_words)) {
+		initial_Z = z;
+	}
+
+	return sign_with_k_blinded(private_key, message_hash, hash_size, k,
+				   initial_Z, blind, signature, recovery_id, curve);
+}
+
+int uECC_sign_with_k(const uint8_t *private_key, const uint8_t *message_hash,
+		     unsigned hash_size, uECC_word_t *k, uint8_t *signature,
+		     uECC_Curve curve)
+{
+	return sign_with_k(private_key, message_hash, hash_size, k, signature,
+			   0, curve);
+}
+
+static int sign_random(const uint8_t *private_key, const uint8_t *message_hash,
+		       unsigned hash_size, uint8_t *signature,
+		       uint8_t *recovery_id, uECC_Curve curve)
 {
 	      uECC_word_t _random[2*NUM_ECC_WORDS];
 	      uECC_word_t k[NUM_ECC_WORDS];
@@ -171,29 +226,156 @@ int uECC_sign(const uint8_t *private_key, const uint8_t *message_hash,
 		// computing k as modular reduction of _random (see FIPS 186.4 B.5.1):
 		uECC_vli_mmod(k, _random, curve->n, BITS_TO_WORDS(curve->num_n_bits));
 
-		if (uECC_sign_with_k(private_key, message_hash, hash_size, k, signature, 
-		    curve)) {
+		if (sign_with_k(private_key, message_hash, hash_size, k,
+				signature, recovery_id, curve)) {
 			return 1;
 		}
 	}
 	return 0;
 }
 
-static bitcount_t smax(bitcount_t a, bitcount_t b)
+int uECC_sign(const uint8_t *private_key, const uint8_t *message_hash,
+	      unsigned hash_size, uint8_t *signature, uECC_Curve curve)
 {
-	return (a > b ? a : b);
+	return sign_random(private_key, message_hash, hash_size, signature, 0,
+			   curve);
 }
 
-int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
-		unsigned hash_size, const uint8_t *signature,
-	        uECC_Curve curve)
+int uECC_sign_recoverable(const uint8_t *private_key,
+			  const uint8_t *message_hash, unsigned hash_size,
+			  uint8_t *signature, uint8_t *recovery_id,
+			  uECC_Curve curve)
 {
+	return sign_random(private_key, message_hash, hash_size, signature,
+			   recovery_id, curve);
+}
 
-	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+/* Draws an integer in [1, top) from an HMAC-DRBG by rejection sampling. For
+ * a 256-bit top this is the candidate loop of RFC 6979 3.2 h: every output
+ * block is followed by the K = HMAC_K(V || 0x00), V = HMAC_K(V) update that
+ * tc_hmac_prng_generate() performs anyway. */
+static int hmac_prng_random_int(uECC_word_t *random, const uECC_word_t *top,
+				wordcount_t num_words, TCHmacPrng_t prng)
+{
+	uint8_t bytes[NUM_ECC_BYTES];
+	uECC_word_t tries;
+	int ret = 0;
+
+	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
+		if (tc_hmac_prng_generate(bytes, num_words * uECC_WORD_SIZE,
+					  prng) != TC_CRYPTO_SUCCESS) {
+			break;
+		}
+		uECC_vli_bytesToNative(random, bytes, num_words * uECC_WORD_SIZE);
+		if (!uECC_vli_isZero(random, num_words) &&
+		    uECC_vli_cmp(top, random, num_words) == 1) {
+			ret = 1;
+			break;
+		}
+	}
+	_set(bytes, 0, sizeof(bytes));
+	return ret;
+}
+
+/* RFC 6979 3.2 b-g (K = 0, V = 1, then the two seeded updates) is HMAC_DRBG
+ * instantiation with the seed as personalization. The seed is all the
+ * entropy the construction takes, so the generator is never reseeded. */
+static void hmac_prng_seed(TCHmacPrng_t prng, const uint8_t *seed,
+			   unsigned int seed_size)
+{
+	(void)tc_hmac_prng_init(prng, seed, seed_size);
+	prng->countdown = (unsigned int)-1;
+}
+
+static int sign_deterministic(const uint8_t *private_key,
+			      const uint8_t *message_hash, unsigned hash_size,
+			      uint8_t *signature, uint8_t *recovery_id,
+			      uECC_Curve curve)
+{
+	static const uint8_t blinding_context[] = "uECC blinding";
+	struct tc_hmac_prng_struct prng;
+	uint8_t seed[2 * NUM_ECC_BYTES + sizeof(blinding_context)];
+	uECC_word_t k[NUM_ECC_WORDS];
 	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t blind[NUM_ECC_WORDS];
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	unsigned num_n_bytes = BITS_TO_BYTES(curve->num_n_bits);
+	uECC_word_t tries;
+	int ret = 0;
+
+	/* seed = int2octets(x) || bits2octets(h1) */
+	_copy(seed, num_n_bytes, private_key, num_n_bytes);
+	bits2int(k, message_hash, hash_size, curve);
+	if (uECC_vli_cmp_unsafe(curve->n, k, num_n_words) != 1) {
+		uECC_vli_sub(k, k, curve->n, num_n_words);
+	}
+	uECC_vli_nativeToBytes(seed + num_n_bytes, num_n_bytes, k);
+
+	/* The blinding values come from a second generator, seeded the same way
+	 * plus a label, so that drawing them does not move the nonce sequence
+	 * away from the one RFC 6979 specifies. */
+	_copy(seed + 2 * num_n_bytes, sizeof(blinding_context),
+	      blinding_context, sizeof(blinding_context));
+	hmac_prng_seed(&prng, seed, 2 * num_n_bytes + sizeof(blinding_context));
+	if (!hmac_prng_random_int(blind, curve->n, num_n_words, &prng) ||
+	    !hmac_prng_random_int(z, curve->p, curve->num_words, &prng)) {
+		goto exit;
+	}
+
+	hmac_prng_seed(&prng, seed, 2 * num_n_bytes);
+	for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
+		if (!hmac_prng_random_int(k, curve->n, num_n_words, &prng)) {
+			break;
+		}
+		if (sign_with_k_blinded(private_key, message_hash, hash_size, k,
+					z, blind, signature, recovery_id,
+					curve)) {
+			ret = 1;
+			break;
+		}
+	}
+
+exit:
+	_set(seed, 0, sizeof(seed));
+	_set(&prng, 0, sizeof(prng));
+	_set(k, 0, sizeof(k));
+	_set(blind, 0, sizeof(blind));
+	_set(z, 0, sizeof(z));
+	return ret;
+}
+
+int uECC_sign_deterministic(const uint8_t *private_key,
+			    const uint8_t *message_hash, unsigned hash_size,
+			    uint8_t *signature, uECC_Curve curve)
+{
+	return sign_deterministic(private_key, message_hash, hash_size,
+				  signature, 0, curve);
+}
+
+int uECC_sign_deterministic_recoverable(const uint8_t *private_key,
+					const uint8_t *message_hash,
+					unsigned hash_size, uint8_t *signature,
+					uint8_t *recovery_id, uECC_Curve curve)
+{
+	return sign_deterministic(private_key, message_hash, hash_size,
+				  signature, recovery_id, curve);
+}
+
+#if !uECC_VERIFY_WNAF_WIDTH
+static bitcount_t smax(bitcount_t a, bitcount_t b)
+{
+	return (a > b ? a : b);
+}
+
+/* Calculates u1*G + u2*Q with Shamir's trick; the result is affine. */
+static void mult_add_shamir(uECC_word_t *result, const uECC_word_t *u1,
+			    const uECC_word_t *u2, const uECC_word_t *point_q,
+			    uECC_Curve curve)
+{
+	uECC_word_t *rx = result;
+	uECC_word_t *ry = result + curve->num_words;
 	uECC_word_t sum[NUM_ECC_WORDS * 2];
-	uECC_word_t rx[NUM_ECC_WORDS];
-	uECC_word_t ry[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
 	uECC_word_t tx[NUM_ECC_WORDS];
 	uECC_word_t ty[NUM_ECC_WORDS];
 	uECC_word_t tz[NUM_ECC_WORDS];
@@ -201,43 +383,12 @@ int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
 	const uECC_word_t *point;
 	bitcount_t num_bits;
 	bitcount_t i;
-
-	uECC_word_t _public[NUM_ECC_WORDS * 2];
-	uECC_word_t r[NUM_ECC_WORDS], s[NUM_ECC_WORDS];
 	wordcount_t num_words = curve->num_words;
 	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
 
-	rx[num_n_words - 1] = 0;
-	r[num_n_words - 1] = 0;
-	s[num_n_words - 1] = 0;
-
-	uECC_vli_bytesToNative(_public, public_key, curve->num_bytes);
-	uECC_vli_bytesToNative(_public + num_words, public_key + curve->num_bytes,
-			       curve->num_bytes);
-	uECC_vli_bytesToNative(r, signature, curve->num_bytes);
-	uECC_vli_bytesToNative(s, signature + curve->num_bytes, curve->num_bytes);
-
-	/* r, s must not be 0. */
-	if (uECC_vli_isZero(r, num_words) || uECC_vli_isZero(s, num_words)) {
-		return 0;
-	}
-
-	/* r, s must be < n. */
-	if (uECC_vli_cmp_unsafe(curve->n, r, num_n_words) != 1 ||
-	    uECC_vli_cmp_unsafe(curve->n, s, num_n_words) != 1) {
-		return 0;
-	}
-
-	/* Calculate u1 and u2. */
-	uECC_vli_modInv(z, s, curve->n, num_n_words); /* z = 1/s */
-	u1[num_n_words - 1] = 0;
-	bits2int(u1, message_hash, hash_size, curve);
-	uECC_vli_modMult(u1, u1, z, curve->n, num_n_words); /* u1 = e/s */
-	uECC_vli_modMult(u2, r, z, curve->n, num_n_words); /* u2 = r/s */
-
 	/* Calculate sum = G + Q. */
-	uECC_vli_set(sum, _public, num_words);
-	uECC_vli_set(sum + num_words, _public + num_words, num_words);
+	uECC_vli_set(sum, point_q, num_words);
+	uECC_vli_set(sum + num_words, point_q + num_words, num_words);
 	uECC_vli_set(tx, curve->G, num_words);
 	uECC_vli_set(ty, curve->G + num_words, num_words);
 	uECC_vli_modSub(z, sum, tx, curve->p, num_words); /* z = x2 - x1 */
@@ -248,7 +399,7 @@ int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
 	/* Use Shamir's trick to calculate u1*G + u2*Q */
 	points[0] = 0;
 	points[1] = curve->G;
-	points[2] = _public;
+	points[2] = point_q;
 	points[3] = sum;
 	num_bits = smax(uECC_vli_numBits(u1, num_n_words),
 	uECC_vli_numBits(u2, num_n_words));
@@ -278,6 +429,86 @@ int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
 
 	uECC_vli_modInv(z, z, curve->p, num_words); /* Z = 1/Z */
 	apply_z(rx, ry, z, curve);
+}
+#endif
+
+/* Reads r and s of a signature, returns 0 unless 0 < r, s < n. */
+static int signature_to_native(uECC_word_t *r, uECC_word_t *s,
+			       const uint8_t *signature, uECC_Curve curve)
+{
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	r[num_n_words - 1] = 0;
+	s[num_n_words - 1] = 0;
+
+	uECC_vli_bytesToNative(r, signature, curve->num_bytes);
+	uECC_vli_bytesToNative(s, signature + curve->num_bytes, curve->num_bytes);
+
+	/* r, s must not be 0. */
+	if (uECC_vli_isZero(r, num_words) || uECC_vli_isZero(s, num_words)) {
+		return 0;
+	}
+
+	/* r, s must be < n. */
+	if (uECC_vli_cmp_unsafe(curve->n, r, num_n_words) != 1 ||
+	    uECC_vli_cmp_unsafe(curve->n, s, num_n_words) != 1) {
+		return 0;
+	}
+	return 1;
+}
+
+int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
+		unsigned hash_size, const uint8_t *signature,
+	        uECC_Curve curve)
+{
+
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+
+	uECC_vli_bytesToNative(_public, public_key, curve->num_bytes);
+	uECC_vli_bytesToNative(_public + curve->num_words,
+			       public_key + curve->num_bytes, curve->num_bytes);
+
+	return uECC_verify_native(_public, message_hash, hash_size, signature,
+				  curve);
+}
+
+int uECC_verify_native(const uECC_word_t *_public, const uint8_t *message_hash,
+		       unsigned hash_size, const uint8_t *signature,
+		       uECC_Curve curve)
+{
+
+	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t sum[NUM_ECC_WORDS * 2];
+	uECC_word_t rx[NUM_ECC_WORDS];
+
+	uECC_word_t r[NUM_ECC_WORDS], s[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	rx[num_n_words - 1] = 0;
+
+	if (!signature_to_native(r, s, signature, curve)) {
+		return 0;
+	}
+
+	/* Calculate u1 and u2. */
+	uECC_vli_modInv(z, s, curve->n, num_n_words); /* z = 1/s */
+	u1[num_n_words - 1] = 0;
+	bits2int(u1, message_hash, hash_size, curve);
+	uECC_vli_modMult_n(u1, u1, z, curve); /* u1 = e/s */
+	uECC_vli_modMult_n(u2, r, z, curve); /* u2 = r/s */
+
+#if uECC_VERIFY_WNAF_WIDTH
+	/* Calculate u1*G + u2*Q with interleaved wNAF, all inputs are public. */
+	if (!EccPoint_mult_add_unsafe(sum, u1, u2, _public, curve)) {
+		return 0;
+	}
+#else
+	mult_add_shamir(sum, u1, u2, _public, curve);
+#endif
+	uECC_vli_set(rx, sum, num_words);
 
 	/* v = x1 (mod n) */
 	if (uECC_vli_cmp_unsafe(curve->n, rx, num_n_words) != 1) {
@@ -288,3 +519,153 @@ int uECC_verify(const uint8_t *public_key, const uint8_t *message_hash,
 	return (int)(uECC_vli_equal(rx, r, num_words) == 0);
 }
 
+#if uECC_VERIFY_WNAF_WIDTH
+void uECC_verify_batch_native(const uECC_VerifyItem *items, unsigned count,
+			      int *results, uECC_Curve curve)
+{
+	uECC_word_t r[uECC_VERIFY_BATCH_CHUNK][NUM_ECC_WORDS];
+	/* 1/s, then Z of u1*G + u2*Q, then 1/Z */
+	uECC_word_t w[uECC_VERIFY_BATCH_CHUNK][NUM_ECC_WORDS];
+	uECC_word_t sum[uECC_VERIFY_BATCH_CHUNK][NUM_ECC_WORDS * 2];
+	uECC_word_t scratch[uECC_VERIFY_BATCH_CHUNK][NUM_ECC_WORDS];
+	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t rx[NUM_ECC_WORDS];
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+	unsigned done, n, i;
+
+	for (done = 0; done < count; done += n, items += n, results += n) {
+		n = count - done;
+		if (n > uECC_VERIFY_BATCH_CHUNK) {
+			n = uECC_VERIFY_BATCH_CHUNK;
+		}
+
+		/* Invalid items keep w = 0, which the batch inversions skip. */
+		for (i = 0; i < n; ++i) {
+			results[i] = signature_to_native(r[i], w[i],
+							 items[i].signature,
+							 curve);
+			if (!results[i]) {
+				uECC_vli_clear(w[i], num_words);
+			}
+		}
+		uECC_vli_modInv_batch(w[0], scratch[0], n, curve->n, curve);
+
+		for (i = 0; i < n; ++i) {
+			if (!results[i]) {
+				continue;
+			}
+			u1[num_n_words - 1] = 0;
+			bits2int(u1, items[i].message_hash, items[i].hash_size,
+				 curve);
+			uECC_vli_modMult_n(u1, u1, w[i], curve); /* u1 = e/s */
+			uECC_vli_modMult_n(u2, r[i], w[i], curve); /* u2 = r/s */
+			if (!EccPoint_mult_add_jacobian_unsafe(sum[i], w[i], u1, u2,
+							       items[i].public_point,
+							       curve)) {
+				results[i] = 0;
+				uECC_vli_clear(w[i], num_words);
+			}
+		}
+		uECC_vli_modInv_batch(w[0], scratch[0], n, curve->p, curve);
+
+		for (i = 0; i < n; ++i) {
+			if (!results[i]) {
+				continue;
+			}
+			/* x1 = X/Z^2 (mod n) */
+			uECC_vli_modMult_fast(u1, w[i], w[i], curve);
+			uECC_vli_modMult_fast(rx, sum[i], u1, curve);
+			if (uECC_vli_cmp_unsafe(curve->n, rx, num_n_words) != 1) {
+				uECC_vli_sub(rx, rx, curve->n, num_n_words);
+			}
+			results[i] = (int)(uECC_vli_equal(rx, r[i], num_words) == 0);
+		}
+	}
+}
+#else
+void uECC_verify_batch_native(const uECC_VerifyItem *items, unsigned count,
+			      int *results, uECC_Curve curve)
+{
+	unsigned i;
+
+	for (i = 0; i < count; ++i) {
+		results[i] = uECC_verify_native(items[i].public_point,
+						items[i].message_hash,
+						items[i].hash_size,
+						items[i].signature, curve);
+	}
+}
+#endif
+
+int uECC_recover_public_key(const uint8_t *message_hash, unsigned hash_size,
+			    const uint8_t *signature, uint8_t recovery_id,
+			    uint8_t *public_key, uECC_Curve curve)
+{
+	uECC_word_t r[NUM_ECC_WORDS], s[NUM_ECC_WORDS];
+	uECC_word_t u1[NUM_ECC_WORDS], u2[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t point[NUM_ECC_WORDS * 2];
+	uECC_word_t _public[NUM_ECC_WORDS * 2];
+	uECC_word_t *y = point + curve->num_words;
+	wordcount_t num_words = curve->num_words;
+	wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+	if (recovery_id > 3 ||
+	    !signature_to_native(r, s, signature, curve)) {
+		return 0;
+	}
+
+	/* R.x = r, or r + n if it was reduced when signing. */
+	uECC_vli_set(point, r, num_words);
+	if (recovery_id & 2) {
+		uECC_vli_sub(z, curve->p, curve->n, num_words);
+		if (uECC_vli_cmp_unsafe(z, r, num_words) != 1) {
+			return 0;
+		}
+		uECC_vli_modAdd(point, r, curve->n, curve->p, num_words);
+	}
+
+	/* R.y = sqrt(x^3 + ax + b), the root with the parity of bit 0. */
+	curve->x_side(z, point, curve);
+	if (uECC_vli_cmp_unsafe(curve->p, z, num_words) != 1) {
+		uECC_vli_sub(z, z, curve->p, num_words);
+	}
+	uECC_vli_set(y, z, num_words);
+	uECC_vli_mod_sqrt(y, curve);
+	uECC_vli_modMult_fast(u1, y, y, curve);
+	if (uECC_vli_cmp_unsafe(curve->p, u1, num_words) != 1) {
+		uECC_vli_sub(u1, u1, curve->p, num_words);
+	}
+	if (uECC_vli_equal(u1, z, num_words) != 0) {
+		return 0;
+	}
+	if ((y[0] & 1) != (recovery_id & 1)) {
+		uECC_vli_sub(y, curve->p, y, num_words);
+	}
+
+	/* Q = r^-1 (s*R - e*G) = (-e/r)*G + (s/r)*R */
+	uECC_vli_modInv(z, r, curve->n, num_n_words); /* z = 1/r */
+	u1[num_n_words - 1] = 0;
+	bits2int(u1, message_hash, hash_size, curve);
+	uECC_vli_modMult_n(u1, u1, z, curve); /* u1 = e/r */
+	uECC_vli_clear(u2, num_n_words);
+	uECC_vli_modSub(u1, u2, u1, curve->n, num_n_words); /* u1 = -e/r */
+	uECC_vli_modMult_n(u2, s, z, curve); /* u2 = s/r */
+
+#if uECC_VERIFY_WNAF_WIDTH
+	if (!EccPoint_mult_add_unsafe(_public, u1, u2, point, curve)) {
+		return 0;
+	}
+#else
+	mult_add_shamir(_public, u1, u2, point, curve);
+	if (EccPoint_isZero(_public, curve)) {
+		return 0;
+	}
+#endif
+
+	uECC_vli_nativeToBytes(public_key, curve->num_bytes, _public);
+	uECC_vli_nativeToBytes(public_key + curve->num_bytes, curve->num_bytes,
+			       _public + num_words);
+	return 1;
+}
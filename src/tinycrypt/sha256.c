@@ -34,7 +34,13 @@
 #include "include/tinycrypt/constants.h"
 #include "include/tinycrypt/utils.h"
 
-static void compress(unsigned int *iv, const uint8_t *data);
+static void compress_blocks(unsigned int *iv, const uint8_t *data,
+			    size_t nblocks);
+
+static inline void compress(unsigned int *iv, const uint8_t *data)
+{
+	compress_blocks(iv, data, 1);
+}
 
 int tc_sha256_init(TCSha256State_t s)
 {
@@ -72,13 +78,40 @@ int tc_sha256_update(TCSha256State_t s, const uint8_t *data, size_t datalen)
 		return TC_CRYPTO_SUCCESS;
 	}
 
-	while (datalen-- > 0) {
-		s->leftover[s->leftover_offset++] = *(data++);
-		if (s->leftover_offset >= TC_SHA256_BLOCK_SIZE) {
-			compress(s->iv, s->leftover);
-			s->leftover_offset = 0;
-			s->bits_hashed += (TC_SHA256_BLOCK_SIZE << 3);
+	/* top up a partially filled block first */
+	if (s->leftover_offset > 0) {
+		size_t fill = TC_SHA256_BLOCK_SIZE - s->leftover_offset;
+
+		if (fill > datalen) {
+			fill = datalen;
+		}
+		(void)_copy(s->leftover + s->leftover_offset, fill, data, fill);
+		s->leftover_offset += fill;
+		data += fill;
+		datalen -= fill;
+
+		if (s->leftover_offset < TC_SHA256_BLOCK_SIZE) {
+			return TC_CRYPTO_SUCCESS;
 		}
+		compress(s->iv, s->leftover);
+		s->leftover_offset = 0;
+		s->bits_hashed += (TC_SHA256_BLOCK_SIZE << 3);
+	}
+
+	/* hash whole blocks straight from the caller's buffer */
+	if (datalen >= TC_SHA256_BLOCK_SIZE) {
+		size_t nblocks = datalen / TC_SHA256_BLOCK_SIZE;
+
+		compress_blocks(s->iv, data, nblocks);
+		data += nblocks * TC_SHA256_BLOCK_SIZE;
+		datalen -= nblocks * TC_SHA256_BLOCK_SIZE;
+		s->bits_hashed += ((uint64_t)nblocks * TC_SHA256_BLOCK_SIZE) << 3;
+	}
+
+	/* keep the tail for the next call */
+	if (datalen > 0) {
+		(void)_copy(s->leftover, sizeof(s->leftover), data, datalen);
+		s->leftover_offset = datalen;
 	}
 
 	return TC_CRYPTO_SUCCESS;
@@ -178,40 +211,54 @@ static inline unsigned int BigEndian(const uint8_t **c)
 	return n;
 }
 
-static void compress(unsigned int *iv, const uint8_t *data)
+/*
+ * Runs the compression function over nblocks consecutive 64-byte blocks. The
+ * chaining value stays in registers between blocks and is written back once.
+ */
+static void compress_blocks(unsigned int *iv, const uint8_t *data,
+			    size_t nblocks)
 {
 	unsigned int a, b, c, d, e, f, g, h;
+	unsigned int h0, h1, h2, h3, h4, h5, h6, h7;
 	unsigned int s0, s1;
 	unsigned int t1, t2;
 	unsigned int work_space[16];
 	unsigned int n;
 	unsigned int i;
 
-	a = iv[0]; b = iv[1]; c = iv[2]; d = iv[3];
-	e = iv[4]; f = iv[5]; g = iv[6]; h = iv[7];
+	h0 = iv[0]; h1 = iv[1]; h2 = iv[2]; h3 = iv[3];
+	h4 = iv[4]; h5 = iv[5]; h6 = iv[6]; h7 = iv[7];
 
-	for (i = 0; i < 16; ++i) {
-		n = BigEndian(&data);
-		t1 = work_space[i] = n;
-		t1 += h + Sigma1(e) + Ch(e, f, g) + k256[i];
-		t2 = Sigma0(a) + Maj(a, b, c);
-		h = g; g = f; f = e; e = d + t1;
-		d = c; c = b; b = a; a = t1 + t2;
-	}
+	while (nblocks-- > 0) {
+		a = h0; b = h1; c = h2; d = h3;
+		e = h4; f = h5; g = h6; h = h7;
+
+		for (i = 0; i < 16; ++i) {
+			n = BigEndian(&data);
+			t1 = work_space[i] = n;
+			t1 += h + Sigma1(e) + Ch(e, f, g) + k256[i];
+			t2 = Sigma0(a) + Maj(a, b, c);
+			h = g; g = f; f = e; e = d + t1;
+			d = c; c = b; b = a; a = t1 + t2;
+		}
+
+		for ( ; i < 64; ++i) {
+			s0 = work_space[(i+1)&0x0f];
+			s0 = sigma0(s0);
+			s1 = work_space[(i+14)&0x0f];
+			s1 = sigma1(s1);
+
+			t1 = work_space[i&0xf] += s0 + s1 + work_space[(i+9)&0xf];
+			t1 += h + Sigma1(e) + Ch(e, f, g) + k256[i];
+			t2 = Sigma0(a) + Maj(a, b, c);
+			h = g; g = f; f = e; e = d + t1;
+			d = c; c = b; b = a; a = t1 + t2;
+		}
 
-	for ( ; i < 64; ++i) {
-		s0 = work_space[(i+1)&0x0f];
-		s0 = sigma0(s0);
-		s1 = work_space[(i+14)&0x0f];
-		s1 = sigma1(s1);
-
-		t1 = work_space[i&0xf] += s0 + s1 + work_space[(i+9)&0xf];
-		t1 += h + Sigma1(e) + Ch(e, f, g) + k256[i];
-		t2 = Sigma0(a) + Maj(a, b, c);
-		h = g; g = f; f = e; e = d + t1;
-		d = c; c = b; b = a; a = t1 + t2;
+		h0 += a; h1 += b; h2 += c; h3 += d;
+		h4 += e; h5 += f; h6 += g; h7 += h;
 	}
 
-	iv[0] += a; iv[1] += b; iv[2] += c; iv[3] += d;
-	iv[4] += e; iv[5] += f; iv[6] += g; iv[7] += h;
+	iv[0] = h0; iv[1] = h1; iv[2] = h2; iv[3] = h3;
+	iv[4] = h4; iv[5] = h5; iv[6] = h6; iv[7] = h7;
 }
@@ -0,0 +1,254 @@
+/* worker_pool.c - TinyCrypt thread pool for batch workloads */
+
+#include "include/tinycrypt/worker_pool.h"
+
+#if TC_WORKER_POOL
+
+#include "include/tinycrypt/constants.h"
+#include "include/tinycrypt/ecc_dsa.h"
+#include "include/tinycrypt/sha256.h"
+
+/*
+ * Number of pieces a SHA-256 batch is cut into per thread. A thread takes
+ * one piece of its own shard at a time, so this bounds both the lock traffic
+ * and how much work is left that nobody can steal.
+ */
+#define SHA256_PIECES_PER_THREAD 16
+
+/* Take up to grain jobs from the front of our own shard. */
+static int shard_take(struct tc_worker_shard *shard, size_t grain,
+		      size_t *begin, size_t *end)
+{
+	int found = 0;
+
+	pthread_mutex_lock(&shard->lock);
+	if (shard->begin < shard->end) {
+		*begin = shard->begin;
+		*end = (shard->end - shard->begin > grain) ?
+			shard->begin + grain : shard->end;
+		shard->begin = *end;
+		found = 1;
+	}
+	pthread_mutex_unlock(&shard->lock);
+	return found;
+}
+
+/* Take the back half (rounded up) of another thread's shard. */
+static int shard_steal(struct tc_worker_shard *shard, size_t *begin,
+		       size_t *end)
+{
+	int found = 0;
+
+	pthread_mutex_lock(&shard->lock);
+	if (shard->begin < shard->end) {
+		*end = shard->end;
+		shard->end -= (shard->end - shard->begin + 1) / 2;
+		*begin = shard->end;
+		found = 1;
+	}
+	pthread_mutex_unlock(&shard->lock);
+	return found;
+}
+
+static void drain(TCWorkerPool_t pool, unsigned int self)
+{
+	struct tc_worker_shard *own = &pool->shards[self];
+	size_t begin = 0, end = 0, i;
+	unsigned int k;
+
+	for (;;) {
+		if (!shard_take(own, pool->grain, &begin, &end)) {
+			for (k = 1; k < pool->thread_count; ++k) {
+				if (shard_steal(&pool->shards[(self + k) % pool->thread_count],
+						&begin, &end)) {
+					break;
+				}
+			}
+			if (k == pool->thread_count) {
+				return;
+			}
+			/* Park the loot in our shard so others can steal from it. */
+			pthread_mutex_lock(&own->lock);
+			own->begin = begin;
+			own->end = end;
+			pthread_mutex_unlock(&own->lock);
+			continue;
+		}
+		for (i = begin; i < end; ++i) {
+			pool->run(pool->jobs, i, pool->results);
+		}
+	}
+}
+
+static void *worker_main(void *arg)
+{
+	struct tc_worker_thread *thread = (struct tc_worker_thread *)arg;
+	TCWorkerPool_t pool = thread->pool;
+	unsigned int seen = 0;
+
+	pthread_mutex_lock(&pool->lock);
+	for (;;) {
+		while (!pool->shutdown && pool->generation == seen) {
+			pthread_cond_wait(&pool->work_ready, &pool->lock);
+		}
+		if (pool->shutdown) {
+			break;
+		}
+		seen = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+
+		drain(pool, thread->index);
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->busy == 0) {
+			pthread_cond_signal(&pool->work_done);
+		}
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return NULL;
+}
+
+static void stop_threads(TCWorkerPool_t pool, unsigned int started)
+{
+	unsigned int i;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->shutdown = 1;
+	pthread_cond_broadcast(&pool->work_ready);
+	pthread_mutex_unlock(&pool->lock);
+
+	for (i = 0; i < started; ++i) {
+		pthread_join(pool->threads[i].thread, NULL);
+	}
+	for (i = 0; i < pool->thread_count; ++i) {
+		pthread_mutex_destroy(&pool->shards[i].lock);
+	}
+	pthread_cond_destroy(&pool->work_done);
+	pthread_cond_destroy(&pool->work_ready);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_mutex_destroy(&pool->submit);
+}
+
+int tc_worker_pool_init(TCWorkerPool_t pool, unsigned int threads)
+{
+	unsigned int i;
+
+	if (pool == (TCWorkerPool_t) 0 || threads == 0 ||
+	    threads > TC_WORKER_POOL_MAX_THREADS) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	pthread_mutex_init(&pool->submit, NULL);
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->work_ready, NULL);
+	pthread_cond_init(&pool->work_done, NULL);
+	pool->thread_count = threads;
+	pool->generation = 0;
+	pool->busy = 0;
+	pool->shutdown = 0;
+	for (i = 0; i < threads; ++i) {
+		pthread_mutex_init(&pool->shards[i].lock, NULL);
+		pool->shards[i].begin = 0;
+		pool->shards[i].end = 0;
+	}
+
+	for (i = 0; i < threads; ++i) {
+		pool->threads[i].pool = pool;
+		pool->threads[i].index = i;
+		if (pthread_create(&pool->threads[i].thread, NULL, worker_main,
+				   &pool->threads[i]) != 0) {
+			stop_threads(pool, i);
+			return TC_CRYPTO_FAIL;
+		}
+	}
+	return TC_CRYPTO_SUCCESS;
+}
+
+void tc_worker_pool_free(TCWorkerPool_t pool)
+{
+	if (pool != (TCWorkerPool_t) 0) {
+		stop_threads(pool, pool->thread_count);
+	}
+}
+
+/* Hand a batch to the threads and wait until all of them are done. */
+static void run_batch(TCWorkerPool_t pool,
+		      void (*run)(const void *, size_t, void *),
+		      const void *jobs, size_t count, void *results, size_t grain)
+{
+	unsigned int i, n;
+
+	if (count == 0) {
+		return;
+	}
+
+	pthread_mutex_lock(&pool->submit);
+	pthread_mutex_lock(&pool->lock);
+	n = pool->thread_count;
+	pool->run = run;
+	pool->jobs = jobs;
+	pool->results = results;
+	pool->grain = grain;
+	for (i = 0; i < n; ++i) {
+		pool->shards[i].begin = count * i / n;
+		pool->shards[i].end = count * (i + 1) / n;
+	}
+	pool->busy = n;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->work_ready);
+	while (pool->busy != 0) {
+		pthread_cond_wait(&pool->work_done, &pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	pthread_mutex_unlock(&pool->submit);
+}
+
+static void run_verify(const void *jobs, size_t index, void *results)
+{
+	const tc_verify_job *job = (const tc_verify_job *)jobs + index;
+
+	((int *)results)[index] = uECC_verify(job->public_key,
+					      job->message_hash,
+					      job->hash_size, job->signature,
+					      job->curve);
+}
+
+int tc_worker_pool_verify(TCWorkerPool_t pool, const tc_verify_job *jobs,
+			  size_t count, int *results)
+{
+	if (pool == (TCWorkerPool_t) 0 ||
+	    (count > 0 && (jobs == NULL || results == NULL))) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	/* A verification is long enough to take them one at a time. */
+	run_batch(pool, run_verify, jobs, count, results, 1);
+	return TC_CRYPTO_SUCCESS;
+}
+
+static void run_sha256(const void *jobs, size_t index, void *results)
+{
+	const tc_sha256_job *job = (const tc_sha256_job *)jobs + index;
+	struct tc_sha256_state_struct s;
+
+	(void)results;
+	(void)tc_sha256_init(&s);
+	(void)tc_sha256_update(&s, job->data, job->data_length);
+	(void)tc_sha256_final(job->digest, &s);
+}
+
+int tc_worker_pool_sha256(TCWorkerPool_t pool, const tc_sha256_job *jobs,
+			  size_t count)
+{
+	size_t grain;
+
+	if (pool == (TCWorkerPool_t) 0 || (count > 0 && jobs == NULL)) {
+		return TC_CRYPTO_FAIL;
+	}
+
+	grain = count / (pool->thread_count * SHA256_PIECES_PER_THREAD);
+	run_batch(pool, run_sha256, jobs, count, NULL, grain ? grain : 1);
+	return TC_CRYPTO_SUCCESS;
+}
+
+#endif /* TC_WORKER_POOL */
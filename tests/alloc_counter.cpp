@@ -0,0 +1,66 @@
+#include "test_helpers.h"
+#include <limits.h> // pulls in __GLIBC__ without declaring the allocator
+
+// Counts heap allocations made by the process so tests can assert that a code
+// path never touches the heap. On glibc the allocator entry points can be
+// replaced by the program, so these forward to the libc implementation and
+// bump a counter on the way through.
+
+static size_t alloc_count = 0;
+
+#if defined(__GLIBC__)
+
+extern "C"
+{
+	void* __libc_malloc(size_t size);
+	void* __libc_calloc(size_t n, size_t size);
+	void* __libc_realloc(void* ptr, size_t size);
+	void __libc_free(void* ptr);
+
+	void* malloc(size_t size)
+	{
+		alloc_count++;
+		return __libc_malloc(size);
+	}
+
+	void* calloc(size_t n, size_t size)
+	{
+		alloc_count++;
+		return __libc_calloc(n, size);
+	}
+
+	void* realloc(void* ptr, size_t size)
+	{
+		alloc_count++;
+		return __libc_realloc(ptr, size);
+	}
+
+	void free(void* ptr)
+	{
+		__libc_free(ptr);
+	}
+}
+
+bool alloc_counter_supported(void)
+{
+	return true;
+}
+
+#else
+
+bool alloc_counter_supported(void)
+{
+	return false;
+}
+
+#endif /* __GLIBC__ */
+
+void alloc_counter_reset(void)
+{
+	alloc_count = 0;
+}
+
+size_t alloc_counter_get(void)
+{
+	return alloc_count;
+}
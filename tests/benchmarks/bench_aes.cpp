@@ -0,0 +1,156 @@
+#include "PSACrypto.h"
+#include "../test_helpers.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#define SESSIONS 4
+#define ROUNDS 2000
+#define MESSAGES 64
+#define MESSAGE_BYTES (16 * 1024)
+
+class BenchAes : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+		for(int i = 0; i < SESSIONS; i++)
+		{
+			uint8_t key[16];
+			memset(key, 0x11 * (i + 1), sizeof(key));
+			psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+			psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+			psa_set_key_algorithm(&attributes, PSA_ALG_CTR);
+			psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+			psa_set_key_bits(&attributes, 128);
+			ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &keys[i]), PSA_SUCCESS);
+		}
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t keys[SESSIONS] = {0};
+	uint8_t iv[16] = {0};
+	uint8_t input[64] = {0};
+	uint8_t output[64] = {0};
+};
+
+// Every round switches to another key, as a gateway serving many peers does.
+TEST_F(BenchAes, InterleavedSessionSetup)
+{
+	size_t output_length = 0;
+	BenchTimer timer;
+	for(int round = 0; round < ROUNDS; round++)
+	{
+		psa_cipher_operation_t operation = PSA_CIPHER_OPERATION_INIT;
+		ASSERT_EQ(psa_cipher_encrypt_setup(&operation, keys[round % SESSIONS], PSA_ALG_CTR),
+				  PSA_SUCCESS);
+		ASSERT_EQ(psa_cipher_set_iv(&operation, iv, sizeof(iv)), PSA_SUCCESS);
+		ASSERT_EQ(psa_cipher_update(&operation, input, sizeof(input), output, sizeof(output),
+									&output_length),
+				  PSA_SUCCESS);
+		psa_cipher_abort(&operation);
+	}
+	bench_report("AES-128-CTR setup+64B, 4 keys round robin", ROUNDS, ROUNDS * sizeof(input),
+				 timer.elapsed_seconds());
+}
+
+// All sessions stay live and their updates are interleaved.
+TEST_F(BenchAes, InterleavedLiveSessions)
+{
+	psa_cipher_operation_t operations[SESSIONS];
+	size_t output_length = 0;
+	for(int i = 0; i < SESSIONS; i++)
+	{
+		operations[i] = psa_cipher_operation_init();
+		ASSERT_EQ(psa_cipher_encrypt_setup(&operations[i], keys[i], PSA_ALG_CTR), PSA_SUCCESS);
+		ASSERT_EQ(psa_cipher_set_iv(&operations[i], iv, sizeof(iv)), PSA_SUCCESS);
+	}
+
+	BenchTimer timer;
+	for(int round = 0; round < ROUNDS; round++)
+		ASSERT_EQ(psa_cipher_update(&operations[round % SESSIONS], input, sizeof(input), output,
+									sizeof(output), &output_length),
+				  PSA_SUCCESS);
+	bench_report("AES-128-CTR 64B updates, 4 live sessions", ROUNDS, ROUNDS * sizeof(input),
+				 timer.elapsed_seconds());
+
+	for(int i = 0; i < SESSIONS; i++)
+		psa_cipher_abort(&operations[i]);
+}
+
+// CBC over 16 KiB messages for each AES key size. Decryption runs the
+// inverse cipher on every block, so it shows both directions of the core.
+class BenchAesKeySize : public ::testing::TestWithParam<size_t>
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+		uint8_t key[32];
+		memset(key, 0x6b, sizeof(key));
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, PSA_ALG_CBC_NO_PADDING);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, GetParam());
+		ASSERT_EQ(psa_import_key(&attributes, key, GetParam() / 8, &key_id), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	std::string Name(const char* operation) const
+	{
+		return "AES-" + std::to_string(GetParam()) + "-CBC " + operation + " 16KiB";
+	}
+
+	psa_key_id_t key_id = 0;
+};
+
+TEST_P(BenchAesKeySize, CbcEncrypt)
+{
+	std::vector<uint8_t> message(MESSAGE_BYTES, 0xa5), ciphertext(16 + MESSAGE_BYTES);
+	size_t ciphertext_length = 0;
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < MESSAGES; i++)
+		ASSERT_EQ(psa_cipher_encrypt(key_id, PSA_ALG_CBC_NO_PADDING, message.data(), message.size(),
+									 ciphertext.data(), ciphertext.size(), &ciphertext_length),
+				  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report(Name("encrypt").c_str(), MESSAGES, (double)MESSAGES * MESSAGE_BYTES,
+				 timer.elapsed_seconds());
+	bench_report_cycles(Name("encrypt").c_str(), (double)MESSAGES * MESSAGE_BYTES, cycles);
+}
+
+TEST_P(BenchAesKeySize, CbcDecrypt)
+{
+	std::vector<uint8_t> message(MESSAGE_BYTES, 0xa5), ciphertext(16 + MESSAGE_BYTES),
+		plaintext(MESSAGE_BYTES);
+	size_t ciphertext_length = 0, plaintext_length = 0;
+	ASSERT_EQ(psa_cipher_encrypt(key_id, PSA_ALG_CBC_NO_PADDING, message.data(), message.size(),
+								 ciphertext.data(), ciphertext.size(), &ciphertext_length),
+			  PSA_SUCCESS);
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < MESSAGES; i++)
+		ASSERT_EQ(psa_cipher_decrypt(key_id, PSA_ALG_CBC_NO_PADDING, ciphertext.data(),
+									 ciphertext_length, plaintext.data(), plaintext.size(),
+									 &plaintext_length),
+				  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report(Name("decrypt").c_str(), MESSAGES, (double)MESSAGES * MESSAGE_BYTES,
+				 timer.elapsed_seconds());
+	bench_report_cycles(Name("decrypt").c_str(), (double)MESSAGES * MESSAGE_BYTES, cycles);
+}
+
+INSTANTIATE_TEST_SUITE_P(KeyBits, BenchAesKeySize, ::testing::Values(128, 192, 256));
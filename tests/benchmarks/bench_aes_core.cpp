@@ -0,0 +1,99 @@
+#include "PSACrypto.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "include/tinycrypt/aes.h"
+#include "include/tinycrypt/constants.h"
+
+// The byte-oriented rounds from the aes_bytewise_core object library.
+int bench_bytewise_aes128_set_encrypt_key(TCAesKeySched_t s, const uint8_t* k);
+int bench_bytewise_aes_encrypt(uint8_t* out, const uint8_t* in, const TCAesKeySched_t s);
+int bench_bytewise_aes_decrypt(uint8_t* out, const uint8_t* in, const TCAesKeySched_t s);
+}
+
+#define BLOCKS 200000
+
+typedef int (*block_fn)(uint8_t* out, const uint8_t* in, const TCAesKeySched_t s);
+
+// Times single blocks chained through the cipher, so each call depends on the
+// previous one as in CBC or CCM, and reports cycles per 16-byte block. The
+// configured core is whatever TC_AES_TTABLE selected for the library build.
+class BenchAesCore : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		memset(key, 0x5a, sizeof(key));
+		ASSERT_EQ(tc_aes128_set_encrypt_key(&sched, key), TC_CRYPTO_SUCCESS);
+	}
+
+	void Run(const char* name, block_fn fn, unsigned int keybits = 128)
+	{
+		uint8_t block[TC_AES_BLOCK_SIZE] = {0};
+		ASSERT_EQ(tc_aes_set_encrypt_key(&sched, key, keybits), TC_CRYPTO_SUCCESS);
+		BenchTimer timer;
+		uint64_t start = bench_cycles();
+		for(int i = 0; i < BLOCKS; i++)
+			ASSERT_EQ(fn(block, block, &sched), TC_CRYPTO_SUCCESS);
+		uint64_t cycles = bench_cycles() - start;
+		bench_report(name, BLOCKS, (double)BLOCKS * sizeof(block), timer.elapsed_seconds());
+		bench_report_cycles_per_op(name, BLOCKS, cycles);
+	}
+
+	uint8_t key[TC_AES_MAX_KEY_SIZE];
+	struct tc_aes_key_sched_struct sched;
+};
+
+TEST_F(BenchAesCore, SameOutput)
+{
+	uint8_t block[TC_AES_BLOCK_SIZE] = {0x01};
+	uint8_t expected[TC_AES_BLOCK_SIZE], actual[TC_AES_BLOCK_SIZE];
+	ASSERT_EQ(bench_bytewise_aes_encrypt(expected, block, &sched), TC_CRYPTO_SUCCESS);
+	ASSERT_EQ(tc_aes_encrypt(actual, block, &sched), TC_CRYPTO_SUCCESS);
+	EXPECT_EQ(memcmp(actual, expected, sizeof(actual)), 0);
+	ASSERT_EQ(bench_bytewise_aes_decrypt(actual, expected, &sched), TC_CRYPTO_SUCCESS);
+	EXPECT_EQ(memcmp(actual, block, sizeof(actual)), 0);
+	ASSERT_EQ(tc_aes_decrypt(actual, expected, &sched), TC_CRYPTO_SUCCESS);
+	EXPECT_EQ(memcmp(actual, block, sizeof(actual)), 0);
+}
+
+TEST_F(BenchAesCore, EncryptBytewise)
+{
+	Run("AES-128 encrypt block, byte-oriented rounds", bench_bytewise_aes_encrypt);
+}
+
+TEST_F(BenchAesCore, EncryptConfigured)
+{
+	Run("AES-128 encrypt block, configured core", tc_aes_encrypt);
+}
+
+TEST_F(BenchAesCore, DecryptBytewise)
+{
+	Run("AES-128 decrypt block, byte-oriented rounds", bench_bytewise_aes_decrypt);
+}
+
+TEST_F(BenchAesCore, DecryptConfigured)
+{
+	Run("AES-128 decrypt block, configured core", tc_aes_decrypt);
+}
+
+TEST_F(BenchAesCore, EncryptConfigured192)
+{
+	Run("AES-192 encrypt block, configured core", tc_aes_encrypt, 192);
+}
+
+TEST_F(BenchAesCore, EncryptConfigured256)
+{
+	Run("AES-256 encrypt block, configured core", tc_aes_encrypt, 256);
+}
+
+TEST_F(BenchAesCore, DecryptConfigured192)
+{
+	Run("AES-192 decrypt block, configured core", tc_aes_decrypt, 192);
+}
+
+TEST_F(BenchAesCore, DecryptConfigured256)
+{
+	Run("AES-256 decrypt block, configured core", tc_aes_decrypt, 256);
+}
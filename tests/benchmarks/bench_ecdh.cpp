@@ -0,0 +1,118 @@
+#include "PSACrypto.h"
+#include "../test_helpers.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+
+#define HANDSHAKES 200
+
+// NIST CAVS 14.1 KAS ECC CDH primitive, P-256, COUNT = 0: the peer's key.
+static const uint8_t peer_key[65] = {
+	0x04, 0x70, 0x0c, 0x48, 0xf7, 0x7f, 0x56, 0x58, 0x4c, 0x5c, 0xc6, 0x32, 0xca, 0x65, 0x64, 0x0d,
+	0xb9, 0x1b, 0x6b, 0xac, 0xce, 0x3a, 0x4d, 0xf6, 0xb4, 0x2c, 0xe7, 0xcc, 0x83, 0x88, 0x33, 0xd2,
+	0x87, 0xdb, 0x71, 0xe5, 0x09, 0xe3, 0xfd, 0x9b, 0x06, 0x0d, 0xdb, 0x20, 0xba, 0x5c, 0x51, 0xdc,
+	0xc5, 0x94, 0x8d, 0x46, 0xfb, 0xf6, 0x40, 0xdf, 0xe0, 0x44, 0x17, 0x82, 0xca, 0xb8, 0x5f, 0xa4,
+	0xac};
+
+// The device side of an ECDHE handshake: create an ephemeral key, send its
+// public key and agree on a secret with the peer's. The pooled variant refills
+// the ephemeral key pool between handshakes, outside the timed part, as an
+// idle loop would.
+class BenchEcdh : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	double Handshakes(bool pooled)
+	{
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_ECDH);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+		psa_set_key_bits(&attributes, 256);
+		uint8_t public_key[65], secret[32];
+		size_t length;
+		double seconds = 0;
+
+		for(int i = 0; i < HANDSHAKES; i++)
+		{
+			if(pooled)
+				EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_fill(PSA_ECC_FAMILY_SECP_R1, 1),
+						  PSA_SUCCESS);
+
+			BenchTimer timer;
+			psa_key_id_t key = 0;
+			EXPECT_EQ(psa_generate_key(&attributes, &key), PSA_SUCCESS);
+			EXPECT_EQ(psa_export_public_key(key, public_key, sizeof(public_key), &length),
+					  PSA_SUCCESS);
+			EXPECT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key, peer_key, sizeof(peer_key),
+											secret, sizeof(secret), &length),
+					  PSA_SUCCESS);
+			EXPECT_EQ(psa_destroy_key(key), PSA_SUCCESS);
+			seconds += timer.elapsed_seconds();
+		}
+		return seconds;
+	}
+};
+
+TEST_F(BenchEcdh, RawKeyAgreement)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+	psa_set_key_algorithm(&attributes, PSA_ALG_ECDH);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+	psa_set_key_bits(&attributes, 256);
+	psa_key_id_t key = 0;
+	ASSERT_EQ(psa_generate_key(&attributes, &key), PSA_SUCCESS);
+	uint8_t secret[32];
+	size_t length;
+
+	BenchTimer timer;
+	for(int i = 0; i < HANDSHAKES; i++)
+		ASSERT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key, peer_key, sizeof(peer_key), secret,
+										sizeof(secret), &length),
+				  PSA_SUCCESS);
+	bench_report("psa_raw_key_agreement P-256", HANDSHAKES, 0, timer.elapsed_seconds());
+}
+
+// secp256k1 multiplies the peer's point with the GLV endomorphism when
+// uECC_SECP256K1_GLV is set, and with the same ladder as P-256 otherwise.
+TEST_F(BenchEcdh, RawKeyAgreementSecp256k1)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+	psa_set_key_algorithm(&attributes, PSA_ALG_ECDH);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_K1));
+	psa_set_key_bits(&attributes, 256);
+	psa_key_id_t key = 0, peer = 0;
+	ASSERT_EQ(psa_generate_key(&attributes, &key), PSA_SUCCESS);
+	ASSERT_EQ(psa_generate_key(&attributes, &peer), PSA_SUCCESS);
+	uint8_t k1_peer_key[65], secret[32];
+	size_t length;
+	ASSERT_EQ(psa_export_public_key(peer, k1_peer_key, sizeof(k1_peer_key), &length),
+			  PSA_SUCCESS);
+
+	BenchTimer timer;
+	for(int i = 0; i < HANDSHAKES; i++)
+		ASSERT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key, k1_peer_key, sizeof(k1_peer_key),
+										secret, sizeof(secret), &length),
+				  PSA_SUCCESS);
+	bench_report("psa_raw_key_agreement secp256k1", HANDSHAKES, 0, timer.elapsed_seconds());
+}
+
+TEST_F(BenchEcdh, Handshake)
+{
+	bench_report("ECDHE handshake P-256", HANDSHAKES, 0, Handshakes(false));
+}
+
+TEST_F(BenchEcdh, HandshakeWithEphemeralPool)
+{
+	bench_report("ECDHE handshake P-256, pooled key", HANDSHAKES, 0, Handshakes(true));
+}
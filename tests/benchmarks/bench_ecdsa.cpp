@@ -0,0 +1,254 @@
+#include "PSACrypto.h"
+#include "../test_helpers.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "include/tinycrypt/ecc.h"
+#include "include/tinycrypt/ecc_dsa.h"
+}
+
+#define VERIFIES 200
+#define SIGNS 200
+#define KEYGENS 200
+#define BATCH_VERIFIES 1024
+
+// RFC 6979 A.2.5: P-256 key and SHA-256 signature of "sample".
+static const uint8_t private_key[32] = {
+	0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+	0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12, 0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21};
+static const uint8_t sample_sha256[32] = {
+	0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+	0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf};
+static const uint8_t sample_signature[64] = {
+	0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+	0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+	0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+	0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8};
+
+// Signature verification with a key pair slot. The slot path reuses the public
+// point cached at import; the derive path is what verify did before, turning
+// the private key into the public key on every call.
+class BenchEcdsa : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH);
+		psa_set_key_algorithm(&attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+		psa_set_key_bits(&attributes, 256);
+		ASSERT_EQ(psa_import_key(&attributes, private_key, sizeof(private_key), &key),
+				  PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t key = 0;
+};
+
+TEST_F(BenchEcdsa, VerifyHashSlot)
+{
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < VERIFIES; i++)
+		ASSERT_EQ(psa_verify_hash(key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), sample_sha256,
+								  sizeof(sample_sha256), sample_signature,
+								  sizeof(sample_signature)),
+				  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("ECDSA P-256 verify, cached point", VERIFIES, 0, timer.elapsed_seconds());
+	bench_report_cycles_per_op("ECDSA P-256 verify, cached point", VERIFIES, cycles);
+}
+
+TEST_F(BenchEcdsa, VerifyHashDerivePublicKey)
+{
+	uint8_t public_key[2 * NUM_ECC_BYTES];
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < VERIFIES; i++)
+	{
+		ASSERT_EQ(uECC_compute_public_key(private_key, public_key, uECC_secp256r1()), 1);
+		ASSERT_EQ(uECC_verify(public_key, sample_sha256, sizeof(sample_sha256), sample_signature,
+							  uECC_secp256r1()),
+				  1);
+	}
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("ECDSA P-256 verify, derive public key", VERIFIES, 0, timer.elapsed_seconds());
+	bench_report_cycles_per_op("ECDSA P-256 verify, derive public key", VERIFIES, cycles);
+}
+
+// secp256k1 verification splits both scalars with the GLV endomorphism when
+// uECC_SECP256K1_GLV is set, and runs the same wNAF as P-256 otherwise.
+TEST_F(BenchEcdsa, VerifyHashSecp256k1)
+{
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH);
+	psa_set_key_algorithm(&attributes, alg);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_K1));
+	psa_set_key_bits(&attributes, 256);
+	psa_key_id_t k1_key = 0;
+	ASSERT_EQ(psa_generate_key(&attributes, &k1_key), PSA_SUCCESS);
+	uint8_t signature[64];
+	size_t signature_length;
+	ASSERT_EQ(psa_sign_hash(k1_key, alg, sample_sha256, sizeof(sample_sha256), signature,
+							sizeof(signature), &signature_length),
+			  PSA_SUCCESS);
+
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < VERIFIES; i++)
+		ASSERT_EQ(psa_verify_hash(k1_key, alg, sample_sha256, sizeof(sample_sha256), signature,
+								  sizeof(signature)),
+				  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("ECDSA secp256k1 verify, cached point", VERIFIES, 0, timer.elapsed_seconds());
+	bench_report_cycles_per_op("ECDSA secp256k1 verify, cached point", VERIFIES, cycles);
+}
+
+// Signing and key generation both multiply the generator; with
+// uECC_BASE_COMB_WIDTH set that goes through the fixed-base comb.
+TEST_F(BenchEcdsa, SignHash)
+{
+	uint8_t signature[64];
+	size_t signature_length;
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < SIGNS; i++)
+		ASSERT_EQ(psa_sign_hash(key, PSA_ALG_ECDSA(PSA_ALG_SHA_256), sample_sha256,
+								sizeof(sample_sha256), signature, sizeof(signature),
+								&signature_length),
+				  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("ECDSA P-256 sign", SIGNS, 0, timer.elapsed_seconds());
+	bench_report_cycles_per_op("ECDSA P-256 sign", SIGNS, cycles);
+}
+
+// RFC 6979 signing derives the nonce and the blinding values with
+// HMAC-SHA-256 instead of drawing them from the RNG.
+TEST_F(BenchEcdsa, SignHashDeterministic)
+{
+	const psa_algorithm_t alg = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256);
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_HASH);
+	psa_set_key_algorithm(&attributes, alg);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+	psa_set_key_bits(&attributes, 256);
+	psa_key_id_t det_key = 0;
+	ASSERT_EQ(psa_import_key(&attributes, private_key, sizeof(private_key), &det_key),
+			  PSA_SUCCESS);
+
+	uint8_t signature[64];
+	size_t signature_length;
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < SIGNS; i++)
+		ASSERT_EQ(psa_sign_hash(det_key, alg, sample_sha256, sizeof(sample_sha256), signature,
+								sizeof(signature), &signature_length),
+				  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("Deterministic ECDSA P-256 sign", SIGNS, 0, timer.elapsed_seconds());
+	bench_report_cycles_per_op("Deterministic ECDSA P-256 sign", SIGNS, cycles);
+}
+
+// Verification costs a double-scalar multiplication with a fresh table for
+// the public point against the comb for signing; the ratio between the two
+// tracks the field arithmetic, which runs on uECC_WORD_SIZE-byte limbs.
+TEST_F(BenchEcdsa, SignVerifyRatio)
+{
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	uint8_t signature[64];
+	size_t signature_length;
+
+	BenchTimer sign_timer;
+	for(int i = 0; i < SIGNS; i++)
+		ASSERT_EQ(psa_sign_hash(key, alg, sample_sha256, sizeof(sample_sha256), signature,
+								sizeof(signature), &signature_length),
+				  PSA_SUCCESS);
+	double sign_seconds = sign_timer.elapsed_seconds();
+
+	BenchTimer verify_timer;
+	for(int i = 0; i < VERIFIES; i++)
+		ASSERT_EQ(psa_verify_hash(key, alg, sample_sha256, sizeof(sample_sha256),
+								  sample_signature, sizeof(sample_signature)),
+				  PSA_SUCCESS);
+	double verify_seconds = verify_timer.elapsed_seconds();
+
+	char name[64];
+	snprintf(name, sizeof(name), "ECDSA P-256 sign, %d-bit limbs", uECC_WORD_BITS);
+	bench_report(name, SIGNS, 0, sign_seconds);
+	snprintf(name, sizeof(name), "ECDSA P-256 verify, %d-bit limbs", uECC_WORD_BITS);
+	bench_report(name, VERIFIES, 0, verify_seconds);
+	std::printf("[ BENCH    ] %-48s %12.2f\n", "ECDSA P-256 verify/sign time ratio",
+				(verify_seconds / VERIFIES) / (sign_seconds / SIGNS));
+}
+
+TEST_F(BenchEcdsa, GenerateKey)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_HASH);
+	psa_set_key_algorithm(&attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1));
+	psa_set_key_bits(&attributes, 256);
+
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < KEYGENS; i++)
+	{
+		psa_key_id_t generated = 0;
+		ASSERT_EQ(psa_generate_key(&attributes, &generated), PSA_SUCCESS);
+		ASSERT_EQ(psa_destroy_key(generated), PSA_SUCCESS);
+	}
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("ECDSA P-256 key generation", KEYGENS, 0, timer.elapsed_seconds());
+	bench_report_cycles_per_op("ECDSA P-256 key generation", KEYGENS, cycles);
+}
+
+// Throughput of iotex_psa_verify_hash_batch() for growing batch sizes, each
+// size verifying the same BATCH_VERIFIES signatures, against a loop over
+// psa_verify_hash().
+TEST_F(BenchEcdsa, VerifyHashBatch)
+{
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	std::vector<uint8_t> hashes(BATCH_VERIFIES * 32);
+	std::vector<uint8_t> signatures(BATCH_VERIFIES * 64);
+	std::vector<iotex_psa_verify_hash_batch_item_t> items(BATCH_VERIFIES);
+	std::vector<psa_status_t> results(BATCH_VERIFIES);
+
+	for(int i = 0; i < BATCH_VERIFIES; i++)
+	{
+		size_t signature_length;
+		uint8_t* hash = &hashes[i * 32];
+		uint8_t* signature = &signatures[i * 64];
+		memcpy(hash, sample_sha256, 32);
+		hash[0] = (uint8_t)i;
+		hash[1] = (uint8_t)(i >> 8);
+		ASSERT_EQ(psa_sign_hash(key, alg, hash, 32, signature, 64, &signature_length),
+				  PSA_SUCCESS);
+		items[i] = {key, alg, hash, 32, signature, 64};
+	}
+
+	BenchTimer loop_timer;
+	for(int i = 0; i < BATCH_VERIFIES; i++)
+		ASSERT_EQ(psa_verify_hash(key, alg, items[i].hash, 32, items[i].signature, 64),
+				  PSA_SUCCESS);
+	bench_report("ECDSA P-256 verify, psa_verify_hash loop", BATCH_VERIFIES, 0,
+				 loop_timer.elapsed_seconds());
+
+	for(int batch = 1; batch <= BATCH_VERIFIES; batch *= 4)
+	{
+		std::string name = "ECDSA P-256 verify, batches of " + std::to_string(batch);
+		BenchTimer timer;
+		for(int i = 0; i < BATCH_VERIFIES; i += batch)
+			ASSERT_EQ(iotex_psa_verify_hash_batch(&items[i], batch, &results[i]), PSA_SUCCESS);
+		bench_report(name.c_str(), BATCH_VERIFIES, 0, timer.elapsed_seconds());
+	}
+}
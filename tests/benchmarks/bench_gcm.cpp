@@ -0,0 +1,129 @@
+#include "PSACrypto.h"
+#include "../test_helpers.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#define FRAMES 20000
+#define MESSAGES 256
+#define MESSAGE_BYTES (16 * 1024)
+#define STREAM_BYTES (1024 * 1024)
+
+// Rebuild with -DIOTEX_GCM_GHASH_TABLE_BITS=8, or with IOTEX_AESNI_C and
+// IOTEX_HAVE_ASM on x86-64, to compare the GHASH variants.
+class BenchGcm : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+		uint8_t key[16];
+		memset(key, 0x3c, sizeof(key));
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, PSA_ALG_GCM);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, 128);
+		ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &key_id), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t key_id = 0;
+	uint8_t nonce[12] = {0};
+	uint8_t header[8] = {0};
+	uint8_t frame[24] = {0};
+};
+
+TEST_F(BenchGcm, EncryptShortFrames)
+{
+	uint8_t ciphertext[sizeof(frame) + 16];
+	size_t ciphertext_length = 0;
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < FRAMES; i++)
+	{
+		nonce[11] = (uint8_t)i;
+		ASSERT_EQ(psa_aead_encrypt(key_id, PSA_ALG_GCM, nonce, sizeof(nonce), header,
+								   sizeof(header), frame, sizeof(frame), ciphertext,
+								   sizeof(ciphertext), &ciphertext_length),
+				  PSA_SUCCESS);
+	}
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("AES-128-GCM encrypt 24B frames", FRAMES, FRAMES * sizeof(frame),
+				 timer.elapsed_seconds());
+	bench_report_cycles("AES-128-GCM encrypt 24B frames", FRAMES * sizeof(frame), cycles);
+}
+
+TEST_F(BenchGcm, Encrypt16KiB)
+{
+	std::vector<uint8_t> message(MESSAGE_BYTES, 0xa5), ciphertext(MESSAGE_BYTES + 16);
+	size_t ciphertext_length = 0;
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < MESSAGES; i++)
+	{
+		nonce[11] = (uint8_t)i;
+		ASSERT_EQ(psa_aead_encrypt(key_id, PSA_ALG_GCM, nonce, sizeof(nonce), header,
+								   sizeof(header), message.data(), message.size(),
+								   ciphertext.data(), ciphertext.size(), &ciphertext_length),
+				  PSA_SUCCESS);
+	}
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("AES-128-GCM encrypt 16KiB", MESSAGES, (double)MESSAGES * MESSAGE_BYTES,
+				 timer.elapsed_seconds());
+	bench_report_cycles("AES-128-GCM encrypt 16KiB", (double)MESSAGES * MESSAGE_BYTES, cycles);
+}
+
+TEST_F(BenchGcm, Decrypt16KiB)
+{
+	std::vector<uint8_t> message(MESSAGE_BYTES, 0xa5), ciphertext(MESSAGE_BYTES + 16),
+		plaintext(MESSAGE_BYTES);
+	size_t ciphertext_length = 0, plaintext_length = 0;
+	ASSERT_EQ(psa_aead_encrypt(key_id, PSA_ALG_GCM, nonce, sizeof(nonce), header, sizeof(header),
+							   message.data(), message.size(), ciphertext.data(),
+							   ciphertext.size(), &ciphertext_length),
+			  PSA_SUCCESS);
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	for(int i = 0; i < MESSAGES; i++)
+	{
+		ASSERT_EQ(psa_aead_decrypt(key_id, PSA_ALG_GCM, nonce, sizeof(nonce), header,
+								   sizeof(header), ciphertext.data(), ciphertext_length,
+								   plaintext.data(), plaintext.size(), &plaintext_length),
+				  PSA_SUCCESS);
+	}
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("AES-128-GCM decrypt 16KiB", MESSAGES, (double)MESSAGES * MESSAGE_BYTES,
+				 timer.elapsed_seconds());
+	bench_report_cycles("AES-128-GCM decrypt 16KiB", (double)MESSAGES * MESSAGE_BYTES, cycles);
+}
+
+// Encrypt 1 MiB through the multipart API in 256-byte chunks, as a firmware
+// image or log upload would arrive.
+TEST_F(BenchGcm, StreamingEncrypt)
+{
+	std::vector<uint8_t> chunk(256, 0xa5), output(256);
+	uint8_t tag[16];
+	size_t output_length = 0, finish_length = 0, tag_length = 0;
+	psa_aead_operation_t operation = PSA_AEAD_OPERATION_INIT;
+	BenchTimer timer;
+	uint64_t start = bench_cycles();
+	ASSERT_EQ(psa_aead_encrypt_setup(&operation, key_id, PSA_ALG_GCM), PSA_SUCCESS);
+	ASSERT_EQ(psa_aead_set_nonce(&operation, nonce, sizeof(nonce)), PSA_SUCCESS);
+	ASSERT_EQ(psa_aead_update_ad(&operation, header, sizeof(header)), PSA_SUCCESS);
+	for(size_t done = 0; done < STREAM_BYTES; done += chunk.size())
+		ASSERT_EQ(psa_aead_update(&operation, chunk.data(), chunk.size(), output.data(),
+								  output.size(), &output_length),
+				  PSA_SUCCESS);
+	ASSERT_EQ(psa_aead_finish(&operation, NULL, 0, &finish_length, tag, sizeof(tag), &tag_length),
+			  PSA_SUCCESS);
+	uint64_t cycles = bench_cycles() - start;
+	bench_report("AES-128-GCM streaming encrypt 256B chunks", STREAM_BYTES / chunk.size(),
+				 STREAM_BYTES, timer.elapsed_seconds());
+	bench_report_cycles("AES-128-GCM streaming encrypt 256B chunks", STREAM_BYTES, cycles);
+}
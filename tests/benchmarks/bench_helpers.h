@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <x86intrin.h>
+#endif
+
+// Benchmarks are plain gtest cases so they share the unit test runner. They
+// are built into the `benchmarks` target, which is not registered with ctest.
+
+class BenchTimer
+{
+  public:
+	BenchTimer() : start(std::chrono::steady_clock::now())
+	{
+	}
+
+	double elapsed_seconds() const
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+  private:
+	std::chrono::steady_clock::time_point start;
+};
+
+static inline void bench_report(const char* name, double ops, double bytes, double seconds)
+{
+	if(bytes > 0)
+		std::printf("[ BENCH    ] %-48s %12.0f ops/s %10.2f MB/s\n", name, ops / seconds,
+					bytes / seconds / 1e6);
+	else
+		std::printf("[ BENCH    ] %-48s %12.0f ops/s\n", name, ops / seconds);
+}
+
+// Time stamp counter ticks, or 0 where there is no cheap cycle counter. On
+// x86 the TSC runs at the nominal clock, so per-byte figures are only
+// comparable between runs with frequency scaling pinned.
+static inline uint64_t bench_cycles()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+static inline void bench_report_cycles(const char* name, double bytes, uint64_t cycles)
+{
+	if(cycles > 0)
+		std::printf("[ BENCH    ] %-48s %12.2f cycles/byte\n", name, (double)cycles / bytes);
+}
+
+static inline void bench_report_cycles_per_op(const char* name, double ops, uint64_t cycles)
+{
+	if(cycles > 0)
+		std::printf("[ BENCH    ] %-48s %12.1f cycles/op\n", name, (double)cycles / ops);
+}
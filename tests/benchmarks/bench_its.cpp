@@ -0,0 +1,87 @@
+#include "bench_helpers.h"
+#include "PSACrypto.h"
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+#if defined(IOTEX_PSA_ITS_FILE_C) && defined(IOTEX_PSA_CRYPTO_STORAGE_C)
+
+	#define ITS_BENCH_KEYS 200
+
+static psa_status_t import_persistent_key(psa_key_id_t id)
+{
+	static const uint8_t key[16] = {0x2B};
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_key_id_t key_id;
+
+	psa_set_key_id(&attributes, id);
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_EXPORT);
+	psa_set_key_algorithm(&attributes, PSA_ALG_CTR);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+	return psa_import_key(&attributes, key, sizeof(key), &key_id);
+}
+
+static void destroy_keys(void)
+{
+	for(psa_key_id_t i = 0; i < ITS_BENCH_KEYS; i++)
+		psa_destroy_key(PSA_KEY_ID_USER_MIN + i);
+}
+
+// Persistent key creation and loading through the file-backed ITS. The
+// files go to a directory under the current one, or under $PSA_BENCH_ITS_DIR,
+// since syncs on a tmpfs cost nothing and would hide what batching saves.
+TEST(BenchIts, PersistentKeys)
+{
+	const char* base = getenv("PSA_BENCH_ITS_DIR");
+	std::string path = std::string(base != NULL ? base : ".") + "/psa_its_bench_XXXXXX";
+	uint8_t key[16];
+	size_t length;
+
+	ASSERT_NE(mkdtemp(&path[0]), nullptr);
+	ASSERT_EQ(iotex_psa_its_file_set_location(path.c_str()), PSA_SUCCESS);
+	ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+
+	// Every key synced on its own
+	BenchTimer store_timer;
+	for(psa_key_id_t i = 0; i < ITS_BENCH_KEYS; i++)
+		ASSERT_EQ(import_persistent_key(PSA_KEY_ID_USER_MIN + i), PSA_SUCCESS);
+	bench_report("Store persistent key, sync each", ITS_BENCH_KEYS, 0,
+				 store_timer.elapsed_seconds());
+
+	// Restart, so every export loads its key from its file
+	iotex_psa_crypto_free();
+	ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	BenchTimer load_timer;
+	for(psa_key_id_t i = 0; i < ITS_BENCH_KEYS; i++)
+		ASSERT_EQ(psa_export_key(PSA_KEY_ID_USER_MIN + i, key, sizeof(key), &length), PSA_SUCCESS);
+	bench_report("Load persistent key", ITS_BENCH_KEYS, 0, load_timer.elapsed_seconds());
+
+	BenchTimer hit_timer;
+	for(psa_key_id_t i = 0; i < ITS_BENCH_KEYS; i++)
+		ASSERT_EQ(psa_export_key(PSA_KEY_ID_USER_MIN + i, key, sizeof(key), &length), PSA_SUCCESS);
+	bench_report("Use loaded persistent key", ITS_BENCH_KEYS, 0, hit_timer.elapsed_seconds());
+
+	BenchTimer destroy_timer;
+	destroy_keys();
+	bench_report("Destroy persistent key, sync each", ITS_BENCH_KEYS, 0,
+				 destroy_timer.elapsed_seconds());
+
+	// The same keys created in batches
+	BenchTimer batch_timer;
+	iotex_psa_its_file_begin_batch();
+	for(psa_key_id_t i = 0; i < ITS_BENCH_KEYS; i++)
+		ASSERT_EQ(import_persistent_key(PSA_KEY_ID_USER_MIN + i), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+	char name[64];
+	snprintf(name, sizeof(name), "Store persistent key, batches of %d",
+			 IOTEX_PSA_ITS_FILE_BATCH_SIZE);
+	bench_report(name, ITS_BENCH_KEYS, 0, batch_timer.elapsed_seconds());
+
+	destroy_keys();
+	iotex_psa_crypto_free();
+	iotex_psa_its_file_set_location(NULL);
+	rmdir(path.c_str());
+}
+
+#endif
@@ -0,0 +1,103 @@
+#include "bench_helpers.h"
+#include "PSACrypto.h"
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <unistd.h>
+
+extern "C"
+{
+#include "include/svc/crypto/psa_crypto_its.h"
+#include "include/svc/crypto/psa_its_flash_sim.h"
+}
+
+#if defined(IOTEX_PSA_ITS_FLASH_C) && defined(IOTEX_FS_IO)
+
+	#define FLASH_BENCH_SECTOR_SIZE 4096
+	#define FLASH_BENCH_SECTORS 16
+	#define FLASH_BENCH_KEYS 32
+	#define FLASH_BENCH_WRITES 2000
+	// A persistent 256-bit key in the storage format: header, attributes and
+	// the key material
+	#define FLASH_BENCH_KEY_SIZE 68
+
+static void report_device(const char* name, const iotex_psa_flash_sim_t& sim, uint64_t busy_ns,
+						  uint32_t erases, double ops)
+{
+	std::printf("[ BENCH    ] %-48s %12.3f ms/op %8.3f erases/op\n", name,
+				(double)(sim.busy_ns - busy_ns) / 1e6 / ops, (double)(sim.erases - erases) / ops);
+}
+
+// Writing key records to the simulated flash device, as a table rewritten
+// in place on each write against the log-structured store. The device
+// timing model is that of a typical SPI NOR flash; the ms/op figures are
+// the time a real part would be busy, the ops/s ones only the host cost.
+TEST(BenchItsFlash, KeyRecords)
+{
+	const char* base = getenv("PSA_BENCH_ITS_DIR");
+	std::string path = std::string(base != NULL ? base : "/tmp") + "/psa_flash_bench_XXXXXX";
+	iotex_psa_flash_sim_t sim;
+	uint8_t record[FLASH_BENCH_KEY_SIZE];
+	uint64_t busy_ns;
+	uint32_t erases;
+	int fd;
+
+	fd = mkstemp(&path[0]);
+	ASSERT_GE(fd, 0);
+	close(fd);
+	ASSERT_EQ(iotex_psa_flash_sim_open(&sim, path.c_str(), FLASH_BENCH_SECTOR_SIZE,
+									   FLASH_BENCH_SECTORS),
+			  PSA_SUCCESS);
+
+	// Every record in one sector, erased and programmed again on each write
+	static uint8_t table[FLASH_BENCH_SECTOR_SIZE];
+	busy_ns = sim.busy_ns;
+	erases = sim.erases;
+	BenchTimer naive_timer;
+	for(int i = 0; i < FLASH_BENCH_WRITES; i++)
+	{
+		ASSERT_EQ(sim.flash.read(sim.flash.context, 0, table, sizeof(table)), 0);
+		memset(table + (i % FLASH_BENCH_KEYS) * FLASH_BENCH_KEY_SIZE, i, FLASH_BENCH_KEY_SIZE);
+		ASSERT_EQ(sim.flash.erase(sim.flash.context, 0), 0);
+		ASSERT_EQ(sim.flash.program(sim.flash.context, 0, table, sizeof(table)), 0);
+	}
+	bench_report("Flash key write, erase and rewrite", FLASH_BENCH_WRITES, 0,
+				 naive_timer.elapsed_seconds());
+	report_device("Flash key write, erase and rewrite", sim, busy_ns, erases, FLASH_BENCH_WRITES);
+
+	ASSERT_EQ(sim.flash.erase(sim.flash.context, 0), 0);
+	ASSERT_EQ(iotex_psa_its_flash_mount(&sim.flash), PSA_SUCCESS);
+	busy_ns = sim.busy_ns;
+	erases = sim.erases;
+	BenchTimer log_timer;
+	for(int i = 0; i < FLASH_BENCH_WRITES; i++)
+	{
+		memset(record, i, sizeof(record));
+		ASSERT_EQ(iotex_psa_its_flash_set(i % FLASH_BENCH_KEYS, sizeof(record), record,
+										  PSA_STORAGE_FLAG_NONE),
+				  PSA_SUCCESS);
+	}
+	bench_report("Flash key write, log-structured", FLASH_BENCH_WRITES, 0,
+				 log_timer.elapsed_seconds());
+	report_device("Flash key write, log-structured", sim, busy_ns, erases, FLASH_BENCH_WRITES);
+
+	iotex_psa_its_flash_stats_t stats;
+	ASSERT_EQ(iotex_psa_its_flash_get_stats(&stats), PSA_SUCCESS);
+	std::printf("[ BENCH    ] %-48s %12u erases min %6u max\n", "Flash sector wear, log-structured",
+				(unsigned)stats.min_erase_count, (unsigned)stats.max_erase_count);
+
+	// Rebuilding the index at boot
+	iotex_psa_its_flash_unmount();
+	busy_ns = sim.busy_ns;
+	BenchTimer mount_timer;
+	ASSERT_EQ(iotex_psa_its_flash_mount(&sim.flash), PSA_SUCCESS);
+	bench_report("Flash store mount", 1, 0, mount_timer.elapsed_seconds());
+	report_device("Flash store mount", sim, busy_ns, sim.erases, 1);
+
+	iotex_psa_its_flash_unmount();
+	iotex_psa_flash_sim_close(&sim);
+	remove(path.c_str());
+}
+
+#endif
@@ -0,0 +1,103 @@
+#include "bench_helpers.h"
+#include "PSACrypto.h"
+#include <gtest/gtest.h>
+#include <stdlib.h>
+#include <vector>
+
+extern "C"
+{
+#include "include/svc/crypto/psa_crypto_key_arena.h"
+#include "include/svc/crypto/psa_crypto_slot_management.h"
+}
+
+#define KEY_SLOT_LOOKUPS 2000000
+
+static const size_t slot_counts[] = {32, 256, 4096};
+
+// Persistent key lookup against the number of key slots: the linear scan
+// psa_get_and_lock_key_slot_in_memory() used to do over the slot table,
+// against the key identifier index. The slot tables are built here so the
+// slot count can vary, the library itself is built with one count.
+TEST(BenchKeySlots, PersistentLookup)
+{
+	char name[64];
+
+	for(size_t count : slot_counts)
+	{
+		std::vector<psa_key_slot_t> slots(count);
+		std::vector<psa_key_slot_index_entry_t> entries(2 * count);
+		psa_key_slot_index_t index = {entries.data(), entries.size() - 1};
+		size_t found = 0;
+
+		psa_key_slot_index_clear(&index);
+		for(size_t i = 0; i < count; i++)
+		{
+			slots[i].attr.id = (psa_key_id_t)(PSA_KEY_ID_USER_MIN + 3 * i);
+			psa_key_slot_index_insert(&index, slots[i].attr.id, i);
+		}
+
+		// Look up every key in turn, the average hit is half a table away
+		BenchTimer scan_timer;
+		for(size_t n = 0; n < KEY_SLOT_LOOKUPS; n++)
+		{
+			psa_key_id_t key = (psa_key_id_t)(PSA_KEY_ID_USER_MIN + 3 * (n % count));
+			for(size_t i = 0; i < count; i++)
+			{
+				if(iotex_svc_key_id_equal(key, slots[i].attr.id))
+				{
+					found += i;
+					break;
+				}
+			}
+		}
+		snprintf(name, sizeof(name), "Linear scan, %zu slots", count);
+		bench_report(name, KEY_SLOT_LOOKUPS, 0, scan_timer.elapsed_seconds());
+
+		BenchTimer index_timer;
+		for(size_t n = 0; n < KEY_SLOT_LOOKUPS; n++)
+		{
+			psa_key_id_t key = (psa_key_id_t)(PSA_KEY_ID_USER_MIN + 3 * (n % count));
+			found -= psa_key_slot_index_find(&index, key);
+		}
+		snprintf(name, sizeof(name), "Key identifier index, %zu slots", count);
+		bench_report(name, KEY_SLOT_LOOKUPS, 0, index_timer.elapsed_seconds());
+
+		EXPECT_EQ(found, 0u);
+	}
+}
+
+#define KEY_BUFFER_ROUNDS 200000
+
+// Key material churn as sessions come and go: 64 live keys of mixed sizes,
+// freed and reallocated in turn, through the heap and through the arena.
+TEST(BenchKeySlots, KeyMaterialAllocation)
+{
+	static const size_t sizes[] = {16, 32, 65, 32, 16, 97};
+	uint8_t* live[64] = {NULL};
+
+	BenchTimer heap_timer;
+	for(size_t n = 0; n < KEY_BUFFER_ROUNDS; n++)
+	{
+		size_t i = n % 64;
+		free(live[i]);
+		live[i] = (uint8_t*)calloc(1, sizes[n % 6]);
+	}
+	bench_report("calloc/free", KEY_BUFFER_ROUNDS, 0, heap_timer.elapsed_seconds());
+	for(uint8_t*& buffer : live)
+	{
+		free(buffer);
+		buffer = NULL;
+	}
+
+	BenchTimer arena_timer;
+	for(size_t n = 0; n < KEY_BUFFER_ROUNDS; n++)
+	{
+		size_t i = n % 64;
+		iotex_psa_key_arena_free(live[i]);
+		live[i] = iotex_psa_key_arena_alloc(sizes[n % 6]);
+	}
+	bench_report("Key arena", KEY_BUFFER_ROUNDS, 0, arena_timer.elapsed_seconds());
+	for(uint8_t* buffer : live)
+		iotex_psa_key_arena_free(buffer);
+	iotex_psa_key_arena_release();
+}
@@ -0,0 +1,64 @@
+#include "PSACrypto.h"
+#include "../test_helpers.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+
+#define FRAMES 20000
+
+class BenchMac : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+		uint8_t key[16];
+		memset(key, 0x5a, sizeof(key));
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_CMAC);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, 128);
+		ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &cmac_key), PSA_SUCCESS);
+
+		attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_HMAC(PSA_ALG_SHA_256));
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+		psa_set_key_bits(&attributes, 128);
+		ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &hmac_key), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	void MacFrames(const char* name, psa_key_id_t key, psa_algorithm_t alg)
+	{
+		uint8_t mac[PSA_MAC_MAX_SIZE];
+		size_t mac_length = 0;
+		BenchTimer timer;
+		for(int i = 0; i < FRAMES; i++)
+		{
+			frame[0] = (uint8_t)i;
+			ASSERT_EQ(psa_mac_compute(key, alg, frame, sizeof(frame), mac, sizeof(mac), &mac_length),
+					  PSA_SUCCESS);
+		}
+		bench_report(name, FRAMES, FRAMES * sizeof(frame), timer.elapsed_seconds());
+	}
+
+	psa_key_id_t cmac_key = 0;
+	psa_key_id_t hmac_key = 0;
+	// A typical LoRaWAN-sized payload.
+	uint8_t frame[24] = {0};
+};
+
+TEST_F(BenchMac, CmacShortFrames)
+{
+	MacFrames("AES-128-CMAC 24B frames", cmac_key, PSA_ALG_CMAC);
+}
+
+TEST_F(BenchMac, HmacShortFrames)
+{
+	MacFrames("HMAC-SHA256 24B frames", hmac_key, PSA_ALG_HMAC(PSA_ALG_SHA_256));
+}
@@ -0,0 +1,57 @@
+#include "PSACrypto.h"
+#include "../test_helpers.h"
+#include "bench_helpers.h"
+#include <gtest/gtest.h>
+
+class BenchSha256 : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+	}
+};
+
+// Throughput of psa_hash_compute as a function of the input size.
+TEST_F(BenchSha256, ThroughputByInputSize)
+{
+	const size_t sizes[] = {16, 64, 256, 1024, 8192, 65536};
+	static uint8_t input[65536];
+	uint8_t hash[32];
+	size_t hash_length = 0;
+	char name[64];
+
+	for(size_t size : sizes)
+	{
+		size_t iterations = (4u << 20) / size;
+		BenchTimer timer;
+		for(size_t i = 0; i < iterations; i++)
+			ASSERT_EQ(psa_hash_compute(PSA_ALG_SHA_256, input, size, hash, sizeof(hash),
+									   &hash_length),
+					  PSA_SUCCESS);
+		snprintf(name, sizeof(name), "SHA-256 compute, %zu bytes", size);
+		bench_report(name, iterations, (double)iterations * size, timer.elapsed_seconds());
+	}
+}
+
+// Streaming a large buffer in chunks that straddle block boundaries.
+TEST_F(BenchSha256, StreamingUnalignedChunks)
+{
+	static uint8_t input[1000];
+	const size_t total = 16u << 20;
+	uint8_t hash[32];
+	size_t hash_length = 0;
+
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	BenchTimer timer;
+	ASSERT_EQ(psa_hash_setup(&operation, PSA_ALG_SHA_256), PSA_SUCCESS);
+	for(size_t done = 0; done < total; done += sizeof(input))
+		ASSERT_EQ(psa_hash_update(&operation, input, sizeof(input)), PSA_SUCCESS);
+	ASSERT_EQ(psa_hash_finish(&operation, hash, sizeof(hash), &hash_length), PSA_SUCCESS);
+	bench_report("SHA-256 update, 1000-byte chunks", (double)total / sizeof(input), total,
+				 timer.elapsed_seconds());
+}
@@ -0,0 +1,98 @@
+#include "bench_helpers.h"
+#include "include/tinycrypt/constants.h"
+#include "include/tinycrypt/ecc_dsa.h"
+#include "include/tinycrypt/sha256.h"
+#include "include/tinycrypt/worker_pool.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+#if TC_WORKER_POOL
+
+#define POOL_VERIFIES 512
+#define POOL_DIGESTS 8192
+#define POOL_DIGEST_SIZE 1024
+
+// RFC 6979 A.2.5: P-256 key and SHA-256 signature of "sample".
+static const uint8_t private_key[32] = {
+	0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+	0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12, 0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21};
+static const uint8_t sample_sha256[32] = {
+	0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+	0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf};
+static const uint8_t sample_signature[64] = {
+	0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+	0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+	0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+	0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8};
+
+static const unsigned int thread_counts[] = {1, 2, 4, 8, 16, 32};
+
+// Throughput of the worker pool against the thread count. The 1-thread pool
+// still pays for the hand-off, so compare it with the plain loop first.
+TEST(BenchWorkerPool, VerifyScaling)
+{
+	uint8_t public_key[64];
+	ASSERT_EQ(uECC_compute_public_key(private_key, public_key, uECC_secp256r1()),
+			  TC_CRYPTO_SUCCESS);
+
+	std::vector<tc_verify_job> jobs(POOL_VERIFIES, {public_key, sample_sha256, 32,
+													sample_signature, uECC_secp256r1()});
+	std::vector<int> results(POOL_VERIFIES);
+	char name[64];
+
+	BenchTimer loop_timer;
+	for(size_t i = 0; i < POOL_VERIFIES; i++)
+		ASSERT_EQ(uECC_verify(public_key, sample_sha256, 32, sample_signature, uECC_secp256r1()),
+				  TC_CRYPTO_SUCCESS);
+	bench_report("uECC_verify loop", POOL_VERIFIES, 0, loop_timer.elapsed_seconds());
+
+	for(unsigned int threads : thread_counts)
+	{
+		struct tc_worker_pool_struct pool;
+		ASSERT_EQ(tc_worker_pool_init(&pool, threads), TC_CRYPTO_SUCCESS);
+		BenchTimer timer;
+		ASSERT_EQ(tc_worker_pool_verify(&pool, jobs.data(), POOL_VERIFIES, results.data()),
+				  TC_CRYPTO_SUCCESS);
+		double seconds = timer.elapsed_seconds();
+		tc_worker_pool_free(&pool);
+		for(int result : results)
+			ASSERT_EQ(result, TC_CRYPTO_SUCCESS);
+		snprintf(name, sizeof(name), "Pool verify, %u threads", threads);
+		bench_report(name, POOL_VERIFIES, 0, seconds);
+	}
+}
+
+TEST(BenchWorkerPool, Sha256Scaling)
+{
+	static uint8_t input[POOL_DIGEST_SIZE];
+	std::vector<uint8_t> digests(POOL_DIGESTS * TC_SHA256_DIGEST_SIZE);
+	std::vector<tc_sha256_job> jobs(POOL_DIGESTS);
+	for(size_t i = 0; i < POOL_DIGESTS; i++)
+		jobs[i] = {input, sizeof(input), &digests[i * TC_SHA256_DIGEST_SIZE]};
+	const double bytes = (double)POOL_DIGESTS * POOL_DIGEST_SIZE;
+	char name[64];
+
+	BenchTimer loop_timer;
+	for(size_t i = 0; i < POOL_DIGESTS; i++)
+	{
+		struct tc_sha256_state_struct s;
+		tc_sha256_init(&s);
+		tc_sha256_update(&s, input, sizeof(input));
+		tc_sha256_final(jobs[i].digest, &s);
+	}
+	bench_report("tc_sha256 loop, 1024 bytes", POOL_DIGESTS, bytes, loop_timer.elapsed_seconds());
+
+	for(unsigned int threads : thread_counts)
+	{
+		struct tc_worker_pool_struct pool;
+		ASSERT_EQ(tc_worker_pool_init(&pool, threads), TC_CRYPTO_SUCCESS);
+		BenchTimer timer;
+		ASSERT_EQ(tc_worker_pool_sha256(&pool, jobs.data(), POOL_DIGESTS), TC_CRYPTO_SUCCESS);
+		double seconds = timer.elapsed_seconds();
+		tc_worker_pool_free(&pool);
+		snprintf(name, sizeof(name), "Pool SHA-256, 1024 bytes, %u threads", threads);
+		bench_report(name, POOL_DIGESTS, bytes, seconds);
+	}
+}
+
+#endif
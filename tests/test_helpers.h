@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -9,6 +11,10 @@ extern "C"
 	void reset_global_data(void);
 	void crypto_slot_management_reset_global_data(void);
 
+	bool alloc_counter_supported(void);
+	void alloc_counter_reset(void);
+	size_t alloc_counter_get(void);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
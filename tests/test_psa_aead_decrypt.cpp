@@ -0,0 +1,324 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+
+// RFC 3610 section 8: all packet vectors share the key C0..CF, and the
+// first header_length bytes of the packet are the additional data.
+static const uint8_t rfc3610_key[16] = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+										0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+
+// RFC 3610 packet vector #1
+static const uint8_t packet1_nonce[13] = {0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00,
+										  0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+static const uint8_t packet1_ciphertext[31] = {
+	0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66, 0xd0, 0xc2, 0xc0, 0xf9, 0x89, 0x80,
+	0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84, 0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0};
+
+// McGrew and Viega GCM test case 4: 20 bytes of additional data and 60 bytes
+// of plaintext, followed by the 16-byte tag.
+static const uint8_t gcm_key[16] = {
+	0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08};
+static const uint8_t gcm_iv[12] = {
+	0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+static const uint8_t gcm_ad[20] = {
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+	0xab, 0xad, 0xda, 0xd2};
+static const uint8_t gcm_plaintext[60] = {
+	0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+	0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+	0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+	0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39};
+static const uint8_t gcm_ciphertext[76] = {
+	0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7, 0x84, 0xd0, 0xd4, 0x9c,
+	0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0, 0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e,
+	0x21, 0xd5, 0x14, 0xb2, 0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+	0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91, 0x5b, 0xc9, 0x4f, 0xbc,
+	0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a, 0xe7, 0x12, 0x1a, 0x47};
+
+// RFC 8439 section 2.8.2: ChaCha20-Poly1305 AEAD encryption of the
+// "sunscreen" plaintext.
+static const uint8_t chachapoly_key[32] = {
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f};
+static const uint8_t chachapoly_nonce[12] = {
+	0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+static const uint8_t chachapoly_aad[12] = {
+	0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7};
+static const uint8_t chachapoly_plaintext[114] = {
+	0x4c, 0x61, 0x64, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x47, 0x65, 0x6e, 0x74, 0x6c,
+	0x65, 0x6d, 0x65, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73,
+	0x73, 0x20, 0x6f, 0x66, 0x20, 0x27, 0x39, 0x39, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x49, 0x20, 0x63,
+	0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x66, 0x65, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6f,
+	0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x69, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x75, 0x6e, 0x73,
+	0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69,
+	0x74, 0x2e};
+static const uint8_t chachapoly_ciphertext[130] = {
+	0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2,
+	0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe, 0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6,
+	0x3d, 0xbe, 0xa4, 0x5e, 0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+	0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36,
+	0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c, 0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58,
+	0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+	0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce, 0xc6, 0x4b,
+	0x61, 0x16, 0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60,
+	0x06, 0x91};
+
+class PsaAeadDecrypt : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+		for(size_t i = 0; i < sizeof(packet); i++)
+			packet[i] = (uint8_t)i;
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportCcmKey(psa_algorithm_t alg)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, alg);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, 128);
+		psa_status_t status = psa_import_key(&attributes, rfc3610_key, sizeof(rfc3610_key), &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	psa_key_id_t ImportGcmKey(psa_algorithm_t alg)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, alg);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, 128);
+		psa_status_t status = psa_import_key(&attributes, gcm_key, sizeof(gcm_key), &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	psa_key_id_t ImportChaChaPolyKey()
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, PSA_ALG_CHACHA20_POLY1305);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_CHACHA20);
+		psa_set_key_bits(&attributes, 256);
+		psa_status_t status =
+			psa_import_key(&attributes, chachapoly_key, sizeof(chachapoly_key), &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	// The packets are the byte sequence 00 01 02 ...
+	uint8_t packet[32];
+};
+
+TEST_F(PsaAeadDecrypt, CcmPacketVector1)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8);
+	psa_key_id_t key_id = ImportCcmKey(alg);
+	uint8_t plaintext[23];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(key_id, alg, packet1_nonce, sizeof(packet1_nonce), packet,
+										   8, packet1_ciphertext, sizeof(packet1_ciphertext),
+										   plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(plaintext_length, 23);
+	EXPECT_EQ(memcmp(plaintext, packet + 8, 23), 0);
+}
+
+// RFC 3610 packet vector #7: 10-byte tag
+TEST_F(PsaAeadDecrypt, CcmPacketVector7)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 10);
+	const uint8_t nonce[13] = {0x00, 0x00, 0x00, 0x09, 0x08, 0x07, 0x06,
+							   0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+	const uint8_t ciphertext[33] = {0x01, 0x35, 0xd1, 0xb2, 0xc9, 0x5f, 0x41, 0xd5, 0xd1,
+									0xd4, 0xfe, 0xc1, 0x85, 0xd1, 0x66, 0xb8, 0x09, 0x4e,
+									0x99, 0x9d, 0xfe, 0xd9, 0x6c, 0x04, 0x8c, 0x56, 0x60,
+									0x2c, 0x97, 0xac, 0xbb, 0x74, 0x90};
+	psa_key_id_t key_id = ImportCcmKey(alg);
+	uint8_t plaintext[23];
+	size_t plaintext_length = 0;
+	psa_status_t status =
+		psa_aead_decrypt(key_id, alg, nonce, sizeof(nonce), packet, 8, ciphertext,
+						 sizeof(ciphertext), plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(plaintext_length, 23);
+	EXPECT_EQ(memcmp(plaintext, packet + 8, 23), 0);
+}
+
+TEST_F(PsaAeadDecrypt, CcmTamperedTagWipesPlaintext)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8);
+	uint8_t ciphertext[sizeof(packet1_ciphertext)];
+	memcpy(ciphertext, packet1_ciphertext, sizeof(ciphertext));
+	ciphertext[sizeof(ciphertext) - 1] ^= 0x01;
+
+	psa_key_id_t key_id = ImportCcmKey(alg);
+	uint8_t plaintext[23];
+	uint8_t zeros[23] = {0};
+	size_t plaintext_length = 0;
+	psa_status_t status =
+		psa_aead_decrypt(key_id, alg, packet1_nonce, sizeof(packet1_nonce), packet, 8, ciphertext,
+						 sizeof(ciphertext), plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+	EXPECT_EQ(memcmp(plaintext, zeros, sizeof(zeros)), 0);
+}
+
+TEST_F(PsaAeadDecrypt, CcmTamperedAdditionalData)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8);
+	packet[0] ^= 0x80;
+
+	psa_key_id_t key_id = ImportCcmKey(alg);
+	uint8_t plaintext[23];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(key_id, alg, packet1_nonce, sizeof(packet1_nonce), packet,
+										   8, packet1_ciphertext, sizeof(packet1_ciphertext),
+										   plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_F(PsaAeadDecrypt, CcmCiphertextShorterThanTag)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8);
+	psa_key_id_t key_id = ImportCcmKey(alg);
+	uint8_t plaintext[8];
+	size_t plaintext_length = 0;
+	psa_status_t status =
+		psa_aead_decrypt(key_id, alg, packet1_nonce, sizeof(packet1_nonce), packet, 8,
+						 packet1_ciphertext, 7, plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(PsaAeadDecrypt, CcmBufferTooSmall)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8);
+	psa_key_id_t key_id = ImportCcmKey(alg);
+	uint8_t plaintext[22];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(key_id, alg, packet1_nonce, sizeof(packet1_nonce), packet,
+										   8, packet1_ciphertext, sizeof(packet1_ciphertext),
+										   plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(PsaAeadDecrypt, GcmTestCase4)
+{
+	psa_key_id_t key_id = ImportGcmKey(PSA_ALG_GCM);
+	uint8_t plaintext[60];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(key_id, PSA_ALG_GCM, gcm_iv, sizeof(gcm_iv), gcm_ad,
+										   sizeof(gcm_ad), gcm_ciphertext, sizeof(gcm_ciphertext),
+										   plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(plaintext_length, 60);
+	EXPECT_EQ(memcmp(plaintext, gcm_plaintext, 60), 0);
+}
+
+// GCM test case 4 with the tag truncated to 8 bytes
+TEST_F(PsaAeadDecrypt, GcmTruncatedTag)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_GCM, 8);
+	psa_key_id_t key_id = ImportGcmKey(alg);
+	uint8_t plaintext[60];
+	size_t plaintext_length = 0;
+	psa_status_t status =
+		psa_aead_decrypt(key_id, alg, gcm_iv, sizeof(gcm_iv), gcm_ad, sizeof(gcm_ad),
+						 gcm_ciphertext, 68, plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(plaintext_length, 60);
+	EXPECT_EQ(memcmp(plaintext, gcm_plaintext, 60), 0);
+}
+
+TEST_F(PsaAeadDecrypt, GcmTamperedTagWipesPlaintext)
+{
+	uint8_t ciphertext[sizeof(gcm_ciphertext)];
+	memcpy(ciphertext, gcm_ciphertext, sizeof(ciphertext));
+	ciphertext[sizeof(ciphertext) - 1] ^= 0x80;
+
+	psa_key_id_t key_id = ImportGcmKey(PSA_ALG_GCM);
+	uint8_t plaintext[60];
+	uint8_t zeros[60] = {0};
+	size_t plaintext_length = 0;
+	psa_status_t status =
+		psa_aead_decrypt(key_id, PSA_ALG_GCM, gcm_iv, sizeof(gcm_iv), gcm_ad, sizeof(gcm_ad),
+						 ciphertext, sizeof(ciphertext), plaintext, sizeof(plaintext),
+						 &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+	EXPECT_EQ(memcmp(plaintext, zeros, sizeof(zeros)), 0);
+}
+
+TEST_F(PsaAeadDecrypt, GcmTamperedAdditionalData)
+{
+	uint8_t ad[sizeof(gcm_ad)];
+	memcpy(ad, gcm_ad, sizeof(ad));
+	ad[19] ^= 0x01;
+
+	psa_key_id_t key_id = ImportGcmKey(PSA_ALG_GCM);
+	uint8_t plaintext[60];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(key_id, PSA_ALG_GCM, gcm_iv, sizeof(gcm_iv), ad,
+										   sizeof(ad), gcm_ciphertext, sizeof(gcm_ciphertext),
+										   plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_F(PsaAeadDecrypt, ChaChaPolyRfc8439)
+{
+	psa_key_id_t key_id = ImportChaChaPolyKey();
+	uint8_t plaintext[sizeof(chachapoly_plaintext)];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(
+		key_id, PSA_ALG_CHACHA20_POLY1305, chachapoly_nonce, sizeof(chachapoly_nonce),
+		chachapoly_aad, sizeof(chachapoly_aad), chachapoly_ciphertext,
+		sizeof(chachapoly_ciphertext), plaintext, sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(plaintext_length, sizeof(chachapoly_plaintext));
+	EXPECT_EQ(memcmp(plaintext, chachapoly_plaintext, sizeof(chachapoly_plaintext)), 0);
+}
+
+TEST_F(PsaAeadDecrypt, ChaChaPolyTamperedTagWipesPlaintext)
+{
+	uint8_t ciphertext[sizeof(chachapoly_ciphertext)];
+	memcpy(ciphertext, chachapoly_ciphertext, sizeof(ciphertext));
+	ciphertext[sizeof(ciphertext) - 16] ^= 0x01;
+
+	psa_key_id_t key_id = ImportChaChaPolyKey();
+	uint8_t plaintext[sizeof(chachapoly_plaintext)];
+	uint8_t zeros[sizeof(chachapoly_plaintext)] = {0};
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(
+		key_id, PSA_ALG_CHACHA20_POLY1305, chachapoly_nonce, sizeof(chachapoly_nonce),
+		chachapoly_aad, sizeof(chachapoly_aad), ciphertext, sizeof(ciphertext), plaintext,
+		sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+	EXPECT_EQ(memcmp(plaintext, zeros, sizeof(zeros)), 0);
+}
+
+TEST_F(PsaAeadDecrypt, ChaChaPolyTamperedCiphertext)
+{
+	uint8_t ciphertext[sizeof(chachapoly_ciphertext)];
+	memcpy(ciphertext, chachapoly_ciphertext, sizeof(ciphertext));
+	ciphertext[0] ^= 0x80;
+
+	psa_key_id_t key_id = ImportChaChaPolyKey();
+	uint8_t plaintext[sizeof(chachapoly_plaintext)];
+	size_t plaintext_length = 0;
+	psa_status_t status = psa_aead_decrypt(
+		key_id, PSA_ALG_CHACHA20_POLY1305, chachapoly_nonce, sizeof(chachapoly_nonce),
+		chachapoly_aad, sizeof(chachapoly_aad), ciphertext, sizeof(ciphertext), plaintext,
+		sizeof(plaintext), &plaintext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+}
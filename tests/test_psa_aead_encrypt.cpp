@@ -0,0 +1,439 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+
+// RFC 3610 section 8: all packet vectors share the key C0..CF, and the
+// first header_length bytes of the packet are the additional data.
+static const uint8_t rfc3610_key[16] = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+										0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+
+// McGrew and Viega, "The Galois/Counter Mode of Operation (GCM)", test
+// cases 3 to 6 share this key and plaintext; 4 to 6 also use the additional
+// data and the first 60 bytes of the plaintext.
+static const uint8_t gcm_key[16] = {
+	0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08};
+static const uint8_t gcm_plaintext[64] = {
+	0xd9, 0x31, 0x32, 0x25, 0xf8, 0x84, 0x06, 0xe5, 0xa5, 0x59, 0x09, 0xc5, 0xaf, 0xf5, 0x26, 0x9a,
+	0x86, 0xa7, 0xa9, 0x53, 0x15, 0x34, 0xf7, 0xda, 0x2e, 0x4c, 0x30, 0x3d, 0x8a, 0x31, 0x8a, 0x72,
+	0x1c, 0x3c, 0x0c, 0x95, 0x95, 0x68, 0x09, 0x53, 0x2f, 0xcf, 0x0e, 0x24, 0x49, 0xa6, 0xb5, 0x25,
+	0xb1, 0x6a, 0xed, 0xf5, 0xaa, 0x0d, 0xe6, 0x57, 0xba, 0x63, 0x7b, 0x39, 0x1a, 0xaf, 0xd2, 0x55};
+static const uint8_t gcm_ad[20] = {
+	0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef, 0xfe, 0xed, 0xfa, 0xce, 0xde, 0xad, 0xbe, 0xef,
+	0xab, 0xad, 0xda, 0xd2};
+
+// RFC 8439 section 2.8.2: ChaCha20-Poly1305 AEAD encryption of the
+// "sunscreen" plaintext.
+static const uint8_t chachapoly_key[32] = {
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f};
+static const uint8_t chachapoly_nonce[12] = {
+	0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+static const uint8_t chachapoly_aad[12] = {
+	0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7};
+static const uint8_t chachapoly_plaintext[114] = {
+	0x4c, 0x61, 0x64, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x47, 0x65, 0x6e, 0x74, 0x6c,
+	0x65, 0x6d, 0x65, 0x6e, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73,
+	0x73, 0x20, 0x6f, 0x66, 0x20, 0x27, 0x39, 0x39, 0x3a, 0x20, 0x49, 0x66, 0x20, 0x49, 0x20, 0x63,
+	0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x66, 0x65, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6f,
+	0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x74, 0x69, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20,
+	0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x75, 0x6e, 0x73,
+	0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x77, 0x6f, 0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69,
+	0x74, 0x2e};
+static const uint8_t chachapoly_ciphertext[130] = {
+	0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2,
+	0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe, 0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6,
+	0x3d, 0xbe, 0xa4, 0x5e, 0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+	0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36,
+	0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c, 0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58,
+	0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+	0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce, 0xc6, 0x4b,
+	0x61, 0x16, 0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60,
+	0x06, 0x91};
+
+class PsaAeadEncrypt : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportCcmKey(psa_algorithm_t alg)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, alg);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, 128);
+		psa_status_t status = psa_import_key(&attributes, rfc3610_key, sizeof(rfc3610_key), &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	// The packets are the byte sequence 00 01 02 ... of the given length.
+	void EncryptPacket(psa_algorithm_t alg, const uint8_t nonce[13], size_t header_length,
+					   size_t packet_length, const uint8_t* expected, size_t expected_length)
+	{
+		uint8_t packet[33];
+		for(size_t i = 0; i < packet_length; i++)
+			packet[i] = (uint8_t)i;
+
+		psa_key_id_t key_id = ImportCcmKey(alg);
+		uint8_t ciphertext[48];
+		size_t ciphertext_length = 0;
+		psa_status_t status = psa_aead_encrypt(key_id, alg, nonce, 13, packet, header_length,
+											   packet + header_length, packet_length - header_length,
+											   ciphertext, sizeof(ciphertext), &ciphertext_length);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		EXPECT_EQ(ciphertext_length, expected_length);
+		EXPECT_EQ(memcmp(ciphertext, expected, expected_length), 0);
+	}
+	psa_key_id_t ImportGcmKey(psa_algorithm_t alg, const uint8_t* key, size_t key_bits = 128)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, alg);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, key_bits);
+		psa_status_t status = psa_import_key(&attributes, key, key_bits / 8, &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	psa_key_id_t ImportChaChaPolyKey()
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&attributes, PSA_ALG_CHACHA20_POLY1305);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_CHACHA20);
+		psa_set_key_bits(&attributes, 256);
+		psa_status_t status =
+			psa_import_key(&attributes, chachapoly_key, sizeof(chachapoly_key), &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	void EncryptGcm(psa_algorithm_t alg, const uint8_t* key, const uint8_t* iv, size_t iv_length,
+					const uint8_t* ad, size_t ad_length, const uint8_t* plaintext,
+					size_t plaintext_length, const uint8_t* expected, size_t expected_length,
+					size_t key_bits = 128)
+	{
+		psa_key_id_t key_id = ImportGcmKey(alg, key, key_bits);
+		uint8_t ciphertext[80];
+		size_t ciphertext_length = 0;
+		psa_status_t status =
+			psa_aead_encrypt(key_id, alg, iv, iv_length, ad, ad_length, plaintext, plaintext_length,
+							 ciphertext, sizeof(ciphertext), &ciphertext_length);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		EXPECT_EQ(ciphertext_length, expected_length);
+		EXPECT_EQ(memcmp(ciphertext, expected, expected_length), 0);
+	}
+};
+
+// RFC 3610 packet vector #1
+TEST_F(PsaAeadEncrypt, CcmPacketVector1)
+{
+	const uint8_t nonce[13] = {0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00,
+							   0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+	const uint8_t expected[31] = {0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66, 0xd0,
+								  0xc2, 0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3,
+								  0x84, 0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0};
+	EncryptPacket(PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8), nonce, 8, 31, expected,
+				  sizeof(expected));
+}
+
+// RFC 3610 packet vector #2
+TEST_F(PsaAeadEncrypt, CcmPacketVector2)
+{
+	const uint8_t nonce[13] = {0x00, 0x00, 0x00, 0x04, 0x03, 0x02, 0x01,
+							   0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+	const uint8_t expected[32] = {0x72, 0xc9, 0x1a, 0x36, 0xe1, 0x35, 0xf8, 0xcf, 0x29, 0x1c, 0xa8,
+								  0x94, 0x08, 0x5c, 0x87, 0xe3, 0xcc, 0x15, 0xc4, 0x39, 0xc9, 0xe4,
+								  0x3a, 0x3b, 0xa0, 0x91, 0xd5, 0x6e, 0x10, 0x40, 0x09, 0x16};
+	EncryptPacket(PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8), nonce, 8, 32, expected,
+				  sizeof(expected));
+}
+
+// RFC 3610 packet vector #3
+TEST_F(PsaAeadEncrypt, CcmPacketVector3)
+{
+	const uint8_t nonce[13] = {0x00, 0x00, 0x00, 0x05, 0x04, 0x03, 0x02,
+							   0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+	const uint8_t expected[33] = {0x51, 0xb1, 0xe5, 0xf4, 0x4a, 0x19, 0x7d, 0x1d, 0xa4,
+								  0x6b, 0x0f, 0x8e, 0x2d, 0x28, 0x2a, 0xe8, 0x71, 0xe8,
+								  0x38, 0xbb, 0x64, 0xda, 0x85, 0x96, 0x57, 0x4a, 0xda,
+								  0xa7, 0x6f, 0xbd, 0x9f, 0xb0, 0xc5};
+	EncryptPacket(PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8), nonce, 8, 33, expected,
+				  sizeof(expected));
+}
+
+// RFC 3610 packet vector #4: 12 bytes of additional data
+TEST_F(PsaAeadEncrypt, CcmPacketVector4)
+{
+	const uint8_t nonce[13] = {0x00, 0x00, 0x00, 0x06, 0x05, 0x04, 0x03,
+							   0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+	const uint8_t expected[27] = {0xa2, 0x8c, 0x68, 0x65, 0x93, 0x9a, 0x9a, 0x79, 0xfa,
+								  0xaa, 0x5c, 0x4c, 0x2a, 0x9d, 0x4a, 0x91, 0xcd, 0xac,
+								  0x8c, 0x96, 0xc8, 0x61, 0xb9, 0xc9, 0xe6, 0x1e, 0xf1};
+	EncryptPacket(PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 8), nonce, 12, 31, expected,
+				  sizeof(expected));
+}
+
+// RFC 3610 packet vector #7: 10-byte tag
+TEST_F(PsaAeadEncrypt, CcmPacketVector7)
+{
+	const uint8_t nonce[13] = {0x00, 0x00, 0x00, 0x09, 0x08, 0x07, 0x06,
+							   0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5};
+	const uint8_t expected[33] = {0x01, 0x35, 0xd1, 0xb2, 0xc9, 0x5f, 0x41, 0xd5, 0xd1,
+								  0xd4, 0xfe, 0xc1, 0x85, 0xd1, 0x66, 0xb8, 0x09, 0x4e,
+								  0x99, 0x9d, 0xfe, 0xd9, 0x6c, 0x04, 0x8c, 0x56, 0x60,
+								  0x2c, 0x97, 0xac, 0xbb, 0x74, 0x90};
+	EncryptPacket(PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, 10), nonce, 8, 31, expected,
+				  sizeof(expected));
+}
+
+TEST_F(PsaAeadEncrypt, CcmBufferTooSmall)
+{
+	const uint8_t nonce[13] = {0};
+	const uint8_t plaintext[16] = {0};
+	psa_key_id_t key_id = ImportCcmKey(PSA_ALG_CCM);
+	uint8_t ciphertext[16 + 15];
+	size_t ciphertext_length = 0;
+	psa_status_t status =
+		psa_aead_encrypt(key_id, PSA_ALG_CCM, nonce, sizeof(nonce), NULL, 0, plaintext,
+						 sizeof(plaintext), ciphertext, sizeof(ciphertext), &ciphertext_length);
+	EXPECT_EQ(status, PSA_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(PsaAeadEncrypt, CcmInvalidNonceLength)
+{
+	const uint8_t nonce[14] = {0};
+	const uint8_t plaintext[16] = {0};
+	psa_key_id_t key_id = ImportCcmKey(PSA_ALG_CCM);
+	uint8_t ciphertext[32];
+	size_t ciphertext_length = 0;
+	psa_status_t status =
+		psa_aead_encrypt(key_id, PSA_ALG_CCM, nonce, sizeof(nonce), NULL, 0, plaintext,
+						 sizeof(plaintext), ciphertext, sizeof(ciphertext), &ciphertext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_ARGUMENT);
+}
+
+// GCM test case 1: all-zero key and IV, no data at all
+TEST_F(PsaAeadEncrypt, GcmTestCase1)
+{
+	const uint8_t key[16] = {0};
+	const uint8_t iv[12] = {0};
+	const uint8_t expected[16] = {
+		0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61, 0x36, 0x7f, 0x1d, 0x57,
+		0xa4, 0xe7, 0x45, 0x5a};
+	EncryptGcm(PSA_ALG_GCM, key, iv, sizeof(iv), NULL, 0, NULL, 0, expected, sizeof(expected));
+}
+
+// GCM test case 2: one block of zeros
+TEST_F(PsaAeadEncrypt, GcmTestCase2)
+{
+	const uint8_t key[16] = {0};
+	const uint8_t iv[12] = {0};
+	const uint8_t plaintext[16] = {0};
+	const uint8_t expected[32] = {
+		0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9,
+		0x71, 0xb2, 0xfe, 0x78, 0xab, 0x6e, 0x47, 0xd4, 0x2c, 0xec, 0x13, 0xbd,
+		0xf5, 0x3a, 0x67, 0xb2, 0x12, 0x57, 0xbd, 0xdf};
+	EncryptGcm(PSA_ALG_GCM, key, iv, sizeof(iv), NULL, 0, plaintext, sizeof(plaintext), expected,
+			   sizeof(expected));
+}
+
+// GCM test case 3: four whole blocks, no additional data
+TEST_F(PsaAeadEncrypt, GcmTestCase3)
+{
+	const uint8_t iv[12] = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+	const uint8_t expected[80] = {
+		0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7,
+		0x84, 0xd0, 0xd4, 0x9c, 0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+		0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e, 0x21, 0xd5, 0x14, 0xb2,
+		0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+		0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91,
+		0x47, 0x3f, 0x59, 0x85, 0x4d, 0x5c, 0x2a, 0xf3, 0x27, 0xcd, 0x64, 0xa6,
+		0x2c, 0xf3, 0x5a, 0xbd, 0x2b, 0xa6, 0xfa, 0xb4};
+	EncryptGcm(PSA_ALG_GCM, gcm_key, iv, sizeof(iv), NULL, 0, gcm_plaintext,
+			   sizeof(gcm_plaintext), expected, sizeof(expected));
+}
+
+// GCM test case 4: partial final block and 20 bytes of additional data
+TEST_F(PsaAeadEncrypt, GcmTestCase4)
+{
+	const uint8_t iv[12] = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+	const uint8_t expected[76] = {
+		0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7,
+		0x84, 0xd0, 0xd4, 0x9c, 0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+		0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e, 0x21, 0xd5, 0x14, 0xb2,
+		0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+		0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91,
+		0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a,
+		0xe7, 0x12, 0x1a, 0x47};
+	EncryptGcm(PSA_ALG_GCM, gcm_key, iv, sizeof(iv), gcm_ad, sizeof(gcm_ad), gcm_plaintext,
+			   60, expected, sizeof(expected));
+}
+
+// GCM test case 5: 8-byte IV, which is hashed into the counter block
+TEST_F(PsaAeadEncrypt, GcmTestCase5)
+{
+	const uint8_t iv[8] = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad};
+	const uint8_t expected[76] = {
+		0x61, 0x35, 0x3b, 0x4c, 0x28, 0x06, 0x93, 0x4a, 0x77, 0x7f, 0xf5, 0x1f,
+		0xa2, 0x2a, 0x47, 0x55, 0x69, 0x9b, 0x2a, 0x71, 0x4f, 0xcd, 0xc6, 0xf8,
+		0x37, 0x66, 0xe5, 0xf9, 0x7b, 0x6c, 0x74, 0x23, 0x73, 0x80, 0x69, 0x00,
+		0xe4, 0x9f, 0x24, 0xb2, 0x2b, 0x09, 0x75, 0x44, 0xd4, 0x89, 0x6b, 0x42,
+		0x49, 0x89, 0xb5, 0xe1, 0xeb, 0xac, 0x0f, 0x07, 0xc2, 0x3f, 0x45, 0x98,
+		0x36, 0x12, 0xd2, 0xe7, 0x9e, 0x3b, 0x07, 0x85, 0x56, 0x1b, 0xe1, 0x4a,
+		0xac, 0xa2, 0xfc, 0xcb};
+	EncryptGcm(PSA_ALG_GCM, gcm_key, iv, sizeof(iv), gcm_ad, sizeof(gcm_ad), gcm_plaintext,
+			   60, expected, sizeof(expected));
+}
+
+// GCM test case 6: 60-byte IV
+TEST_F(PsaAeadEncrypt, GcmTestCase6)
+{
+	const uint8_t iv[60] = {
+		0x93, 0x13, 0x22, 0x5d, 0xf8, 0x84, 0x06, 0xe5, 0x55, 0x90, 0x9c, 0x5a,
+		0xff, 0x52, 0x69, 0xaa, 0x6a, 0x7a, 0x95, 0x38, 0x53, 0x4f, 0x7d, 0xa1,
+		0xe4, 0xc3, 0x03, 0xd2, 0xa3, 0x18, 0xa7, 0x28, 0xc3, 0xc0, 0xc9, 0x51,
+		0x56, 0x80, 0x95, 0x39, 0xfc, 0xf0, 0xe2, 0x42, 0x9a, 0x6b, 0x52, 0x54,
+		0x16, 0xae, 0xdb, 0xf5, 0xa0, 0xde, 0x6a, 0x57, 0xa6, 0x37, 0xb3, 0x9b};
+	const uint8_t expected[76] = {
+		0x8c, 0xe2, 0x49, 0x98, 0x62, 0x56, 0x15, 0xb6, 0x03, 0xa0, 0x33, 0xac,
+		0xa1, 0x3f, 0xb8, 0x94, 0xbe, 0x91, 0x12, 0xa5, 0xc3, 0xa2, 0x11, 0xa8,
+		0xba, 0x26, 0x2a, 0x3c, 0xca, 0x7e, 0x2c, 0xa7, 0x01, 0xe4, 0xa9, 0xa4,
+		0xfb, 0xa4, 0x3c, 0x90, 0xcc, 0xdc, 0xb2, 0x81, 0xd4, 0x8c, 0x7c, 0x6f,
+		0xd6, 0x28, 0x75, 0xd2, 0xac, 0xa4, 0x17, 0x03, 0x4c, 0x34, 0xae, 0xe5,
+		0x61, 0x9c, 0xc5, 0xae, 0xff, 0xfe, 0x0b, 0xfa, 0x46, 0x2a, 0xf4, 0x3c,
+		0x16, 0x99, 0xd0, 0x50};
+	EncryptGcm(PSA_ALG_GCM, gcm_key, iv, sizeof(iv), gcm_ad, sizeof(gcm_ad), gcm_plaintext,
+			   60, expected, sizeof(expected));
+}
+
+// GCM test case 13: AES-256, empty plaintext
+TEST_F(PsaAeadEncrypt, GcmTestCase13)
+{
+	const uint8_t key[32] = {0};
+	const uint8_t iv[12] = {0};
+	const uint8_t expected[16] = {
+		0x53, 0x0f, 0x8a, 0xfb, 0xc7, 0x45, 0x36, 0xb9, 0xa9, 0x63, 0xb4, 0xf1,
+		0xc4, 0xcb, 0x73, 0x8b};
+	EncryptGcm(PSA_ALG_GCM, key, iv, sizeof(iv), NULL, 0, NULL, 0, expected, sizeof(expected), 256);
+}
+
+// GCM test case 14: AES-256, one block of zeros
+TEST_F(PsaAeadEncrypt, GcmTestCase14)
+{
+	const uint8_t key[32] = {0};
+	const uint8_t iv[12] = {0};
+	const uint8_t plaintext[16] = {0};
+	const uint8_t expected[32] = {
+		0xce, 0xa7, 0x40, 0x3d, 0x4d, 0x60, 0x6b, 0x6e, 0x07, 0x4e, 0xc5, 0xd3,
+		0xba, 0xf3, 0x9d, 0x18, 0xd0, 0xd1, 0xc8, 0xa7, 0x99, 0x99, 0x6b, 0xf0,
+		0x26, 0x5b, 0x98, 0xb5, 0xd4, 0x8a, 0xb9, 0x19};
+	EncryptGcm(PSA_ALG_GCM, key, iv, sizeof(iv), NULL, 0, plaintext, sizeof(plaintext), expected,
+			   sizeof(expected), 256);
+}
+
+// GCM test case 16: AES-256, partial final block and additional data
+TEST_F(PsaAeadEncrypt, GcmTestCase16)
+{
+	const uint8_t key[32] = {
+		0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c, 0x6d, 0x6a, 0x8f, 0x94,
+		0x67, 0x30, 0x83, 0x08, 0xfe, 0xff, 0xe9, 0x92, 0x86, 0x65, 0x73, 0x1c,
+		0x6d, 0x6a, 0x8f, 0x94, 0x67, 0x30, 0x83, 0x08};
+	const uint8_t iv[12] = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+	const uint8_t expected[76] = {
+		0x52, 0x2d, 0xc1, 0xf0, 0x99, 0x56, 0x7d, 0x07, 0xf4, 0x7f, 0x37, 0xa3,
+		0x2a, 0x84, 0x42, 0x7d, 0x64, 0x3a, 0x8c, 0xdc, 0xbf, 0xe5, 0xc0, 0xc9,
+		0x75, 0x98, 0xa2, 0xbd, 0x25, 0x55, 0xd1, 0xaa, 0x8c, 0xb0, 0x8e, 0x48,
+		0x59, 0x0d, 0xbb, 0x3d, 0xa7, 0xb0, 0x8b, 0x10, 0x56, 0x82, 0x88, 0x38,
+		0xc5, 0xf6, 0x1e, 0x63, 0x93, 0xba, 0x7a, 0x0a, 0xbc, 0xc9, 0xf6, 0x62,
+		0x76, 0xfc, 0x6e, 0xce, 0x0f, 0x4e, 0x17, 0x68, 0xcd, 0xdf, 0x88, 0x53,
+		0xbb, 0x2d, 0x55, 0x1b};
+	EncryptGcm(PSA_ALG_GCM, key, iv, sizeof(iv), gcm_ad, sizeof(gcm_ad), gcm_plaintext, 60,
+			   expected, sizeof(expected), 256);
+}
+
+// GCM test case 4 with the tag truncated to 12 bytes
+TEST_F(PsaAeadEncrypt, GcmTruncatedTag)
+{
+	const uint8_t iv[12] = {0xca, 0xfe, 0xba, 0xbe, 0xfa, 0xce, 0xdb, 0xad, 0xde, 0xca, 0xf8, 0x88};
+	const uint8_t expected[72] = {
+		0x42, 0x83, 0x1e, 0xc2, 0x21, 0x77, 0x74, 0x24, 0x4b, 0x72, 0x21, 0xb7,
+		0x84, 0xd0, 0xd4, 0x9c, 0xe3, 0xaa, 0x21, 0x2f, 0x2c, 0x02, 0xa4, 0xe0,
+		0x35, 0xc1, 0x7e, 0x23, 0x29, 0xac, 0xa1, 0x2e, 0x21, 0xd5, 0x14, 0xb2,
+		0x54, 0x66, 0x93, 0x1c, 0x7d, 0x8f, 0x6a, 0x5a, 0xac, 0x84, 0xaa, 0x05,
+		0x1b, 0xa3, 0x0b, 0x39, 0x6a, 0x0a, 0xac, 0x97, 0x3d, 0x58, 0xe0, 0x91,
+		0x5b, 0xc9, 0x4f, 0xbc, 0x32, 0x21, 0xa5, 0xdb, 0x94, 0xfa, 0xe9, 0x5a};
+	EncryptGcm(PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_GCM, 12), gcm_key, iv, sizeof(iv), gcm_ad,
+			   sizeof(gcm_ad), gcm_plaintext, 60, expected, sizeof(expected));
+}
+
+TEST_F(PsaAeadEncrypt, GcmEmptyNonce)
+{
+	psa_key_id_t key_id = ImportGcmKey(PSA_ALG_GCM, gcm_key);
+	uint8_t ciphertext[80];
+	size_t ciphertext_length = 0;
+	psa_status_t status =
+		psa_aead_encrypt(key_id, PSA_ALG_GCM, gcm_ad, 0, NULL, 0, gcm_plaintext,
+						 sizeof(gcm_plaintext), ciphertext, sizeof(ciphertext), &ciphertext_length);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(PsaAeadEncrypt, ChaChaPolyRfc8439)
+{
+	psa_key_id_t key_id = ImportChaChaPolyKey();
+	uint8_t ciphertext[sizeof(chachapoly_ciphertext)];
+	size_t ciphertext_length = 0;
+	psa_status_t status = psa_aead_encrypt(
+		key_id, PSA_ALG_CHACHA20_POLY1305, chachapoly_nonce, sizeof(chachapoly_nonce),
+		chachapoly_aad, sizeof(chachapoly_aad), chachapoly_plaintext, sizeof(chachapoly_plaintext),
+		ciphertext, sizeof(ciphertext), &ciphertext_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(ciphertext_length, sizeof(chachapoly_ciphertext));
+	EXPECT_EQ(memcmp(ciphertext, chachapoly_ciphertext, sizeof(chachapoly_ciphertext)), 0);
+}
+
+TEST_F(PsaAeadEncrypt, ChaChaPolyEightByteNonceNotSupported)
+{
+	psa_key_id_t key_id = ImportChaChaPolyKey();
+	uint8_t ciphertext[sizeof(chachapoly_ciphertext)];
+	size_t ciphertext_length = 0;
+	psa_status_t status = psa_aead_encrypt(
+		key_id, PSA_ALG_CHACHA20_POLY1305, chachapoly_nonce, 8, chachapoly_aad,
+		sizeof(chachapoly_aad), chachapoly_plaintext, sizeof(chachapoly_plaintext), ciphertext,
+		sizeof(ciphertext), &ciphertext_length);
+	EXPECT_EQ(status, PSA_ERROR_NOT_SUPPORTED);
+}
+
+TEST_F(PsaAeadEncrypt, ChaChaPolyShortenedTagNotSupported)
+{
+	const psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CHACHA20_POLY1305, 8);
+	psa_key_id_t key_id = 0;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+	psa_set_key_algorithm(&attributes, alg);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_CHACHA20);
+	psa_set_key_bits(&attributes, 256);
+	ASSERT_EQ(psa_import_key(&attributes, chachapoly_key, sizeof(chachapoly_key), &key_id),
+			  PSA_SUCCESS);
+
+	uint8_t ciphertext[sizeof(chachapoly_ciphertext)];
+	size_t ciphertext_length = 0;
+	psa_status_t status = psa_aead_encrypt(
+		key_id, alg, chachapoly_nonce, sizeof(chachapoly_nonce), chachapoly_aad,
+		sizeof(chachapoly_aad), chachapoly_plaintext, sizeof(chachapoly_plaintext), ciphertext,
+		sizeof(ciphertext), &ciphertext_length);
+	EXPECT_NE(status, PSA_SUCCESS);
+}
@@ -2,6 +2,36 @@
 #include "test_helpers.h"
 #include <gtest/gtest.h>
 
+// SP 800-38A F.1: the ECB-AES vectors, which share one plaintext.
+static const uint8_t sp800_38a_plaintext[64] = {
+	0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a,
+	0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51,
+	0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+	0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10};
+static const uint8_t sp800_38a_ecb_key128[16] = {
+	0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+static const uint8_t sp800_38a_ecb_ciphertext128[64] = {
+	0x3a, 0xd7, 0x7b, 0xb4, 0x0d, 0x7a, 0x36, 0x60, 0xa8, 0x9e, 0xca, 0xf3, 0x24, 0x66, 0xef, 0x97,
+	0xf5, 0xd3, 0xd5, 0x85, 0x03, 0xb9, 0x69, 0x9d, 0xe7, 0x85, 0x89, 0x5a, 0x96, 0xfd, 0xba, 0xaf,
+	0x43, 0xb1, 0xcd, 0x7f, 0x59, 0x8e, 0xce, 0x23, 0x88, 0x1b, 0x00, 0xe3, 0xed, 0x03, 0x06, 0x88,
+	0x7b, 0x0c, 0x78, 0x5e, 0x27, 0xe8, 0xad, 0x3f, 0x82, 0x23, 0x20, 0x71, 0x04, 0x72, 0x5d, 0xd4};
+static const uint8_t sp800_38a_ecb_key192[24] = {
+	0x8e, 0x73, 0xb0, 0xf7, 0xda, 0x0e, 0x64, 0x52, 0xc8, 0x10, 0xf3, 0x2b, 0x80, 0x90, 0x79, 0xe5,
+	0x62, 0xf8, 0xea, 0xd2, 0x52, 0x2c, 0x6b, 0x7b};
+static const uint8_t sp800_38a_ecb_ciphertext192[64] = {
+	0xbd, 0x33, 0x4f, 0x1d, 0x6e, 0x45, 0xf2, 0x5f, 0xf7, 0x12, 0xa2, 0x14, 0x57, 0x1f, 0xa5, 0xcc,
+	0x97, 0x41, 0x04, 0x84, 0x6d, 0x0a, 0xd3, 0xad, 0x77, 0x34, 0xec, 0xb3, 0xec, 0xee, 0x4e, 0xef,
+	0xef, 0x7a, 0xfd, 0x22, 0x70, 0xe2, 0xe6, 0x0a, 0xdc, 0xe0, 0xba, 0x2f, 0xac, 0xe6, 0x44, 0x4e,
+	0x9a, 0x4b, 0x41, 0xba, 0x73, 0x8d, 0x6c, 0x72, 0xfb, 0x16, 0x69, 0x16, 0x03, 0xc1, 0x8e, 0x0e};
+static const uint8_t sp800_38a_ecb_key256[32] = {
+	0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+	0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4};
+static const uint8_t sp800_38a_ecb_ciphertext256[64] = {
+	0xf3, 0xee, 0xd1, 0xbd, 0xb5, 0xd2, 0xa0, 0x3c, 0x06, 0x4b, 0x5a, 0x7e, 0x3d, 0xb1, 0x81, 0xf8,
+	0x59, 0x1c, 0xcb, 0x10, 0xd4, 0x10, 0xed, 0x26, 0xdc, 0x5b, 0xa7, 0x4a, 0x31, 0x36, 0x28, 0x70,
+	0xb6, 0xed, 0x21, 0xb9, 0x9c, 0xa6, 0xf4, 0xf9, 0xf1, 0x53, 0xe7, 0xb1, 0xbe, 0xaf, 0xed, 0x1d,
+	0x23, 0x30, 0x4b, 0x7a, 0x39, 0xf9, 0xf3, 0xff, 0x06, 0x7d, 0x8d, 0x8f, 0x9e, 0x24, 0xec, 0xc7};
+
 class PsaCipherDecrypt : public ::testing::Test
 {
   protected:
@@ -14,6 +44,27 @@ class PsaCipherDecrypt : public ::testing::Test
 		crypto_slot_management_reset_global_data();
 	}
 
+	void EcbDecryptVector(const uint8_t* key, size_t key_bits, const uint8_t* input,
+						  const uint8_t* expected)
+	{
+		uint8_t output[64] = {0};
+		size_t output_length = 0;
+		psa_crypto_init();
+		psa_key_handle_t key_handle = 0;
+		psa_key_attributes_t key_attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&key_attributes, PSA_KEY_USAGE_DECRYPT);
+		psa_set_key_algorithm(&key_attributes, PSA_ALG_ECB_NO_PADDING);
+		psa_set_key_type(&key_attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&key_attributes, key_bits);
+		psa_status_t status = psa_import_key(&key_attributes, key, key_bits / 8, &key_handle);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		status = psa_cipher_decrypt(key_handle, PSA_ALG_ECB_NO_PADDING, input, sizeof(output),
+									output, sizeof(output), &output_length);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		EXPECT_EQ(output_length, sizeof(output));
+		EXPECT_EQ(memcmp(output, expected, sizeof(output)), 0);
+	}
+
 	const uint8_t aes_cbc_key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
 									 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
 	const uint8_t aes_ctr_key[16] = {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -139,4 +190,19 @@ TEST_F(PsaCipherDecrypt, Success)
 	EXPECT_EQ(status, PSA_SUCCESS);
 	EXPECT_EQ(output_length, sizeof(msg));
 	EXPECT_EQ(memcmp(msg_buf, msg, sizeof(msg)), 0);
-}
\ No newline at end of file
+}
+
+TEST_F(PsaCipherDecrypt, EcbAes128Vectors)
+{
+	EcbDecryptVector(sp800_38a_ecb_key128, 128, sp800_38a_ecb_ciphertext128, sp800_38a_plaintext);
+}
+
+TEST_F(PsaCipherDecrypt, EcbAes192Vectors)
+{
+	EcbDecryptVector(sp800_38a_ecb_key192, 192, sp800_38a_ecb_ciphertext192, sp800_38a_plaintext);
+}
+
+TEST_F(PsaCipherDecrypt, EcbAes256Vectors)
+{
+	EcbDecryptVector(sp800_38a_ecb_key256, 256, sp800_38a_ecb_ciphertext256, sp800_38a_plaintext);
+}
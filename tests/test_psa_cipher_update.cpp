@@ -109,4 +109,85 @@ TEST_F(PsaCipherUpdate, MultipleUpdates)
 							   sizeof(output) - block_size, &output_length);
 	EXPECT_EQ(status, PSA_SUCCESS);
 	EXPECT_EQ(output_length, block_size);
-}
\ No newline at end of file
+}
+TEST_F(PsaCipherUpdate, InterleavedOperationsWithDifferentKeys)
+{
+	const uint8_t other_key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+								   0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+	uint8_t iv[16] = {0};
+	uint8_t input[32] = {0};
+	uint8_t expected[32] = {0};
+	uint8_t output[32] = {0};
+	uint8_t other_output[16] = {0};
+	size_t output_length = 0;
+
+	// Reference run: the fixture operation alone
+	psa_status_t status =
+		psa_cipher_update(&operation, input, sizeof(input), expected, sizeof(expected),
+						  &output_length);
+	ASSERT_EQ(status, PSA_SUCCESS);
+	psa_cipher_abort(&operation);
+
+	psa_key_handle_t other_handle = 0;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+	psa_set_key_algorithm(&attributes, PSA_ALG_CTR);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attributes, 128);
+	status = psa_import_key(&attributes, other_key, sizeof(other_key), &other_handle);
+	ASSERT_EQ(status, PSA_SUCCESS);
+
+	psa_cipher_operation_t first = PSA_CIPHER_OPERATION_INIT;
+	psa_cipher_operation_t second = PSA_CIPHER_OPERATION_INIT;
+	ASSERT_EQ(psa_cipher_encrypt_setup(&first, key_handle, PSA_ALG_CTR), PSA_SUCCESS);
+	ASSERT_EQ(psa_cipher_set_iv(&first, iv, sizeof(iv)), PSA_SUCCESS);
+	ASSERT_EQ(psa_cipher_update(&first, input, 16, output, 16, &output_length), PSA_SUCCESS);
+
+	// Setting up and running a second operation must not disturb the first one
+	ASSERT_EQ(psa_cipher_encrypt_setup(&second, other_handle, PSA_ALG_CTR), PSA_SUCCESS);
+	ASSERT_EQ(psa_cipher_set_iv(&second, iv, sizeof(iv)), PSA_SUCCESS);
+	ASSERT_EQ(psa_cipher_update(&second, input, 16, other_output, 16, &output_length),
+			  PSA_SUCCESS);
+
+	ASSERT_EQ(psa_cipher_update(&first, input + 16, 16, output + 16, 16, &output_length),
+			  PSA_SUCCESS);
+	EXPECT_EQ(memcmp(output, expected, sizeof(expected)), 0);
+	EXPECT_NE(memcmp(other_output, expected, sizeof(other_output)), 0);
+
+	psa_cipher_abort(&first);
+	psa_cipher_abort(&second);
+}
+
+// RFC 8439 appendix A.1, test vector #1: all-zero key and nonce, counter 0.
+TEST_F(PsaCipherUpdate, ChaCha20Keystream)
+{
+	const uint8_t key[32] = {0};
+	const uint8_t nonce[12] = {0};
+	const uint8_t expected[64] = {
+		0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a, 0xe5,
+		0x53, 0x86, 0xbd, 0x28, 0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d, 0xed, 0x1a,
+		0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7, 0xda, 0x41, 0x59, 0x7c,
+		0x51, 0x57, 0x48, 0x8d, 0x77, 0x24, 0xe0, 0x3f, 0xb8, 0xd8, 0x4a, 0x37,
+		0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1, 0x1c, 0xc3, 0x87, 0xb6, 0x69,
+		0xb2, 0xee, 0x65, 0x86};
+	uint8_t zeros[64] = {0};
+	uint8_t output[64];
+	size_t output_length = 0;
+	psa_key_id_t key_id = 0;
+	psa_cipher_operation_t chacha = PSA_CIPHER_OPERATION_INIT;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+	psa_set_key_algorithm(&attributes, PSA_ALG_STREAM_CIPHER);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_CHACHA20);
+	psa_set_key_bits(&attributes, 256);
+	ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &key_id), PSA_SUCCESS);
+
+	ASSERT_EQ(psa_cipher_encrypt_setup(&chacha, key_id, PSA_ALG_STREAM_CIPHER), PSA_SUCCESS);
+	ASSERT_EQ(psa_cipher_set_iv(&chacha, nonce, sizeof(nonce)), PSA_SUCCESS);
+	ASSERT_EQ(psa_cipher_update(&chacha, zeros, sizeof(zeros), output, sizeof(output),
+								&output_length),
+			  PSA_SUCCESS);
+	EXPECT_EQ(output_length, sizeof(output));
+	EXPECT_EQ(memcmp(output, expected, sizeof(expected)), 0);
+	psa_cipher_abort(&chacha);
+}
@@ -49,6 +49,29 @@ class PsaExportPublicKey : public ::testing::Test
 		ASSERT_EQ(status, PSA_SUCCESS);
 	}
 
+	void ExpectPublicKey(psa_ecc_family_t family, std::string priv_str, std::string pub_str)
+	{
+		psa_key_id_t key = 0;
+		psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+		uint8_t priv[32] = {};
+		uint8_t expected[65] = {};
+		uint8_t buffer[65] = {};
+		size_t buffer_size = 0;
+		hex_string_to_byte_array(priv_str, priv, sizeof(priv));
+		hex_string_to_byte_array(pub_str, expected, sizeof(expected));
+
+		psa_crypto_init();
+		psa_set_key_algorithm(&attr, PSA_ALG_ECDSA_ANY);
+		psa_set_key_type(&attr, PSA_KEY_TYPE_ECC_KEY_PAIR(family));
+		psa_set_key_bits(&attr, 256);
+		psa_set_key_lifetime(&attr, PSA_KEY_LIFETIME_VOLATILE);
+		ASSERT_EQ(psa_import_key(&attr, priv, sizeof(priv), &key), PSA_SUCCESS);
+		ASSERT_EQ(psa_export_public_key(key, buffer, sizeof(buffer), &buffer_size), PSA_SUCCESS);
+		EXPECT_EQ(buffer_size, sizeof(expected));
+		EXPECT_EQ(memcmp(buffer, expected, sizeof(expected)), 0) << priv_str;
+		psa_destroy_key(key);
+	}
+
 	void hex_string_to_byte_array(std::string& in, uint8_t* out, size_t size)
 	{
 		std::string hex = in;
@@ -118,4 +141,61 @@ TEST_F(PsaExportPublicKey, EccKey)
 	EXPECT_EQ(status, PSA_SUCCESS);
 	EXPECT_EQ(buffer_size, sizeof(public_key));
 	EXPECT_EQ(memcmp(buffer, public_key, sizeof(public_key)), 0);
-}
\ No newline at end of file
+}
+// Private keys at the edges of the scalar range exercise the carries and the
+// sign handling of the fixed-base generator multiplication.
+TEST_F(PsaExportPublicKey, EccKeyEdgeScalarsSecpR1)
+{
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_R1,
+					"0000000000000000000000000000000000000000000000000000000000000003",
+					"045ecbe4d1a6330a44c8f7ef951d4bf165e6c6b721efada985fb41661bc6e7fd6c"
+					"8734640c4998ff7e374b06ce1a64a2ecd82ab036384fb83d9a79b127a27d5032");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_R1,
+					"0000000000000000000000000000000000000000000000000000000000000002",
+					"047cf27b188d034f7e8a52380304b51ac3c08969e277f21b35a60b48fc47669978"
+					"07775510db8ed040293d9ac69f7430dbba7dade63ce982299e04b79d227873d1");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_R1,
+					"ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc63254e",
+					"045ecbe4d1a6330a44c8f7ef951d4bf165e6c6b721efada985fb41661bc6e7fd6c"
+					"78cb9bf2b6670082c8b4f931e59b5d1327d54fcac7b047c265864ed85d82afcd");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_R1,
+					"ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc63254d",
+					"04e2534a3532d08fbba02dde659ee62bd0031fe2db785596ef509302446b030852"
+					"1f0ea8a4b39cc339e62011a02579d289b103693d0cf11ffaa3bd3dc0e7b12739");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_R1,
+					"8000000000000000000000000000000000000000000000000000000000000001",
+					"04f808033c1c060c40db4b76f8c62dc8f16aa316952da3d54cfac436f9f815161a"
+					"4cf4e7923c8fcc355ebbaeddaf2661d1a83cbf836a675a3fe979cc8646a8bf72");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_R1,
+					"5555555555555555555555555555555555555555555555555555555555555555",
+					"0457e977f6db7e33c3fe7acf2842ed987009caf56d458682fca447b7d3d762ab34"
+					"c5ab3770ba573bdff5414065640ffb5b346dfa84dec4db4d68e5f59cc471c2ec");
+}
+
+TEST_F(PsaExportPublicKey, EccKeyEdgeScalarsSecpK1)
+{
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_K1,
+					"0000000000000000000000000000000000000000000000000000000000000003",
+					"04f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9"
+					"388f7b0f632de8140fe337e62a37f3566500a99934c2231b6cb9fd7584b8e672");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_K1,
+					"0000000000000000000000000000000000000000000000000000000000000002",
+					"04c6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5"
+					"1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_K1,
+					"fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd036413e",
+					"04f9308a019258c31049344f85f89d5229b531c845836f99b08601f113bce036f9"
+					"c77084f09cd217ebf01cc819d5c80ca99aff5666cb3ddce4934602897b4715bd");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_K1,
+					"fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd036413d",
+					"04e493dbf1c10d80f3581e4904930b1404cc6c13900ee0758474fa94abe8c4cd13"
+					"ae1266c15f2baa48a9bd1df6715aebb7269851cc404201bf30168422b88c630d");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_K1,
+					"8000000000000000000000000000000000000000000000000000000000000001",
+					"04885f71c4561e1733119c66fce72d2209771e096a8305ff8fd36a405afbcbbe10"
+					"0887d9db657cf382a6fef4f8269fe0f754c3c33a0c5c87b8f4d006db0392d260");
+	ExpectPublicKey(PSA_ECC_FAMILY_SECP_K1,
+					"5555555555555555555555555555555555555555555555555555555555555555",
+					"049ac20335eb38768d2052be1dbbc3c8f6178407458e51e6b4ad22f1d91758895b"
+					"af102a603fa09b366705fd727757a5abd614410a6e3f802ab8da8dfe84289d64");
+}
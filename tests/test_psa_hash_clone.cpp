@@ -65,4 +65,44 @@ TEST_F(PsaHashClone, ClonesOperation)
 	EXPECT_EQ(status, PSA_SUCCESS);
 	EXPECT_EQ(clone_hash_length, 32);
 	EXPECT_EQ(memcmp(hash, clone_hash, 32), 0);
-}
\ No newline at end of file
+}
+TEST_F(PsaHashClone, DoesNotAllocate)
+{
+	if(!alloc_counter_supported())
+		GTEST_SKIP() << "Allocation counting is not available on this platform";
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	psa_hash_operation_t clone = PSA_HASH_OPERATION_INIT;
+	psa_crypto_init();
+	psa_hash_setup(&operation, PSA_ALG_SHA_256);
+	psa_hash_update(&operation, (const uint8_t*)"test", 4);
+	alloc_counter_reset();
+	psa_status_t status = psa_hash_clone(&operation, &clone);
+	psa_hash_abort(&operation);
+	psa_hash_abort(&clone);
+	size_t allocations = alloc_counter_get();
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(allocations, 0);
+}
+
+TEST_F(PsaHashClone, CloneOutlivesAbortedSource)
+{
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	psa_hash_operation_t clone = PSA_HASH_OPERATION_INIT;
+	psa_crypto_init();
+	psa_hash_setup(&operation, PSA_ALG_SHA_256);
+	psa_hash_update(&operation, (const uint8_t*)"te", 2);
+	psa_status_t status = psa_hash_clone(&operation, &clone);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	psa_hash_abort(&operation);
+	status = psa_hash_update(&clone, (const uint8_t*)"st", 2);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	uint8_t hash[32];
+	size_t hash_length = 0;
+	status = psa_hash_finish(&clone, hash, sizeof(hash), &hash_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	// SHA-256("test")
+	const uint8_t expected[32] = {0x9f, 0x86, 0xd0, 0x81, 0x88, 0x4c, 0x7d, 0x65, 0x9a, 0x2f, 0xea,
+								  0xa0, 0xc5, 0x5a, 0xd0, 0x15, 0xa3, 0xbf, 0x4f, 0x1b, 0x2b, 0x0b,
+								  0x82, 0x2c, 0xd1, 0x5d, 0x6c, 0x15, 0xb0, 0xf0, 0x0a, 0x08};
+	EXPECT_EQ(memcmp(hash, expected, sizeof(expected)), 0);
+}
@@ -35,4 +35,23 @@ TEST_F(PsaHashSetup, NotAHashAlgorithm)
 	psa_crypto_init();
 	psa_status_t status = psa_hash_setup(&operation, PSA_ALG_CBC_NO_PADDING);
 	EXPECT_EQ(status, PSA_ERROR_INVALID_ARGUMENT);
-}
\ No newline at end of file
+}
+
+TEST_F(PsaHashSetup, DoesNotAllocate)
+{
+	if(!alloc_counter_supported())
+		GTEST_SKIP() << "Allocation counting is not available on this platform";
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	uint8_t hash[32];
+	size_t hash_length = 0;
+	psa_crypto_init();
+	alloc_counter_reset();
+	psa_status_t setup_status = psa_hash_setup(&operation, PSA_ALG_SHA_256);
+	psa_status_t update_status = psa_hash_update(&operation, (const uint8_t*)"test", 4);
+	psa_status_t finish_status = psa_hash_finish(&operation, hash, sizeof(hash), &hash_length);
+	size_t allocations = alloc_counter_get();
+	EXPECT_EQ(setup_status, PSA_SUCCESS);
+	EXPECT_EQ(update_status, PSA_SUCCESS);
+	EXPECT_EQ(finish_status, PSA_SUCCESS);
+	EXPECT_EQ(allocations, 0);
+}
@@ -58,3 +58,34 @@ TEST_F(PsaHashUpdate, Ok)
 	status = psa_hash_update(&operation, (const uint8_t*)"abc", 3);
 	EXPECT_EQ(status, PSA_SUCCESS);
 }
+
+TEST_F(PsaHashUpdate, UnalignedChunksMatchOneMillionA)
+{
+	// FIPS 180-2 test vector: SHA-256 of one million 'a' characters
+	const uint8_t expected[32] = {0xcd, 0xc7, 0x6e, 0x5c, 0x99, 0x14, 0xfb, 0x92, 0x81, 0xa1, 0xc7,
+								  0xe2, 0x84, 0xd7, 0x3e, 0x67, 0xf1, 0x80, 0x9a, 0x48, 0xa4, 0x97,
+								  0x20, 0x0e, 0x04, 0x6d, 0x39, 0xcc, 0xc7, 0x11, 0x2c, 0xd0};
+	const size_t chunk_sizes[] = {1, 63, 64, 65, 127, 128, 200, 4096};
+	static uint8_t input[4096];
+	memset(input, 'a', sizeof(input));
+
+	psa_hash_operation_t operation = PSA_HASH_OPERATION_INIT;
+	psa_crypto_init();
+	ASSERT_EQ(psa_hash_setup(&operation, PSA_ALG_SHA_256), PSA_SUCCESS);
+
+	size_t remaining = 1000000;
+	for(size_t i = 0; remaining > 0; i++)
+	{
+		size_t chunk = chunk_sizes[i % (sizeof(chunk_sizes) / sizeof(chunk_sizes[0]))];
+		if(chunk > remaining)
+			chunk = remaining;
+		ASSERT_EQ(psa_hash_update(&operation, input, chunk), PSA_SUCCESS);
+		remaining -= chunk;
+	}
+
+	uint8_t hash[32] = {0};
+	size_t hash_length = 0;
+	ASSERT_EQ(psa_hash_finish(&operation, hash, sizeof(hash), &hash_length), PSA_SUCCESS);
+	EXPECT_EQ(hash_length, sizeof(expected));
+	EXPECT_EQ(memcmp(hash, expected, sizeof(expected)), 0);
+}
@@ -130,7 +130,12 @@ TEST_F(PsaImportKey, PersistentKey)
 	psa_set_key_bits(&attr, 128);
 	psa_set_key_lifetime(&attr, PSA_KEY_LIFETIME_PERSISTENT);
 	psa_status_t status = psa_import_key(&attr, data, sizeof(data), &key);
+#if defined(IOTEX_PSA_CRYPTO_STORAGE_C)
+	// A persistent key needs an identifier
+	EXPECT_EQ(status, PSA_ERROR_INVALID_ARGUMENT);
+#else
 	EXPECT_EQ(status, PSA_ERROR_NOT_SUPPORTED);
+#endif
 }
 
 TEST_F(PsaImportKey, VolatileKey)
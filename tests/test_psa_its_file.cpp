@@ -0,0 +1,323 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <algorithm>
+#include <dirent.h>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdlib.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+extern "C"
+{
+#include "include/svc/crypto/psa_crypto_its.h"
+}
+
+#if defined(IOTEX_PSA_ITS_FILE_C)
+
+// Every test gets a directory of its own for the ITS files
+class PsaItsFile : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		char path[] = "/tmp/psa_its_XXXXXX";
+		ASSERT_NE(mkdtemp(path), nullptr);
+		directory = path;
+		ASSERT_EQ(iotex_psa_its_file_set_location(directory.c_str()), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		EXPECT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+		for(const std::string& name : Files())
+			remove((directory + "/" + name).c_str());
+		rmdir(directory.c_str());
+		iotex_psa_its_file_set_location(NULL);
+	}
+
+	std::vector<std::string> Files()
+	{
+		std::vector<std::string> names;
+		DIR* dir = opendir(directory.c_str());
+		for(struct dirent* entry = readdir(dir); entry != NULL; entry = readdir(dir))
+		{
+			if(entry->d_name[0] != '.')
+				names.push_back(entry->d_name);
+		}
+		closedir(dir);
+		return names;
+	}
+
+	std::string ReadFile(const std::string& name)
+	{
+		std::ifstream file(directory + "/" + name, std::ios::binary);
+		return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	}
+
+	std::string Get(psa_storage_uid_t uid)
+	{
+		struct psa_storage_info_t info;
+		size_t length = 0;
+
+		if(psa_its_get_info(uid, &info) != PSA_SUCCESS)
+			return "<none>";
+		std::string data(info.size, '\0');
+		EXPECT_EQ(psa_its_get(uid, 0, info.size, &data[0], &length), PSA_SUCCESS);
+		EXPECT_EQ(length, info.size);
+		return data;
+	}
+
+	std::string directory;
+};
+
+TEST_F(PsaItsFile, SetGetRemove)
+{
+	static const char data[] = "key material";
+	struct psa_storage_info_t info;
+	char part[4];
+	size_t length;
+
+	EXPECT_EQ(psa_its_get_info(5, &info), PSA_ERROR_DOES_NOT_EXIST);
+	ASSERT_EQ(psa_its_set(5, sizeof(data), data, PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	ASSERT_EQ(psa_its_get_info(5, &info), PSA_SUCCESS);
+	EXPECT_EQ(info.size, sizeof(data));
+	EXPECT_EQ(info.flags, (psa_storage_create_flags_t)PSA_STORAGE_FLAG_NONE);
+	EXPECT_EQ(Files(), std::vector<std::string>{"0000000000000005.psa_its"});
+
+	ASSERT_EQ(psa_its_get(5, 4, sizeof(part), part, &length), PSA_SUCCESS);
+	EXPECT_EQ(std::string(part, length), "mate");
+	EXPECT_EQ(psa_its_get(5, 10, sizeof(part), part, &length), PSA_ERROR_INVALID_ARGUMENT);
+
+	EXPECT_EQ(psa_its_remove(5), PSA_SUCCESS);
+	EXPECT_EQ(psa_its_get_info(5, &info), PSA_ERROR_DOES_NOT_EXIST);
+	EXPECT_EQ(psa_its_remove(5), PSA_ERROR_DOES_NOT_EXIST);
+	EXPECT_TRUE(Files().empty());
+}
+
+// A new version replaces the old one whole, and leaves no temporary file
+TEST_F(PsaItsFile, Replace)
+{
+	ASSERT_EQ(psa_its_set(7, 3, "old", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	ASSERT_EQ(psa_its_set(7, 11, "new version", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	EXPECT_EQ(Get(7), "new version");
+	EXPECT_EQ(Files(), std::vector<std::string>{"0000000000000007.psa_its"});
+}
+
+TEST_F(PsaItsFile, Flags)
+{
+	EXPECT_EQ(psa_its_set(1, 4, "data", 0x100), PSA_ERROR_NOT_SUPPORTED);
+	ASSERT_EQ(psa_its_set(1, 4, "data", PSA_STORAGE_FLAG_WRITE_ONCE), PSA_SUCCESS);
+	EXPECT_EQ(psa_its_set(1, 4, "more", PSA_STORAGE_FLAG_NONE), PSA_ERROR_NOT_PERMITTED);
+	EXPECT_EQ(psa_its_remove(1), PSA_ERROR_NOT_PERMITTED);
+	EXPECT_EQ(Get(1), "data");
+}
+
+TEST_F(PsaItsFile, CorruptFile)
+{
+	struct psa_storage_info_t info;
+
+	std::ofstream(directory + "/0000000000000003.psa_its") << "garbage";
+	EXPECT_EQ(psa_its_get_info(3, &info), PSA_ERROR_DATA_CORRUPT);
+	EXPECT_EQ(psa_its_remove(3), PSA_SUCCESS);
+	EXPECT_TRUE(Files().empty());
+}
+
+// Until the batch is flushed the previous version stays in place, which is
+// what a restart after a crash would find; reads see the new data at once.
+TEST_F(PsaItsFile, BatchKeepsPreviousVersion)
+{
+	ASSERT_EQ(psa_its_set(2, 3, "old", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	std::string committed = ReadFile("0000000000000002.psa_its");
+
+	iotex_psa_its_file_begin_batch();
+	ASSERT_EQ(psa_its_set(2, 3, "new", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	ASSERT_EQ(psa_its_set(4, 5, "fresh", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	EXPECT_EQ(Get(2), "new");
+	EXPECT_EQ(Get(4), "fresh");
+	EXPECT_EQ(ReadFile("0000000000000002.psa_its"), committed);
+	EXPECT_EQ(Files().size(), 3u);
+
+	ASSERT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+	EXPECT_EQ(Get(2), "new");
+	EXPECT_EQ(Get(4), "fresh");
+	std::vector<std::string> files = Files();
+	std::sort(files.begin(), files.end());
+	EXPECT_EQ(files, (std::vector<std::string>{"0000000000000002.psa_its",
+											   "0000000000000004.psa_its"}));
+}
+
+TEST_F(PsaItsFile, BatchFlushesWhenFull)
+{
+	iotex_psa_its_file_begin_batch();
+	for(psa_storage_uid_t uid = 1; uid <= IOTEX_PSA_ITS_FILE_BATCH_SIZE; uid++)
+		ASSERT_EQ(psa_its_set(uid, 4, "data", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+
+	std::vector<std::string> files = Files();
+	EXPECT_EQ(files.size(), (size_t)IOTEX_PSA_ITS_FILE_BATCH_SIZE);
+	for(const std::string& name : files)
+		EXPECT_EQ(name.substr(name.size() - 8), ".psa_its");
+}
+
+// A directory in the way of the first entry makes its rename, and so the
+// automatic flush, fail. The write that triggered the flush fails and is
+// forgotten; the others stay pending and the batch never overflows.
+TEST_F(PsaItsFile, BatchFlushFails)
+{
+	const psa_storage_uid_t last = IOTEX_PSA_ITS_FILE_BATCH_SIZE;
+	const std::string blocker = directory + "/0000000000000001.psa_its";
+
+	ASSERT_EQ(mkdir(blocker.c_str(), 0700), 0);
+	iotex_psa_its_file_begin_batch();
+	for(psa_storage_uid_t uid = 1; uid < last; uid++)
+		ASSERT_EQ(psa_its_set(uid, 4, "data", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	EXPECT_EQ(psa_its_set(last, 4, "data", PSA_STORAGE_FLAG_NONE), PSA_ERROR_STORAGE_FAILURE);
+	EXPECT_EQ(Get(last), "<none>");
+	EXPECT_EQ(psa_its_set(last + 1, 4, "data", PSA_STORAGE_FLAG_NONE), PSA_ERROR_STORAGE_FAILURE);
+	EXPECT_EQ(Get(last + 1), "<none>");
+	EXPECT_EQ(Get(last - 1), "data");
+	EXPECT_EQ(iotex_psa_its_file_end_batch(), PSA_ERROR_STORAGE_FAILURE);
+
+	ASSERT_EQ(rmdir(blocker.c_str()), 0);
+	ASSERT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+	std::vector<std::string> files = Files();
+	EXPECT_EQ(files.size(), (size_t)last - 1);
+	for(const std::string& name : files)
+		EXPECT_EQ(name.substr(name.size() - 8), ".psa_its");
+	EXPECT_EQ(Get(1), "data");
+	EXPECT_EQ(Get(last), "<none>");
+}
+
+TEST_F(PsaItsFile, RemoveInBatch)
+{
+	ASSERT_EQ(psa_its_set(6, 3, "old", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	iotex_psa_its_file_begin_batch();
+	ASSERT_EQ(psa_its_set(6, 3, "new", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	ASSERT_EQ(psa_its_set(8, 3, "new", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	EXPECT_EQ(psa_its_remove(6), PSA_SUCCESS);
+	EXPECT_EQ(psa_its_remove(8), PSA_SUCCESS);
+	EXPECT_EQ(Get(6), "<none>");
+	EXPECT_EQ(Get(8), "<none>");
+	EXPECT_TRUE(Files().empty());
+	EXPECT_EQ(iotex_psa_its_file_set_location(NULL), PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_its_file_set_location(directory.c_str()), PSA_SUCCESS);
+}
+
+// With no write pending, flushing still syncs the removals
+TEST_F(PsaItsFile, FlushRemovals)
+{
+	ASSERT_EQ(psa_its_set(4, 4, "data", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	iotex_psa_its_file_begin_batch();
+	ASSERT_EQ(psa_its_remove(4), PSA_SUCCESS);
+	EXPECT_EQ(Get(4), "<none>");
+	EXPECT_TRUE(Files().empty());
+
+	// The directory cannot be synced while it is gone
+	ASSERT_EQ(rmdir(directory.c_str()), 0);
+	EXPECT_EQ(iotex_psa_its_file_flush(), PSA_ERROR_STORAGE_FAILURE);
+	EXPECT_EQ(iotex_psa_its_file_end_batch(), PSA_ERROR_STORAGE_FAILURE);
+	ASSERT_EQ(mkdir(directory.c_str(), 0700), 0);
+	EXPECT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_its_file_flush(), PSA_SUCCESS);
+}
+
+// The pending files must be renamed where they were written
+TEST_F(PsaItsFile, LocationIsFixedWhileBatching)
+{
+	iotex_psa_its_file_begin_batch();
+	ASSERT_EQ(psa_its_set(3, 4, "data", PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_its_file_set_location(NULL), PSA_ERROR_BAD_STATE);
+	EXPECT_EQ(iotex_psa_its_file_set_location("/tmp"), PSA_ERROR_BAD_STATE);
+	ASSERT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+	EXPECT_EQ(Files(), std::vector<std::string>{"0000000000000003.psa_its"});
+	EXPECT_EQ(iotex_psa_its_file_set_location(NULL), PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_its_file_set_location(directory.c_str()), PSA_SUCCESS);
+}
+
+	#if defined(IOTEX_PSA_CRYPTO_STORAGE_C)
+
+class PsaPersistentKey : public PsaItsFile
+{
+  protected:
+	void SetUp() override
+	{
+		PsaItsFile::SetUp();
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+		PsaItsFile::TearDown();
+	}
+
+	psa_status_t ImportKey(psa_key_id_t id, uint8_t fill)
+	{
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		uint8_t key[16];
+		psa_key_id_t key_id;
+
+		memset(key, fill, sizeof(key));
+		psa_set_key_id(&attributes, id);
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT | PSA_KEY_USAGE_EXPORT);
+		psa_set_key_algorithm(&attributes, PSA_ALG_CTR);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		return psa_import_key(&attributes, key, sizeof(key), &key_id);
+	}
+
+	void Restart()
+	{
+		iotex_psa_crypto_free();
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	}
+
+	void ExpectKey(psa_key_id_t id, uint8_t fill)
+	{
+		uint8_t key[16], expected[16];
+		size_t length;
+
+		memset(expected, fill, sizeof(expected));
+		ASSERT_EQ(psa_export_key(id, key, sizeof(key), &length), PSA_SUCCESS);
+		EXPECT_EQ(length, sizeof(key));
+		EXPECT_EQ(memcmp(key, expected, sizeof(key)), 0);
+	}
+};
+
+TEST_F(PsaPersistentKey, SurvivesRestart)
+{
+	const psa_key_id_t id = PSA_KEY_ID_USER_MIN + 1;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+
+	ASSERT_EQ(ImportKey(id, 0x5A), PSA_SUCCESS);
+	EXPECT_EQ(ImportKey(id, 0x5A), PSA_ERROR_ALREADY_EXISTS);
+	Restart();
+
+	ASSERT_EQ(psa_get_key_attributes(id, &attributes), PSA_SUCCESS);
+	EXPECT_EQ(psa_get_key_lifetime(&attributes), PSA_KEY_LIFETIME_PERSISTENT);
+	EXPECT_EQ(psa_get_key_type(&attributes), PSA_KEY_TYPE_AES);
+	EXPECT_EQ(psa_get_key_bits(&attributes), 128u);
+	ExpectKey(id, 0x5A);
+
+	EXPECT_EQ(psa_destroy_key(id), PSA_SUCCESS);
+	EXPECT_EQ(psa_get_key_attributes(id, &attributes), PSA_ERROR_INVALID_HANDLE);
+	EXPECT_TRUE(Files().empty());
+}
+
+TEST_F(PsaPersistentKey, BatchedCreation)
+{
+	iotex_psa_its_file_begin_batch();
+	for(uint8_t i = 0; i < 10; i++)
+		ASSERT_EQ(ImportKey(PSA_KEY_ID_USER_MIN + i, i), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_file_end_batch(), PSA_SUCCESS);
+	EXPECT_EQ(Files().size(), 10u);
+
+	Restart();
+	for(uint8_t i = 0; i < 10; i++)
+		ExpectKey(PSA_KEY_ID_USER_MIN + i, i);
+}
+
+	#endif /* IOTEX_PSA_CRYPTO_STORAGE_C */
+
+#endif /* IOTEX_PSA_ITS_FILE_C */
@@ -0,0 +1,407 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+extern "C"
+{
+#include "include/svc/crypto/psa_crypto_its.h"
+#include "include/svc/crypto/psa_its_flash_sim.h"
+}
+
+#if defined(IOTEX_PSA_ITS_FLASH_C) && defined(IOTEX_FS_IO)
+
+	#define FLASH_SECTOR_SIZE 512
+	#define FLASH_SECTOR_COUNT 4
+
+// Every test gets a simulated flash device of its own
+class PsaItsFlash : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		char name[] = "/tmp/psa_flash_XXXXXX";
+		int fd = mkstemp(name);
+		ASSERT_GE(fd, 0);
+		close(fd);
+		path = name;
+		Mount();
+	}
+	void TearDown() override
+	{
+		iotex_psa_its_flash_unmount();
+		iotex_psa_flash_sim_close(&sim);
+		remove(path.c_str());
+	}
+
+	void Mount()
+	{
+		ASSERT_EQ(iotex_psa_flash_sim_open(&sim, path.c_str(), FLASH_SECTOR_SIZE, FLASH_SECTOR_COUNT),
+				  PSA_SUCCESS);
+		ASSERT_EQ(iotex_psa_its_flash_mount(&sim.flash), PSA_SUCCESS);
+	}
+
+	// A power cycle: the index is rebuilt from the device
+	void Remount()
+	{
+		iotex_psa_its_flash_unmount();
+		iotex_psa_flash_sim_close(&sim);
+		Mount();
+	}
+
+	std::string Get(psa_storage_uid_t uid)
+	{
+		struct psa_storage_info_t info;
+		size_t length = 0;
+
+		if(iotex_psa_its_flash_get_info(uid, &info) != PSA_SUCCESS)
+			return "<none>";
+		std::string data(info.size, '\0');
+		EXPECT_EQ(iotex_psa_its_flash_get(uid, 0, info.size, &data[0], &length), PSA_SUCCESS);
+		EXPECT_EQ(length, info.size);
+		return data;
+	}
+
+	psa_status_t Set(psa_storage_uid_t uid, const std::string& data)
+	{
+		return iotex_psa_its_flash_set(uid, data.size(), data.data(), PSA_STORAGE_FLAG_NONE);
+	}
+
+	iotex_psa_its_flash_stats_t Stats()
+	{
+		iotex_psa_its_flash_stats_t stats;
+		EXPECT_EQ(iotex_psa_its_flash_get_stats(&stats), PSA_SUCCESS);
+		return stats;
+	}
+
+	std::string path;
+	iotex_psa_flash_sim_t sim;
+};
+
+TEST_F(PsaItsFlash, SetGetRemove)
+{
+	static const char data[] = "key material";
+	struct psa_storage_info_t info;
+	char part[4];
+	size_t length;
+
+	EXPECT_EQ(iotex_psa_its_flash_get_info(5, &info), PSA_ERROR_DOES_NOT_EXIST);
+	ASSERT_EQ(iotex_psa_its_flash_set(5, sizeof(data), data, PSA_STORAGE_FLAG_NONE), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_flash_get_info(5, &info), PSA_SUCCESS);
+	EXPECT_EQ(info.size, sizeof(data));
+	EXPECT_EQ(info.flags, (psa_storage_create_flags_t)PSA_STORAGE_FLAG_NONE);
+
+	ASSERT_EQ(iotex_psa_its_flash_get(5, 4, sizeof(part), part, &length), PSA_SUCCESS);
+	EXPECT_EQ(std::string(part, length), "mate");
+	EXPECT_EQ(iotex_psa_its_flash_get(5, 10, sizeof(part), part, &length),
+			  PSA_ERROR_INVALID_ARGUMENT);
+
+	EXPECT_EQ(iotex_psa_its_flash_remove(5), PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_its_flash_get_info(5, &info), PSA_ERROR_DOES_NOT_EXIST);
+	EXPECT_EQ(iotex_psa_its_flash_remove(5), PSA_ERROR_DOES_NOT_EXIST);
+	EXPECT_EQ(Stats().entries, 0u);
+}
+
+// Writes append to the log: nothing is erased until it wraps around
+TEST_F(PsaItsFlash, WritesDoNotErase)
+{
+	uint32_t formatted = sim.erases;
+
+	ASSERT_EQ(Set(1, "first"), PSA_SUCCESS);
+	ASSERT_EQ(Set(2, "second"), PSA_SUCCESS);
+	ASSERT_EQ(Set(1, "first, again"), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_flash_remove(2), PSA_SUCCESS);
+	EXPECT_EQ(sim.erases, formatted);
+	EXPECT_EQ(Stats().compactions, 0u);
+
+	Remount();
+	EXPECT_EQ(Get(1), "first, again");
+	EXPECT_EQ(Get(2), "<none>");
+	EXPECT_EQ(Stats().entries, 1u);
+}
+
+TEST_F(PsaItsFlash, Flags)
+{
+	EXPECT_EQ(iotex_psa_its_flash_set(1, 4, "data", 0x100), PSA_ERROR_NOT_SUPPORTED);
+	ASSERT_EQ(iotex_psa_its_flash_set(1, 4, "data", PSA_STORAGE_FLAG_WRITE_ONCE), PSA_SUCCESS);
+	EXPECT_EQ(Set(1, "more"), PSA_ERROR_NOT_PERMITTED);
+	EXPECT_EQ(iotex_psa_its_flash_remove(1), PSA_ERROR_NOT_PERMITTED);
+	Remount();
+	EXPECT_EQ(Get(1), "data");
+	EXPECT_EQ(iotex_psa_its_flash_remove(1), PSA_ERROR_NOT_PERMITTED);
+}
+
+TEST_F(PsaItsFlash, NotMounted)
+{
+	struct psa_storage_info_t info;
+	iotex_psa_its_flash_stats_t stats;
+
+	iotex_psa_its_flash_unmount();
+	EXPECT_EQ(Set(1, "data"), PSA_ERROR_BAD_STATE);
+	EXPECT_EQ(iotex_psa_its_flash_get_info(1, &info), PSA_ERROR_DOES_NOT_EXIST);
+	EXPECT_EQ(iotex_psa_its_flash_remove(1), PSA_ERROR_DOES_NOT_EXIST);
+	EXPECT_EQ(iotex_psa_its_flash_get_stats(&stats), PSA_ERROR_BAD_STATE);
+
+	iotex_psa_flash_t small = sim.flash;
+	small.sector_count = 1;
+	EXPECT_EQ(iotex_psa_its_flash_mount(&small), PSA_ERROR_INVALID_ARGUMENT);
+	ASSERT_EQ(iotex_psa_its_flash_mount(&sim.flash), PSA_SUCCESS);
+}
+
+// Rewriting a few entries over and over wraps the log many times. Every
+// sector takes its turn, so the erase counts stay level, and they survive
+// a power cycle.
+TEST_F(PsaItsFlash, CompactionLevelsWear)
+{
+	for(int round = 0; round < 300; round++)
+	{
+		for(psa_storage_uid_t uid = 1; uid <= 4; uid++)
+			ASSERT_EQ(Set(uid, "version " + std::to_string(round) + " of " + std::to_string(uid)),
+					  PSA_SUCCESS);
+	}
+	ASSERT_EQ(Set(9, "never changes"), PSA_SUCCESS);
+	for(int round = 0; round < 300; round++)
+		ASSERT_EQ(Set(1, "version " + std::to_string(round)), PSA_SUCCESS);
+
+	iotex_psa_its_flash_stats_t stats = Stats();
+	EXPECT_GT(stats.compactions, 20u);
+	EXPECT_EQ(stats.erases, sim.erases);
+	EXPECT_LE(stats.max_erase_count - stats.min_erase_count, 1u);
+	EXPECT_EQ(stats.entries, 5u);
+
+	Remount();
+	EXPECT_EQ(Get(1), "version 299");
+	EXPECT_EQ(Get(4), "version 299 of 4");
+	EXPECT_EQ(Get(9), "never changes");
+	iotex_psa_its_flash_stats_t after = Stats();
+	EXPECT_EQ(after.min_erase_count, stats.min_erase_count);
+	EXPECT_EQ(after.max_erase_count, stats.max_erase_count);
+	EXPECT_EQ(after.live_bytes, stats.live_bytes);
+}
+
+// A write that does not fit leaves the store as it was
+TEST_F(PsaItsFlash, Full)
+{
+	std::string big(400, 'x');
+	int stored = 0;
+
+	EXPECT_EQ(Set(100, std::string(FLASH_SECTOR_SIZE, 'y')), PSA_ERROR_INSUFFICIENT_STORAGE);
+	while(Set(stored + 1, big) == PSA_SUCCESS)
+		stored++;
+	EXPECT_EQ(stored, FLASH_SECTOR_COUNT - 1);
+	EXPECT_EQ(Set(stored + 1, big), PSA_ERROR_INSUFFICIENT_STORAGE);
+	for(int uid = 1; uid <= stored; uid++)
+		EXPECT_EQ(Get(uid), big);
+
+	// Replacing an entry or removing one still works
+	ASSERT_EQ(Set(1, "small"), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_flash_remove(2), PSA_SUCCESS);
+	ASSERT_EQ(Set(stored + 1, big), PSA_SUCCESS);
+	Remount();
+	EXPECT_EQ(Get(1), "small");
+	EXPECT_EQ(Get(2), "<none>");
+	EXPECT_EQ(Get(stored + 1), big);
+}
+
+TEST_F(PsaItsFlash, TooManyEntries)
+{
+	for(psa_storage_uid_t uid = 1; uid <= IOTEX_PSA_ITS_FLASH_MAX_ENTRIES; uid++)
+		ASSERT_EQ(Set(uid, "k"), PSA_SUCCESS);
+	EXPECT_EQ(Set(0, "k"), PSA_ERROR_INSUFFICIENT_STORAGE);
+	EXPECT_EQ(Set(1, "replaced"), PSA_SUCCESS);
+}
+
+// A power loss while a record is programmed leaves part of it on the
+// device; clearing bits of its data models that. The previous version
+// comes back and later writes go to a fresh sector.
+TEST_F(PsaItsFlash, TornWrite)
+{
+	ASSERT_EQ(Set(3, "committed"), PSA_SUCCESS);
+	ASSERT_EQ(Set(3, "cut short"), PSA_SUCCESS);
+	iotex_psa_its_flash_unmount();
+	iotex_psa_flash_sim_close(&sim);
+
+	std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+	std::string image((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	size_t at = image.find("cut short");
+	ASSERT_NE(at, std::string::npos);
+	file.seekp(at + 4);
+	file.put('\0');
+	file.close();
+
+	Mount();
+	EXPECT_EQ(Get(3), "committed");
+	ASSERT_EQ(Set(4, "after"), PSA_SUCCESS);
+	Remount();
+	EXPECT_EQ(Get(3), "committed");
+	EXPECT_EQ(Get(4), "after");
+}
+
+// Entries too large to share a sector: the end of each sector is lost.
+// Once full, a write is refused without wearing the device, and removing
+// an entry still works.
+TEST_F(PsaItsFlash, FullSectors)
+{
+	std::string big(460, 'x');
+
+	ASSERT_EQ(Set(1, big), PSA_SUCCESS);
+	ASSERT_EQ(Set(2, big), PSA_SUCCESS);
+	uint32_t erases = sim.erases;
+	EXPECT_EQ(Set(3, big), PSA_ERROR_INSUFFICIENT_STORAGE);
+	EXPECT_EQ(Set(3, big), PSA_ERROR_INSUFFICIENT_STORAGE);
+	EXPECT_EQ(sim.erases, erases);
+
+	ASSERT_EQ(iotex_psa_its_flash_remove(1), PSA_SUCCESS);
+	ASSERT_EQ(Set(3, big), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_flash_remove(2), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_flash_remove(3), PSA_SUCCESS);
+	Remount();
+	EXPECT_EQ(Stats().entries, 0u);
+}
+
+// A flash device whose next programs fail, after programming the first
+// word of each
+struct FailingFlash
+{
+	iotex_psa_flash_t flash;
+	iotex_psa_flash_sim_t* sim;
+	int failures;
+
+	static int Read(void* context, uint32_t address, void* data, size_t length)
+	{
+		FailingFlash* self = (FailingFlash*)context;
+		return self->sim->flash.read(self->sim, address, data, length);
+	}
+	static int Erase(void* context, uint32_t sector)
+	{
+		FailingFlash* self = (FailingFlash*)context;
+		return self->sim->flash.erase(self->sim, sector);
+	}
+	static int Program(void* context, uint32_t address, const void* data, size_t length)
+	{
+		FailingFlash* self = (FailingFlash*)context;
+
+		if(self->failures == 0)
+			return self->sim->flash.program(self->sim, address, data, length);
+		self->failures--;
+		if(length > 4)
+			self->sim->flash.program(self->sim, address, data, 4);
+		return -1;
+	}
+};
+
+// A record cut short by a failed program ends the scan of its sector at
+// the next mount: later writes must not go after it
+TEST_F(PsaItsFlash, ProgramFails)
+{
+	FailingFlash failing = {sim.flash, &sim, 0};
+	failing.flash.context = &failing;
+	failing.flash.read = FailingFlash::Read;
+	failing.flash.program = FailingFlash::Program;
+	failing.flash.erase = FailingFlash::Erase;
+	iotex_psa_its_flash_unmount();
+	ASSERT_EQ(iotex_psa_its_flash_mount(&failing.flash), PSA_SUCCESS);
+
+	ASSERT_EQ(Set(1, "first"), PSA_SUCCESS);
+	failing.failures = 1;
+	EXPECT_EQ(Set(2, "second"), PSA_ERROR_STORAGE_FAILURE);
+	EXPECT_EQ(Get(2), "<none>");
+	ASSERT_EQ(Set(3, "third"), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_its_flash_remove(1), PSA_SUCCESS);
+
+	Remount();
+	EXPECT_EQ(Get(1), "<none>");
+	EXPECT_EQ(Get(2), "<none>");
+	EXPECT_EQ(Get(3), "third");
+}
+
+// The simulated device refuses what real NOR flash cannot do
+TEST_F(PsaItsFlash, SimulatedDevice)
+{
+	uint8_t word[4] = {0xF0, 0xF0, 0xF0, 0xF0};
+	uint8_t back[4];
+	uint64_t busy = sim.busy_ns;
+
+	const uint32_t last = (FLASH_SECTOR_COUNT - 1) * FLASH_SECTOR_SIZE;
+	iotex_psa_its_flash_unmount();
+	EXPECT_EQ(sim.flash.program(sim.flash.context, last + 1, word, 4), -1);
+	EXPECT_EQ(sim.flash.program(sim.flash.context, last + FLASH_SECTOR_SIZE, word, 4), -1);
+	ASSERT_EQ(sim.flash.erase(sim.flash.context, FLASH_SECTOR_COUNT - 1), 0);
+	ASSERT_EQ(sim.flash.program(sim.flash.context, last, word, 4), 0);
+	// Programming a word again is refused, even if it only clears bits
+	word[0] = 0x00;
+	EXPECT_EQ(sim.flash.program(sim.flash.context, last, word, 4), -1);
+	EXPECT_EQ(sim.flash.program(sim.flash.context, last, word, 8), -1);
+	ASSERT_EQ(sim.flash.read(sim.flash.context, last, back, 4), 0);
+	EXPECT_EQ(back[0], 0xF0);
+	EXPECT_EQ(back[1], 0xF0);
+	EXPECT_EQ(sim.busy_ns - busy, sim.erase_time_us * 1000ull + 4 * sim.program_time_ns +
+										  4 * sim.read_time_ns);
+
+	// Even a word programmed to all ones, until the next erase
+	memset(word, 0xFF, sizeof(word));
+	ASSERT_EQ(sim.flash.program(sim.flash.context, last + 4, word, 4), 0);
+	EXPECT_EQ(sim.flash.program(sim.flash.context, last + 4, word, 4), -1);
+	ASSERT_EQ(sim.flash.erase(sim.flash.context, FLASH_SECTOR_COUNT - 1), 0);
+	ASSERT_EQ(sim.flash.program(sim.flash.context, last + 4, word, 4), 0);
+	word[0] = 0x00;
+	ASSERT_EQ(sim.flash.program(sim.flash.context, last, word, 4), 0);
+
+	// The damaged sector is formatted again at mount
+	ASSERT_EQ(iotex_psa_its_flash_mount(&sim.flash), PSA_SUCCESS);
+	ASSERT_EQ(Set(1, "data"), PSA_SUCCESS);
+	EXPECT_EQ(Get(1), "data");
+}
+
+	#if defined(IOTEX_PSA_CRYPTO_STORAGE_C) && !defined(IOTEX_PSA_ITS_FILE_C)
+
+// Persistent keys go to the flash store when it provides the PSA ITS
+class PsaFlashPersistentKey : public PsaItsFlash
+{
+  protected:
+	void SetUp() override
+	{
+		PsaItsFlash::SetUp();
+		ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+		PsaItsFlash::TearDown();
+	}
+};
+
+TEST_F(PsaFlashPersistentKey, SurvivesPowerCycle)
+{
+	const psa_key_id_t id = PSA_KEY_ID_USER_MIN + 1;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	uint8_t key[16], exported[16];
+	psa_key_id_t key_id;
+	size_t length;
+
+	memset(key, 0x5A, sizeof(key));
+	psa_set_key_id(&attributes, id);
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_EXPORT);
+	psa_set_key_algorithm(&attributes, PSA_ALG_CTR);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+	ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &key_id), PSA_SUCCESS);
+	EXPECT_EQ(Stats().entries, 1u);
+
+	iotex_psa_crypto_free();
+	Remount();
+	ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	ASSERT_EQ(psa_export_key(id, exported, sizeof(exported), &length), PSA_SUCCESS);
+	EXPECT_EQ(memcmp(exported, key, sizeof(key)), 0);
+
+	EXPECT_EQ(psa_destroy_key(id), PSA_SUCCESS);
+	EXPECT_EQ(Stats().entries, 0u);
+}
+
+	#endif /* IOTEX_PSA_CRYPTO_STORAGE_C && !IOTEX_PSA_ITS_FILE_C */
+
+#endif /* IOTEX_PSA_ITS_FLASH_C && IOTEX_FS_IO */
@@ -0,0 +1,67 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+
+class PsaKeyDerivationOutputBytes : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	uint8_t ikm[22] = {0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+					   0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b};
+};
+
+// RFC 5869 test case 1
+TEST_F(PsaKeyDerivationOutputBytes, HkdfSha256)
+{
+	const uint8_t salt[13] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+							  0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c};
+	const uint8_t info[10] = {0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9};
+	const uint8_t expected[42] = {0x3c, 0xb2, 0x5f, 0x25, 0xfa, 0xac, 0xd5, 0x7a, 0x90, 0x43, 0x4f,
+								  0x64, 0xd0, 0x36, 0x2f, 0x2a, 0x2d, 0x2d, 0x0a, 0x90, 0xcf, 0x1a,
+								  0x5a, 0x4c, 0x5d, 0xb0, 0x2d, 0x56, 0xec, 0xc4, 0xc5, 0xbf, 0x34,
+								  0x00, 0x72, 0x08, 0xd5, 0xb8, 0x87, 0x18, 0x58, 0x65};
+	psa_key_derivation_operation_t operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+	ASSERT_EQ(psa_key_derivation_setup(&operation, PSA_ALG_HKDF(PSA_ALG_SHA_256)), PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_input_bytes(&operation, PSA_KEY_DERIVATION_INPUT_SALT, salt,
+											 sizeof(salt)),
+			  PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_input_bytes(&operation, PSA_KEY_DERIVATION_INPUT_SECRET, ikm,
+											 sizeof(ikm)),
+			  PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_input_bytes(&operation, PSA_KEY_DERIVATION_INPUT_INFO, info,
+											 sizeof(info)),
+			  PSA_SUCCESS);
+	uint8_t okm[42];
+	EXPECT_EQ(psa_key_derivation_output_bytes(&operation, okm, sizeof(okm)), PSA_SUCCESS);
+	EXPECT_EQ(memcmp(okm, expected, sizeof(expected)), 0);
+	EXPECT_EQ(psa_key_derivation_abort(&operation), PSA_SUCCESS);
+}
+
+// RFC 5869 test case 3: no salt, which keys the extract step with an empty key
+TEST_F(PsaKeyDerivationOutputBytes, HkdfSha256WithoutSaltAndInfo)
+{
+	const uint8_t expected[42] = {0x8d, 0xa4, 0xe7, 0x75, 0xa5, 0x63, 0xc1, 0x8f, 0x71, 0x5f, 0x80,
+								  0x2a, 0x06, 0x3c, 0x5a, 0x31, 0xb8, 0xa1, 0x1f, 0x5c, 0x5e, 0xe1,
+								  0x87, 0x9e, 0xc3, 0x45, 0x4e, 0x5f, 0x3c, 0x73, 0x8d, 0x2d, 0x9d,
+								  0x20, 0x13, 0x95, 0xfa, 0xa4, 0xb6, 0x1a, 0x96, 0xc8};
+	psa_key_derivation_operation_t operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+	ASSERT_EQ(psa_key_derivation_setup(&operation, PSA_ALG_HKDF(PSA_ALG_SHA_256)), PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_input_bytes(&operation, PSA_KEY_DERIVATION_INPUT_SECRET, ikm,
+											 sizeof(ikm)),
+			  PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_input_bytes(&operation, PSA_KEY_DERIVATION_INPUT_INFO, NULL, 0),
+			  PSA_SUCCESS);
+	uint8_t okm[42];
+	EXPECT_EQ(psa_key_derivation_output_bytes(&operation, okm, sizeof(okm)), PSA_SUCCESS);
+	EXPECT_EQ(memcmp(okm, expected, sizeof(expected)), 0);
+	EXPECT_EQ(psa_key_derivation_abort(&operation), PSA_SUCCESS);
+}
@@ -0,0 +1,349 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <string.h>
+#include <vector>
+
+extern "C"
+{
+#include "include/svc/crypto/psa_crypto_key_arena.h"
+#include "include/svc/crypto/psa_crypto_slot_management.h"
+}
+
+class PsaKeySlotIndex : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		entries.resize(64);
+		index = {entries.data(), entries.size() - 1};
+		psa_key_slot_index_clear(&index);
+	}
+
+	std::vector<psa_key_slot_index_entry_t> entries;
+	psa_key_slot_index_t index;
+};
+
+TEST_F(PsaKeySlotIndex, FindInserted)
+{
+	for(size_t i = 0; i < 32; i++)
+		psa_key_slot_index_insert(&index, (psa_key_id_t)(i + 1), i);
+
+	for(size_t i = 0; i < 32; i++)
+		EXPECT_EQ(psa_key_slot_index_find(&index, (psa_key_id_t)(i + 1)), i);
+	EXPECT_EQ(psa_key_slot_index_find(&index, 33), PSA_KEY_SLOT_INDEX_NOT_FOUND);
+}
+
+// Removing from the middle of probe runs must keep every other entry
+// reachable, whatever order the entries went in and come out.
+TEST_F(PsaKeySlotIndex, RemoveKeepsProbeRuns)
+{
+	const size_t count = 32;
+	std::vector<bool> present(count, true);
+
+	for(size_t i = 0; i < count; i++)
+		psa_key_slot_index_insert(&index, (psa_key_id_t)(0x10000 * (i + 1)), i);
+
+	for(size_t step = 0; step < count; step++)
+	{
+		size_t victim = (step * 7) % count;
+		psa_key_slot_index_remove(&index, (psa_key_id_t)(0x10000 * (victim + 1)), victim);
+		present[victim] = false;
+
+		for(size_t i = 0; i < count; i++)
+			EXPECT_EQ(psa_key_slot_index_find(&index, (psa_key_id_t)(0x10000 * (i + 1))),
+					  present[i] ? i : PSA_KEY_SLOT_INDEX_NOT_FOUND);
+	}
+	for(const psa_key_slot_index_entry_t& entry : entries)
+		EXPECT_EQ(entry.key_id, 0u);
+}
+
+// A persistent key being created can share its identifier with a loaded
+// copy for a moment; each slot is removed on its own.
+TEST_F(PsaKeySlotIndex, DuplicateIdentifiers)
+{
+	psa_key_slot_index_insert(&index, 42, 3);
+	psa_key_slot_index_insert(&index, 42, 5);
+
+	psa_key_slot_index_remove(&index, 42, 5);
+	EXPECT_EQ(psa_key_slot_index_find(&index, 42), 3u);
+	psa_key_slot_index_remove(&index, 42, 5);
+	EXPECT_EQ(psa_key_slot_index_find(&index, 42), 3u);
+	psa_key_slot_index_remove(&index, 42, 3);
+	EXPECT_EQ(psa_key_slot_index_find(&index, 42), PSA_KEY_SLOT_INDEX_NOT_FOUND);
+}
+
+class PsaKeySlotFreeList : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_status_t ImportAesKey(psa_key_id_t* key_id)
+	{
+		static const uint8_t key[16] = {0};
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_ENCRYPT);
+		psa_set_key_algorithm(&attributes, PSA_ALG_ECB_NO_PADDING);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		return psa_import_key(&attributes, key, sizeof(key), key_id);
+	}
+};
+
+// Destroyed keys hand their slots back, so the table never runs dry while
+// fewer than IOTEX_PSA_KEY_SLOT_COUNT keys are alive.
+TEST_F(PsaKeySlotFreeList, SlotsAreRecycled)
+{
+	psa_key_id_t keys[IOTEX_PSA_KEY_SLOT_COUNT];
+	psa_key_id_t extra;
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		ASSERT_EQ(ImportAesKey(&keys[i]), PSA_SUCCESS);
+	EXPECT_EQ(ImportAesKey(&extra), PSA_ERROR_INSUFFICIENT_MEMORY);
+
+	for(int round = 0; round < 3; round++)
+	{
+		for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i += 2)
+			ASSERT_EQ(psa_destroy_key(keys[i]), PSA_SUCCESS);
+		for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i += 2)
+			ASSERT_EQ(ImportAesKey(&keys[i]), PSA_SUCCESS);
+		EXPECT_EQ(ImportAesKey(&extra), PSA_ERROR_INSUFFICIENT_MEMORY);
+	}
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		EXPECT_EQ(psa_destroy_key(keys[i]), PSA_SUCCESS);
+}
+
+// Unknown persistent identifiers go through the index, not a slot scan
+TEST_F(PsaKeySlotFreeList, UnknownPersistentKey)
+{
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	EXPECT_EQ(psa_get_key_attributes(PSA_KEY_ID_USER_MIN + 7, &attributes),
+			  PSA_ERROR_INVALID_HANDLE);
+}
+
+// The cache tests put key descriptions into slots directly, as a load from
+// storage would, without storing the keys.
+class PsaKeySlotCache : public PsaKeySlotFreeList
+{
+  protected:
+	void LoadPersistentKey(psa_key_id_t key_id)
+	{
+		psa_key_id_t volatile_key_id;
+		psa_key_slot_t* slot;
+
+		ASSERT_EQ(psa_get_empty_key_slot(&volatile_key_id, &slot), PSA_SUCCESS);
+		slot->attr.id = key_id;
+		slot->attr.lifetime = PSA_KEY_LIFETIME_PERSISTENT;
+		slot->attr.type = PSA_KEY_TYPE_RAW_DATA;
+		psa_index_key_slot(slot);
+		ASSERT_EQ(psa_unlock_key_slot(slot), PSA_SUCCESS);
+	}
+
+	psa_status_t UseKey(psa_key_id_t key_id)
+	{
+		psa_key_slot_t* slot;
+		psa_status_t status = psa_get_and_lock_key_slot(key_id, &slot);
+		if(status == PSA_SUCCESS)
+			status = psa_unlock_key_slot(slot);
+		return status;
+	}
+
+	iotex_psa_stats_t Stats()
+	{
+		iotex_psa_stats_t stats;
+		iotex_psa_get_stats(&stats);
+		return stats;
+	}
+};
+
+TEST_F(PsaKeySlotCache, EvictsLeastRecentlyUsed)
+{
+	const psa_key_id_t base = PSA_KEY_ID_USER_MIN;
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		LoadPersistentKey(base + (psa_key_id_t)i);
+
+	// Keep the first key hot, the second one is now the coldest
+	EXPECT_EQ(UseKey(base), PSA_SUCCESS);
+	LoadPersistentKey(base + 100);
+
+	EXPECT_EQ(UseKey(base + 1), PSA_ERROR_INVALID_HANDLE);
+	EXPECT_EQ(UseKey(base), PSA_SUCCESS);
+	EXPECT_EQ(UseKey(base + 100), PSA_SUCCESS);
+
+	iotex_psa_stats_t stats = Stats();
+	EXPECT_EQ(stats.cache_hits, 3u);
+	EXPECT_EQ(stats.cache_misses, 1u);
+	EXPECT_EQ(stats.cache_evictions, 1u);
+	EXPECT_EQ(stats.persistent_slots, (size_t)IOTEX_PSA_KEY_SLOT_COUNT);
+}
+
+// A key in use is never evicted, the next coldest one goes instead
+TEST_F(PsaKeySlotCache, SkipsLockedSlots)
+{
+	const psa_key_id_t base = PSA_KEY_ID_USER_MIN;
+	psa_key_slot_t* locked;
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		LoadPersistentKey(base + (psa_key_id_t)i);
+
+	ASSERT_EQ(psa_get_and_lock_key_slot(base, &locked), PSA_SUCCESS);
+	for(size_t i = 1; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		ASSERT_EQ(UseKey(base + (psa_key_id_t)i), PSA_SUCCESS);
+
+	// base is the least recently used key but it is locked
+	LoadPersistentKey(base + 100);
+	EXPECT_EQ(UseKey(base + 1), PSA_ERROR_INVALID_HANDLE);
+	EXPECT_EQ(psa_unlock_key_slot(locked), PSA_SUCCESS);
+	EXPECT_EQ(UseKey(base), PSA_SUCCESS);
+	EXPECT_EQ(Stats().cache_evictions, 1u);
+}
+
+TEST_F(PsaKeySlotCache, NothingToEvict)
+{
+	psa_key_id_t keys[IOTEX_PSA_KEY_SLOT_COUNT];
+	psa_key_id_t volatile_key_id;
+	psa_key_slot_t* slot;
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		ASSERT_EQ(ImportAesKey(&keys[i]), PSA_SUCCESS);
+
+	// Volatile keys are not a cache
+	EXPECT_EQ(psa_get_empty_key_slot(&volatile_key_id, &slot), PSA_ERROR_INSUFFICIENT_MEMORY);
+	EXPECT_EQ(UseKey(PSA_KEY_ID_USER_MIN), PSA_ERROR_INVALID_HANDLE);
+	EXPECT_EQ(UseKey(keys[0]), PSA_SUCCESS);
+
+	iotex_psa_stats_t stats = Stats();
+	EXPECT_EQ(stats.cache_hits, 0u);
+	EXPECT_EQ(stats.cache_misses, 1u);
+	EXPECT_EQ(stats.cache_evictions, 0u);
+}
+
+TEST_F(PsaKeySlotFreeList, FootprintReport)
+{
+	psa_key_id_t keys[IOTEX_PSA_KEY_SLOT_COUNT];
+	iotex_psa_stats_t stats;
+
+	iotex_psa_get_stats(&stats);
+	EXPECT_GT(stats.slot_capacity, 0u);
+	EXPECT_LE(stats.slot_capacity, (size_t)IOTEX_PSA_KEY_SLOT_COUNT);
+	EXPECT_GE(stats.slot_table_bytes, stats.slot_capacity * sizeof(psa_key_slot_t));
+	EXPECT_EQ(stats.key_arena_used_bytes, 0u);
+	EXPECT_EQ(stats.key_heap_bytes, 0u);
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		ASSERT_EQ(ImportAesKey(&keys[i]), PSA_SUCCESS);
+
+	iotex_psa_get_stats(&stats);
+	EXPECT_EQ(stats.slot_capacity, (size_t)IOTEX_PSA_KEY_SLOT_COUNT);
+	EXPECT_EQ(stats.volatile_slots, (size_t)IOTEX_PSA_KEY_SLOT_COUNT);
+	// AES-128 keys take the 16-byte class
+	EXPECT_EQ(stats.key_arena_used_bytes + stats.key_heap_bytes,
+			  16u * IOTEX_PSA_KEY_SLOT_COUNT);
+	EXPECT_LE(stats.key_arena_used_bytes, stats.key_arena_bytes);
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+		EXPECT_EQ(psa_destroy_key(keys[i]), PSA_SUCCESS);
+
+	iotex_psa_get_stats(&stats);
+	EXPECT_EQ(stats.key_arena_used_bytes, 0u);
+	EXPECT_EQ(stats.key_heap_bytes, 0u);
+}
+
+#if defined(IOTEX_PSA_KEY_SLOT_DYNAMIC)
+// The table starts with one chunk and only grows when it is full; keys
+// created earlier keep their slots, and so their identifiers.
+TEST_F(PsaKeySlotFreeList, TableGrows)
+{
+	std::vector<psa_key_id_t> keys;
+	iotex_psa_stats_t stats;
+	size_t capacity;
+	psa_key_id_t key;
+
+	iotex_psa_get_stats(&stats);
+	capacity = stats.slot_capacity;
+	EXPECT_EQ(capacity, std::min<size_t>(IOTEX_PSA_KEY_SLOT_CHUNK, IOTEX_PSA_KEY_SLOT_COUNT));
+
+	for(size_t i = 0; i < IOTEX_PSA_KEY_SLOT_COUNT; i++)
+	{
+		ASSERT_EQ(ImportAesKey(&key), PSA_SUCCESS);
+		keys.push_back(key);
+		iotex_psa_get_stats(&stats);
+		if(i < capacity)
+			EXPECT_EQ(stats.slot_capacity, capacity);
+		else
+		{
+			EXPECT_GT(stats.slot_capacity, capacity);
+			capacity = stats.slot_capacity;
+		}
+	}
+	EXPECT_EQ(ImportAesKey(&key), PSA_ERROR_INSUFFICIENT_MEMORY);
+
+	for(psa_key_id_t id : keys)
+	{
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		EXPECT_EQ(psa_get_key_attributes(id, &attributes), PSA_SUCCESS);
+	}
+	for(psa_key_id_t id : keys)
+		EXPECT_EQ(psa_destroy_key(id), PSA_SUCCESS);
+
+	// Volatile identifiers past the table are not keys
+	iotex_psa_crypto_free();
+	ASSERT_EQ(psa_crypto_init(), PSA_SUCCESS);
+	iotex_psa_get_stats(&stats);
+	EXPECT_EQ(stats.key_arena_bytes, 0u);
+	if(stats.slot_capacity < IOTEX_PSA_KEY_SLOT_COUNT)
+	{
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		EXPECT_EQ(psa_get_key_attributes(PSA_KEY_ID_VOLATILE_MAX, &attributes),
+				  PSA_ERROR_INVALID_HANDLE);
+	}
+}
+#endif
+
+TEST(PsaKeyArena, BlocksAreRecycledAndWiped)
+{
+	size_t reserved, used, heap;
+	uint8_t* a = iotex_psa_key_arena_alloc(20);
+	uint8_t* b;
+
+	ASSERT_NE(a, nullptr);
+	EXPECT_EQ((uintptr_t)a % 8, 0u);
+	for(size_t i = 0; i < 32; i++)
+		EXPECT_EQ(a[i], 0);
+	memset(a, 0xA5, 32);
+	iotex_psa_key_arena_get_stats(&reserved, &used, &heap);
+	EXPECT_EQ(used + heap, 32u);
+
+	// Same class, same block, wiped
+	iotex_psa_key_arena_free(a);
+	b = iotex_psa_key_arena_alloc(32);
+	if(heap == 0)
+		EXPECT_EQ(b, a);
+	for(size_t i = 0; i < 32; i++)
+		EXPECT_EQ(b[i], 0);
+	iotex_psa_key_arena_free(b);
+
+	// Past the largest class, straight from the heap
+	b = iotex_psa_key_arena_alloc(1000);
+	ASSERT_NE(b, nullptr);
+	iotex_psa_key_arena_get_stats(&reserved, &used, &heap);
+	EXPECT_EQ(used, 0u);
+	EXPECT_EQ(heap, 1000u);
+	iotex_psa_key_arena_free(b);
+	iotex_psa_key_arena_get_stats(&reserved, &used, &heap);
+	EXPECT_EQ(heap, 0u);
+
+	iotex_psa_key_arena_release();
+	iotex_psa_key_arena_get_stats(&reserved, &used, &heap);
+	EXPECT_EQ(reserved, 0u);
+}
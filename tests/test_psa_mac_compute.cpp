@@ -0,0 +1,211 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+
+class PsaMacCompute : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportHmacKey(const uint8_t* key, size_t key_length)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes,
+								PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_HMAC(PSA_ALG_SHA_256));
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+		psa_set_key_bits(&attributes, PSA_BYTES_TO_BITS(key_length));
+		psa_status_t status = psa_import_key(&attributes, key, key_length, &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+};
+
+// RFC 4231 test case 1
+TEST_F(PsaMacCompute, HmacSha256ShortKey)
+{
+	uint8_t key[20];
+	memset(key, 0x0b, sizeof(key));
+	const uint8_t expected[32] = {0xb0, 0x34, 0x4c, 0x61, 0xd8, 0xdb, 0x38, 0x53, 0x5c, 0xa8, 0xaf,
+								  0xce, 0xaf, 0x0b, 0xf1, 0x2b, 0x88, 0x1d, 0xc2, 0x00, 0xc9, 0x83,
+								  0x3d, 0xa7, 0x26, 0xe9, 0x37, 0x6c, 0x2e, 0x32, 0xcf, 0xf7};
+	psa_key_id_t key_id = ImportHmacKey(key, sizeof(key));
+	uint8_t mac[32];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_compute(key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256),
+										  (const uint8_t*)"Hi There", 8, mac, sizeof(mac), &mac_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(mac_length, 32);
+	EXPECT_EQ(memcmp(mac, expected, sizeof(expected)), 0);
+}
+
+// RFC 4231 test case 2
+TEST_F(PsaMacCompute, HmacSha256KeyShorterThanOutput)
+{
+	const char* data = "what do ya want for nothing?";
+	const uint8_t expected[32] = {0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24,
+								  0x26, 0x08, 0x95, 0x75, 0xc7, 0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27,
+								  0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43};
+	psa_key_id_t key_id = ImportHmacKey((const uint8_t*)"Jefe", 4);
+	uint8_t mac[32];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_compute(key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256),
+										  (const uint8_t*)data, strlen(data), mac, sizeof(mac),
+										  &mac_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(mac_length, 32);
+	EXPECT_EQ(memcmp(mac, expected, sizeof(expected)), 0);
+}
+
+// RFC 4231 test case 6
+TEST_F(PsaMacCompute, HmacSha256KeyLongerThanBlock)
+{
+	uint8_t key[131];
+	memset(key, 0xaa, sizeof(key));
+	const char* data = "Test Using Larger Than Block-Size Key - Hash Key First";
+	const uint8_t expected[32] = {0x60, 0xe4, 0x31, 0x59, 0x1e, 0xe0, 0xb6, 0x7f, 0x0d, 0x8a, 0x26,
+								  0xaa, 0xcb, 0xf5, 0xb7, 0x7f, 0x8e, 0x0b, 0xc6, 0x21, 0x37, 0x28,
+								  0xc5, 0x14, 0x05, 0x46, 0x04, 0x0f, 0x0e, 0xe3, 0x7f, 0x54};
+	psa_key_id_t key_id = ImportHmacKey(key, sizeof(key));
+	uint8_t mac[32];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_compute(key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256),
+										  (const uint8_t*)data, strlen(data), mac, sizeof(mac),
+										  &mac_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(mac_length, 32);
+	EXPECT_EQ(memcmp(mac, expected, sizeof(expected)), 0);
+}
+
+// RFC 4231 test case 5
+TEST_F(PsaMacCompute, HmacSha256Truncated)
+{
+	uint8_t key[20];
+	memset(key, 0x0c, sizeof(key));
+	const uint8_t expected[16] = {0xa3, 0xb6, 0x16, 0x74, 0x73, 0x10, 0x0e, 0xe0,
+								  0x6e, 0x0c, 0x79, 0x6c, 0x29, 0x55, 0x55, 0x2b};
+	psa_algorithm_t alg = PSA_ALG_TRUNCATED_MAC(PSA_ALG_HMAC(PSA_ALG_SHA_256), 16);
+	psa_key_id_t key_id = 0;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
+	psa_set_key_algorithm(&attributes, alg);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+	psa_set_key_bits(&attributes, 160);
+	ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &key_id), PSA_SUCCESS);
+	uint8_t mac[32];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_compute(key_id, alg, (const uint8_t*)"Test With Truncation", 20,
+										  mac, sizeof(mac), &mac_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+	EXPECT_EQ(mac_length, 16);
+	EXPECT_EQ(memcmp(mac, expected, sizeof(expected)), 0);
+}
+
+TEST_F(PsaMacCompute, BufferTooSmall)
+{
+	psa_key_id_t key_id = ImportHmacKey((const uint8_t*)"Jefe", 4);
+	uint8_t mac[31];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_compute(key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256),
+										  (const uint8_t*)"test", 4, mac, sizeof(mac), &mac_length);
+	EXPECT_EQ(status, PSA_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(PsaMacCompute, UnsupportedHash)
+{
+	psa_key_id_t key_id = 0;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
+	psa_set_key_algorithm(&attributes, PSA_ALG_HMAC(PSA_ALG_SHA_512));
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+	psa_set_key_bits(&attributes, 32);
+	ASSERT_EQ(psa_import_key(&attributes, (const uint8_t*)"Jefe", 4, &key_id), PSA_SUCCESS);
+	uint8_t mac[64];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_compute(key_id, PSA_ALG_HMAC(PSA_ALG_SHA_512),
+										  (const uint8_t*)"test", 4, mac, sizeof(mac), &mac_length);
+	EXPECT_EQ(status, PSA_ERROR_NOT_SUPPORTED);
+}
+
+class PsaMacComputeCmac : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes,
+								PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_CMAC);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+		psa_set_key_bits(&attributes, 128);
+		psa_status_t status = psa_import_key(&attributes, key, sizeof(key), &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	void ExpectCmac(size_t message_length, const uint8_t expected[16])
+	{
+		uint8_t mac[16];
+		size_t mac_length = 0;
+		psa_status_t status = psa_mac_compute(key_id, PSA_ALG_CMAC, message, message_length, mac,
+											  sizeof(mac), &mac_length);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		EXPECT_EQ(mac_length, 16);
+		EXPECT_EQ(memcmp(mac, expected, 16), 0);
+	}
+
+	// RFC 4493 section 4
+	const uint8_t key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+							 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+	const uint8_t message[64] = {0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e,
+								 0x11, 0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03,
+								 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51, 0x30,
+								 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19,
+								 0x1a, 0x0a, 0x52, 0xef, 0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b,
+								 0x17, 0xad, 0x2b, 0x41, 0x7b, 0xe6, 0x6c, 0x37, 0x10};
+	psa_key_id_t key_id = 0;
+};
+
+TEST_F(PsaMacComputeCmac, EmptyMessage)
+{
+	const uint8_t expected[16] = {0xbb, 0x1d, 0x69, 0x29, 0xe9, 0x59, 0x37, 0x28,
+								  0x7f, 0xa3, 0x7d, 0x12, 0x9b, 0x75, 0x67, 0x46};
+	ExpectCmac(0, expected);
+}
+
+TEST_F(PsaMacComputeCmac, OneBlock)
+{
+	const uint8_t expected[16] = {0x07, 0x0a, 0x16, 0xb4, 0x6b, 0x4d, 0x41, 0x44,
+								  0xf7, 0x9b, 0xdd, 0x9d, 0xd0, 0x4a, 0x28, 0x7c};
+	ExpectCmac(16, expected);
+}
+
+TEST_F(PsaMacComputeCmac, PartialLastBlock)
+{
+	const uint8_t expected[16] = {0xdf, 0xa6, 0x67, 0x47, 0xde, 0x9a, 0xe6, 0x30,
+								  0x30, 0xca, 0x32, 0x61, 0x14, 0x97, 0xc8, 0x27};
+	ExpectCmac(40, expected);
+}
+
+TEST_F(PsaMacComputeCmac, FourBlocks)
+{
+	const uint8_t expected[16] = {0x51, 0xf0, 0xbe, 0xbf, 0x7e, 0x3b, 0x9d, 0x92,
+								  0xfc, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3c, 0xfe};
+	// The second run starts from the cached subkeys.
+	ExpectCmac(64, expected);
+	ExpectCmac(64, expected);
+}
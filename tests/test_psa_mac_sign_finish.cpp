@@ -0,0 +1,140 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+
+class PsaMacSignFinish : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportHmacKey(const uint8_t* key, size_t key_length)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes,
+								PSA_KEY_USAGE_SIGN_MESSAGE | PSA_KEY_USAGE_VERIFY_MESSAGE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_HMAC(PSA_ALG_SHA_256));
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_HMAC);
+		psa_set_key_bits(&attributes, PSA_BYTES_TO_BITS(key_length));
+		psa_status_t status = psa_import_key(&attributes, key, key_length, &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	void SignInChunks(psa_key_id_t key_id, const char* data, size_t chunk, uint8_t mac[32])
+	{
+		psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
+		size_t mac_length = 0;
+		size_t length = strlen(data);
+		ASSERT_EQ(psa_mac_sign_setup(&operation, key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256)),
+				  PSA_SUCCESS);
+		for(size_t offset = 0; offset < length; offset += chunk)
+		{
+			size_t n = (length - offset < chunk) ? length - offset : chunk;
+			ASSERT_EQ(psa_mac_update(&operation, (const uint8_t*)data + offset, n), PSA_SUCCESS);
+		}
+		ASSERT_EQ(psa_mac_sign_finish(&operation, mac, 32, &mac_length), PSA_SUCCESS);
+		EXPECT_EQ(mac_length, 32);
+	}
+
+	// RFC 4231 test case 2
+	const char* jefe_data = "what do ya want for nothing?";
+	const uint8_t jefe_mac[32] = {0x5b, 0xdc, 0xc1, 0x46, 0xbf, 0x60, 0x75, 0x4e, 0x6a, 0x04, 0x24,
+								  0x26, 0x08, 0x95, 0x75, 0xc7, 0x5a, 0x00, 0x3f, 0x08, 0x9d, 0x27,
+								  0x39, 0x83, 0x9d, 0xec, 0x58, 0xb9, 0x64, 0xec, 0x38, 0x43};
+};
+
+TEST_F(PsaMacSignFinish, BadState)
+{
+	psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
+	uint8_t mac[32];
+	size_t mac_length = 0;
+	psa_status_t status = psa_mac_sign_finish(&operation, mac, sizeof(mac), &mac_length);
+	EXPECT_EQ(status, PSA_ERROR_BAD_STATE);
+}
+
+TEST_F(PsaMacSignFinish, MultipartMatchesReference)
+{
+	psa_key_id_t key_id = ImportHmacKey((const uint8_t*)"Jefe", 4);
+	uint8_t mac[32];
+	for(size_t chunk = 1; chunk <= strlen(jefe_data); chunk++)
+	{
+		SignInChunks(key_id, jefe_data, chunk, mac);
+		EXPECT_EQ(memcmp(mac, jefe_mac, sizeof(jefe_mac)), 0) << "chunk size " << chunk;
+	}
+}
+
+TEST_F(PsaMacSignFinish, ReplacedKeyDoesNotReusePads)
+{
+	psa_key_id_t key_id = ImportHmacKey((const uint8_t*)"Jefe", 4);
+	uint8_t mac[32];
+	SignInChunks(key_id, jefe_data, 7, mac);
+	EXPECT_EQ(memcmp(mac, jefe_mac, sizeof(jefe_mac)), 0);
+	ASSERT_EQ(psa_destroy_key(key_id), PSA_SUCCESS);
+
+	// The new key is likely to get the same identifier as the destroyed one.
+	psa_key_id_t other_key_id = ImportHmacKey((const uint8_t*)"Jeff", 4);
+	SignInChunks(other_key_id, jefe_data, 7, mac);
+	EXPECT_NE(memcmp(mac, jefe_mac, sizeof(jefe_mac)), 0);
+}
+
+TEST_F(PsaMacSignFinish, VerifyFinishChecksMac)
+{
+	psa_key_id_t key_id = ImportHmacKey((const uint8_t*)"Jefe", 4);
+	psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
+	ASSERT_EQ(psa_mac_verify_setup(&operation, key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256)), PSA_SUCCESS);
+	ASSERT_EQ(psa_mac_update(&operation, (const uint8_t*)jefe_data, strlen(jefe_data)), PSA_SUCCESS);
+	EXPECT_EQ(psa_mac_verify_finish(&operation, jefe_mac, sizeof(jefe_mac)), PSA_SUCCESS);
+
+	uint8_t bad_mac[32];
+	memcpy(bad_mac, jefe_mac, sizeof(bad_mac));
+	bad_mac[31] ^= 1;
+	ASSERT_EQ(psa_mac_verify_setup(&operation, key_id, PSA_ALG_HMAC(PSA_ALG_SHA_256)), PSA_SUCCESS);
+	ASSERT_EQ(psa_mac_update(&operation, (const uint8_t*)jefe_data, strlen(jefe_data)), PSA_SUCCESS);
+	EXPECT_EQ(psa_mac_verify_finish(&operation, bad_mac, sizeof(bad_mac)),
+			  PSA_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_F(PsaMacSignFinish, CmacMultipartMatchesReference)
+{
+	// RFC 4493 example 3
+	const uint8_t key[16] = {0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+							 0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c};
+	const uint8_t message[40] = {0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d,
+								 0x7e, 0x11, 0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57,
+								 0x1e, 0x03, 0xac, 0x9c, 0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf,
+								 0x8e, 0x51, 0x30, 0xc8, 0x1c, 0x46, 0xa3, 0x5c, 0xe4, 0x11};
+	const uint8_t expected[16] = {0xdf, 0xa6, 0x67, 0x47, 0xde, 0x9a, 0xe6, 0x30,
+								  0x30, 0xca, 0x32, 0x61, 0x14, 0x97, 0xc8, 0x27};
+	psa_key_id_t key_id = 0;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_MESSAGE);
+	psa_set_key_algorithm(&attributes, PSA_ALG_CMAC);
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+	psa_set_key_bits(&attributes, 128);
+	ASSERT_EQ(psa_import_key(&attributes, key, sizeof(key), &key_id), PSA_SUCCESS);
+
+	for(size_t chunk = 1; chunk <= sizeof(message); chunk++)
+	{
+		psa_mac_operation_t operation = PSA_MAC_OPERATION_INIT;
+		uint8_t mac[16];
+		size_t mac_length = 0;
+		ASSERT_EQ(psa_mac_sign_setup(&operation, key_id, PSA_ALG_CMAC), PSA_SUCCESS);
+		for(size_t offset = 0; offset < sizeof(message); offset += chunk)
+		{
+			size_t n = (sizeof(message) - offset < chunk) ? sizeof(message) - offset : chunk;
+			ASSERT_EQ(psa_mac_update(&operation, message + offset, n), PSA_SUCCESS);
+		}
+		ASSERT_EQ(psa_mac_sign_finish(&operation, mac, sizeof(mac), &mac_length), PSA_SUCCESS);
+		EXPECT_EQ(mac_length, 16);
+		EXPECT_EQ(memcmp(mac, expected, sizeof(expected)), 0) << "chunk size " << chunk;
+	}
+}
@@ -0,0 +1,226 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+#include <string.h>
+
+// NIST CAVS 14.1 KAS ECC CDH primitive, P-256, COUNT = 0
+static const uint8_t p256_private_key[32] = {
+	0x7d, 0x7d, 0xc5, 0xf7, 0x1e, 0xb2, 0x9d, 0xda, 0xf8, 0x0d, 0x62, 0x14, 0x63, 0x2e, 0xea, 0xe0,
+	0x3d, 0x90, 0x58, 0xaf, 0x1f, 0xb6, 0xd2, 0x2e, 0xd8, 0x0b, 0xad, 0xb6, 0x2b, 0xc1, 0xa5, 0x34};
+
+static const uint8_t p256_peer_key[65] = {
+	0x04, 0x70, 0x0c, 0x48, 0xf7, 0x7f, 0x56, 0x58, 0x4c, 0x5c, 0xc6, 0x32, 0xca, 0x65, 0x64, 0x0d,
+	0xb9, 0x1b, 0x6b, 0xac, 0xce, 0x3a, 0x4d, 0xf6, 0xb4, 0x2c, 0xe7, 0xcc, 0x83, 0x88, 0x33, 0xd2,
+	0x87, 0xdb, 0x71, 0xe5, 0x09, 0xe3, 0xfd, 0x9b, 0x06, 0x0d, 0xdb, 0x20, 0xba, 0x5c, 0x51, 0xdc,
+	0xc5, 0x94, 0x8d, 0x46, 0xfb, 0xf6, 0x40, 0xdf, 0xe0, 0x44, 0x17, 0x82, 0xca, 0xb8, 0x5f, 0xa4,
+	0xac};
+
+static const uint8_t p256_shared_secret[32] = {
+	0x46, 0xfc, 0x62, 0x10, 0x64, 0x20, 0xff, 0x01, 0x2e, 0x54, 0xa4, 0x34, 0xfb, 0xdd, 0x2d, 0x25,
+	0xcc, 0xc5, 0x85, 0x20, 0x60, 0x56, 0x1e, 0x68, 0x04, 0x0d, 0xd7, 0x77, 0x89, 0x97, 0xbd, 0x7b};
+
+// Two secp256k1 key pairs and their shared secret, checked with OpenSSL
+static const uint8_t k1_private_key_a[32] = {
+	0x7b, 0x9e, 0x1f, 0x7d, 0x2b, 0x5e, 0x28, 0xa4, 0xb7, 0xd2, 0xc3, 0xf0, 0xa9, 0xb8, 0xe1, 0xd2,
+	0xc3, 0xb4, 0xa5, 0x96, 0x87, 0xf0, 0xe1, 0xd2, 0xc3, 0xb4, 0xa5, 0x96, 0x87, 0x78, 0xc0, 0x1c};
+
+static const uint8_t k1_private_key_b[32] = {
+	0x3c, 0x2d, 0x1e, 0x0f, 0x9a, 0x8b, 0x7c, 0x6d, 0x5e, 0x4f, 0x30, 0x21, 0x12, 0x03, 0xf4, 0xe5,
+	0xd6, 0xc7, 0xb8, 0xa9, 0x9a, 0x8b, 0x7c, 0x6d, 0x5e, 0x4f, 0x30, 0x21, 0x12, 0x03, 0x04, 0xf5};
+
+static const uint8_t k1_shared_secret[32] = {
+	0x9a, 0xcf, 0x24, 0x63, 0x59, 0x88, 0xcb, 0x30, 0x3e, 0x62, 0x0c, 0xa5, 0xce, 0x69, 0xbc, 0xb0,
+	0xdb, 0xbc, 0x11, 0xc9, 0x81, 0x58, 0xe4, 0x44, 0x9e, 0x8e, 0xc1, 0xad, 0x47, 0x5d, 0xb1, 0xf4};
+
+// HKDF-SHA-256 of p256_shared_secret without salt, info "handshake"
+static const uint8_t p256_hkdf_output[32] = {
+	0x8a, 0x42, 0x64, 0x08, 0x61, 0x4e, 0x93, 0x9b, 0x01, 0x9a, 0x8c, 0xb3, 0xcb, 0x6e, 0x33, 0x09,
+	0x04, 0x94, 0x4f, 0x7f, 0x31, 0xac, 0x82, 0xd5, 0xc3, 0xa1, 0xe2, 0x03, 0x49, 0xb8, 0xcd, 0xe4};
+
+class PsaRawKeyAgreement : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportKeyPair(psa_ecc_family_t family, const uint8_t* data, psa_algorithm_t alg)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+		psa_set_key_algorithm(&attributes, alg);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(family));
+		psa_set_key_bits(&attributes, 256);
+		EXPECT_EQ(psa_import_key(&attributes, data, 32, &key_id), PSA_SUCCESS);
+		return key_id;
+	}
+
+	psa_key_id_t GenerateKeyPair(psa_ecc_family_t family)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_DERIVE);
+		psa_set_key_algorithm(&attributes, PSA_ALG_ECDH);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(family));
+		psa_set_key_bits(&attributes, 256);
+		EXPECT_EQ(psa_generate_key(&attributes, &key_id), PSA_SUCCESS);
+		return key_id;
+	}
+
+	// Both sides of an exchange between two keys must get the same secret
+	void ExpectAgreement(psa_key_id_t a, psa_key_id_t b, uint8_t* secret)
+	{
+		uint8_t public_a[65], public_b[65], other[32];
+		size_t length = 0;
+
+		ASSERT_EQ(psa_export_public_key(a, public_a, sizeof(public_a), &length), PSA_SUCCESS);
+		ASSERT_EQ(psa_export_public_key(b, public_b, sizeof(public_b), &length), PSA_SUCCESS);
+		ASSERT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, a, public_b, sizeof(public_b), secret, 32,
+										&length),
+				  PSA_SUCCESS);
+		ASSERT_EQ(length, 32u);
+		ASSERT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, b, public_a, sizeof(public_a), other,
+										sizeof(other), &length),
+				  PSA_SUCCESS);
+		EXPECT_EQ(memcmp(secret, other, sizeof(other)), 0);
+	}
+};
+
+TEST_F(PsaRawKeyAgreement, P256KnownAnswer)
+{
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, PSA_ALG_ECDH);
+	uint8_t secret[32] = {0};
+	size_t length = 0;
+
+	ASSERT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key_id, p256_peer_key, sizeof(p256_peer_key),
+									secret, sizeof(secret), &length),
+			  PSA_SUCCESS);
+	EXPECT_EQ(length, sizeof(secret));
+	EXPECT_EQ(memcmp(secret, p256_shared_secret, sizeof(secret)), 0);
+}
+
+TEST_F(PsaRawKeyAgreement, K1KnownAnswer)
+{
+	psa_key_id_t a = ImportKeyPair(PSA_ECC_FAMILY_SECP_K1, k1_private_key_a, PSA_ALG_ECDH);
+	psa_key_id_t b = ImportKeyPair(PSA_ECC_FAMILY_SECP_K1, k1_private_key_b, PSA_ALG_ECDH);
+	uint8_t secret[32] = {0};
+
+	ExpectAgreement(a, b, secret);
+	EXPECT_EQ(memcmp(secret, k1_shared_secret, sizeof(secret)), 0);
+}
+
+TEST_F(PsaRawKeyAgreement, GeneratedKeysAgree)
+{
+	uint8_t secret[32];
+
+	ExpectAgreement(GenerateKeyPair(PSA_ECC_FAMILY_SECP_R1),
+					GenerateKeyPair(PSA_ECC_FAMILY_SECP_R1), secret);
+}
+
+TEST_F(PsaRawKeyAgreement, InvalidPeerKey)
+{
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, PSA_ALG_ECDH);
+	uint8_t peer_key[sizeof(p256_peer_key)];
+	uint8_t secret[32];
+	size_t length = 0;
+
+	// Not on the curve
+	memcpy(peer_key, p256_peer_key, sizeof(peer_key));
+	peer_key[64] ^= 0x01;
+	EXPECT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key_id, peer_key, sizeof(peer_key), secret,
+									sizeof(secret), &length),
+			  PSA_ERROR_INVALID_ARGUMENT);
+
+	// Not the uncompressed representation
+	memcpy(peer_key, p256_peer_key, sizeof(peer_key));
+	peer_key[0] = 0x02;
+	EXPECT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key_id, peer_key, sizeof(peer_key), secret,
+									sizeof(secret), &length),
+			  PSA_ERROR_INVALID_ARGUMENT);
+	EXPECT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key_id, p256_peer_key, 33, secret,
+									sizeof(secret), &length),
+			  PSA_ERROR_INVALID_ARGUMENT);
+
+	// A point of the other curve
+	psa_key_id_t k1_key = ImportKeyPair(PSA_ECC_FAMILY_SECP_K1, k1_private_key_a, PSA_ALG_ECDH);
+	EXPECT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, k1_key, p256_peer_key, sizeof(p256_peer_key),
+									secret, sizeof(secret), &length),
+			  PSA_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(PsaRawKeyAgreement, BufferTooSmall)
+{
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, PSA_ALG_ECDH);
+	uint8_t secret[31];
+	size_t length = 0;
+
+	EXPECT_EQ(psa_raw_key_agreement(PSA_ALG_ECDH, key_id, p256_peer_key, sizeof(p256_peer_key),
+									secret, sizeof(secret), &length),
+			  PSA_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(PsaRawKeyAgreement, KeyDerivationWithHkdf)
+{
+	const psa_algorithm_t alg = PSA_ALG_KEY_AGREEMENT(PSA_ALG_ECDH, PSA_ALG_HKDF(PSA_ALG_SHA_256));
+	const uint8_t info[] = {'h', 'a', 'n', 'd', 's', 'h', 'a', 'k', 'e'};
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, alg);
+	psa_key_derivation_operation_t operation = PSA_KEY_DERIVATION_OPERATION_INIT;
+	uint8_t okm[32];
+
+	ASSERT_EQ(psa_key_derivation_setup(&operation, alg), PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_key_agreement(&operation, PSA_KEY_DERIVATION_INPUT_SECRET, key_id,
+											   p256_peer_key, sizeof(p256_peer_key)),
+			  PSA_SUCCESS);
+	ASSERT_EQ(psa_key_derivation_input_bytes(&operation, PSA_KEY_DERIVATION_INPUT_INFO, info,
+											 sizeof(info)),
+			  PSA_SUCCESS);
+	EXPECT_EQ(psa_key_derivation_output_bytes(&operation, okm, sizeof(okm)), PSA_SUCCESS);
+	EXPECT_EQ(memcmp(okm, p256_hkdf_output, sizeof(okm)), 0);
+	EXPECT_EQ(psa_key_derivation_abort(&operation), PSA_SUCCESS);
+}
+
+#if defined(IOTEX_PSA_ECC_PUBLIC_KEY_CACHE) && IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE > 0
+TEST_F(PsaRawKeyAgreement, EphemeralPool)
+{
+	ASSERT_EQ(iotex_psa_ecc_ephemeral_pool_fill(PSA_ECC_FAMILY_SECP_R1, 1), PSA_SUCCESS);
+	ASSERT_EQ(iotex_psa_ecc_ephemeral_pool_fill(PSA_ECC_FAMILY_SECP_K1, 1), PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_R1), 1u);
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_K1), 1u);
+
+	// The pool never grows past its size
+	ASSERT_EQ(iotex_psa_ecc_ephemeral_pool_fill(PSA_ECC_FAMILY_SECP_R1,
+												IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE + 1),
+			  PSA_SUCCESS);
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_R1) +
+				  iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_K1),
+			  (size_t)IOTEX_PSA_ECC_EPHEMERAL_POOL_SIZE);
+
+	// A generated key takes a pooled pair of its curve, which must be usable
+	size_t pooled = iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_K1);
+	psa_key_id_t a = GenerateKeyPair(PSA_ECC_FAMILY_SECP_K1);
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_K1), pooled - 1);
+	psa_key_id_t b = ImportKeyPair(PSA_ECC_FAMILY_SECP_K1, k1_private_key_b, PSA_ALG_ECDH);
+	uint8_t secret[32];
+	ExpectAgreement(a, b, secret);
+
+	// Once the pool is empty, keys are generated on the spot again
+	psa_key_id_t c = GenerateKeyPair(PSA_ECC_FAMILY_SECP_K1);
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_K1), 0u);
+	ExpectAgreement(c, a, secret);
+}
+
+TEST_F(PsaRawKeyAgreement, EphemeralPoolIsWipedOnFree)
+{
+	ASSERT_EQ(iotex_psa_ecc_ephemeral_pool_fill(PSA_ECC_FAMILY_SECP_R1, 1), PSA_SUCCESS);
+	iotex_psa_crypto_free();
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_count(PSA_ECC_FAMILY_SECP_R1), 0u);
+	EXPECT_EQ(iotex_psa_ecc_ephemeral_pool_fill(PSA_ECC_FAMILY_SECP_R1, 1), PSA_ERROR_BAD_STATE);
+}
+#endif
@@ -0,0 +1,254 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+#include <string.h>
+
+// RFC 6979 A.2.5: P-256 key with the SHA-256 signatures of "sample" and "test"
+static const uint8_t p256_private_key[32] = {
+	0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+	0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12, 0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21};
+static const uint8_t sample_sha256[32] = {
+	0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+	0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf};
+static const uint8_t p256_sample_signature[64] = {
+	0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+	0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+	0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+	0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8};
+static const uint8_t test_sha256[32] = {
+	0x9f, 0x86, 0xd0, 0x81, 0x88, 0x4c, 0x7d, 0x65, 0x9a, 0x2f, 0xea, 0xa0, 0xc5, 0x5a, 0xd0, 0x15,
+	0xa3, 0xbf, 0x4f, 0x1b, 0x2b, 0x0b, 0x82, 0x2c, 0xd1, 0x5d, 0x6c, 0x15, 0xb0, 0xf0, 0x0a, 0x08};
+static const uint8_t p256_test_signature[64] = {
+	0xf1, 0xab, 0xb0, 0x23, 0x51, 0x83, 0x51, 0xcd, 0x71, 0xd8, 0x81, 0x56, 0x7b, 0x1e, 0xa6, 0x63,
+	0xed, 0x3e, 0xfc, 0xf6, 0xc5, 0x13, 0x2b, 0x35, 0x4f, 0x28, 0xd3, 0xb0, 0xb7, 0xd3, 0x83, 0x67,
+	0x01, 0x9f, 0x41, 0x13, 0x74, 0x2a, 0x2b, 0x14, 0xbd, 0x25, 0x92, 0x6b, 0x49, 0xc6, 0x49, 0x15,
+	0x5f, 0x26, 0x7e, 0x60, 0xd3, 0x81, 0x4b, 0x4c, 0x0c, 0xc8, 0x42, 0x50, 0xe4, 0x6f, 0x00, 0x83};
+
+// secp256k1 key pair also used by the public key export tests, with the
+// RFC 6979 signature of the SHA-256 of "sample"
+static const uint8_t k1_private_key[32] = {
+	0x7b, 0x9e, 0x34, 0x32, 0xde, 0xe7, 0xb1, 0xce, 0xb7, 0x19, 0x49, 0x6d, 0x30, 0xb8, 0x6a, 0x76,
+	0xcc, 0x34, 0xb6, 0x81, 0x59, 0x19, 0x32, 0x80, 0x99, 0x46, 0x8d, 0xd9, 0xa9, 0x9d, 0xc0, 0x1c};
+static const uint8_t k1_sample_signature[64] = {
+	0xcb, 0x99, 0xf8, 0xae, 0x19, 0xe7, 0x6a, 0x36, 0xcb, 0x57, 0x03, 0x1b, 0x49, 0x1d, 0xd0, 0x9b,
+	0x5f, 0x7f, 0x9d, 0xe7, 0xc1, 0x88, 0xef, 0x66, 0x27, 0x36, 0x24, 0xea, 0x33, 0x11, 0xba, 0x0c,
+	0x0f, 0x43, 0x54, 0x52, 0xb8, 0x11, 0x71, 0x7c, 0x70, 0x6f, 0x65, 0xfb, 0x55, 0xe9, 0x88, 0xa5,
+	0xf5, 0xdb, 0xec, 0x3e, 0xb0, 0x95, 0x60, 0x70, 0xd8, 0x10, 0xad, 0x11, 0xf7, 0xfc, 0xf0, 0xea};
+static const uint8_t k1_public_key[65] = {
+	0x04, 0xd3, 0xe3, 0x55, 0x5d, 0x86, 0xd4, 0x04, 0xfa, 0x93, 0x7c, 0x1d, 0xff, 0x8c, 0xe3, 0xf1,
+	0x77, 0x7d, 0xc1, 0x1a, 0x0e, 0x7f, 0xf9, 0x72, 0xca, 0xb0, 0xef, 0x8f, 0x7e, 0xfc, 0x62, 0x26,
+	0x79, 0x49, 0xd6, 0x39, 0xfc, 0xee, 0xbf, 0xcb, 0x1c, 0x34, 0x95, 0xf5, 0x0c, 0x56, 0x94, 0xd7,
+	0x16, 0xb7, 0xd6, 0x44, 0x3e, 0x2a, 0x50, 0xba, 0xf4, 0x6a, 0xc5, 0xfe, 0xe6, 0xb6, 0x65, 0x22,
+	0x06};
+// R of k1_sample_signature has an odd y coordinate
+static const uint8_t k1_sample_recovery_id = 1;
+
+class PsaSignHash : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportKeyPair(psa_ecc_family_t family, const uint8_t* data, size_t data_length,
+							   psa_algorithm_t alg)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH);
+		psa_set_key_algorithm(&attributes, alg);
+		psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_KEY_PAIR(family));
+		psa_set_key_bits(&attributes, 256);
+		psa_status_t status = psa_import_key(&attributes, data, data_length, &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+
+	void ExpectDeterministicSignature(psa_ecc_family_t family, const uint8_t* private_key,
+									  const uint8_t* hash, const uint8_t* expected)
+	{
+		const psa_algorithm_t alg = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256);
+		psa_key_id_t key_id = ImportKeyPair(family, private_key, 32, alg);
+		uint8_t signature[64] = {0};
+		size_t signature_length = 0;
+
+		ASSERT_EQ(psa_sign_hash(key_id, alg, hash, 32, signature, sizeof(signature),
+								&signature_length),
+				  PSA_SUCCESS);
+		ASSERT_EQ(signature_length, sizeof(signature));
+		EXPECT_EQ(memcmp(signature, expected, sizeof(signature)), 0);
+		EXPECT_EQ(psa_verify_hash(key_id, alg, hash, 32, signature, signature_length),
+				  PSA_SUCCESS);
+	}
+};
+
+TEST_F(PsaSignHash, DeterministicP256Sample)
+{
+	ExpectDeterministicSignature(PSA_ECC_FAMILY_SECP_R1, p256_private_key, sample_sha256,
+								 p256_sample_signature);
+}
+
+TEST_F(PsaSignHash, DeterministicP256Test)
+{
+	ExpectDeterministicSignature(PSA_ECC_FAMILY_SECP_R1, p256_private_key, test_sha256,
+								 p256_test_signature);
+}
+
+TEST_F(PsaSignHash, DeterministicK1)
+{
+	ExpectDeterministicSignature(PSA_ECC_FAMILY_SECP_K1, k1_private_key, sample_sha256,
+								 k1_sample_signature);
+}
+
+TEST_F(PsaSignHash, DeterministicIsRepeatable)
+{
+	const psa_algorithm_t alg = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256);
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, 32, alg);
+	uint8_t first[64], second[64];
+	size_t length = 0;
+
+	ASSERT_EQ(psa_sign_hash(key_id, alg, test_sha256, 32, first, sizeof(first), &length),
+			  PSA_SUCCESS);
+	for(int i = 0; i < 4; i++)
+	{
+		ASSERT_EQ(psa_sign_hash(key_id, alg, test_sha256, 32, second, sizeof(second), &length),
+				  PSA_SUCCESS);
+		EXPECT_EQ(memcmp(first, second, sizeof(first)), 0);
+	}
+}
+
+// The randomized variant keeps drawing its nonce from the RNG
+TEST_F(PsaSignHash, RandomizedDiffersFromDeterministic)
+{
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, 32, alg);
+	uint8_t first[64], second[64];
+	size_t length = 0;
+
+	ASSERT_EQ(psa_sign_hash(key_id, alg, sample_sha256, 32, first, sizeof(first), &length),
+			  PSA_SUCCESS);
+	ASSERT_EQ(psa_sign_hash(key_id, alg, sample_sha256, 32, second, sizeof(second), &length),
+			  PSA_SUCCESS);
+	EXPECT_NE(memcmp(first, second, sizeof(first)), 0);
+	EXPECT_NE(memcmp(first, p256_sample_signature, sizeof(first)), 0);
+	EXPECT_EQ(psa_verify_hash(key_id, alg, sample_sha256, 32, first, length), PSA_SUCCESS);
+}
+
+// Only HMAC-SHA-256 is available to derive the nonce
+TEST_F(PsaSignHash, DeterministicOtherHashNotSupported)
+{
+	const psa_algorithm_t alg = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_384);
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_R1, p256_private_key, 32, alg);
+	uint8_t hash[48] = {0};
+	uint8_t signature[64];
+	size_t length = 0;
+
+	EXPECT_EQ(psa_sign_hash(key_id, alg, hash, sizeof(hash), signature, sizeof(signature),
+							&length),
+			  PSA_ERROR_NOT_SUPPORTED);
+}
+
+TEST_F(PsaSignHash, RecoverableK1KnownSignature)
+{
+	const psa_algorithm_t alg = PSA_ALG_DETERMINISTIC_ECDSA(PSA_ALG_SHA_256);
+	psa_key_id_t key_id = ImportKeyPair(PSA_ECC_FAMILY_SECP_K1, k1_private_key, 32, alg);
+	uint8_t signature[IOTEX_PSA_ECDSA_RECOVERABLE_SIGNATURE_SIZE(256)];
+	uint8_t public_key[65];
+	size_t length = 0;
+
+	ASSERT_EQ(iotex_psa_sign_hash_recoverable(key_id, alg, sample_sha256, 32, signature,
+											  sizeof(signature), &length),
+			  PSA_SUCCESS);
+	ASSERT_EQ(length, 65u);
+	EXPECT_EQ(memcmp(signature, k1_sample_signature, 64), 0);
+	EXPECT_EQ(signature[64], k1_sample_recovery_id);
+
+	ASSERT_EQ(iotex_psa_recover_public_key(PSA_ECC_FAMILY_SECP_K1, alg, sample_sha256, 32,
+										   signature, length, public_key, sizeof(public_key),
+										   &length),
+			  PSA_SUCCESS);
+	ASSERT_EQ(length, sizeof(public_key));
+	EXPECT_EQ(memcmp(public_key, k1_public_key, sizeof(public_key)), 0);
+
+	// The other parity gives a valid point but somebody else's key
+	signature[64] ^= 1;
+	ASSERT_EQ(iotex_psa_recover_public_key(PSA_ECC_FAMILY_SECP_K1, alg, sample_sha256, 32,
+										   signature, 65, public_key, sizeof(public_key),
+										   &length),
+			  PSA_SUCCESS);
+	EXPECT_NE(memcmp(public_key, k1_public_key, sizeof(public_key)), 0);
+}
+
+// Randomized signatures on both curves recover the exported public key
+TEST_F(PsaSignHash, RecoverableRoundTrip)
+{
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	const psa_ecc_family_t families[2] = {PSA_ECC_FAMILY_SECP_R1, PSA_ECC_FAMILY_SECP_K1};
+	const uint8_t* private_keys[2] = {p256_private_key, k1_private_key};
+
+	for(int i = 0; i < 2; i++)
+	{
+		psa_key_id_t key_id = ImportKeyPair(families[i], private_keys[i], 32, alg);
+		uint8_t expected[65], public_key[65];
+		uint8_t signature[65];
+		size_t length = 0;
+
+		ASSERT_EQ(psa_export_public_key(key_id, expected, sizeof(expected), &length),
+				  PSA_SUCCESS);
+		for(int j = 0; j < 8; j++)
+		{
+			ASSERT_EQ(iotex_psa_sign_hash_recoverable(key_id, alg, test_sha256, 32, signature,
+													  sizeof(signature), &length),
+					  PSA_SUCCESS);
+			ASSERT_LE(signature[64], 3);
+			EXPECT_EQ(psa_verify_hash(key_id, alg, test_sha256, 32, signature, 64), PSA_SUCCESS);
+			ASSERT_EQ(iotex_psa_recover_public_key(families[i], alg, test_sha256, 32, signature,
+												   sizeof(signature), public_key,
+												   sizeof(public_key), &length),
+					  PSA_SUCCESS);
+			EXPECT_EQ(memcmp(public_key, expected, sizeof(expected)), 0);
+		}
+	}
+}
+
+TEST_F(PsaSignHash, RecoverMalformedSignature)
+{
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	uint8_t signature[65];
+	uint8_t public_key[65];
+	size_t length = 0;
+
+	memcpy(signature, k1_sample_signature, 64);
+	signature[64] = 4;
+	EXPECT_EQ(iotex_psa_recover_public_key(PSA_ECC_FAMILY_SECP_K1, alg, sample_sha256, 32,
+										   signature, sizeof(signature), public_key,
+										   sizeof(public_key), &length),
+			  PSA_ERROR_INVALID_SIGNATURE);
+
+	// r = 0
+	memset(signature, 0, 32);
+	signature[64] = 0;
+	EXPECT_EQ(iotex_psa_recover_public_key(PSA_ECC_FAMILY_SECP_K1, alg, sample_sha256, 32,
+										   signature, sizeof(signature), public_key,
+										   sizeof(public_key), &length),
+			  PSA_ERROR_INVALID_SIGNATURE);
+
+	// Without the recovery id
+	EXPECT_EQ(iotex_psa_recover_public_key(PSA_ECC_FAMILY_SECP_K1, alg, sample_sha256, 32,
+										   k1_sample_signature, 64, public_key,
+										   sizeof(public_key), &length),
+			  PSA_ERROR_INVALID_SIGNATURE);
+
+	memcpy(signature, k1_sample_signature, 64);
+	signature[64] = k1_sample_recovery_id;
+	EXPECT_EQ(iotex_psa_recover_public_key(PSA_ECC_FAMILY_SECP_K1, alg, sample_sha256, 32,
+										   signature, sizeof(signature), public_key, 64,
+										   &length),
+			  PSA_ERROR_BUFFER_TOO_SMALL);
+}
@@ -0,0 +1,316 @@
+#include "PSACrypto.h"
+#include "test_helpers.h"
+#include <gtest/gtest.h>
+#include <string.h>
+
+// RFC 6979 A.2.5: P-256 key, SHA-256 signature of "sample" with the deterministic nonce
+static const uint8_t p256_private_key[32] = {
+	0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16, 0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+	0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12, 0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21};
+static const uint8_t p256_public_key[65] = {
+	0x04, 0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d, 0x31, 0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d,
+	0x68, 0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa, 0x6c, 0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f,
+	0xb6, 0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc, 0x99, 0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc,
+	0x64, 0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f, 0x51, 0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22,
+	0x99};
+static const uint8_t p256_sample_sha256[32] = {
+	0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+	0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf};
+static const uint8_t p256_sample_signature[64] = {
+	0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+	0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+	0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+	0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8};
+
+// secp256k1 key pair also used by the public key export tests
+static const uint8_t k1_private_key[32] = {
+	0x7b, 0x9e, 0x34, 0x32, 0xde, 0xe7, 0xb1, 0xce, 0xb7, 0x19, 0x49, 0x6d, 0x30, 0xb8, 0x6a, 0x76,
+	0xcc, 0x34, 0xb6, 0x81, 0x59, 0x19, 0x32, 0x80, 0x99, 0x46, 0x8d, 0xd9, 0xa9, 0x9d, 0xc0, 0x1c};
+static const uint8_t k1_public_key[65] = {
+	0x04, 0xd3, 0xe3, 0x55, 0x5d, 0x86, 0xd4, 0x04, 0xfa, 0x93, 0x7c, 0x1d, 0xff, 0x8c, 0xe3, 0xf1,
+	0x77, 0x7d, 0xc1, 0x1a, 0x0e, 0x7f, 0xf9, 0x72, 0xca, 0xb0, 0xef, 0x8f, 0x7e, 0xfc, 0x62, 0x26,
+	0x79, 0x49, 0xd6, 0x39, 0xfc, 0xee, 0xbf, 0xcb, 0x1c, 0x34, 0x95, 0xf5, 0x0c, 0x56, 0x94, 0xd7,
+	0x16, 0xb7, 0xd6, 0x44, 0x3e, 0x2a, 0x50, 0xba, 0xf4, 0x6a, 0xc5, 0xfe, 0xe6, 0xb6, 0x65, 0x22,
+	0x06};
+
+// Signature of the SHA-256 of "sample" with the key above, made by OpenSSL
+static const uint8_t k1_sample_signature[64] = {
+	0x46, 0x44, 0xcf, 0x2e, 0xc6, 0x11, 0xe0, 0x5e, 0xd7, 0xa2, 0x98, 0x5c, 0x4f, 0xd5, 0xe0, 0xc6,
+	0xca, 0x89, 0x26, 0x28, 0xbf, 0x09, 0xd1, 0x84, 0x76, 0x40, 0xfc, 0x6f, 0x47, 0xe8, 0x63, 0xed,
+	0x59, 0x50, 0x2e, 0x76, 0xac, 0xc8, 0x80, 0x24, 0x96, 0xb2, 0x56, 0xfd, 0x4c, 0x6a, 0xdf, 0xdb,
+	0xd4, 0xf2, 0xf7, 0xc9, 0x36, 0x13, 0x4c, 0x3d, 0xb2, 0x46, 0x10, 0x8d, 0x8b, 0xb1, 0x3c, 0xd2};
+
+class PsaVerifyHash : public ::testing::Test
+{
+  protected:
+	void SetUp() override
+	{
+		psa_crypto_init();
+	}
+	void TearDown() override
+	{
+		reset_global_data();
+		crypto_slot_management_reset_global_data();
+	}
+
+	psa_key_id_t ImportEccKey(psa_key_type_t type, const uint8_t* data, size_t data_length,
+							  psa_key_usage_t usage = PSA_KEY_USAGE_VERIFY_HASH |
+													  PSA_KEY_USAGE_VERIFY_MESSAGE)
+	{
+		psa_key_id_t key_id = 0;
+		psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+		psa_set_key_usage_flags(&attributes, usage);
+		psa_set_key_algorithm(&attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+		psa_set_key_type(&attributes, type);
+		psa_set_key_bits(&attributes, 256);
+		psa_status_t status = psa_import_key(&attributes, data, data_length, &key_id);
+		EXPECT_EQ(status, PSA_SUCCESS);
+		return key_id;
+	}
+};
+
+TEST_F(PsaVerifyHash, P256PublicKeyKnownSignature)
+{
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),
+									   p256_public_key, sizeof(p256_public_key));
+	psa_status_t status =
+		psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+						sizeof(p256_sample_sha256), p256_sample_signature,
+						sizeof(p256_sample_signature));
+	EXPECT_EQ(status, PSA_SUCCESS);
+}
+
+TEST_F(PsaVerifyHash, P256KeyPairKnownSignature)
+{
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+									   p256_private_key, sizeof(p256_private_key));
+	psa_status_t status =
+		psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+						sizeof(p256_sample_sha256), p256_sample_signature,
+						sizeof(p256_sample_signature));
+	EXPECT_EQ(status, PSA_SUCCESS);
+}
+
+TEST_F(PsaVerifyHash, K1PublicKeyKnownSignature)
+{
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_K1),
+									   k1_public_key, sizeof(k1_public_key));
+	psa_status_t status =
+		psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+						sizeof(p256_sample_sha256), k1_sample_signature,
+						sizeof(k1_sample_signature));
+	EXPECT_EQ(status, PSA_SUCCESS);
+
+	// The P-256 signature of the same hash must not verify with this key
+	status = psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+							 sizeof(p256_sample_sha256), p256_sample_signature,
+							 sizeof(p256_sample_signature));
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_F(PsaVerifyHash, P256VerifyMessage)
+{
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),
+									   p256_public_key, sizeof(p256_public_key));
+	psa_status_t status =
+		psa_verify_message(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), (const uint8_t*)"sample", 6,
+						   p256_sample_signature, sizeof(p256_sample_signature));
+	EXPECT_EQ(status, PSA_SUCCESS);
+}
+
+TEST_F(PsaVerifyHash, TamperedSignature)
+{
+	uint8_t signature[sizeof(p256_sample_signature)];
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),
+									   p256_public_key, sizeof(p256_public_key));
+	memcpy(signature, p256_sample_signature, sizeof(signature));
+	signature[40] ^= 0x01;
+	psa_status_t status = psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+										  p256_sample_sha256, sizeof(p256_sample_sha256),
+										  signature, sizeof(signature));
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_F(PsaVerifyHash, TruncatedSignature)
+{
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),
+									   p256_public_key, sizeof(p256_public_key));
+	psa_status_t status = psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+										  p256_sample_sha256, sizeof(p256_sample_sha256),
+										  p256_sample_signature, sizeof(p256_sample_signature) - 1);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_F(PsaVerifyHash, UsageFlagNotSet)
+{
+	psa_key_id_t key_id =
+		ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1), p256_public_key,
+					 sizeof(p256_public_key), PSA_KEY_USAGE_VERIFY_MESSAGE);
+	psa_status_t status =
+		psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+						sizeof(p256_sample_sha256), p256_sample_signature,
+						sizeof(p256_sample_signature));
+	EXPECT_EQ(status, PSA_ERROR_NOT_PERMITTED);
+}
+
+TEST_F(PsaVerifyHash, PointNotOnCurve)
+{
+	psa_key_id_t key_id = 0;
+	psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+	uint8_t public_key[sizeof(p256_public_key)];
+	memcpy(public_key, p256_public_key, sizeof(public_key));
+	public_key[64] ^= 0x01;
+	psa_set_key_usage_flags(&attributes, PSA_KEY_USAGE_VERIFY_HASH);
+	psa_set_key_algorithm(&attributes, PSA_ALG_ECDSA(PSA_ALG_SHA_256));
+	psa_set_key_type(&attributes, PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1));
+	psa_status_t status = psa_import_key(&attributes, public_key, sizeof(public_key), &key_id);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_ARGUMENT);
+}
+
+TEST_F(PsaVerifyHash, SignVerifyRoundTrip)
+{
+	uint8_t signature[64];
+	size_t signature_length = 0;
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_K1),
+									   k1_private_key, sizeof(k1_private_key),
+									   PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH);
+	psa_status_t status =
+		psa_sign_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+					  sizeof(p256_sample_sha256), signature, sizeof(signature), &signature_length);
+	ASSERT_EQ(status, PSA_SUCCESS);
+	ASSERT_EQ(signature_length, sizeof(signature));
+
+	status = psa_verify_hash(key_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+							 sizeof(p256_sample_sha256), signature, signature_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+
+	psa_key_id_t public_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_K1),
+										  k1_public_key, sizeof(k1_public_key));
+	status = psa_verify_hash(public_id, PSA_ALG_ECDSA(PSA_ALG_SHA_256), p256_sample_sha256,
+							 sizeof(p256_sample_sha256), signature, signature_length);
+	EXPECT_EQ(status, PSA_SUCCESS);
+}
+
+TEST_F(PsaVerifyHash, ExportPublicKeyPerSlot)
+{
+	uint8_t exported[65];
+	size_t exported_length = 0;
+	psa_key_id_t p256_id = ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1),
+										p256_private_key, sizeof(p256_private_key));
+	psa_key_id_t k1_id = ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_K1),
+									  k1_private_key, sizeof(k1_private_key));
+
+	// Each slot keeps its own public key, whichever was imported last
+	psa_status_t status =
+		psa_export_public_key(p256_id, exported, sizeof(exported), &exported_length);
+	ASSERT_EQ(status, PSA_SUCCESS);
+	ASSERT_EQ(exported_length, sizeof(p256_public_key));
+	EXPECT_EQ(memcmp(exported, p256_public_key, sizeof(p256_public_key)), 0);
+
+	status = psa_export_public_key(k1_id, exported, sizeof(exported), &exported_length);
+	ASSERT_EQ(status, PSA_SUCCESS);
+	ASSERT_EQ(exported_length, sizeof(k1_public_key));
+	EXPECT_EQ(memcmp(exported, k1_public_key, sizeof(k1_public_key)), 0);
+}
+
+TEST_F(PsaVerifyHash, ExportPublicKeyOfPublicKey)
+{
+	uint8_t exported[65];
+	size_t exported_length = 0;
+	psa_key_id_t key_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),
+									   p256_public_key, sizeof(p256_public_key));
+	psa_status_t status =
+		psa_export_public_key(key_id, exported, sizeof(exported), &exported_length);
+	ASSERT_EQ(status, PSA_SUCCESS);
+	ASSERT_EQ(exported_length, sizeof(p256_public_key));
+	EXPECT_EQ(memcmp(exported, p256_public_key, sizeof(p256_public_key)), 0);
+}
+
+TEST_F(PsaVerifyHash, BatchMatchesSingleVerify)
+{
+	uint8_t tampered[sizeof(p256_sample_signature)];
+	memcpy(tampered, p256_sample_signature, sizeof(tampered));
+	tampered[40] ^= 0x01;
+	psa_key_id_t p256_id = ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1),
+										p256_public_key, sizeof(p256_public_key));
+	psa_key_id_t k1_id = ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_K1),
+									  k1_private_key, sizeof(k1_private_key));
+	psa_key_id_t no_usage_id =
+		ImportEccKey(PSA_KEY_TYPE_ECC_PUBLIC_KEY(PSA_ECC_FAMILY_SECP_R1), p256_public_key,
+					 sizeof(p256_public_key), PSA_KEY_USAGE_VERIFY_MESSAGE);
+	const psa_algorithm_t alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+	const iotex_psa_verify_hash_batch_item_t items[] = {
+		{p256_id, alg, p256_sample_sha256, 32, p256_sample_signature, 64},
+		{k1_id, alg, p256_sample_sha256, 32, k1_sample_signature, 64},
+		{p256_id, alg, p256_sample_sha256, 32, tampered, 64},
+		{k1_id, alg, p256_sample_sha256, 32, p256_sample_signature, 64},
+		{p256_id, alg, p256_sample_sha256, 32, p256_sample_signature, 63},
+		{no_usage_id, alg, p256_sample_sha256, 32, p256_sample_signature, 64},
+		{0, alg, p256_sample_sha256, 32, p256_sample_signature, 64},
+		{p256_id, PSA_ALG_SHA_256, p256_sample_sha256, 32, p256_sample_signature, 64},
+		{k1_id, alg, p256_sample_sha256, 32, k1_sample_signature, 64},
+	};
+	const size_t count = sizeof(items) / sizeof(items[0]);
+	psa_status_t results[count];
+
+	psa_status_t status = iotex_psa_verify_hash_batch(items, count, results);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+	EXPECT_EQ(results[0], PSA_SUCCESS);
+	EXPECT_EQ(results[1], PSA_SUCCESS);
+	EXPECT_EQ(results[5], PSA_ERROR_NOT_PERMITTED);
+	EXPECT_EQ(results[8], PSA_SUCCESS);
+	for(size_t i = 0; i < count; i++)
+	{
+		EXPECT_EQ(results[i],
+				  psa_verify_hash(items[i].key, items[i].alg, items[i].hash,
+								  items[i].hash_length, items[i].signature,
+								  items[i].signature_length))
+			<< "item " << i;
+	}
+}
+
+TEST_F(PsaVerifyHash, BatchManyItems)
+{
+	// More items than are locked or verified together at once
+	const size_t count = 70;
+	psa_key_id_t keys[2] = {
+		ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_R1), p256_private_key,
+					 sizeof(p256_private_key),
+					 PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH),
+		ImportEccKey(PSA_KEY_TYPE_ECC_KEY_PAIR(PSA_ECC_FAMILY_SECP_K1), k1_private_key,
+					 sizeof(k1_private_key), PSA_KEY_USAGE_SIGN_HASH | PSA_KEY_USAGE_VERIFY_HASH)};
+	uint8_t hashes[count][32];
+	uint8_t signatures[count][64];
+	iotex_psa_verify_hash_batch_item_t items[count];
+	psa_status_t results[count];
+
+	for(size_t i = 0; i < count; i++)
+	{
+		size_t signature_length = 0;
+		memcpy(hashes[i], p256_sample_sha256, sizeof(hashes[i]));
+		hashes[i][0] = (uint8_t)i;
+		ASSERT_EQ(psa_sign_hash(keys[i % 2], PSA_ALG_ECDSA(PSA_ALG_SHA_256), hashes[i], 32,
+								signatures[i], sizeof(signatures[i]), &signature_length),
+				  PSA_SUCCESS);
+		// Every fifth signature is made invalid
+		if(i % 5 == 3)
+			signatures[i][10] ^= 0x80;
+		items[i] = {keys[i % 2], PSA_ALG_ECDSA(PSA_ALG_SHA_256),
+					hashes[i], 32, signatures[i], 64};
+	}
+
+	psa_status_t status = iotex_psa_verify_hash_batch(items, count, results);
+	EXPECT_EQ(status, PSA_ERROR_INVALID_SIGNATURE);
+	for(size_t i = 0; i < count; i++)
+		EXPECT_EQ(results[i], i % 5 == 3 ? PSA_ERROR_INVALID_SIGNATURE : PSA_SUCCESS)
+			<< "item " << i;
+
+	EXPECT_EQ(iotex_psa_verify_hash_batch(items, 3, results), PSA_SUCCESS);
+}
+
+TEST_F(PsaVerifyHash, BatchInvalidArguments)
+{
+	psa_status_t results[1];
+	EXPECT_EQ(iotex_psa_verify_hash_batch(NULL, 1, results), PSA_ERROR_INVALID_ARGUMENT);
+	EXPECT_EQ(iotex_psa_verify_hash_batch(NULL, 0, NULL), PSA_SUCCESS);
+}
@@ -0,0 +1,195 @@
+#include "include/tinycrypt/constants.h"
+#include "include/tinycrypt/ecc.h"
+#include <gtest/gtest.h>
+#include <string.h>
+
+#if uECC_VERIFY_WNAF_WIDTH && uECC_SECP256K1_GLV
+
+#define RANDOM_ROUNDS 64
+
+// Scalars whose GLV halves are zero, even, negative or at the 128-bit bound,
+// with the multiple of G each one gives.
+static const struct
+{
+	uint8_t scalar[32];
+	uint8_t point[64];
+} edge_cases[] = {
+	// 1
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01},
+	 {0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac, 0x55, 0xa0, 0x62, 0x95, 0xce, 0x87, 0x0b, 0x07,
+	  0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9, 0x59, 0xf2, 0x81, 0x5b, 0x16, 0xf8, 0x17, 0x98,
+	  0x48, 0x3a, 0xda, 0x77, 0x26, 0xa3, 0xc4, 0x65, 0x5d, 0xa4, 0xfb, 0xfc, 0x0e, 0x11, 0x08, 0xa8,
+	  0xfd, 0x17, 0xb4, 0x48, 0xa6, 0x85, 0x54, 0x19, 0x9c, 0x47, 0xd0, 0x8f, 0xfb, 0x10, 0xd4, 0xb8}},
+	// 2
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02},
+	 {0xc6, 0x04, 0x7f, 0x94, 0x41, 0xed, 0x7d, 0x6d, 0x30, 0x45, 0x40, 0x6e, 0x95, 0xc0, 0x7c, 0xd8,
+	  0x5c, 0x77, 0x8e, 0x4b, 0x8c, 0xef, 0x3c, 0xa7, 0xab, 0xac, 0x09, 0xb9, 0x5c, 0x70, 0x9e, 0xe5,
+	  0x1a, 0xe1, 0x68, 0xfe, 0xa6, 0x3d, 0xc3, 0x39, 0xa3, 0xc5, 0x84, 0x19, 0x46, 0x6c, 0xea, 0xee,
+	  0xf7, 0xf6, 0x32, 0x65, 0x32, 0x66, 0xd0, 0xe1, 0x23, 0x64, 0x31, 0xa9, 0x50, 0xcf, 0xe5, 0x2a}},
+	// 3
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03},
+	 {0xf9, 0x30, 0x8a, 0x01, 0x92, 0x58, 0xc3, 0x10, 0x49, 0x34, 0x4f, 0x85, 0xf8, 0x9d, 0x52, 0x29,
+	  0xb5, 0x31, 0xc8, 0x45, 0x83, 0x6f, 0x99, 0xb0, 0x86, 0x01, 0xf1, 0x13, 0xbc, 0xe0, 0x36, 0xf9,
+	  0x38, 0x8f, 0x7b, 0x0f, 0x63, 0x2d, 0xe8, 0x14, 0x0f, 0xe3, 0x37, 0xe6, 0x2a, 0x37, 0xf3, 0x56,
+	  0x65, 0x00, 0xa9, 0x99, 0x34, 0xc2, 0x23, 0x1b, 0x6c, 0xb9, 0xfd, 0x75, 0x84, 0xb8, 0xe6, 0x72}},
+	// lambda
+	{{0x53, 0x63, 0xad, 0x4c, 0xc0, 0x5c, 0x30, 0xe0, 0xa5, 0x26, 0x1c, 0x02, 0x88, 0x12, 0x64, 0x5a,
+	  0x12, 0x2e, 0x22, 0xea, 0x20, 0x81, 0x66, 0x78, 0xdf, 0x02, 0x96, 0x7c, 0x1b, 0x23, 0xbd, 0x72},
+	 {0xbc, 0xac, 0xe2, 0xe9, 0x9d, 0xa0, 0x18, 0x87, 0xab, 0x01, 0x02, 0xb6, 0x96, 0x90, 0x23, 0x25,
+	  0x87, 0x28, 0x44, 0x06, 0x7f, 0x15, 0xe9, 0x8d, 0xa7, 0xbb, 0xa0, 0x44, 0x00, 0xb8, 0x8f, 0xcb,
+	  0x48, 0x3a, 0xda, 0x77, 0x26, 0xa3, 0xc4, 0x65, 0x5d, 0xa4, 0xfb, 0xfc, 0x0e, 0x11, 0x08, 0xa8,
+	  0xfd, 0x17, 0xb4, 0x48, 0xa6, 0x85, 0x54, 0x19, 0x9c, 0x47, 0xd0, 0x8f, 0xfb, 0x10, 0xd4, 0xb8}},
+	// n - lambda
+	{{0xac, 0x9c, 0x52, 0xb3, 0x3f, 0xa3, 0xcf, 0x1f, 0x5a, 0xd9, 0xe3, 0xfd, 0x77, 0xed, 0x9b, 0xa4,
+	  0xa8, 0x80, 0xb9, 0xfc, 0x8e, 0xc7, 0x39, 0xc2, 0xe0, 0xcf, 0xc8, 0x10, 0xb5, 0x12, 0x83, 0xcf},
+	 {0xbc, 0xac, 0xe2, 0xe9, 0x9d, 0xa0, 0x18, 0x87, 0xab, 0x01, 0x02, 0xb6, 0x96, 0x90, 0x23, 0x25,
+	  0x87, 0x28, 0x44, 0x06, 0x7f, 0x15, 0xe9, 0x8d, 0xa7, 0xbb, 0xa0, 0x44, 0x00, 0xb8, 0x8f, 0xcb,
+	  0xb7, 0xc5, 0x25, 0x88, 0xd9, 0x5c, 0x3b, 0x9a, 0xa2, 0x5b, 0x04, 0x03, 0xf1, 0xee, 0xf7, 0x57,
+	  0x02, 0xe8, 0x4b, 0xb7, 0x59, 0x7a, 0xab, 0xe6, 0x63, 0xb8, 0x2f, 0x6f, 0x04, 0xef, 0x27, 0x77}},
+	// 2^128
+	{{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+	  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+	 {0x8f, 0x68, 0xb9, 0xd2, 0xf6, 0x3b, 0x5f, 0x33, 0x92, 0x39, 0xc1, 0xad, 0x98, 0x1f, 0x16, 0x2e,
+	  0xe8, 0x8c, 0x56, 0x78, 0x72, 0x3e, 0xa3, 0x35, 0x1b, 0x7b, 0x44, 0x4c, 0x9e, 0xc4, 0xc0, 0xda,
+	  0x66, 0x2a, 0x9f, 0x2d, 0xba, 0x06, 0x39, 0x86, 0xde, 0x1d, 0x90, 0xc2, 0xb6, 0xbe, 0x21, 0x5d,
+	  0xbb, 0xea, 0x2c, 0xfe, 0x95, 0x51, 0x0b, 0xfd, 0xf2, 0x3c, 0xbf, 0x79, 0x50, 0x1f, 0xff, 0x82}},
+	// n - 1
+	{{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	  0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x40},
+	 {0x79, 0xbe, 0x66, 0x7e, 0xf9, 0xdc, 0xbb, 0xac, 0x55, 0xa0, 0x62, 0x95, 0xce, 0x87, 0x0b, 0x07,
+	  0x02, 0x9b, 0xfc, 0xdb, 0x2d, 0xce, 0x28, 0xd9, 0x59, 0xf2, 0x81, 0x5b, 0x16, 0xf8, 0x17, 0x98,
+	  0xb7, 0xc5, 0x25, 0x88, 0xd9, 0x5c, 0x3b, 0x9a, 0xa2, 0x5b, 0x04, 0x03, 0xf1, 0xee, 0xf7, 0x57,
+	  0x02, 0xe8, 0x4b, 0xb7, 0x59, 0x7a, 0xab, 0xe6, 0x63, 0xb8, 0x2f, 0x6f, 0x04, 0xef, 0x27, 0x77}},
+	// n - 2
+	{{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	  0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x3f},
+	 {0xc6, 0x04, 0x7f, 0x94, 0x41, 0xed, 0x7d, 0x6d, 0x30, 0x45, 0x40, 0x6e, 0x95, 0xc0, 0x7c, 0xd8,
+	  0x5c, 0x77, 0x8e, 0x4b, 0x8c, 0xef, 0x3c, 0xa7, 0xab, 0xac, 0x09, 0xb9, 0x5c, 0x70, 0x9e, 0xe5,
+	  0xe5, 0x1e, 0x97, 0x01, 0x59, 0xc2, 0x3c, 0xc6, 0x5c, 0x3a, 0x7b, 0xe6, 0xb9, 0x93, 0x15, 0x11,
+	  0x08, 0x09, 0xcd, 0x9a, 0xcd, 0x99, 0x2f, 0x1e, 0xdc, 0x9b, 0xce, 0x55, 0xaf, 0x30, 0x17, 0x05}},
+	// n + 5, the same as 5
+	{{0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe,
+	  0xba, 0xae, 0xdc, 0xe6, 0xaf, 0x48, 0xa0, 0x3b, 0xbf, 0xd2, 0x5e, 0x8c, 0xd0, 0x36, 0x41, 0x46},
+	 {0x2f, 0x8b, 0xde, 0x4d, 0x1a, 0x07, 0x20, 0x93, 0x55, 0xb4, 0xa7, 0x25, 0x0a, 0x5c, 0x51, 0x28,
+	  0xe8, 0x8b, 0x84, 0xbd, 0xdc, 0x61, 0x9a, 0xb7, 0xcb, 0xa8, 0xd5, 0x69, 0xb2, 0x40, 0xef, 0xe4,
+	  0xd8, 0xac, 0x22, 0x26, 0x36, 0xe5, 0xe3, 0xd6, 0xd4, 0xdb, 0xa9, 0xdd, 0xa6, 0xc9, 0xc4, 0x26,
+	  0xf7, 0x88, 0x27, 0x1b, 0xab, 0x0d, 0x68, 0x40, 0xdc, 0xa8, 0x7d, 0x3a, 0xa6, 0xac, 0x62, 0xd6}},
+};
+
+static void to_bytes(uint8_t* bytes, const uECC_word_t* point)
+{
+	uECC_vli_nativeToBytes(bytes, NUM_ECC_BYTES, point);
+	uECC_vli_nativeToBytes(bytes + NUM_ECC_BYTES, NUM_ECC_BYTES, point + NUM_ECC_WORDS);
+}
+
+// k*Q through the co-Z Montgomery ladder the other curves use.
+static void ladder_mult(uECC_word_t* result, const uECC_word_t* point, const uECC_word_t* k,
+						uECC_Curve curve)
+{
+	uECC_word_t k0[NUM_ECC_WORDS];
+	uECC_word_t k1[NUM_ECC_WORDS];
+	uECC_word_t* p2[2] = {k0, k1};
+	uECC_word_t carry = regularize_k(k, k0, k1, curve);
+	EccPoint_mult(result, point, p2[!carry], 0, curve->num_n_bits + 1, curve);
+}
+
+static void random_point(uECC_word_t* point, uECC_Curve curve)
+{
+	uECC_word_t d[NUM_ECC_WORDS];
+	ASSERT_EQ(uECC_generate_random_int(d, curve->n, NUM_ECC_WORDS), 1);
+	ASSERT_EQ(EccPoint_compute_public_key(point, d, curve), 1);
+}
+
+TEST(TcEccGlv, MultMatchesLadder)
+{
+	uECC_Curve curve = uECC_secp256k1();
+	uECC_word_t point[2 * NUM_ECC_WORDS];
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t z[NUM_ECC_WORDS];
+	uECC_word_t expected[2 * NUM_ECC_WORDS];
+	uECC_word_t result[2 * NUM_ECC_WORDS];
+
+	for(int i = 0; i < RANDOM_ROUNDS; i++)
+	{
+		random_point(point, curve);
+		ASSERT_EQ(uECC_generate_random_int(k, curve->n, NUM_ECC_WORDS), 1);
+		ladder_mult(expected, point, k, curve);
+
+		ASSERT_EQ(EccPoint_mult_glv(result, point, k, 0, curve), 1);
+		ASSERT_EQ(memcmp(result, expected, sizeof(expected)), 0) << "round " << i;
+
+		// Randomized projective coordinates, with the result over the point.
+		ASSERT_EQ(uECC_generate_random_int(z, curve->p, NUM_ECC_WORDS), 1);
+		ASSERT_EQ(EccPoint_mult_glv(point, point, k, z, curve), 1);
+		ASSERT_EQ(memcmp(point, expected, sizeof(expected)), 0) << "round " << i;
+	}
+}
+
+TEST(TcEccGlv, MultEdgeScalars)
+{
+	uECC_Curve curve = uECC_secp256k1();
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t result[2 * NUM_ECC_WORDS];
+	uint8_t bytes[64];
+
+	for(const auto& edge : edge_cases)
+	{
+		uECC_vli_bytesToNative(k, edge.scalar, sizeof(edge.scalar));
+		ASSERT_EQ(EccPoint_mult_glv(result, curve->G, k, 0, curve), 1);
+		to_bytes(bytes, result);
+		EXPECT_EQ(memcmp(bytes, edge.point, sizeof(bytes)), 0);
+	}
+}
+
+TEST(TcEccGlv, MultInfinity)
+{
+	uECC_Curve curve = uECC_secp256k1();
+	uECC_word_t k[NUM_ECC_WORDS] = {0};
+	uECC_word_t result[2 * NUM_ECC_WORDS];
+
+	EXPECT_EQ(EccPoint_mult_glv(result, curve->G, k, 0, curve), 0);
+	EXPECT_TRUE(EccPoint_isZero(result, curve));
+	EXPECT_EQ(EccPoint_mult_glv(result, curve->G, curve->n, 0, curve), 0);
+	EXPECT_TRUE(EccPoint_isZero(result, curve));
+}
+
+TEST(TcEccGlv, MultRejectsOtherCurves)
+{
+	uECC_word_t k[NUM_ECC_WORDS] = {5};
+	uECC_word_t result[2 * NUM_ECC_WORDS];
+
+	EXPECT_EQ(EccPoint_mult_glv(result, uECC_secp256r1()->G, k, 0, uECC_secp256r1()), 0);
+}
+
+// u1*G + u2*Q with Q = d*G is (u1 + u2*d)*G.
+TEST(TcEccGlv, MultAddMatchesSingleScalar)
+{
+	uECC_Curve curve = uECC_secp256k1();
+	uECC_word_t d[NUM_ECC_WORDS];
+	uECC_word_t u1[NUM_ECC_WORDS];
+	uECC_word_t u2[NUM_ECC_WORDS];
+	uECC_word_t k[NUM_ECC_WORDS];
+	uECC_word_t point[2 * NUM_ECC_WORDS];
+	uECC_word_t expected[2 * NUM_ECC_WORDS];
+	uECC_word_t result[2 * NUM_ECC_WORDS];
+
+	for(int i = 0; i < RANDOM_ROUNDS; i++)
+	{
+		ASSERT_EQ(uECC_generate_random_int(d, curve->n, NUM_ECC_WORDS), 1);
+		ASSERT_EQ(uECC_generate_random_int(u1, curve->n, NUM_ECC_WORDS), 1);
+		ASSERT_EQ(uECC_generate_random_int(u2, curve->n, NUM_ECC_WORDS), 1);
+		ASSERT_EQ(EccPoint_compute_public_key(point, d, curve), 1);
+
+		uECC_vli_modMult_n(k, u2, d, curve);
+		uECC_vli_modAdd(k, k, u1, curve->n, NUM_ECC_WORDS);
+		ASSERT_EQ(EccPoint_compute_public_key(expected, k, curve), 1);
+
+		ASSERT_EQ(EccPoint_mult_add_unsafe(result, u1, u2, point, curve), 1);
+		ASSERT_EQ(memcmp(result, expected, sizeof(expected)), 0) << "round " << i;
+	}
+}
+
+#endif
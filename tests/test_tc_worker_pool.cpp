@@ -0,0 +1,173 @@
+#include "include/tinycrypt/constants.h"
+#include "include/tinycrypt/ecc_dsa.h"
+#include "include/tinycrypt/sha256.h"
+#include "include/tinycrypt/worker_pool.h"
+#include <gtest/gtest.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#if TC_WORKER_POOL
+
+// RFC 6979 A.2.5: P-256 key, SHA-256 signature of "sample" with the deterministic nonce
+static const uint8_t p256_public_key[65] = {
+	0x04, 0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d, 0x31, 0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d,
+	0x68, 0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa, 0x6c, 0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f,
+	0xb6, 0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc, 0x99, 0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc,
+	0x64, 0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f, 0x51, 0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22,
+	0x99};
+static const uint8_t p256_sample_sha256[32] = {
+	0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1, 0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+	0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15, 0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf};
+static const uint8_t p256_sample_signature[64] = {
+	0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd, 0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+	0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91, 0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+	0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41, 0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+	0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06, 0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8};
+
+// secp256k1 key and OpenSSL signature of the same hash, as in test_psa_verify_hash.cpp
+static const uint8_t k1_public_key[65] = {
+	0x04, 0xd3, 0xe3, 0x55, 0x5d, 0x86, 0xd4, 0x04, 0xfa, 0x93, 0x7c, 0x1d, 0xff, 0x8c, 0xe3, 0xf1,
+	0x77, 0x7d, 0xc1, 0x1a, 0x0e, 0x7f, 0xf9, 0x72, 0xca, 0xb0, 0xef, 0x8f, 0x7e, 0xfc, 0x62, 0x26,
+	0x79, 0x49, 0xd6, 0x39, 0xfc, 0xee, 0xbf, 0xcb, 0x1c, 0x34, 0x95, 0xf5, 0x0c, 0x56, 0x94, 0xd7,
+	0x16, 0xb7, 0xd6, 0x44, 0x3e, 0x2a, 0x50, 0xba, 0xf4, 0x6a, 0xc5, 0xfe, 0xe6, 0xb6, 0x65, 0x22,
+	0x06};
+static const uint8_t k1_sample_signature[64] = {
+	0x46, 0x44, 0xcf, 0x2e, 0xc6, 0x11, 0xe0, 0x5e, 0xd7, 0xa2, 0x98, 0x5c, 0x4f, 0xd5, 0xe0, 0xc6,
+	0xca, 0x89, 0x26, 0x28, 0xbf, 0x09, 0xd1, 0x84, 0x76, 0x40, 0xfc, 0x6f, 0x47, 0xe8, 0x63, 0xed,
+	0x59, 0x50, 0x2e, 0x76, 0xac, 0xc8, 0x80, 0x24, 0x96, 0xb2, 0x56, 0xfd, 0x4c, 0x6a, 0xdf, 0xdb,
+	0xd4, 0xf2, 0xf7, 0xc9, 0x36, 0x13, 0x4c, 0x3d, 0xb2, 0x46, 0x10, 0x8d, 0x8b, 0xb1, 0x3c, 0xd2};
+
+class TcWorkerPool : public ::testing::Test
+{
+  protected:
+	void TearDown() override
+	{
+		if(started)
+			tc_worker_pool_free(&pool);
+	}
+
+	void Start(unsigned int threads)
+	{
+		ASSERT_EQ(tc_worker_pool_init(&pool, threads), TC_CRYPTO_SUCCESS);
+		started = true;
+	}
+
+	struct tc_worker_pool_struct pool;
+	bool started = false;
+};
+
+TEST_F(TcWorkerPool, InitRejectsBadThreadCounts)
+{
+	EXPECT_EQ(tc_worker_pool_init(NULL, 2), TC_CRYPTO_FAIL);
+	EXPECT_EQ(tc_worker_pool_init(&pool, 0), TC_CRYPTO_FAIL);
+	EXPECT_EQ(tc_worker_pool_init(&pool, TC_WORKER_POOL_MAX_THREADS + 1), TC_CRYPTO_FAIL);
+}
+
+TEST_F(TcWorkerPool, NullArguments)
+{
+	Start(2);
+	int result = 0;
+	tc_verify_job job = {p256_public_key + 1, p256_sample_sha256, 32, p256_sample_signature,
+						 uECC_secp256r1()};
+
+	EXPECT_EQ(tc_worker_pool_verify(NULL, &job, 1, &result), TC_CRYPTO_FAIL);
+	EXPECT_EQ(tc_worker_pool_verify(&pool, NULL, 1, &result), TC_CRYPTO_FAIL);
+	EXPECT_EQ(tc_worker_pool_verify(&pool, &job, 1, NULL), TC_CRYPTO_FAIL);
+	EXPECT_EQ(tc_worker_pool_sha256(NULL, NULL, 0), TC_CRYPTO_FAIL);
+	EXPECT_EQ(tc_worker_pool_sha256(&pool, NULL, 1), TC_CRYPTO_FAIL);
+
+	// Empty batches are fine
+	EXPECT_EQ(tc_worker_pool_verify(&pool, NULL, 0, NULL), TC_CRYPTO_SUCCESS);
+	EXPECT_EQ(tc_worker_pool_sha256(&pool, NULL, 0), TC_CRYPTO_SUCCESS);
+}
+
+TEST_F(TcWorkerPool, Sha256MatchesSingleThreaded)
+{
+	Start(4);
+	static uint8_t data[2048];
+	for(size_t i = 0; i < sizeof(data); i++)
+		data[i] = (uint8_t)(i * 31 + 7);
+
+	// Lengths vary so that the shards finish at different times and get stolen from
+	const size_t count = 500;
+	std::vector<tc_sha256_job> jobs(count);
+	std::vector<uint8_t> digests(count * TC_SHA256_DIGEST_SIZE);
+	for(size_t i = 0; i < count; i++)
+		jobs[i] = {data, (i * i) % sizeof(data), &digests[i * TC_SHA256_DIGEST_SIZE]};
+	jobs[0].data = NULL;
+
+	ASSERT_EQ(tc_worker_pool_sha256(&pool, jobs.data(), count), TC_CRYPTO_SUCCESS);
+
+	for(size_t i = 0; i < count; i++)
+	{
+		struct tc_sha256_state_struct s;
+		uint8_t expected[TC_SHA256_DIGEST_SIZE];
+		tc_sha256_init(&s);
+		tc_sha256_update(&s, data, jobs[i].data_length);
+		tc_sha256_final(expected, &s);
+		EXPECT_EQ(memcmp(expected, jobs[i].digest, sizeof(expected)), 0) << "job " << i;
+	}
+}
+
+TEST_F(TcWorkerPool, VerifyMixedCurves)
+{
+	uint8_t tampered[64];
+	memcpy(tampered, p256_sample_signature, sizeof(tampered));
+	tampered[40] ^= 0x01;
+
+	const tc_verify_job kinds[] = {
+		{p256_public_key + 1, p256_sample_sha256, 32, p256_sample_signature, uECC_secp256r1()},
+		{k1_public_key + 1, p256_sample_sha256, 32, k1_sample_signature, uECC_secp256k1()},
+		{p256_public_key + 1, p256_sample_sha256, 32, tampered, uECC_secp256r1()},
+		{k1_public_key + 1, p256_sample_sha256, 32, p256_sample_signature, uECC_secp256k1()},
+	};
+	const int expected[] = {TC_CRYPTO_SUCCESS, TC_CRYPTO_SUCCESS, TC_CRYPTO_FAIL, TC_CRYPTO_FAIL};
+
+	const size_t count = 37;
+	std::vector<tc_verify_job> jobs(count);
+	for(size_t i = 0; i < count; i++)
+		jobs[i] = kinds[i % 4];
+
+	for(unsigned int threads : {1u, 3u, 8u})
+	{
+		struct tc_worker_pool_struct local;
+		ASSERT_EQ(tc_worker_pool_init(&local, threads), TC_CRYPTO_SUCCESS);
+		std::vector<int> results(count, -1);
+		ASSERT_EQ(tc_worker_pool_verify(&local, jobs.data(), count, results.data()),
+				  TC_CRYPTO_SUCCESS);
+		tc_worker_pool_free(&local);
+		for(size_t i = 0; i < count; i++)
+			EXPECT_EQ(results[i], expected[i % 4]) << threads << " threads, job " << i;
+	}
+}
+
+// Batches handed in from several threads at once run one after the other
+TEST_F(TcWorkerPool, ConcurrentSubmitters)
+{
+	Start(3);
+	static const uint8_t data[] = "abc";
+	static const uint8_t abc_sha256[32] = {
+		0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+		0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad};
+	const size_t count = 64;
+	uint8_t digests[4][count][32];
+
+	std::vector<std::thread> submitters;
+	for(int t = 0; t < 4; t++)
+		submitters.emplace_back([&, t]() {
+			tc_sha256_job jobs[count];
+			for(size_t i = 0; i < count; i++)
+				jobs[i] = {data, 3, digests[t][i]};
+			for(int round = 0; round < 20; round++)
+				EXPECT_EQ(tc_worker_pool_sha256(&pool, jobs, count), TC_CRYPTO_SUCCESS);
+		});
+	for(auto& submitter : submitters)
+		submitter.join();
+
+	for(int t = 0; t < 4; t++)
+		for(size_t i = 0; i < count; i++)
+			EXPECT_EQ(memcmp(digests[t][i], abc_sha256, 32), 0);
+}
+
+#endif
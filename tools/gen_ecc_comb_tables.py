@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Generate src/tinycrypt/ecc_comb_tables.c.
+
+The fixed-base comb in src/tinycrypt/ecc.c multiplies the generator G of a
+curve by looking up points of the form
+
+    T[i] = (1 + i_1 * 2^d + i_2 * 2^(2d) + ... + i_(w-1) * 2^((w-1)d)) * G
+
+where i = (i_(w-1) ... i_1) in binary and d = ceil(256 / w). The wNAF
+double-scalar multiplication used by signature verification looks up the
+odd multiples
+
+    T[i] = (2i + 1) * G,  0 <= i < 2^(w-2)
+
+This script computes both for every supported width and writes them as affine
+points, X then Y, in the BYTES_TO_WORDS_8 form the curve constants use.
+
+Usage: python3 tools/gen_ecc_comb_tables.py > src/tinycrypt/ecc_comb_tables.c
+"""
+
+CURVES = {
+    "secp256r1": dict(
+        p=0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF,
+        a=-3,
+        gx=0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+        gy=0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5,
+    ),
+    "secp256k1": dict(
+        p=0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F,
+        a=0,
+        gx=0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798,
+        gy=0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8,
+    ),
+}
+
+WIDTHS = (4, 5, 6)
+WNAF_WIDTHS = (4, 5)
+BITS = 256
+
+
+def add(P, Q, c):
+    p = c["p"]
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    if P[0] == Q[0]:
+        if (P[1] + Q[1]) % p == 0:
+            return None
+        lam = (3 * P[0] * P[0] + c["a"]) * pow(2 * P[1], -1, p) % p
+    else:
+        lam = (Q[1] - P[1]) * pow(Q[0] - P[0], -1, p) % p
+    x = (lam * lam - P[0] - Q[0]) % p
+    return (x, (lam * (P[0] - x) - P[1]) % p)
+
+
+def mul(k, P, c):
+    R = None
+    while k:
+        if k & 1:
+            R = add(R, P, c)
+        P = add(P, P, c)
+        k >>= 1
+    return R
+
+
+def words(v):
+    le = v.to_bytes(BITS // 8, "little")
+    out = []
+    for i in range(0, len(le), 8):
+        out.append("\tBYTES_TO_WORDS_8(%s)," % ", ".join("%02X" % b for b in le[i:i + 8]))
+    return out
+
+
+def comb_scalar(i, w):
+    d = (BITS + w - 1) // w
+    k = 1
+    for j in range(1, w):
+        if (i >> (j - 1)) & 1:
+            k += 1 << (j * d)
+    return k
+
+
+def table(name, size, scalar, c):
+    G = (c["gx"], c["gy"])
+    lines = ["const uECC_word_t %s[%d * 2 * NUM_ECC_WORDS] = {" % (name, size)]
+    for i in range(size):
+        T = mul(scalar(i), G, c)
+        lines.append("\t/* T[%d] */" % i)
+        lines += words(T[0]) + words(T[1])
+    lines[-1] = lines[-1][:-1]
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    print("/* ecc_comb_tables.c - Precomputed generator tables for the TinyCrypt curves */")
+    print()
+    print("/* Generated by tools/gen_ecc_comb_tables.py, do not edit. */")
+    print()
+    print('#include "include/tinycrypt/ecc.h"')
+    for w in WIDTHS:
+        print()
+        print("#%s uECC_BASE_COMB_WIDTH == %d" % ("if" if w == WIDTHS[0] else "elif", w))
+        for name, c in CURVES.items():
+            print()
+            print(table("ecc_base_comb_%s" % name, 1 << (w - 1),
+                        lambda i: comb_scalar(i, w), c))
+    print()
+    print("#endif")
+    for w in WNAF_WIDTHS:
+        print()
+        print("#%s uECC_VERIFY_WNAF_WIDTH == %d" % ("if" if w == WNAF_WIDTHS[0] else "elif", w))
+        for name, c in CURVES.items():
+            print()
+            print(table("ecc_base_wnaf_%s" % name, 1 << (w - 2), lambda i: 2 * i + 1, c))
+    print()
+    print("#endif")
+
+
+if __name__ == "__main__":
+    main()